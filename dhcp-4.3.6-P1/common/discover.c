@@ -31,9 +31,22 @@
 /* length of line we can read from the IF file, 256 is too small in some cases */
 #define IF_LINE_LENGTH 1024
 
+/*
+ * Number of packets got_one() and got_one_v6() will read from a socket
+ * for each readiness notification.  Every notification is a round trip
+ * through the socket manager's watcher thread and task queue, so when
+ * packets are queued up it is cheaper to read a few of them at once.
+ * Each packet is still fully processed, on the dispatcher thread, before
+ * the next one is read.
+ */
+#if !defined (MAX_PACKETS_PER_READ)
+# define MAX_PACKETS_PER_READ 16
+#endif
+
 #define BSD_COMP		/* needed on Solaris for SIOCGLIFNUM */
 #include <sys/ioctl.h>
 #include <errno.h>
+#include <poll.h>
 
 #ifdef HAVE_NET_IF6_H
 # include <net/if6.h>
@@ -1036,6 +1049,25 @@ void reinitialize_interfaces ()
 	interfaces_invalidated = 1;
 }
 
+/*
+ * Check, without blocking, whether another packet is waiting to be read
+ * from the given descriptor.
+ */
+static int
+packet_pending(int fd)
+{
+	struct pollfd pfd;
+
+	if (fd < 0)
+		return (0);
+
+	pfd.fd = fd;
+	pfd.events = POLLIN;
+	pfd.revents = 0;
+
+	return ((poll(&pfd, 1, 0) > 0) && ((pfd.revents & POLLIN) != 0));
+}
+
 isc_result_t got_one (h)
 	omapi_object_t *h;
 {
@@ -1049,13 +1081,15 @@ isc_result_t got_one (h)
 						 possible MTU. */
 		struct dhcp_packet packet;
 	} u;
-	struct interface_info *ip;
+	struct interface_info *ip, *rip;
+	int count = 0;
 
 	if (h -> type != dhcp_type_interface)
 		return DHCP_R_INVALIDARG;
-	ip = (struct interface_info *)h;
+	rip = (struct interface_info *)h;
 
       again:
+	ip = rip;
 	if ((result =
 	     receive_packet (ip, u.packbuf, sizeof u, &from, &hfrom)) < 0) {
 		log_error ("receive_packet failed on %s: %m", ip -> name);
@@ -1105,7 +1139,12 @@ isc_result_t got_one (h)
 
 	/* If there is buffered data, read again.    This is for, e.g.,
 	   bpf, which may return two packets at once. */
-	if (ip -> rbuf_offset != ip -> rbuf_len)
+	if (rip -> rbuf_offset != rip -> rbuf_len)
+		goto again;
+
+	/* Likewise pick up any further packets already queued on the
+	   socket rather than waiting to be called back for each one. */
+	if ((++count < MAX_PACKETS_PER_READ) && packet_pending(rip -> rfdesc))
 		goto again;
 	return ISC_R_SUCCESS;
 }
@@ -1118,15 +1157,19 @@ got_one_v6(omapi_object_t *h) {
 	struct iaddr ifrom;
 	int result;
 	char buf[65536];	/* maximum size for a UDP packet is 65536 */
-	struct interface_info *ip;
+	struct interface_info *ip, *rip;
 	int is_unicast;
-	unsigned int if_idx = 0;
+	unsigned int if_idx;
+	int count = 0;
 
 	if (h->type != dhcp_type_interface) {
 		return DHCP_R_INVALIDARG;
 	}
-	ip = (struct interface_info *)h;
+	rip = (struct interface_info *)h;
 
+      again:
+	ip = rip;
+	if_idx = 0;
 	result = receive_packet6(ip, (unsigned char *)buf, sizeof(buf),
 				 &from, &to, &if_idx);
 	if (result < 0) {
@@ -1164,6 +1207,9 @@ got_one_v6(omapi_object_t *h) {
 					 &ifrom, is_unicast);
 	}
 
+	/* Pick up any further packets already queued on the socket. */
+	if ((++count < MAX_PACKETS_PER_READ) && packet_pending(rip->rfdesc))
+		goto again;
 	return ISC_R_SUCCESS;
 }
 #endif /* DHCPv6 */
@@ -3448,6 +3448,7 @@ int parse_boolean_expression (expr, cfile, lose)
 		expression_dereference (expr, MDL);
 		return 0;
 	}
+	fold_constant_expression (expr);
 	return 1;
 }
 
@@ -3515,6 +3516,7 @@ int parse_data_expression (expr, cfile, lose)
 		*lose = 1;
 		return 0;
 	}
+	fold_constant_expression (expr);
 	return 1;
 }
 
@@ -4923,6 +4925,8 @@ int parse_option_statement (result, cfile, lookups, option, op)
 		log_fatal ("no memory for option statement.");
 
         (*result)->op = op;
+	if (expr)
+		fold_constant_expression (&expr);
 	if (expr && !option_cache (&(*result)->data.option,
 				   NULL, expr, option, MDL))
 		log_fatal ("no memory for option cache");
@@ -34,6 +34,11 @@
  * I have implemented it under Linux; other systems should be doable also.
  */
 
+/* For sendmmsg(). */
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+
 #include "dhcpd.h"
 #include <errno.h>
 #include <sys/ioctl.h>
@@ -52,10 +57,16 @@
 # if !defined (USE_SOCKET_SEND)
 #  define if_register_send if_register_fallback
 #  define send_packet send_fallback
+#  define send_packet_many send_fallback_many
 #  define if_reinitialize_send if_reinitialize_fallback
 # endif
 #endif
 
+/* Largest number of copies of a packet passed to sendmmsg() at once. */
+#if !defined (SEND_MANY_BATCH)
+# define SEND_MANY_BATCH 32
+#endif
+
 #if defined(DHCPv6)
 /*
  * XXX: this is gross.  we need to go back and overhaul the API for socket
@@ -666,6 +677,104 @@ ssize_t send_packet (interface, packet, raw, len, from, to, hto)
 	return result;
 }
 
+/*
+ * Send the same packet to several destinations.  Where sendmmsg() is
+ * available, the copies are handed to the kernel in a single system call
+ * (or a few, if some of them fail); otherwise they are sent one by one.
+ * The result of each send is stored in results[] and the number of copies
+ * sent is returned.
+ */
+int send_packet_many(struct interface_info *interface,
+		     struct dhcp_packet *raw, size_t len,
+		     struct in_addr from, struct sockaddr_in *to,
+		     int count, ssize_t *results)
+{
+#if defined (HAVE_SENDMMSG)
+	struct mmsghdr msgs[SEND_MANY_BATCH];
+	struct iovec iov;
+	int sent = 0;
+	int base, batch, i, result;
+#ifdef IGNORE_HOSTUNREACH
+	int retry = 0;
+#endif
+
+	iov.iov_base = (char *)raw;
+	iov.iov_len = len;
+
+#if defined(IP_PKTINFO) && defined(IP_RECVPKTINFO) && defined(USE_V4_PKTINFO)
+	if (interface->ifp != NULL) {
+		struct in_pktinfo pktinfo;
+
+		memset(&pktinfo, 0, sizeof (pktinfo));
+		pktinfo.ipi_ifindex = interface->ifp->ifr_index;
+		if (setsockopt(interface->wfdesc, IPPROTO_IP,
+			       IP_PKTINFO, (char *)&pktinfo,
+			       sizeof(pktinfo)) < 0)
+			log_fatal("setsockopt: IP_PKTINFO: %m");
+	}
+#endif
+
+	base = 0;
+	while (base < count) {
+		batch = count - base;
+		if (batch > SEND_MANY_BATCH)
+			batch = SEND_MANY_BATCH;
+
+		memset(msgs, 0, batch * sizeof(msgs[0]));
+		for (i = 0; i < batch; i++) {
+			msgs[i].msg_hdr.msg_name = &to[base + i];
+			msgs[i].msg_hdr.msg_namelen = sizeof(to[base + i]);
+			msgs[i].msg_hdr.msg_iov = &iov;
+			msgs[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		result = sendmmsg(interface->wfdesc, msgs, batch, 0);
+#ifdef IGNORE_HOSTUNREACH
+		/* Retry the first message of the batch as send_packet()
+		   does. */
+		if (result < 0 &&
+		    to[base].sin_addr.s_addr == htonl (INADDR_BROADCAST) &&
+		    (errno == EHOSTUNREACH ||
+		     errno == ECONNREFUSED) &&
+		    retry++ < 10)
+			continue;
+		retry = 0;
+#endif
+		if (result <= 0) {
+			/* The first message of the batch failed: report it
+			   and carry on with the next one. */
+			log_error("send_packet_many: %m");
+			if (errno == ENETUNREACH)
+				log_error("send_packet_many: please consult "
+					  "README file regarding broadcast "
+					  "address.");
+			results[base] = -1;
+			base++;
+			continue;
+		}
+
+		for (i = 0; i < result; i++)
+			results[base + i] = msgs[i].msg_len;
+		sent += result;
+		base += result;
+	}
+
+	return sent;
+#else
+	int sent = 0;
+	int i;
+
+	for (i = 0; i < count; i++) {
+		results[i] = send_packet(interface, NULL, raw, len, from,
+					 &to[i], NULL);
+		if (results[i] >= 0)
+			sent++;
+	}
+
+	return sent;
+#endif
+}
+
 #endif /* USE_SOCKET_SEND || USE_SOCKET_FALLBACK */
 
 #ifdef DHCPv6
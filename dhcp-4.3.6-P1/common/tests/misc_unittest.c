@@ -216,7 +216,86 @@ ATF_TC_BODY(print_hex_only, tc)
 	    atf_tc_fail("limit too small should have failed");
     }
 }
-    	
+
+ATF_TC(fold_constant_expression);
+
+ATF_TC_HEAD(fold_constant_expression, tc)
+{
+    atf_tc_set_md_var(tc, "descr", "Verify constant expression folding.");
+}
+
+/* This test checks that concatenations of constants are replaced by
+ * their value and that expressions depending on the packet are left
+ * alone, with only their constant parts folded.
+ */
+ATF_TC_BODY(fold_constant_expression, tc)
+{
+    struct expression *expr = NULL, *left = NULL, *right = NULL;
+    struct expression *inner = NULL, *hw = NULL;
+
+    /* concat (concat ("ab", "cd"), "ef") folds to "abcdef" */
+    if (!make_const_data(&left, (const unsigned char *)"ab", 2, 0, 1, MDL) ||
+        !make_const_data(&right, (const unsigned char *)"cd", 2, 0, 1, MDL) ||
+        !make_concat(&inner, left, right)) {
+        atf_tc_fail("unable to build expression");
+    }
+    expression_dereference(&left, MDL);
+    expression_dereference(&right, MDL);
+
+    if (!make_const_data(&right, (const unsigned char *)"ef", 2, 0, 1, MDL) ||
+        !make_concat(&expr, inner, right)) {
+        atf_tc_fail("unable to build expression");
+    }
+    expression_dereference(&inner, MDL);
+    expression_dereference(&right, MDL);
+
+    if (!fold_constant_expression(&expr)) {
+        atf_tc_fail("constant concat not folded");
+    }
+    if ((expr->op != expr_const_data) ||
+        (expr->data.const_data.len != 6) ||
+        (memcmp(expr->data.const_data.data, "abcdef", 6) != 0)) {
+        atf_tc_fail("folded value is wrong");
+    }
+
+    /* Folding a constant again does nothing */
+    if (fold_constant_expression(&expr)) {
+        atf_tc_fail("constant folded twice");
+    }
+    expression_dereference(&expr, MDL);
+
+    /* concat (hardware, concat ("ab", "cd")) keeps the concat but
+     * folds its constant right hand side */
+    if (!expression_allocate(&hw, MDL)) {
+        atf_tc_fail("unable to build expression");
+    }
+    hw->op = expr_hardware;
+
+    if (!make_const_data(&left, (const unsigned char *)"ab", 2, 0, 1, MDL) ||
+        !make_const_data(&right, (const unsigned char *)"cd", 2, 0, 1, MDL) ||
+        !make_concat(&inner, left, right) ||
+        !make_concat(&expr, hw, inner)) {
+        atf_tc_fail("unable to build expression");
+    }
+    expression_dereference(&left, MDL);
+    expression_dereference(&right, MDL);
+    expression_dereference(&inner, MDL);
+    expression_dereference(&hw, MDL);
+
+    if (!fold_constant_expression(&expr)) {
+        atf_tc_fail("constant operand not folded");
+    }
+    if ((expr->op != expr_concat) ||
+        (expr->data.concat[0]->op != expr_hardware) ||
+        (expr->data.concat[1]->op != expr_const_data) ||
+        (expr->data.concat[1]->data.const_data.len != 4) ||
+        (memcmp(expr->data.concat[1]->data.const_data.data,
+                "abcd", 4) != 0)) {
+        atf_tc_fail("partially folded expression is wrong");
+    }
+    expression_dereference(&expr, MDL);
+}
+
 /* This macro defines main() method that will call specified
    test cases. tp and simple_test_case names can be whatever you want
    as long as it is a valid variable identifier. */
@@ -225,6 +304,7 @@ ATF_TP_ADD_TCS(tp)
     ATF_TP_ADD_TC(tp, find_percent_basic);
     ATF_TP_ADD_TC(tp, find_percent_adv);
     ATF_TP_ADD_TC(tp, print_hex_only);
+    ATF_TP_ADD_TC(tp, fold_constant_expression);
 
     return (atf_no_error());
 }
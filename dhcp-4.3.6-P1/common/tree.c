@@ -374,6 +374,164 @@ int option_cache (struct option_cache **oc, struct data_string *dp,
 	return 1;
 }
 
+/* Return nonzero if the value of an expression is fixed once the
+   configuration has been read: it is built only from constants using
+   operators whose result depends on nothing but their operands. */
+
+static int is_constant_expression (struct expression *expr)
+{
+	if (!expr)
+		return 0;
+
+	switch (expr -> op) {
+	      case expr_const_data:
+	      case expr_const_int:
+		return 1;
+
+	      case expr_concat:
+		return (is_constant_expression (expr -> data.concat [0]) &&
+			is_constant_expression (expr -> data.concat [1]));
+
+	      case expr_substring:
+		return (is_constant_expression (expr -> data.substring.expr) &&
+			is_constant_expression (expr -> data.substring.offset) &&
+			is_constant_expression (expr -> data.substring.len));
+
+	      case expr_suffix:
+		return (is_constant_expression (expr -> data.suffix.expr) &&
+			is_constant_expression (expr -> data.suffix.len));
+
+	      case expr_lcase:
+		return is_constant_expression (expr -> data.lcase);
+
+	      case expr_ucase:
+		return is_constant_expression (expr -> data.ucase);
+
+	      case expr_encode_int8:
+	      case expr_encode_int16:
+	      case expr_encode_int32:
+		return is_constant_expression (expr -> data.encode_int);
+
+	      case expr_binary_to_ascii:
+		return (is_constant_expression (expr -> data.b2a.base) &&
+			is_constant_expression (expr -> data.b2a.width) &&
+			is_constant_expression (expr -> data.b2a.separator) &&
+			is_constant_expression (expr -> data.b2a.buffer));
+
+	      case expr_reverse:
+		return (is_constant_expression (expr -> data.reverse.width) &&
+			is_constant_expression (expr -> data.reverse.buffer));
+
+	      default:
+		return 0;
+	}
+}
+
+/* Replace constant data subexpressions of an expression with their
+   value, so that they are computed once while the configuration is
+   parsed instead of on every packet.   Option data written as a list,
+   e.g. several addresses, is parsed into a chain of concatenations of
+   constants and is the most common case.   Boolean and data operators
+   that can't themselves be folded are searched for foldable operands.
+   Returns nonzero if anything was replaced. */
+
+int fold_constant_expression (struct expression **expr)
+{
+	struct data_string value;
+	struct expression *folded;
+	int rv = 0;
+
+	if (!expr || !*expr)
+		return 0;
+
+	if ((*expr) -> op == expr_const_data ||
+	    (*expr) -> op == expr_const_int)
+		return 0;
+
+	if (is_data_expression (*expr) && is_constant_expression (*expr)) {
+		memset (&value, 0, sizeof value);
+		if (!evaluate_data_expression (&value, (struct packet *)0,
+					       (struct lease *)0,
+					       (struct client_state *)0,
+					       (struct option_state *)0,
+					       (struct option_state *)0,
+					       (struct binding_scope **)0,
+					       *expr, MDL))
+			return 0;
+
+		folded = (struct expression *)0;
+		if (!expression_allocate (&folded, MDL)) {
+			data_string_forget (&value, MDL);
+			return 0;
+		}
+		folded -> op = expr_const_data;
+		data_string_copy (&folded -> data.const_data, &value, MDL);
+		data_string_forget (&value, MDL);
+
+		expression_dereference (expr, MDL);
+		expression_reference (expr, folded, MDL);
+		expression_dereference (&folded, MDL);
+		return 1;
+	}
+
+	switch ((*expr) -> op) {
+	      case expr_concat:
+		rv |= fold_constant_expression (&(*expr) -> data.concat [0]);
+		rv |= fold_constant_expression (&(*expr) -> data.concat [1]);
+		break;
+
+	      case expr_substring:
+		rv |= fold_constant_expression (&(*expr) -> data.substring.expr);
+		break;
+
+	      case expr_suffix:
+		rv |= fold_constant_expression (&(*expr) -> data.suffix.expr);
+		break;
+
+	      case expr_lcase:
+		rv |= fold_constant_expression (&(*expr) -> data.lcase);
+		break;
+
+	      case expr_ucase:
+		rv |= fold_constant_expression (&(*expr) -> data.ucase);
+		break;
+
+	      case expr_pick_first_value:
+		rv |= fold_constant_expression
+			(&(*expr) -> data.pick_first_value.car);
+		rv |= fold_constant_expression
+			(&(*expr) -> data.pick_first_value.cdr);
+		break;
+
+	      case expr_equal:
+	      case expr_not_equal:
+	      case expr_regex_match:
+	      case expr_iregex_match:
+		rv |= fold_constant_expression (&(*expr) -> data.equal [0]);
+		rv |= fold_constant_expression (&(*expr) -> data.equal [1]);
+		break;
+
+	      case expr_and:
+		rv |= fold_constant_expression (&(*expr) -> data.and [0]);
+		rv |= fold_constant_expression (&(*expr) -> data.and [1]);
+		break;
+
+	      case expr_or:
+		rv |= fold_constant_expression (&(*expr) -> data.or [0]);
+		rv |= fold_constant_expression (&(*expr) -> data.or [1]);
+		break;
+
+	      case expr_not:
+		rv |= fold_constant_expression (&(*expr) -> data.not);
+		break;
+
+	      default:
+		break;
+	}
+
+	return rv;
+}
+
 int make_let (result, name)
 	struct executable_statement **result;
 	const char *name;
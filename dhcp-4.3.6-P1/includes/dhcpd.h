@@ -230,6 +230,15 @@ typedef time_t TIME;
 	 (((x) >> OPTION_HASH_EXP) & \
 	  (OPTION_HASH_PTWO - 1))) % OPTION_HASH_SIZE;
 
+/*
+ * Maximum number of leases a pool's lease timer will expire, or clean
+ * up, in one run.  If more are due the timer is rescheduled right away
+ * so that packets queued in the meantime are handled between batches.
+ */
+#if !defined (EXPIRED_IPV6_BATCH_SIZE)
+# define EXPIRED_IPV6_BATCH_SIZE 1000
+#endif
+
 /* Lease queue information.  We have two ways of storing leases.
  * The original is a linear linked list which is slower but uses
  * less memory while the other adds a binary array on top of that
@@ -782,6 +791,7 @@ struct lease_state {
 # define SV_LDAP_TLS_RANDFILE           77
 #endif
 # define SV_LDAP_INIT_RETRY            178
+# define SV_LDAP_CACHE_TTL             181
 #if defined (LDAP_USE_GSSAPI)
 # define SV_LDAP_GSSAPI_KEYTAB         179
 # define SV_LDAP_GSSAPI_PRINCIPAL      180
@@ -2279,6 +2289,7 @@ int make_let (struct executable_statement **, const char *);
 int option_cache (struct option_cache **, struct data_string *,
 		  struct expression *, struct option *,
 		  const char *, int);
+int fold_constant_expression (struct expression **);
 int evaluate_expression (struct binding_value **, struct packet *,
 			 struct lease *, struct client_state *,
 			 struct option_state *, struct option_state *,
@@ -2603,6 +2614,9 @@ ssize_t send_fallback (struct interface_info *,
 		       struct packet *, struct dhcp_packet *, size_t,
 		       struct in_addr,
 		       struct sockaddr_in *, struct hardware *);
+int send_fallback_many(struct interface_info *, struct dhcp_packet *,
+		       size_t, struct in_addr, struct sockaddr_in *, int,
+		       ssize_t *);
 ssize_t send_fallback6(struct interface_info *, struct packet *,
 		       struct dhcp_packet *, size_t, struct in6_addr *,
 		       struct sockaddr_in6 *, struct hardware *);
@@ -2616,6 +2630,9 @@ ssize_t send_packet (struct interface_info *,
 		     struct packet *, struct dhcp_packet *, size_t,
 		     struct in_addr,
 		     struct sockaddr_in *, struct hardware *);
+int send_packet_many(struct interface_info *, struct dhcp_packet *,
+		     size_t, struct in_addr, struct sockaddr_in *, int,
+		     ssize_t *);
 #endif
 ssize_t send_packet6(struct interface_info *, const unsigned char *, size_t,
 		     struct sockaddr_in6 *);
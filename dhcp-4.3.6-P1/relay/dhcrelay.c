@@ -101,6 +101,31 @@ struct server_list {
 	struct sockaddr_in to;
 } *servers;
 
+/* Addresses of the servers, in the order of the list above, so that a
+   request can be passed to send_packet_many() in one go. */
+static struct sockaddr_in *server_addrs = NULL;
+static ssize_t *server_results = NULL;
+static int server_count = 0;
+
+/* Interfaces indexed by their circuit ID and by their IPv4 addresses.
+   A relay may serve thousands of interfaces (e.g., VLANs), so the
+   interface through which a reply goes back to the client is looked up
+   in these tables rather than by walking the interface list. */
+typedef struct hash_table relay_interface_hash_t;
+HASH_FUNCTIONS_DECL(relay_circuit_id, const unsigned char *,
+		    struct interface_info, relay_interface_hash_t)
+HASH_FUNCTIONS_DECL(relay_address, const unsigned char *,
+		    struct interface_info, relay_interface_hash_t)
+HASH_FUNCTIONS(relay_circuit_id, const unsigned char *,
+	       struct interface_info, relay_interface_hash_t,
+	       interface_reference, interface_dereference, do_id_hash)
+HASH_FUNCTIONS(relay_address, const unsigned char *,
+	       struct interface_info, relay_interface_hash_t,
+	       interface_reference, interface_dereference, do_ip4_hash)
+
+static relay_interface_hash_t *circuit_id_hash = NULL;
+static relay_interface_hash_t *address_hash = NULL;
+
 struct interface_info *uplink = NULL;
 
 #ifdef DHCPv6
@@ -111,6 +136,15 @@ struct stream_list {
 	int id;
 } *downstreams, *upstreams;
 
+/* Downstreams indexed by their interface-id. */
+typedef struct hash_table relay_stream_hash_t;
+HASH_FUNCTIONS_DECL(relay_stream, const int *, struct stream_list,
+		    relay_stream_hash_t)
+HASH_FUNCTIONS(relay_stream, const int *, struct stream_list,
+	       relay_stream_hash_t, 0, 0, do_number_hash)
+
+static relay_stream_hash_t *downstream_hash = NULL;
+
 static struct stream_list *parse_downstream(char *);
 static struct stream_list *parse_upstream(char *);
 static void setup_streams(void);
@@ -137,6 +171,11 @@ static int strip_relay_agent_options(struct interface_info *,
 				     struct dhcp_packet *, unsigned);
 
 static void request_v4_interface(const char* name, int flags);
+static void setup_interface_hashes(void);
+static void setup_server_addrs(void);
+static struct interface_info *find_interface_by_address(struct in_addr);
+static void forward_to_servers(struct interface_info *,
+			       struct dhcp_packet *, unsigned);
 
 static const char copyright[] =
 "Copyright 2004-2018 Internet Systems Consortium.";
@@ -639,8 +678,12 @@ main(int argc, char **argv) {
 	/* Discover all the network interfaces. */
 	discover_interfaces(DISCOVER_RELAY);
 
+	if (local_family == AF_INET) {
+		setup_interface_hashes();
+		setup_server_addrs();
+	}
 #ifdef DHCPv6
-	if (local_family == AF_INET6)
+	else
 		setup_streams();
 #endif
 
@@ -710,7 +753,6 @@ static void
 do_relay4(struct interface_info *ip, struct dhcp_packet *packet,
 	  unsigned int length, unsigned int from_port, struct iaddr from,
 	  struct hardware *hfrom) {
-	struct server_list *sp;
 	struct sockaddr_in to;
 	struct interface_info *out;
 	struct hardware hto, *htop;
@@ -729,20 +771,7 @@ do_relay4(struct interface_info *ip, struct dhcp_packet *packet,
 	/* Find the interface that corresponds to the giaddr
 	   in the packet. */
 	if (packet->giaddr.s_addr) {
-		for (out = interfaces; out; out = out->next) {
-			int i;
-
-			for (i = 0 ; i < out->address_count ; i++ ) {
-				if (out->addresses[i].s_addr ==
-				    packet->giaddr.s_addr) {
-					i = -1;
-					break;
-				}
-			}
-
-			if (i == -1)
-				break;
-		}
+		out = find_interface_by_address(packet->giaddr);
 	} else {
 		out = NULL;
 	}
@@ -837,21 +866,56 @@ do_relay4(struct interface_info *ip, struct dhcp_packet *packet,
 
 	/* Otherwise, it's a BOOTREQUEST, so forward it to all the
 	   servers. */
-	for (sp = servers; sp; sp = sp->next) {
-		if (send_packet((fallback_interface
-				 ? fallback_interface : interfaces),
-				 NULL, packet, length, ip->addresses[0],
-				 &sp->to, NULL) < 0) {
+	forward_to_servers(ip, packet, length);
+}
+
+/* Send a BOOTREQUEST to all the servers.  When the requests go out
+   through a socket (the fallback interface), all the copies are handed
+   to send_packet_many(), which passes them to the kernel in as few
+   system calls as possible. */
+
+static void
+forward_to_servers(struct interface_info *ip, struct dhcp_packet *packet,
+		   unsigned length) {
+	struct server_list *sp;
+	struct interface_info *out;
+	int i;
+
+	out = fallback_interface ? fallback_interface : interfaces;
+
+#if defined (USE_SOCKET_FALLBACK) && !defined (USE_SOCKET_SEND)
+	/* Only the fallback interface is a socket. */
+	if (fallback_interface == NULL) {
+		for (sp = servers, i = 0; sp; sp = sp->next, i++)
+			server_results[i] = send_packet(out, NULL, packet,
+							length,
+							ip->addresses[0],
+							&sp->to, NULL);
+	} else
+		send_fallback_many(out, packet, length, ip->addresses[0],
+				   server_addrs, server_count,
+				   server_results);
+#elif defined (USE_SOCKET_SEND)
+	send_packet_many(out, packet, length, ip->addresses[0],
+			 server_addrs, server_count, server_results);
+#else
+	for (sp = servers, i = 0; sp; sp = sp->next, i++)
+		server_results[i] = send_packet(out, NULL, packet, length,
+						ip->addresses[0], &sp->to,
+						NULL);
+#endif
+
+	for (i = 0; i < server_count; i++) {
+		if (server_results[i] < 0) {
 			++client_packet_errors;
 		} else {
 			log_debug("Forwarded BOOTREQUEST for %s to %s",
 			       print_hw_addr(packet->htype, packet->hlen,
 					      packet->chaddr),
-			       inet_ntoa(sp->to.sin_addr));
+			       inet_ntoa(server_addrs[i].sin_addr));
 			++client_packets_relayed;
 		}
 	}
-				 
 }
 
 /* Strip any Relay Agent Information options from the DHCP packet
@@ -1028,19 +1092,15 @@ find_interface_by_agent_option(struct dhcp_packet *packet,
 		return (-1);
 	}
 
-	/* Scan the interface list looking for an interface whose
-	   name matches the one specified in circuit_id. */
-
-	for (ip = interfaces; ip; ip = ip->next) {
-		if (ip->circuit_id &&
-		    ip->circuit_id_len == circuit_id_len &&
-		    !memcmp(ip->circuit_id, circuit_id, circuit_id_len))
-			break;
-	}
-
-	/* If we got a match, use it. */
-	if (ip) {
+	/* Look for an interface whose name matches the one specified
+	   in circuit_id. */
+	ip = NULL;
+	if (relay_circuit_id_hash_lookup(&ip, circuit_id_hash, circuit_id,
+					 circuit_id_len, MDL)) {
+		/* The interface is held by the interface list, so the
+		   reference taken by the lookup isn't needed. */
 		*out = ip;
+		interface_dereference(&ip, MDL);
 		return (1);
 	}
 
@@ -1049,6 +1109,90 @@ find_interface_by_agent_option(struct dhcp_packet *packet,
 	return (-1);
 }
 
+/* Find the interface which has the given IPv4 address assigned. */
+
+static struct interface_info *
+find_interface_by_address(struct in_addr addr) {
+	struct interface_info *ip = NULL, *found;
+
+	if (!relay_address_hash_lookup(&ip, address_hash,
+				       (const unsigned char *)&addr,
+				       sizeof(addr), MDL))
+		return (NULL);
+
+	/* The interface is held by the interface list. */
+	found = ip;
+	interface_dereference(&ip, MDL);
+	return (found);
+}
+
+/* Index the discovered interfaces by their circuit ID and by their
+   IPv4 addresses.  Where several interfaces share a circuit ID or an
+   address, the first one in the interface list is used, as a scan of
+   the list would find it first. */
+
+static void
+setup_interface_hashes(void) {
+	struct interface_info *ip, *found;
+	int i;
+
+	if (!relay_circuit_id_new_hash(&circuit_id_hash, 0, MDL) ||
+	    !relay_address_new_hash(&address_hash, 0, MDL))
+		log_fatal("Can't allocate interface hash tables.");
+
+	for (ip = interfaces; ip; ip = ip->next) {
+		if (ip->circuit_id && ip->circuit_id_len > 0) {
+			found = NULL;
+			if (relay_circuit_id_hash_lookup(&found,
+							 circuit_id_hash,
+							 ip->circuit_id,
+							 ip->circuit_id_len,
+							 MDL))
+				interface_dereference(&found, MDL);
+			else
+				relay_circuit_id_hash_add(circuit_id_hash,
+							  ip->circuit_id,
+							  ip->circuit_id_len,
+							  ip, MDL);
+		}
+
+		for (i = 0; i < ip->address_count; i++) {
+			const unsigned char *addr =
+				(const unsigned char *)&ip->addresses[i];
+
+			found = NULL;
+			if (relay_address_hash_lookup(&found, address_hash,
+						      addr,
+						      sizeof(struct in_addr),
+						      MDL))
+				interface_dereference(&found, MDL);
+			else
+				relay_address_hash_add(address_hash, addr,
+						       sizeof(struct in_addr),
+						       ip, MDL);
+		}
+	}
+}
+
+/* Copy the server addresses into an array for send_packet_many(). */
+
+static void
+setup_server_addrs(void) {
+	struct server_list *sp;
+	int i;
+
+	for (sp = servers; sp; sp = sp->next)
+		server_count++;
+
+	server_addrs = dmalloc(server_count * sizeof(*server_addrs), MDL);
+	server_results = dmalloc(server_count * sizeof(*server_results), MDL);
+	if ((server_addrs == NULL) || (server_results == NULL))
+		log_fatal("No memory for server addresses.");
+
+	for (sp = servers, i = 0; sp; sp = sp->next, i++)
+		server_addrs[i] = sp->to;
+}
+
 /*
  * Examine a packet to see if it's a candidate to have a Relay
  * Agent Information option tacked onto its tail.   If it is, tack
@@ -1474,6 +1618,19 @@ setup_streams(void) {
 			dp->id = dp->ifp->index;
 	}
 
+	/* Index the downstreams by interface-id, keeping the first one
+	   when several have the same. */
+	if (!relay_stream_new_hash(&downstream_hash, 0, MDL))
+		log_fatal("Can't allocate downstream hash table.");
+	for (dp = downstreams; dp; dp = dp->next) {
+		struct stream_list *found = NULL;
+
+		if (!relay_stream_hash_lookup(&found, downstream_hash,
+					      &dp->id, sizeof(int), MDL))
+			relay_stream_hash_add(downstream_hash, &dp->id,
+					      sizeof(int), dp, MDL);
+	}
+
 	for (up = upstreams; up; up = up->next) {
 		up->link.sin6_port = local_port;
 		up->link.sin6_family = AF_INET6;
@@ -1718,10 +1875,9 @@ process_down6(struct packet *packet) {
 			goto cleanup;
 		}
 		memcpy(&if_index, if_id.data, sizeof(int));
-		for (dp = downstreams; dp; dp = dp->next) {
-			if (dp->id == if_index)
-				break;
-		}
+		dp = NULL;
+		relay_stream_hash_lookup(&dp, downstream_hash, &if_index,
+					 sizeof(int), MDL);
 	} else {
 		if (use_if_id) {
 			/* Require an interface-id. */
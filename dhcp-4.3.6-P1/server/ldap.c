@@ -113,6 +113,26 @@ typedef struct ldap_dn_node {
 static ldap_dn_node *ldap_service_dn_head = NULL;
 static ldap_dn_node *ldap_service_dn_tail = NULL;
 
+/*
+** Cache of dhcpHost lookups by hardware address.  With ldap-method dynamic
+** every packet from a client that has no host entry would otherwise cost a
+** synchronous directory search.  When ldap-cache-ttl is set, both found and
+** not found results are remembered for that many seconds.
+*/
+#define LDAP_HOST_CACHE_SIZE 1021
+
+typedef struct ldap_host_cache_entry {
+    struct ldap_host_cache_entry *next;
+    TIME expires;
+    int htype;
+    unsigned hlen;
+    unsigned char haddr[HARDWARE_ADDR_LEN];
+    struct host_decl *host;        /* NULL for a negative entry */
+} ldap_host_cache_entry;
+
+static ldap_host_cache_entry *ldap_host_cache[LDAP_HOST_CACHE_SIZE];
+static int ldap_cache_ttl = 0;
+
 static int ldap_read_function (struct parse *cfile);
 
 static struct parse *
@@ -1353,6 +1373,7 @@ ldap_start (void)
                                                        SV_LDAP_DEBUG_FILE);
       ldap_referrals = _do_lookup_dhcp_enum_option (options, SV_LDAP_REFERRALS);
       ldap_init_retry = _do_lookup_dhcp_int_option (options, SV_LDAP_INIT_RETRY);
+      ldap_cache_ttl = _do_lookup_dhcp_int_option (options, SV_LDAP_CACHE_TTL);
 
 #if defined (LDAP_USE_SSL)
       ldap_use_ssl = _do_lookup_dhcp_enum_option (options, SV_LDAP_SSL);
@@ -2588,6 +2609,94 @@ ldap_parse_options (LDAPMessage * ent, struct group *group,
 
 
 
+static unsigned
+ldap_host_cache_hash (int htype, unsigned hlen, const unsigned char *haddr)
+{
+  unsigned hash = (unsigned) htype;
+  unsigned i;
+
+  for (i = 0; i < hlen; i++)
+    hash = (hash * 31) + haddr[i];
+
+  return (hash % LDAP_HOST_CACHE_SIZE);
+}
+
+static void
+ldap_host_cache_free (ldap_host_cache_entry **ep)
+{
+  ldap_host_cache_entry *e = *ep;
+
+  *ep = e->next;
+  if (e->host != NULL)
+    host_dereference (&e->host, MDL);
+  dfree (e, MDL);
+}
+
+/*
+** Look up a cached result, dropping any expired entries met in the bucket.
+** Returns the entry or NULL if the address is not (or no longer) cached.
+*/
+static ldap_host_cache_entry *
+ldap_host_cache_find (int htype, unsigned hlen, const unsigned char *haddr)
+{
+  ldap_host_cache_entry **ep;
+
+  if (hlen > HARDWARE_ADDR_LEN)
+    return (NULL);
+
+  ep = &ldap_host_cache[ldap_host_cache_hash (htype, hlen, haddr)];
+  while (*ep != NULL)
+    {
+      if ((*ep)->expires <= cur_time)
+        {
+          ldap_host_cache_free (ep);
+          continue;
+        }
+
+      if ((*ep)->htype == htype && (*ep)->hlen == hlen &&
+          memcmp ((*ep)->haddr, haddr, hlen) == 0)
+        return (*ep);
+
+      ep = &(*ep)->next;
+    }
+
+  return (NULL);
+}
+
+static void
+ldap_host_cache_store (int htype, unsigned hlen, const unsigned char *haddr,
+                       struct host_decl *host)
+{
+  ldap_host_cache_entry *e;
+  unsigned bucket;
+
+  if (ldap_cache_ttl <= 0 || hlen > HARDWARE_ADDR_LEN)
+    return;
+
+  e = ldap_host_cache_find (htype, hlen, haddr);
+  if (e == NULL)
+    {
+      e = dmalloc (sizeof (*e), MDL);
+      if (e == NULL)
+        return;
+
+      e->htype = htype;
+      e->hlen = hlen;
+      memcpy (e->haddr, haddr, hlen);
+
+      bucket = ldap_host_cache_hash (htype, hlen, haddr);
+      e->next = ldap_host_cache[bucket];
+      ldap_host_cache[bucket] = e;
+    }
+  else if (e->host != NULL)
+    host_dereference (&e->host, MDL);
+
+  if (host != NULL)
+    host_reference (&e->host, host, MDL);
+  e->expires = cur_time + ldap_cache_ttl;
+}
+
+
 int
 find_haddr_in_ldap (struct host_decl **hp, int htype, unsigned hlen,
                     const unsigned char *haddr, const char *file, int line)
@@ -2601,6 +2710,7 @@ find_haddr_in_ldap (struct host_decl **hp, int htype, unsigned hlen,
   char lo_hwaddr[20];
   int ret;
   struct berval bv_o[2];
+  ldap_host_cache_entry *cached;
 
   *hp = NULL;
 
@@ -2608,6 +2718,19 @@ find_haddr_in_ldap (struct host_decl **hp, int htype, unsigned hlen,
   if (ldap_method == LDAP_METHOD_STATIC)
     return (0);
 
+  if (ldap_cache_ttl > 0 &&
+      (cached = ldap_host_cache_find (htype, hlen, haddr)) != NULL)
+    {
+#if defined (DEBUG_LDAP)
+      log_info ("Using cached LDAP host lookup for %s",
+                print_hw_addr (htype, hlen, haddr));
+#endif
+      if (cached->host == NULL)
+        return (0);
+      host_reference (hp, cached->host, MDL);
+      return (1);
+    }
+
   if (ld == NULL)
     ldap_start ();
   if (ld == NULL)
@@ -2739,6 +2862,7 @@ find_haddr_in_ldap (struct host_decl **hp, int htype, unsigned hlen,
               ldap_msgfree (res);
               res = NULL;
             }
+          ldap_host_cache_store (htype, hlen, haddr, *hp);
           return (*hp != NULL);
         }
       else
@@ -2766,6 +2890,7 @@ find_haddr_in_ldap (struct host_decl **hp, int htype, unsigned hlen,
         }
     }
 
+  ldap_host_cache_store (htype, hlen, haddr, NULL);
   return (0);
 }
 
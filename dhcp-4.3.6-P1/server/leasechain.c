@@ -135,13 +135,34 @@ lc_get_next(struct leasechain *lc, struct lease *lp) {
 	return lp->next;
 }
 
+/*!
+ *
+ * \brief Compare the sort keys of two leases
+ *
+ * \param a The lease in the chain
+ * \param b The lease being looked for or inserted
+ *
+ * \return a negative value, zero or a positive value if a sorts before,
+ * together with or after b
+ */
+static inline int
+lc_lease_cmp(struct lease *a, struct lease *b)
+{
+	if (a->sort_time != b->sort_time)
+		return (a->sort_time < b->sort_time ? -1 : 1);
+	if (a->sort_tiebreaker != b->sort_tiebreaker)
+		return (a->sort_tiebreaker < b->sort_tiebreaker ? -1 : 1);
+	return (0);
+}
+
 /*!
  *
  * \brief Find the best position for inserting a lease
  *
  * Given a potential range of the array to insert the lease into this routine
- * will recursively examine the range to find the proper place in which to
- * insert the lease.
+ * will examine the range to find the proper place in which to insert the
+ * lease.  The search is done with a loop rather than by recursion so that
+ * very long chains don't cost a stack frame per halving.
  * 
  * \param lc The leasechain to add the lease to
  * \param lp The lease to insert
@@ -155,32 +176,35 @@ lc_binary_search_insert_point(struct leasechain *lc,
 			      struct lease *lp,
 			      size_t min, size_t max)
 {
-	size_t mid_index = ((max - min)/2) + min;
-
-	if ((lc->list[mid_index]->sort_time > lp->sort_time) ||
-	    ((lc->list[mid_index]->sort_time == lp->sort_time) &&
-	     (lc->list[mid_index]->sort_tiebreaker > lp->sort_tiebreaker))) {
-		if (mid_index == min) {
-			/* insert in the min position, as sort_time is larger */
-			return (min);
-		}
-		/* try again with lower half of list */
-		return (lc_binary_search_insert_point(lc, lp,
-						      min, mid_index - 1));
-	} else  if ((lc->list[mid_index]->sort_time < lp->sort_time) ||
-		    ((lc->list[mid_index]->sort_time == lp->sort_time) && 
-		     (lc->list[mid_index]->sort_tiebreaker < lp->sort_tiebreaker))) {
-		if (mid_index == max) {
-			/* insert in mid_index + 1 as sort_time is smaller */
-			return (mid_index+1);
+	size_t mid_index;
+	int cmp;
+
+	for (;;) {
+		mid_index = ((max - min)/2) + min;
+		cmp = lc_lease_cmp(lc->list[mid_index], lp);
+
+		if (cmp > 0) {
+			if (mid_index == min) {
+				/* insert in the min position, as sort_time
+				 * is larger */
+				return (min);
+			}
+			/* try again with lower half of list */
+			max = mid_index - 1;
+		} else if (cmp < 0) {
+			if (mid_index == max) {
+				/* insert in mid_index + 1 as sort_time is
+				 * smaller */
+				return (mid_index + 1);
+			}
+			/* try again with upper half of list */
+			min = mid_index + 1;
+		} else {
+			/* sort_time and sort_tiebreaker match, so insert
+			 * in this position */
+			return (mid_index);
 		}
-		/* try again with upper half of list */
-		return (lc_binary_search_insert_point(lc, lp,
-						      mid_index + 1, max));
 	}
-
-	/* sort_time and sort_tiebreaker match, so insert in this position */
-	return (mid_index);
 }
 
 /*!
@@ -188,7 +212,7 @@ lc_binary_search_insert_point(struct leasechain *lc,
  * \brief Find an exact match for a lease
  *
  * Given a potential range of the array to search this routine
- * will recursively examine the range to find the proper lease
+ * will examine the range to find the proper lease
  * 
  * \param lc The leasechain to check
  * \param lp The lease to find
@@ -206,28 +230,30 @@ lc_binary_search_lease(struct leasechain *lc,
 {
 	size_t mid_index;
 	size_t i;
+	int cmp;
 
-	if (max < min) {
-		/* lease not found */
-		return (SIZE_MAX);
-	}
-
-	mid_index = ((max - min)/2) + min;
-
-	if ((lc->list[mid_index]->sort_time > lp->sort_time) ||
-	    ((lc->list[mid_index]->sort_time == lp->sort_time) &&
-	     (lc->list[mid_index]->sort_tiebreaker > lp->sort_tiebreaker))) {
-		if (mid_index == min) {
+	for (;;) {
+		if (max < min) {
 			/* lease not found */
 			return (SIZE_MAX);
-		} 
-		/* try the lower half of the list */
-		return (lc_binary_search_lease(lc, lp, min, mid_index - 1));
-	} else if ((lc->list[mid_index]->sort_time < lp->sort_time) ||
-		   ((lc->list[mid_index]->sort_time == lp->sort_time) &&
-		    (lc->list[mid_index]->sort_tiebreaker < lp->sort_tiebreaker))) {
-		/* try the upper half of the list */	  
-		return (lc_binary_search_lease(lc, lp, mid_index + 1, max));
+		}
+
+		mid_index = ((max - min)/2) + min;
+		cmp = lc_lease_cmp(lc->list[mid_index], lp);
+
+		if (cmp > 0) {
+			if (mid_index == min) {
+				/* lease not found */
+				return (SIZE_MAX);
+			}
+			/* try the lower half of the list */
+			max = mid_index - 1;
+		} else if (cmp < 0) {
+			/* try the upper half of the list */
+			min = mid_index + 1;
+		} else {
+			break;
+		}
 	}
 
 	/*
@@ -305,9 +331,16 @@ lc_grow_chain(struct leasechain *lc) {
 	size_t temp_size;
 
 	if (lc->growth == 0) 
-		temp_size = lc->total + LC_GROWTH_DELTA;
+		temp_size = LC_GROWTH_DELTA;
 	else
-		temp_size = lc->total + lc->growth;
+		temp_size = lc->growth;
+
+	/* Once the chain is larger than the growth step grow it by at
+	 * least half again, so that queues which keep growing past the
+	 * size estimated at startup aren't copied on every few inserts */
+	if (temp_size < lc->total / 2)
+		temp_size = lc->total / 2;
+	temp_size += lc->total;
 
 	/* try to allocate the memory */
 	p = dmalloc(sizeof(struct lease *) * temp_size, MDL);
@@ -1863,6 +1863,11 @@ add_ipv6_pool(struct ipv6_pool *pool) {
 	return ISC_R_SUCCESS;
 }
 
+/*
+ * Remove leases that have been on the inactive heap for long enough.
+ * At most EXPIRED_IPV6_BATCH_SIZE leases are removed per call, the
+ * rest are left for the next run of the pool's timer.
+ */
 static void
 cleanup_old_expired(struct ipv6_pool *pool) {
 	struct iasubopt *tmp;
@@ -1870,8 +1875,10 @@ cleanup_old_expired(struct ipv6_pool *pool) {
 	struct ia_xx *ia_active;
 	unsigned char *tmpd;
 	time_t timeout;
+	int count = 0;
 	
-	while (pool->num_inactive > 0) {
+	while ((pool->num_inactive > 0) &&
+	       (count++ < EXPIRED_IPV6_BATCH_SIZE)) {
 		tmp = (struct iasubopt *)
 				isc_heap_element(pool->inactive_timeouts, 1);
 		if (tmp->hard_lifetime_end_time != 0) {
@@ -1932,9 +1939,18 @@ static void
 lease_timeout_support(void *vpool) {
 	struct ipv6_pool *pool;
 	struct iasubopt *lease;
+	int count;
 	
 	pool = (struct ipv6_pool *)vpool;
-	for (;;) {
+	/*
+	 * Expire at most EXPIRED_IPV6_BATCH_SIZE leases per run.  When
+	 * many leases expire together, e.g. after a restart or an outage,
+	 * doing them all at once would stop packet processing for as long
+	 * as it takes.  If any expired leases are left the oldest one is
+	 * already due, so schedule_lease_timeout() below will run us again
+	 * as soon as the dispatcher has had a chance to process packets.
+	 */
+	for (count = 0; count < EXPIRED_IPV6_BATCH_SIZE; count++) {
 		/*
 		 * Get the next lease scheduled to expire.
 		 *
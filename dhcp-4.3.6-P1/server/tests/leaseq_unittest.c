@@ -490,6 +490,91 @@ ATF_TC_BODY(leaseq_same_time, tc)
 
 }
 
+/* Test a long queue built from leases added in no particular order,
+ * as happens to the active and free queues of a large pool.  The
+ * queue has to stay sorted while it grows well past its initial size
+ * and has to be emptied again by removing leases from the middle.
+ */
+#define LEASEQ_LARGE_COUNT 20000
+
+ATF_TC(leaseq_large);
+ATF_TC_HEAD(leaseq_large, tc)
+{
+	atf_tc_set_md_var(tc, "descr", "Verify a large unordered list");
+}
+
+ATF_TC_BODY(leaseq_large, tc)
+{
+	LEASE_STRUCT lq;
+	struct lease *test_lease, *check_lease;
+	unsigned int seed = 1;
+	TIME last_time;
+	int i, count;
+
+	INIT_LQ(lq);
+#if defined (BINARY_LEASES)
+	lc_init_growth(&lq, 16);
+#endif
+
+	test_lease = calloc(LEASEQ_LARGE_COUNT, sizeof(struct lease));
+	if (test_lease == NULL)
+		atf_tc_fail("unable to allocate leases");
+
+	/* add the leases with pseudo random sort times */
+	for (i = 0; i < LEASEQ_LARGE_COUNT; i++) {
+		seed = seed * 1103515245 + 12345;
+		test_lease[i].sort_time = (seed >> 8) % 5000;
+		check_lease = NULL;
+		lease_reference(&check_lease, &test_lease[i], MDL);
+
+		LEASE_INSERTP(&lq, &test_lease[i]);
+	}
+
+	/* check that the whole queue is in order */
+	count = 0;
+	last_time = 0;
+	for (check_lease = LEASE_GET_FIRST(lq); check_lease != NULL;
+	     check_lease = LEASE_GET_NEXT(lq, check_lease)) {
+		if (check_lease->sort_time < last_time)
+			atf_tc_fail("queue out of order at %d", count);
+		last_time = check_lease->sort_time;
+		count++;
+	}
+	if (count != LEASEQ_LARGE_COUNT)
+		atf_tc_fail("queue has %d leases, expected %d",
+			    count, LEASEQ_LARGE_COUNT);
+
+	/* remove every other lease and check the rest is still in order */
+	for (i = 0; i < LEASEQ_LARGE_COUNT; i += 2) {
+		LEASE_REMOVEP(&lq, &test_lease[i]);
+	}
+
+	count = 0;
+	last_time = 0;
+	for (check_lease = LEASE_GET_FIRST(lq); check_lease != NULL;
+	     check_lease = LEASE_GET_NEXT(lq, check_lease)) {
+		if (check_lease->sort_time < last_time)
+			atf_tc_fail("queue out of order at %d", count);
+		last_time = check_lease->sort_time;
+		count++;
+	}
+	if (count != LEASEQ_LARGE_COUNT / 2)
+		atf_tc_fail("queue has %d leases, expected %d",
+			    count, LEASEQ_LARGE_COUNT / 2);
+
+	/* and the remainder */
+	for (i = 1; i < LEASEQ_LARGE_COUNT; i += 2) {
+		LEASE_REMOVEP(&lq, &test_lease[i]);
+	}
+	if (LEASE_NOT_EMPTY(lq))
+		atf_tc_fail("queue not empty");
+
+#if defined (BINARY_LEASES)
+	lc_delete_all(&lq);
+#endif
+	free(test_lease);
+}
+
 ATF_TP_ADD_TCS(tp)
 {
 	ATF_TP_ADD_TC(tp, leaseq_basic);
@@ -499,5 +584,6 @@ ATF_TP_ADD_TCS(tp)
 	ATF_TP_ADD_TC(tp, leaseq_cycle);
 	ATF_TP_ADD_TC(tp, leaseq_long);
 	ATF_TP_ADD_TC(tp, leaseq_same_time);
+	ATF_TP_ADD_TC(tp, leaseq_large);
 	return (atf_no_error());
 }
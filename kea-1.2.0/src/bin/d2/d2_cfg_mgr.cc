@@ -75,6 +75,12 @@ D2CfgContext::toElement() const {
     const dhcp_ddns::NameChangeFormat& ncr_format = d2_params_->getNcrFormat();
     d2->set("ncr-format",
             Element::create(dhcp_ddns::ncrFormatToString(ncr_format)));
+    // Set worker-threads (only when the updates are multi-threaded)
+    size_t worker_threads = d2_params_->getWorkerThreads();
+    if (worker_threads > 0) {
+        d2->set("worker-threads",
+                Element::create(static_cast<int64_t>(worker_threads)));
+    }
     // Set forward-ddns
     ElementPtr forward_ddns = Element::createMap();
     forward_ddns->set("ddns-domains", forward_mgr_->toElement());
@@ -309,7 +315,8 @@ D2CfgMgr::parseElement(const std::string& element_id,
             (element_id == "ncr-protocol") ||
             (element_id == "ncr-format") ||
             (element_id == "port")  ||
-            (element_id == "dns-server-timeout"))  {
+            (element_id == "dns-server-timeout") ||
+            (element_id == "worker-threads"))  {
             // global scalar params require nothing extra be done
         } else if (element_id == "tsig-keys") {
             TSIGKeyInfoListParser parser;
@@ -357,6 +364,7 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
     uint32_t dns_server_timeout = 0;
     dhcp_ddns::NameChangeProtocol ncr_protocol = dhcp_ddns::NCR_UDP;
     dhcp_ddns::NameChangeFormat ncr_format = dhcp_ddns::FMT_JSON;
+    uint32_t worker_threads = 0;
 
     // Assumes that params_config has had defaults added
     BOOST_FOREACH(isc::dhcp::ConfigPair param, params_config->mapValue()) {
@@ -391,6 +399,8 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
                               << " is not yet supported"
                               << " (" << value->getPosition() << ")");
                 }
+            } else if (entry == "worker-threads") {
+                worker_threads = getInt<uint32_t>(entry, value);
             } else {
                 isc_throw(D2CfgError,
                           "unsupported parameter '" << entry
@@ -407,7 +417,8 @@ D2CfgMgr::buildParams(isc::data::ConstElementPtr params_config) {
     // Attempt to create the new client config. This ought to fly as
     // we already validated everything.
     D2ParamsPtr params(new D2Params(ip_address, port, dns_server_timeout,
-                                    ncr_protocol, ncr_format));
+                                    ncr_protocol, ncr_format,
+                                    worker_threads));
 
     getD2CfgContext()->getD2Params() = params;
 }
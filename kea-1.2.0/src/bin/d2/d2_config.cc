@@ -15,6 +15,10 @@
 #include <boost/foreach.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/unordered_map.hpp>
+
+#include <cctype>
 
 #include <sstream>
 #include <string>
@@ -31,12 +35,14 @@ D2Params::D2Params(const isc::asiolink::IOAddress& ip_address,
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format)
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const size_t worker_threads)
     : ip_address_(ip_address),
     port_(port),
     dns_server_timeout_(dns_server_timeout),
     ncr_protocol_(ncr_protocol),
-    ncr_format_(ncr_format) {
+    ncr_format_(ncr_format),
+    worker_threads_(worker_threads) {
     validateContents();
 }
 
@@ -44,7 +50,7 @@ D2Params::D2Params()
     : ip_address_(isc::asiolink::IOAddress("127.0.0.1")),
      port_(53001), dns_server_timeout_(100),
      ncr_protocol_(dhcp_ddns::NCR_UDP),
-     ncr_format_(dhcp_ddns::FMT_JSON) {
+     ncr_format_(dhcp_ddns::FMT_JSON), worker_threads_(0) {
     validateContents();
 }
 
@@ -93,7 +99,8 @@ D2Params::operator == (const D2Params& other) const {
             (port_ == other.port_) &&
             (dns_server_timeout_ == other.dns_server_timeout_) &&
             (ncr_protocol_ == other.ncr_protocol_) &&
-            (ncr_format_ == other.ncr_format_));
+            (ncr_format_ == other.ncr_format_) &&
+            (worker_threads_ == other.worker_threads_));
 }
 
 bool
@@ -111,7 +118,8 @@ D2Params::toText() const {
            << ", ncr-protocol: "
            << dhcp_ddns::ncrProtocolToString(ncr_protocol_)
            << ", ncr-format: " << ncr_format_
-           << dhcp_ddns::ncrFormatToString(ncr_format_);
+           << dhcp_ddns::ncrFormatToString(ncr_format_)
+           << ", worker-threads: " << worker_threads_;
 
     return (stream.str());
 }
@@ -282,10 +290,110 @@ DdnsDomain::toElement() const {
 
 // *********************** DdnsDomainLstMgr  *************************
 
+namespace {
+
+/// @brief Refers to a label within a domain name, without copying it.
+struct LabelRef {
+    /// @brief Constructor
+    ///
+    /// @param data pointer to the first character of the label
+    /// @param len number of characters of the label
+    LabelRef(const char* data, size_t len) : data_(data), len_(len) {
+    }
+
+    /// @brief Pointer to the first character of the label.
+    const char* data_;
+
+    /// @brief Number of characters of the label.
+    size_t len_;
+};
+
+/// @brief Case-insensitive hash of the labels.
+struct LabelHash {
+    size_t operator()(const std::string& label) const {
+        return (hash(label.data(), label.size()));
+    }
+
+    size_t operator()(const LabelRef& label) const {
+        return (hash(label.data_, label.len_));
+    }
+
+    static size_t hash(const char* data, size_t len) {
+        size_t seed = 0;
+        for (size_t i = 0; i < len; ++i) {
+            boost::hash_combine(seed, static_cast<char>
+                                (std::tolower(static_cast<unsigned char>(data[i]))));
+        }
+        return (seed);
+    }
+};
+
+/// @brief Case-insensitive equality of the labels.
+struct LabelEqual {
+    bool operator()(const std::string& a, const std::string& b) const {
+        return (equal(a.data(), a.size(), b.data(), b.size()));
+    }
+
+    bool operator()(const LabelRef& a, const std::string& b) const {
+        return (equal(a.data_, a.len_, b.data(), b.size()));
+    }
+
+    bool operator()(const std::string& a, const LabelRef& b) const {
+        return (equal(a.data(), a.size(), b.data_, b.len_));
+    }
+
+    static bool equal(const char* a, size_t a_len,
+                      const char* b, size_t b_len) {
+        if (a_len != b_len) {
+            return (false);
+        }
+        for (size_t i = 0; i < a_len; ++i) {
+            if (std::tolower(static_cast<unsigned char>(a[i])) !=
+                std::tolower(static_cast<unsigned char>(b[i]))) {
+                return (false);
+            }
+        }
+        return (true);
+    }
+};
+
+/// @brief Returns the label of a name ending at a given position.
+///
+/// The labels are separated by dots: a name ending with a dot has an empty
+/// rightmost label, so "example.com" and "example.com." do not match, as
+/// when names were compared as strings.
+///
+/// @param name domain name
+/// @param end position following the last character of the label
+/// @param[out] dot position of the dot preceding the label, or npos if
+/// this is the leftmost label.
+///
+/// @return reference to the label.
+LabelRef
+labelBefore(const std::string& name, size_t end, size_t& dot) {
+    dot = (end > 0 ? name.rfind('.', end - 1) : std::string::npos);
+    size_t start = (dot == std::string::npos ? 0 : dot + 1);
+    return (LabelRef(name.data() + start, end - start));
+}
+
+} // end of anonymous namespace
+
+struct DdnsDomainListMgr::DomainNode {
+    /// @brief Defines the children of a node, keyed by their label.
+    typedef boost::unordered_map<std::string, DomainNodePtr,
+                                 LabelHash, LabelEqual> DomainNodeMap;
+
+    /// @brief Children of the node.
+    DomainNodeMap children_;
+
+    /// @brief Domain whose name ends at this node, if any.
+    DdnsDomainPtr domain_;
+};
+
 const char* DdnsDomainListMgr::wildcard_domain_name_ = "*";
 
 DdnsDomainListMgr::DdnsDomainListMgr(const std::string& name) : name_(name),
-    domains_(new DdnsDomainMap()) {
+    domains_(new DdnsDomainMap()), domain_trie_(new DomainNode()) {
 }
 
 
@@ -308,6 +416,31 @@ DdnsDomainListMgr::setDomains(DdnsDomainMapPtr domains) {
     if (gotit != domains_->end()) {
             wildcard_domain_ = gotit->second;
     }
+
+    // Build the suffix trie of the domain names.  Names differing only by
+    // case share a node, which keeps the first one in the map.
+    DomainNodePtr trie(new DomainNode());
+    DdnsDomainMapPair map_pair;
+    BOOST_FOREACH (map_pair, *domains_) {
+        const std::string& domain_name = map_pair.first;
+        DomainNode* node = trie.get();
+        size_t dot = domain_name.size();
+        do {
+            LabelRef label = labelBefore(domain_name, dot, dot);
+            DomainNodePtr& child = node->children_[std::string(label.data_,
+                                                               label.len_)];
+            if (!child) {
+                child.reset(new DomainNode());
+            }
+            node = child.get();
+        } while (dot != std::string::npos);
+
+        if (!node->domain_) {
+            node->domain_ = map_pair.second;
+        }
+    }
+
+    domain_trie_ = trie;
 }
 
 bool
@@ -318,46 +451,25 @@ DdnsDomainListMgr::matchDomain(const std::string& fqdn, DdnsDomainPtr& domain) {
         return (true);
     }
 
-    // Iterate over the domain map looking for the domain which matches
-    // the longest portion of the given fqdn.
-
-    size_t req_len = fqdn.size();
-    size_t match_len = 0;
-    DdnsDomainMapPair map_pair;
+    // Walk the trie along the labels of the fqdn, from the rightmost one,
+    // and keep the deepest domain found, which matches the longest portion
+    // of the fqdn.
     DdnsDomainPtr best_match;
-    BOOST_FOREACH (map_pair, *domains_) {
-        std::string domain_name = map_pair.first;
-        size_t dom_len = domain_name.size();
-
-        // If the domain name is longer than the fqdn, then it cant be match.
-        if (req_len < dom_len) {
-            continue;
+    const DomainNode* node = domain_trie_.get();
+    size_t dot = fqdn.size();
+    do {
+        LabelRef label = labelBefore(fqdn, dot, dot);
+        DomainNode::DomainNodeMap::const_iterator child =
+            node->children_.find(label, LabelHash(), LabelEqual());
+        if (child == node->children_.end()) {
+            break;
         }
 
-        // If the lengths are identical and the names match we're done.
-        if (req_len == dom_len) {
-            if (boost::iequals(fqdn, domain_name)) {
-                // exact match, done
-                domain = map_pair.second;
-                return (true);
-            }
-        } else {
-            // The fqdn is longer than the domain name.  Adjust the start
-            // point of comparison by the excess in length.  Only do the
-            // comparison if the adjustment lands on a boundary. This
-            // prevents "onetwo.net" from matching "two.net".
-            size_t offset = req_len - dom_len;
-            if ((fqdn[offset - 1] == '.')  &&
-               (boost::iequals(fqdn.substr(offset), domain_name))) {
-                // Fqdn contains domain name, keep it if its better than
-                // any we have matched so far.
-                if (dom_len > match_len) {
-                    match_len = dom_len;
-                    best_match = map_pair.second;
-                }
-            }
+        node = child->second.get();
+        if (node->domain_) {
+            best_match = node->domain_;
         }
-    }
+    } while (dot != std::string::npos);
 
     if (!best_match) {
         // There's no match. If they specified a wild card domain use it
@@ -143,6 +143,8 @@ public:
     /// wait for a response to a single DNS update request.
     /// @param ncr_protocol socket protocol D2 should use to receive NCRS
     /// @param ncr_format packet format of the inbound NCRs
+    /// @param worker_threads number of threads carrying out the DNS updates.
+    /// The value of 0 means the updates are carried out by the main thread.
     ///
     /// @throw D2CfgError if:
     /// -# ip_address is 0.0.0.0 or ::
@@ -154,7 +156,8 @@ public:
                    const size_t port,
                    const size_t dns_server_timeout,
                    const dhcp_ddns::NameChangeProtocol& ncr_protocol,
-                   const dhcp_ddns::NameChangeFormat& ncr_format);
+                   const dhcp_ddns::NameChangeFormat& ncr_format,
+                   const size_t worker_threads = 0);
 
     /// @brief Default constructor
     /// The default constructor creates an instance that has updates disabled.
@@ -188,6 +191,11 @@ public:
         return(ncr_format_);
     }
 
+    /// @brief Return the number of threads carrying out the DNS updates.
+    size_t getWorkerThreads() const {
+        return(worker_threads_);
+    }
+
     /// @brief Return summary of the configuration used by D2.
     ///
     /// The returned summary of the configuration is meant to be appended to
@@ -237,6 +245,10 @@ private:
     /// @brief Format of the inbound requests (NCRs).
     /// Currently only JSON format is supported.
     dhcp_ddns::NameChangeFormat ncr_format_;
+
+    /// @brief Number of threads carrying out the DNS updates.
+    /// The value of 0 means the updates are carried out by the main thread.
+    size_t worker_threads_;
 };
 
 /// @brief Dumps the contents of a D2Params as text to an output stream
@@ -626,6 +638,11 @@ public:
     /// match.  If the wild card domain is the only domain in the list, then
     /// it will be returned immediately for any FQDN.
     ///
+    /// The search walks the labels of the FQDN from the rightmost one down
+    /// a suffix trie of the domain names, so its cost depends on the length
+    /// of the FQDN and not on the number of domains.  The labels are
+    /// compared in place, ignoring case.
+    ///
     /// @param fqdn is the name for which to look.
     /// @param domain receives the matching domain. If no match is found its
     /// contents will be unchanged.
@@ -685,6 +702,18 @@ private:
 
     /// @brief Pointer to the wild card domain.
     DdnsDomainPtr wildcard_domain_;
+
+    /// @brief Node of the suffix trie of the domain names.
+    ///
+    /// The path from the root of the trie to a node spells the labels of
+    /// a domain name, from the rightmost label.
+    struct DomainNode;
+
+    /// @brief Defines a pointer to a node of the suffix trie.
+    typedef boost::shared_ptr<DomainNode> DomainNodePtr;
+
+    /// @brief Root of the suffix trie of the domain names.
+    DomainNodePtr domain_trie_;
 };
 
 /// @brief Defines a pointer for DdnsDomain instances.
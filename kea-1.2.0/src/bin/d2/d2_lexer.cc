@@ -1269,8 +1269,8 @@ static const flex_int16_t yy_rule_linenum[61] =
       164,  170,  179,  190,  201,  210,  219,  228,  238,  248,
       258,  267,  276,  286,  296,  306,  317,  326,  336,  346,
       357,  366,  375,  384,  393,  402,  411,  420,  433,  442,
-      451,  460,  470,  568,  573,  578,  583,  584,  585,  586,
-      587,  588,  590,  608,  621,  626,  630,  632,  634,  636
+      451,  460,  470,  580,  585,  590,  595,  596,  597,  598,
+      599,  600,  602,  620,  633,  638,  642,  644,  646,  648
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -2312,13 +2312,25 @@ YY_RULE_SETUP
         }
     }
 
+    // Keywords which have no rule of their own above are recognized here,
+    // from the decoded string, in the context they belong to.
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        if (decoded == "worker-threads") {
+            return isc::d2::D2Parser::make_WORKER_THREADS(driver.loc_);
+        }
+        break;
+    default:
+        break;
+    }
+
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
 case 44:
 /* rule 44 can match eol */
 YY_RULE_SETUP
-#line 568 "d2_lexer.ll"
+#line 580 "d2_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
@@ -2327,7 +2339,7 @@ YY_RULE_SETUP
 case 45:
 /* rule 45 can match eol */
 YY_RULE_SETUP
-#line 573 "d2_lexer.ll"
+#line 585 "d2_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
@@ -2335,7 +2347,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 578 "d2_lexer.ll"
+#line 590 "d2_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
@@ -2343,37 +2355,37 @@ YY_RULE_SETUP
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 583 "d2_lexer.ll"
+#line 595 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 584 "d2_lexer.ll"
+#line 596 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 585 "d2_lexer.ll"
+#line 597 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 586 "d2_lexer.ll"
+#line 598 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 587 "d2_lexer.ll"
+#line 599 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 588 "d2_lexer.ll"
+#line 600 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 590 "d2_lexer.ll"
+#line 602 "d2_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -2394,7 +2406,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 608 "d2_lexer.ll"
+#line 620 "d2_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -2410,7 +2422,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 621 "d2_lexer.ll"
+#line 633 "d2_lexer.ll"
 {
     string tmp(yytext);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
@@ -2418,33 +2430,33 @@ YY_RULE_SETUP
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 626 "d2_lexer.ll"
+#line 638 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 630 "d2_lexer.ll"
+#line 642 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 632 "d2_lexer.ll"
+#line 644 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 634 "d2_lexer.ll"
+#line 646 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 636 "d2_lexer.ll"
+#line 648 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 638 "d2_lexer.ll"
+#line 650 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2470,10 +2482,10 @@ case YY_STATE_EOF(INITIAL):
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 661 "d2_lexer.ll"
+#line 673 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2476 "d2_lexer.cc"
+#line 2488 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3574,7 +3586,7 @@ void d2_parser_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 661 "d2_lexer.ll"
+#line 673 "d2_lexer.ll"
 
 
 using namespace isc::dhcp;
@@ -561,6 +561,18 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
         }
     }
 
+    // Keywords which have no rule of their own above are recognized here,
+    // from the decoded string, in the context they belong to.
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DHCPDDNS:
+        if (decoded == "worker-threads") {
+            return isc::d2::D2Parser::make_WORKER_THREADS(driver.loc_);
+        }
+        break;
+    default:
+        break;
+    }
+
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 
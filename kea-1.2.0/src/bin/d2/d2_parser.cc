@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   d2_parser_lex
 
-// First part of user declarations.
-
-#line 39 "d2_parser.cc" // lalr1.cc:404
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "d2_parser.h"
 
-// User implementation prologue.
 
-#line 53 "d2_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "d2_parser.yy" // lalr1.cc:413
+#line 34 "d2_parser.yy"
 
 #include <d2/parser_context.h>
 
-#line 59 "d2_parser.cc" // lalr1.cc:413
+#line 52 "d2_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if D2_PARSER_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !D2_PARSER_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !D2_PARSER_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "d2_parser.yy" // lalr1.cc:479
+#line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 145 "d2_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  D2Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "d2_parser.cc"
 
   /// Build a parser object.
   D2Parser::D2Parser (isc::d2::D2ParserContext& ctx_yyarg)
-    :
 #if D2_PARSER_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace d2 {
   D2Parser::~D2Parser ()
   {}
 
+  D2Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  D2Parser::by_state::by_state ()
+  D2Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  D2Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  D2Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  D2Parser::by_state::clear ()
+  D2Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   D2Parser::by_state::move (by_state& that)
   {
@@ -227,51 +188,82 @@ namespace isc { namespace d2 {
     that.clear ();
   }
 
-  inline
-  D2Parser::by_state::by_state (state_type s)
+  D2Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  D2Parser::symbol_number_type
-  D2Parser::by_state::type_get () const
+  D2Parser::symbol_kind_type
+  D2Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   D2Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  D2Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
-  inline
-  D2Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+  D2Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 65: // value
-      case 92: // ncr_protocol_value
-        value.move< ElementPtr > (that.value);
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 53: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 52: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 51: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 50: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -279,34 +271,34 @@ namespace isc { namespace d2 {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   D2Parser::stack_symbol_type&
   D2Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 65: // value
-      case 92: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 53: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 52: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 51: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 50: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -318,9 +310,45 @@ namespace isc { namespace d2 {
     return *this;
   }
 
+  D2Parser::stack_symbol_type&
+  D2Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   D2Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -331,91 +359,85 @@ namespace isc { namespace d2 {
 #if D2_PARSER_DEBUG
   template <typename Base>
   void
-  D2Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  D2Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 50: // "constant string"
-
-#line 107 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 354 "d2_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 108 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 380 "d2_parser.cc"
         break;
 
-      case 51: // "integer"
-
-#line 107 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 361 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 108 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 386 "d2_parser.cc"
         break;
 
-      case 52: // "floating point"
-
-#line 107 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 368 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 108 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 392 "d2_parser.cc"
         break;
 
-      case 53: // "boolean"
-
-#line 107 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 375 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 108 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 398 "d2_parser.cc"
         break;
 
-      case 65: // value
-
-#line 107 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 382 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 108 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 404 "d2_parser.cc"
         break;
 
-      case 92: // ncr_protocol_value
-
-#line 107 "d2_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 389 "d2_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 108 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 410 "d2_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  D2Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  D2Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  D2Parser::yypush_ (const char* m, stack_symbol_type& s)
+  D2Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  D2Parser::yypop_ (unsigned int n)
+  D2Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -447,32 +469,37 @@ namespace isc { namespace d2 {
   }
 #endif // D2_PARSER_DEBUG
 
-  inline D2Parser::state_type
+  D2Parser::state_type
   D2Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  D2Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  D2Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  D2Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  D2Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  D2Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   D2Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -490,11 +517,11 @@ namespace isc { namespace d2 {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -502,48 +529,70 @@ namespace isc { namespace d2 {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -560,50 +609,52 @@ namespace isc { namespace d2 {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
+      switch (yyr1_[yyn])
     {
-      case 65: // value
-      case 92: // ncr_protocol_value
-        yylhs.value.build< ElementPtr > ();
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 53: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 52: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 51: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 50: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -611,1025 +662,1045 @@ namespace isc { namespace d2 {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 116 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 630 "d2_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 117 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 684 "d2_parser.cc"
     break;
 
-  case 4:
-#line 117 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 636 "d2_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 118 "d2_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 690 "d2_parser.cc"
     break;
 
-  case 6:
-#line 118 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCPDDNS; }
-#line 642 "d2_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 119 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.DHCPDDNS; }
+#line 696 "d2_parser.cc"
     break;
 
-  case 8:
-#line 119 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.TSIG_KEY; }
-#line 648 "d2_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 120 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.TSIG_KEY; }
+#line 702 "d2_parser.cc"
     break;
 
-  case 10:
-#line 120 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.TSIG_KEYS; }
-#line 654 "d2_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 121 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.TSIG_KEYS; }
+#line 708 "d2_parser.cc"
     break;
 
-  case 12:
-#line 121 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DDNS_DOMAIN; }
-#line 660 "d2_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 122 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DDNS_DOMAIN; }
+#line 714 "d2_parser.cc"
     break;
 
-  case 14:
-#line 122 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DDNS_DOMAINS; }
-#line 666 "d2_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 123 "d2_parser.yy"
+                        { ctx.ctx_ = ctx.DDNS_DOMAINS; }
+#line 720 "d2_parser.cc"
     break;
 
-  case 16:
-#line 123 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 672 "d2_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 124 "d2_parser.yy"
+                      { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 726 "d2_parser.cc"
     break;
 
-  case 18:
-#line 124 "d2_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 678 "d2_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 125 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 732 "d2_parser.cc"
     break;
 
-  case 20:
-#line 132 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 684 "d2_parser.cc" // lalr1.cc:859
+  case 20: // value: "integer"
+#line 133 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 738 "d2_parser.cc"
     break;
 
-  case 21:
-#line 133 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 690 "d2_parser.cc" // lalr1.cc:859
+  case 21: // value: "floating point"
+#line 134 "d2_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 744 "d2_parser.cc"
     break;
 
-  case 22:
-#line 134 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 696 "d2_parser.cc" // lalr1.cc:859
+  case 22: // value: "boolean"
+#line 135 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 750 "d2_parser.cc"
     break;
 
-  case 23:
-#line 135 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 702 "d2_parser.cc" // lalr1.cc:859
+  case 23: // value: "constant string"
+#line 136 "d2_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 756 "d2_parser.cc"
     break;
 
-  case 24:
-#line 136 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 708 "d2_parser.cc" // lalr1.cc:859
+  case 24: // value: "null"
+#line 137 "d2_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 762 "d2_parser.cc"
     break;
 
-  case 25:
-#line 137 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 714 "d2_parser.cc" // lalr1.cc:859
+  case 25: // value: map2
+#line 138 "d2_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 768 "d2_parser.cc"
     break;
 
-  case 26:
-#line 138 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 720 "d2_parser.cc" // lalr1.cc:859
+  case 26: // value: list_generic
+#line 139 "d2_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 774 "d2_parser.cc"
     break;
 
-  case 27:
-#line 141 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 27: // sub_json: value
+#line 142 "d2_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 729 "d2_parser.cc" // lalr1.cc:859
+#line 783 "d2_parser.cc"
     break;
 
-  case 28:
-#line 146 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 28: // $@10: %empty
+#line 147 "d2_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 740 "d2_parser.cc" // lalr1.cc:859
+#line 794 "d2_parser.cc"
     break;
 
-  case 29:
-#line 151 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 29: // map2: "{" $@10 map_content "}"
+#line 152 "d2_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 750 "d2_parser.cc" // lalr1.cc:859
+#line 804 "d2_parser.cc"
     break;
 
-  case 32:
-#line 162 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 32: // not_empty_map: "constant string" ":" value
+#line 163 "d2_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 759 "d2_parser.cc" // lalr1.cc:859
+#line 813 "d2_parser.cc"
     break;
 
-  case 33:
-#line 166 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 33: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 167 "d2_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 769 "d2_parser.cc" // lalr1.cc:859
+#line 823 "d2_parser.cc"
     break;
 
-  case 34:
-#line 173 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 34: // $@11: %empty
+#line 174 "d2_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 778 "d2_parser.cc" // lalr1.cc:859
+#line 832 "d2_parser.cc"
     break;
 
-  case 35:
-#line 176 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 35: // list_generic: "[" $@11 list_content "]"
+#line 177 "d2_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 786 "d2_parser.cc" // lalr1.cc:859
+#line 840 "d2_parser.cc"
     break;
 
-  case 38:
-#line 184 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 38: // not_empty_list: value
+#line 186 "d2_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 795 "d2_parser.cc" // lalr1.cc:859
+#line 849 "d2_parser.cc"
     break;
 
-  case 39:
-#line 188 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 39: // not_empty_list: not_empty_list "," value
+#line 190 "d2_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 804 "d2_parser.cc" // lalr1.cc:859
+#line 858 "d2_parser.cc"
     break;
 
-  case 40:
-#line 199 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 40: // unknown_map_entry: "constant string" ":"
+#line 201 "d2_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 815 "d2_parser.cc" // lalr1.cc:859
+#line 869 "d2_parser.cc"
     break;
 
-  case 41:
-#line 209 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 41: // $@12: %empty
+#line 211 "d2_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 826 "d2_parser.cc" // lalr1.cc:859
+#line 880 "d2_parser.cc"
     break;
 
-  case 42:
-#line 214 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 42: // syntax_map: "{" $@12 global_objects "}"
+#line 216 "d2_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 836 "d2_parser.cc" // lalr1.cc:859
+#line 890 "d2_parser.cc"
     break;
 
-  case 50:
-#line 235 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 50: // $@13: %empty
+#line 238 "d2_parser.yy"
+                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCPDDNS);
 }
-#line 847 "d2_parser.cc" // lalr1.cc:859
+#line 901 "d2_parser.cc"
     break;
 
-  case 51:
-#line 240 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 51: // dhcpddns_object: "DhcpDdns" $@13 ":" "{" dhcpddns_params "}"
+#line 243 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 856 "d2_parser.cc" // lalr1.cc:859
+#line 910 "d2_parser.cc"
     break;
 
-  case 52:
-#line 245 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 52: // $@14: %empty
+#line 248 "d2_parser.yy"
+                             {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 866 "d2_parser.cc" // lalr1.cc:859
+#line 920 "d2_parser.cc"
     break;
 
-  case 53:
-#line 249 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 53: // sub_dhcpddns: "{" $@14 dhcpddns_params "}"
+#line 252 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 874 "d2_parser.cc" // lalr1.cc:859
+#line 928 "d2_parser.cc"
     break;
 
-  case 65:
-#line 269 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 66: // $@15: %empty
+#line 273 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 882 "d2_parser.cc" // lalr1.cc:859
+#line 936 "d2_parser.cc"
     break;
 
-  case 66:
-#line 271 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 67: // ip_address: "ip-address" $@15 ":" "constant string"
+#line 275 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 892 "d2_parser.cc" // lalr1.cc:859
+#line 946 "d2_parser.cc"
     break;
 
-  case 67:
-#line 277 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 68: // port: "port" ":" "integer"
+#line 281 "d2_parser.yy"
+                         {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 904 "d2_parser.cc" // lalr1.cc:859
+#line 958 "d2_parser.cc"
     break;
 
-  case 68:
-#line 285 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0) {
+  case 69: // dns_server_timeout: "dns-server-timeout" ":" "integer"
+#line 289 "d2_parser.yy"
+                                                     {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
     } else {
-        ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
         ctx.stack_.back()->set("dns-server-timeout", i);
     }
 }
-#line 917 "d2_parser.cc" // lalr1.cc:859
+#line 971 "d2_parser.cc"
     break;
 
-  case 69:
-#line 294 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 70: // worker_threads: "worker-threads" ":" "integer"
+#line 298 "d2_parser.yy"
+                                             {
+    if (yystack_[0].value.as < int64_t > () < 0) {
+        error(yystack_[0].location, "worker-threads must not be negative");
+    } else {
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ctx.stack_.back()->set("worker-threads", i);
+    }
+}
+#line 984 "d2_parser.cc"
+    break;
+
+  case 71: // $@16: %empty
+#line 307 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 925 "d2_parser.cc" // lalr1.cc:859
+#line 992 "d2_parser.cc"
     break;
 
-  case 70:
-#line 296 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 72: // ncr_protocol: "ncr-protocol" $@16 ":" ncr_protocol_value
+#line 309 "d2_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 934 "d2_parser.cc" // lalr1.cc:859
+#line 1001 "d2_parser.cc"
     break;
 
-  case 71:
-#line 302 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 940 "d2_parser.cc" // lalr1.cc:859
+  case 73: // ncr_protocol_value: "UDP"
+#line 315 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 1007 "d2_parser.cc"
     break;
 
-  case 72:
-#line 303 "d2_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 946 "d2_parser.cc" // lalr1.cc:859
+  case 74: // ncr_protocol_value: "TCP"
+#line 316 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 1013 "d2_parser.cc"
     break;
 
-  case 73:
-#line 306 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 75: // $@17: %empty
+#line 319 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 954 "d2_parser.cc" // lalr1.cc:859
+#line 1021 "d2_parser.cc"
     break;
 
-  case 74:
-#line 308 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 76: // ncr_format: "ncr-format" $@17 ":" "JSON"
+#line 321 "d2_parser.yy"
+             {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 964 "d2_parser.cc" // lalr1.cc:859
+#line 1031 "d2_parser.cc"
     break;
 
-  case 75:
-#line 314 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 77: // $@18: %empty
+#line 327 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.FORWARD_DDNS);
 }
-#line 975 "d2_parser.cc" // lalr1.cc:859
+#line 1042 "d2_parser.cc"
     break;
 
-  case 76:
-#line 319 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 78: // forward_ddns: "forward-ddns" $@18 ":" "{" ddns_mgr_params "}"
+#line 332 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 984 "d2_parser.cc" // lalr1.cc:859
+#line 1051 "d2_parser.cc"
     break;
 
-  case 77:
-#line 324 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 79: // $@19: %empty
+#line 337 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.REVERSE_DDNS);
 }
-#line 995 "d2_parser.cc" // lalr1.cc:859
+#line 1062 "d2_parser.cc"
     break;
 
-  case 78:
-#line 329 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 80: // reverse_ddns: "reverse-ddns" $@19 ":" "{" ddns_mgr_params "}"
+#line 342 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1004 "d2_parser.cc" // lalr1.cc:859
+#line 1071 "d2_parser.cc"
     break;
 
-  case 85:
-#line 348 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 87: // $@20: %empty
+#line 361 "d2_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DDNS_DOMAINS);
 }
-#line 1015 "d2_parser.cc" // lalr1.cc:859
+#line 1082 "d2_parser.cc"
     break;
 
-  case 86:
-#line 353 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 88: // ddns_domains: "ddns-domains" $@20 ":" "[" ddns_domain_list "]"
+#line 366 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1024 "d2_parser.cc" // lalr1.cc:859
+#line 1091 "d2_parser.cc"
     break;
 
-  case 87:
-#line 358 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 89: // $@21: %empty
+#line 371 "d2_parser.yy"
+                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1033 "d2_parser.cc" // lalr1.cc:859
+#line 1100 "d2_parser.cc"
     break;
 
-  case 88:
-#line 361 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 90: // sub_ddns_domains: "[" $@21 ddns_domain_list "]"
+#line 374 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1041 "d2_parser.cc" // lalr1.cc:859
+#line 1108 "d2_parser.cc"
     break;
 
-  case 93:
-#line 373 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 95: // $@22: %empty
+#line 386 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1051 "d2_parser.cc" // lalr1.cc:859
+#line 1118 "d2_parser.cc"
     break;
 
-  case 94:
-#line 377 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 96: // ddns_domain: "{" $@22 ddns_domain_params "}"
+#line 390 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1059 "d2_parser.cc" // lalr1.cc:859
+#line 1126 "d2_parser.cc"
     break;
 
-  case 95:
-#line 381 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 97: // $@23: %empty
+#line 394 "d2_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1068 "d2_parser.cc" // lalr1.cc:859
+#line 1135 "d2_parser.cc"
     break;
 
-  case 96:
-#line 384 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 98: // sub_ddns_domain: "{" $@23 ddns_domain_params "}"
+#line 397 "d2_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1076 "d2_parser.cc" // lalr1.cc:859
+#line 1143 "d2_parser.cc"
     break;
 
-  case 103:
-#line 399 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 105: // $@24: %empty
+#line 412 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1084 "d2_parser.cc" // lalr1.cc:859
+#line 1151 "d2_parser.cc"
     break;
 
-  case 104:
-#line 401 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 106: // ddns_domain_name: "name" $@24 ":" "constant string"
+#line 414 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1098 "d2_parser.cc" // lalr1.cc:859
+#line 1165 "d2_parser.cc"
     break;
 
-  case 105:
-#line 411 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 107: // $@25: %empty
+#line 424 "d2_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1106 "d2_parser.cc" // lalr1.cc:859
+#line 1173 "d2_parser.cc"
     break;
 
-  case 106:
-#line 413 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 108: // ddns_domain_key_name: "key-name" $@25 ":" "constant string"
+#line 426 "d2_parser.yy"
+               {
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("key-name", name);
     ctx.leave();
 }
-#line 1117 "d2_parser.cc" // lalr1.cc:859
+#line 1184 "d2_parser.cc"
     break;
 
-  case 107:
-#line 423 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 109: // $@26: %empty
+#line 436 "d2_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DNS_SERVERS);
 }
-#line 1128 "d2_parser.cc" // lalr1.cc:859
+#line 1195 "d2_parser.cc"
     break;
 
-  case 108:
-#line 428 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 110: // dns_servers: "dns-servers" $@26 ":" "[" dns_server_list "]"
+#line 441 "d2_parser.yy"
+                                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1137 "d2_parser.cc" // lalr1.cc:859
+#line 1204 "d2_parser.cc"
     break;
 
-  case 109:
-#line 433 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 111: // $@27: %empty
+#line 446 "d2_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1146 "d2_parser.cc" // lalr1.cc:859
+#line 1213 "d2_parser.cc"
     break;
 
-  case 110:
-#line 436 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 112: // sub_dns_servers: "[" $@27 dns_server_list "]"
+#line 449 "d2_parser.yy"
+                                  {
     // parsing completed
 }
-#line 1154 "d2_parser.cc" // lalr1.cc:859
+#line 1221 "d2_parser.cc"
     break;
 
-  case 113:
-#line 444 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 115: // $@28: %empty
+#line 457 "d2_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1164 "d2_parser.cc" // lalr1.cc:859
+#line 1231 "d2_parser.cc"
     break;
 
-  case 114:
-#line 448 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 116: // dns_server: "{" $@28 dns_server_params "}"
+#line 461 "d2_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1172 "d2_parser.cc" // lalr1.cc:859
+#line 1239 "d2_parser.cc"
     break;
 
-  case 115:
-#line 452 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 117: // $@29: %empty
+#line 465 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1181 "d2_parser.cc" // lalr1.cc:859
+#line 1248 "d2_parser.cc"
     break;
 
-  case 116:
-#line 455 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 118: // sub_dns_server: "{" $@29 dns_server_params "}"
+#line 468 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1189 "d2_parser.cc" // lalr1.cc:859
+#line 1256 "d2_parser.cc"
     break;
 
-  case 123:
-#line 469 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 125: // $@30: %empty
+#line 482 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1197 "d2_parser.cc" // lalr1.cc:859
+#line 1264 "d2_parser.cc"
     break;
 
-  case 124:
-#line 471 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () != "") {
+  case 126: // dns_server_hostname: "hostname" $@30 ":" "constant string"
+#line 484 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", name);
     ctx.leave();
 }
-#line 1211 "d2_parser.cc" // lalr1.cc:859
+#line 1278 "d2_parser.cc"
     break;
 
-  case 125:
-#line 481 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 127: // $@31: %empty
+#line 494 "d2_parser.yy"
+                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1219 "d2_parser.cc" // lalr1.cc:859
+#line 1286 "d2_parser.cc"
     break;
 
-  case 126:
-#line 483 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 128: // dns_server_ip_address: "ip-address" $@31 ":" "constant string"
+#line 496 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 1229 "d2_parser.cc" // lalr1.cc:859
+#line 1296 "d2_parser.cc"
     break;
 
-  case 127:
-#line 489 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 129: // dns_server_port: "port" ":" "integer"
+#line 502 "d2_parser.yy"
+                                    {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 1241 "d2_parser.cc" // lalr1.cc:859
+#line 1308 "d2_parser.cc"
     break;
 
-  case 128:
-#line 503 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 130: // $@32: %empty
+#line 516 "d2_parser.yy"
+                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.TSIG_KEYS);
 }
-#line 1252 "d2_parser.cc" // lalr1.cc:859
+#line 1319 "d2_parser.cc"
     break;
 
-  case 129:
-#line 508 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 131: // tsig_keys: "tsig-keys" $@32 ":" "[" tsig_keys_list "]"
+#line 521 "d2_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1261 "d2_parser.cc" // lalr1.cc:859
+#line 1328 "d2_parser.cc"
     break;
 
-  case 130:
-#line 513 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 132: // $@33: %empty
+#line 526 "d2_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1270 "d2_parser.cc" // lalr1.cc:859
+#line 1337 "d2_parser.cc"
     break;
 
-  case 131:
-#line 516 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 133: // sub_tsig_keys: "[" $@33 tsig_keys_list "]"
+#line 529 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1278 "d2_parser.cc" // lalr1.cc:859
+#line 1345 "d2_parser.cc"
     break;
 
-  case 136:
-#line 528 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 138: // $@34: %empty
+#line 541 "d2_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1288 "d2_parser.cc" // lalr1.cc:859
+#line 1355 "d2_parser.cc"
     break;
 
-  case 137:
-#line 532 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 139: // tsig_key: "{" $@34 tsig_key_params "}"
+#line 545 "d2_parser.yy"
+                                 {
     ctx.stack_.pop_back();
 }
-#line 1296 "d2_parser.cc" // lalr1.cc:859
+#line 1363 "d2_parser.cc"
     break;
 
-  case 138:
-#line 536 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 140: // $@35: %empty
+#line 549 "d2_parser.yy"
+                             {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1306 "d2_parser.cc" // lalr1.cc:859
+#line 1373 "d2_parser.cc"
     break;
 
-  case 139:
-#line 540 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 141: // sub_tsig_key: "{" $@35 tsig_key_params "}"
+#line 553 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1314 "d2_parser.cc" // lalr1.cc:859
+#line 1381 "d2_parser.cc"
     break;
 
-  case 147:
-#line 556 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 149: // $@36: %empty
+#line 569 "d2_parser.yy"
+                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1322 "d2_parser.cc" // lalr1.cc:859
+#line 1389 "d2_parser.cc"
     break;
 
-  case 148:
-#line 558 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 150: // tsig_key_name: "name" $@36 ":" "constant string"
+#line 571 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1336 "d2_parser.cc" // lalr1.cc:859
+#line 1403 "d2_parser.cc"
     break;
 
-  case 149:
-#line 568 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 151: // $@37: %empty
+#line 581 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1344 "d2_parser.cc" // lalr1.cc:859
+#line 1411 "d2_parser.cc"
     break;
 
-  case 150:
-#line 570 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 152: // tsig_key_algorithm: "algorithm" $@37 ":" "constant string"
+#line 583 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("algorithm", elem);
     ctx.leave();
 }
-#line 1357 "d2_parser.cc" // lalr1.cc:859
+#line 1424 "d2_parser.cc"
     break;
 
-  case 151:
-#line 579 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< int64_t > () < 0 || (yystack_[0].value.as< int64_t > () > 0  && (yystack_[0].value.as< int64_t > () % 8 != 0))) {
+  case 153: // tsig_key_digest_bits: "digest-bits" ":" "integer"
+#line 592 "d2_parser.yy"
+                                                {
+    if (yystack_[0].value.as < int64_t > () < 0 || (yystack_[0].value.as < int64_t > () > 0  && (yystack_[0].value.as < int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
     }
-    ElementPtr elem(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("digest-bits", elem);
 }
-#line 1369 "d2_parser.cc" // lalr1.cc:859
+#line 1436 "d2_parser.cc"
     break;
 
-  case 152:
-#line 587 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 154: // $@38: %empty
+#line 600 "d2_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1377 "d2_parser.cc" // lalr1.cc:859
+#line 1444 "d2_parser.cc"
     break;
 
-  case 153:
-#line 589 "d2_parser.yy" // lalr1.cc:859
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 155: // tsig_key_secret: "secret" $@38 ":" "constant string"
+#line 602 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("secret", elem);
     ctx.leave();
 }
-#line 1390 "d2_parser.cc" // lalr1.cc:859
+#line 1457 "d2_parser.cc"
     break;
 
-  case 154:
-#line 602 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 156: // $@39: %empty
+#line 615 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1398 "d2_parser.cc" // lalr1.cc:859
+#line 1465 "d2_parser.cc"
     break;
 
-  case 155:
-#line 604 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 157: // dhcp6_json_object: "Dhcp6" $@39 ":" value
+#line 617 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1407 "d2_parser.cc" // lalr1.cc:859
+#line 1474 "d2_parser.cc"
     break;
 
-  case 156:
-#line 609 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 158: // $@40: %empty
+#line 622 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1415 "d2_parser.cc" // lalr1.cc:859
+#line 1482 "d2_parser.cc"
     break;
 
-  case 157:
-#line 611 "d2_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 159: // dhcp4_json_object: "Dhcp4" $@40 ":" value
+#line 624 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1424 "d2_parser.cc" // lalr1.cc:859
+#line 1491 "d2_parser.cc"
     break;
 
-  case 158:
-#line 621 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 160: // $@41: %empty
+#line 635 "d2_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1435 "d2_parser.cc" // lalr1.cc:859
+#line 1502 "d2_parser.cc"
     break;
 
-  case 159:
-#line 626 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 161: // logging_object: "Logging" $@41 ":" "{" logging_params "}"
+#line 640 "d2_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1444 "d2_parser.cc" // lalr1.cc:859
+#line 1511 "d2_parser.cc"
     break;
 
-  case 163:
-#line 643 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 165: // $@42: %empty
+#line 657 "d2_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1455 "d2_parser.cc" // lalr1.cc:859
+#line 1522 "d2_parser.cc"
     break;
 
-  case 164:
-#line 648 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 166: // loggers: "loggers" $@42 ":" "[" loggers_entries "]"
+#line 662 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1464 "d2_parser.cc" // lalr1.cc:859
+#line 1531 "d2_parser.cc"
     break;
 
-  case 167:
-#line 660 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 169: // $@43: %empty
+#line 674 "d2_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1474 "d2_parser.cc" // lalr1.cc:859
+#line 1541 "d2_parser.cc"
     break;
 
-  case 168:
-#line 664 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 170: // logger_entry: "{" $@43 logger_params "}"
+#line 678 "d2_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1482 "d2_parser.cc" // lalr1.cc:859
+#line 1549 "d2_parser.cc"
     break;
 
-  case 176:
-#line 679 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 178: // $@44: %empty
+#line 693 "d2_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1490 "d2_parser.cc" // lalr1.cc:859
+#line 1557 "d2_parser.cc"
     break;
 
-  case 177:
-#line 681 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 179: // name: "name" $@44 ":" "constant string"
+#line 695 "d2_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1500 "d2_parser.cc" // lalr1.cc:859
+#line 1567 "d2_parser.cc"
     break;
 
-  case 178:
-#line 687 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 180: // debuglevel: "debuglevel" ":" "integer"
+#line 701 "d2_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1509 "d2_parser.cc" // lalr1.cc:859
+#line 1576 "d2_parser.cc"
     break;
 
-  case 179:
-#line 691 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 181: // $@45: %empty
+#line 706 "d2_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1517 "d2_parser.cc" // lalr1.cc:859
+#line 1584 "d2_parser.cc"
     break;
 
-  case 180:
-#line 693 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 182: // severity: "severity" $@45 ":" "constant string"
+#line 708 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1527 "d2_parser.cc" // lalr1.cc:859
+#line 1594 "d2_parser.cc"
     break;
 
-  case 181:
-#line 699 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 183: // $@46: %empty
+#line 714 "d2_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1538 "d2_parser.cc" // lalr1.cc:859
+#line 1605 "d2_parser.cc"
     break;
 
-  case 182:
-#line 704 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 184: // output_options_list: "output_options" $@46 ":" "[" output_options_list_content "]"
+#line 719 "d2_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1547 "d2_parser.cc" // lalr1.cc:859
+#line 1614 "d2_parser.cc"
     break;
 
-  case 185:
-#line 713 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 187: // $@47: %empty
+#line 728 "d2_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1557 "d2_parser.cc" // lalr1.cc:859
+#line 1624 "d2_parser.cc"
     break;
 
-  case 186:
-#line 717 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 188: // output_entry: "{" $@47 output_params_list "}"
+#line 732 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1565 "d2_parser.cc" // lalr1.cc:859
+#line 1632 "d2_parser.cc"
     break;
 
-  case 193:
-#line 731 "d2_parser.yy" // lalr1.cc:859
-    {
+  case 195: // $@48: %empty
+#line 746 "d2_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1573 "d2_parser.cc" // lalr1.cc:859
+#line 1640 "d2_parser.cc"
     break;
 
-  case 194:
-#line 733 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 196: // output: "output" $@48 ":" "constant string"
+#line 748 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1583 "d2_parser.cc" // lalr1.cc:859
+#line 1650 "d2_parser.cc"
     break;
 
-  case 195:
-#line 739 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 197: // flush: "flush" ":" "boolean"
+#line 754 "d2_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1592 "d2_parser.cc" // lalr1.cc:859
+#line 1659 "d2_parser.cc"
     break;
 
-  case 196:
-#line 744 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 198: // maxsize: "maxsize" ":" "integer"
+#line 759 "d2_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1601 "d2_parser.cc" // lalr1.cc:859
+#line 1668 "d2_parser.cc"
     break;
 
-  case 197:
-#line 749 "d2_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 199: // maxver: "maxver" ":" "integer"
+#line 764 "d2_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1610 "d2_parser.cc" // lalr1.cc:859
+#line 1677 "d2_parser.cc"
     break;
 
 
-#line 1614 "d2_parser.cc" // lalr1.cc:859
+#line 1681 "d2_parser.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1638,7 +1709,9 @@ namespace isc { namespace d2 {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1649,7 +1722,7 @@ namespace isc { namespace d2 {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1666,69 +1739,81 @@ namespace isc { namespace d2 {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1736,6 +1821,7 @@ namespace isc { namespace d2 {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1744,12 +1830,12 @@ namespace isc { namespace d2 {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -1760,26 +1846,112 @@ namespace isc { namespace d2 {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   D2Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  D2Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  D2Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  D2Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
 
+
+
+  // D2Parser::context.
+  D2Parser::context::context (const D2Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  D2Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  D2Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1798,41 +1970,32 @@ namespace isc { namespace d2 {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  D2Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1841,22 +2004,23 @@ namespace isc { namespace d2 {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1865,47 +2029,47 @@ namespace isc { namespace d2 {
   }
 
 
-  const signed char D2Parser::yypact_ninf_ = -108;
+  const signed char D2Parser::yypact_ninf_ = -106;
 
   const signed char D2Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   D2Parser::yypact_[] =
   {
-      20,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,
-      11,    -2,    22,    94,    99,    37,   100,   103,   102,   105,
-    -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,
-    -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,
-    -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,    -2,    34,
-       2,     3,     6,   107,     7,   108,    -5,   109,  -108,   106,
-      91,   113,   110,   117,  -108,  -108,  -108,  -108,   118,  -108,
-      12,  -108,  -108,  -108,  -108,  -108,  -108,   119,   120,  -108,
-    -108,  -108,  -108,  -108,  -108,    51,  -108,  -108,  -108,  -108,
-    -108,  -108,  -108,  -108,  -108,  -108,   121,  -108,  -108,  -108,
-      67,  -108,  -108,  -108,  -108,  -108,  -108,   122,   123,  -108,
-    -108,  -108,  -108,  -108,    68,  -108,  -108,  -108,  -108,  -108,
-     124,   128,  -108,  -108,   129,  -108,  -108,    69,  -108,  -108,
-    -108,  -108,  -108,    35,  -108,  -108,    -2,    -2,  -108,    82,
-     130,   131,   132,   133,  -108,     2,  -108,   136,    92,    93,
-     137,   138,   141,   142,   143,     3,  -108,   144,    98,   146,
-     147,     6,  -108,     6,  -108,   107,   148,   149,   150,     7,
-    -108,     7,  -108,   108,   151,   111,   152,    -5,  -108,    -5,
-     109,  -108,  -108,  -108,   153,    -2,    -2,   154,   156,  -108,
-     114,  -108,  -108,    87,   139,   158,   159,   155,  -108,   125,
-    -108,   126,   127,  -108,    70,  -108,   134,   162,   135,  -108,
-      71,  -108,   140,  -108,   145,  -108,    77,  -108,    -2,  -108,
-    -108,     3,   157,  -108,  -108,  -108,  -108,  -108,   -13,   -13,
-     107,  -108,  -108,  -108,  -108,  -108,   109,  -108,  -108,  -108,
-    -108,  -108,  -108,    78,  -108,    79,  -108,  -108,  -108,  -108,
-      80,  -108,  -108,  -108,    88,   163,    52,  -108,   164,   157,
-    -108,   166,   -13,  -108,  -108,  -108,  -108,   167,  -108,   168,
-    -108,   173,   108,  -108,    96,  -108,   175,    10,   173,  -108,
-    -108,  -108,  -108,   170,  -108,  -108,    89,  -108,  -108,  -108,
-    -108,  -108,  -108,   178,   179,   160,   182,    10,  -108,   165,
-     183,  -108,   169,  -108,  -108,   180,  -108,  -108,    97,  -108,
-     -12,   180,  -108,  -108,   187,   188,   189,    90,  -108,  -108,
-    -108,  -108,  -108,  -108,   190,   161,   171,   172,   -12,  -108,
-     174,  -108,  -108,  -108,  -108,  -108
+      21,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+      15,    -2,    17,    29,    37,   103,    97,   104,   105,   106,
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,    -2,   -29,
+       2,     4,    11,   108,     3,   110,    -5,   111,  -106,    94,
+     107,   109,   112,   116,  -106,  -106,  -106,  -106,   117,  -106,
+       8,  -106,  -106,  -106,  -106,  -106,  -106,   119,   121,  -106,
+    -106,  -106,  -106,  -106,   122,  -106,    39,  -106,  -106,  -106,
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,   123,  -106,
+    -106,  -106,    40,  -106,  -106,  -106,  -106,  -106,  -106,   125,
+     126,  -106,  -106,  -106,  -106,  -106,    71,  -106,  -106,  -106,
+    -106,  -106,   127,   131,  -106,  -106,   124,  -106,  -106,    75,
+    -106,  -106,  -106,  -106,  -106,    26,  -106,  -106,    -2,    -2,
+    -106,    84,   132,   133,   134,   135,  -106,     2,  -106,   136,
+      92,    96,   139,   141,   142,   143,   145,    98,     4,  -106,
+     147,   100,   149,   150,    11,  -106,    11,  -106,   108,   151,
+     152,   153,     3,  -106,     3,  -106,   110,   154,   113,   155,
+      -5,  -106,    -5,   111,  -106,  -106,  -106,   156,    -2,    -2,
+     157,   159,  -106,   118,  -106,  -106,    89,   148,   160,   163,
+     158,  -106,  -106,   120,  -106,   128,   129,  -106,    77,  -106,
+     130,   167,   137,  -106,    78,  -106,   138,  -106,   140,  -106,
+      79,  -106,    -2,  -106,  -106,     4,   144,  -106,  -106,  -106,
+    -106,  -106,   -13,   -13,   108,  -106,  -106,  -106,  -106,  -106,
+     111,  -106,  -106,  -106,  -106,  -106,  -106,    81,  -106,    85,
+    -106,  -106,  -106,  -106,    87,  -106,  -106,  -106,    91,   168,
+      27,  -106,   169,   144,  -106,   172,   -13,  -106,  -106,  -106,
+    -106,   173,  -106,   179,  -106,   178,   110,  -106,    55,  -106,
+     180,    22,   178,  -106,  -106,  -106,  -106,   183,  -106,  -106,
+      93,  -106,  -106,  -106,  -106,  -106,  -106,   186,   188,   146,
+     189,    22,  -106,   161,   190,  -106,   162,  -106,  -106,   187,
+    -106,  -106,    99,  -106,    36,   187,  -106,  -106,   192,   193,
+     195,    95,  -106,  -106,  -106,  -106,  -106,  -106,   196,   164,
+     165,   170,    36,  -106,   174,  -106,  -106,  -106,  -106,  -106
   };
 
   const unsigned char
@@ -1914,202 +2078,204 @@ namespace isc { namespace d2 {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    34,    28,    24,    23,    20,    21,    22,    27,     3,
-      25,    26,    41,     5,    52,     7,   138,     9,   130,    11,
-      95,    13,    87,    15,   115,    17,   109,    19,    36,    30,
-       0,     0,     0,   132,     0,    89,     0,     0,    38,     0,
-      37,     0,     0,    31,   154,   156,    50,   158,     0,    49,
-       0,    43,    48,    45,    47,    46,    65,     0,     0,    69,
-      73,    75,    77,   128,    64,     0,    54,    56,    57,    58,
-      59,    60,    61,    62,    63,   149,     0,   152,   147,   146,
-       0,   140,   142,   143,   144,   145,   136,     0,   133,   134,
-     105,   107,   103,   102,     0,    97,    99,   100,   101,    93,
-       0,    90,    91,   125,     0,   123,   122,     0,   117,   119,
-     120,   121,   113,     0,   111,    35,     0,     0,    29,     0,
-       0,     0,     0,     0,    40,     0,    42,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    53,     0,     0,     0,
-       0,     0,   139,     0,   131,     0,     0,     0,     0,     0,
-      96,     0,    88,     0,     0,     0,     0,     0,   116,     0,
-       0,   110,    39,    32,     0,     0,     0,     0,     0,    44,
-       0,    67,    68,     0,     0,     0,     0,     0,    55,     0,
-     151,     0,     0,   141,     0,   135,     0,     0,     0,    98,
-       0,    92,     0,   127,     0,   118,     0,   112,     0,   155,
-     157,     0,     0,    66,    71,    72,    70,    74,    79,    79,
-     132,   150,   153,   148,   137,   106,     0,   104,    94,   126,
-     124,   114,    33,     0,   163,     0,   160,   162,    85,    84,
-       0,    80,    81,    83,     0,     0,     0,    51,     0,     0,
-     159,     0,     0,    76,    78,   129,   108,     0,   161,     0,
-      82,     0,    89,   167,     0,   165,     0,     0,     0,   164,
-      86,   176,   181,     0,   179,   175,     0,   169,   171,   173,
-     174,   172,   166,     0,     0,     0,     0,     0,   168,     0,
-       0,   178,     0,   170,   177,     0,   180,   185,     0,   183,
-       0,     0,   182,   193,     0,     0,     0,     0,   187,   189,
-     190,   191,   192,   184,     0,     0,     0,     0,     0,   186,
-       0,   195,   196,   197,   188,   194
+      25,    26,    41,     5,    52,     7,   140,     9,   132,    11,
+      97,    13,    89,    15,   117,    17,   111,    19,    36,    30,
+       0,     0,     0,   134,     0,    91,     0,     0,    38,     0,
+      37,     0,     0,    31,   156,   158,    50,   160,     0,    49,
+       0,    43,    48,    45,    47,    46,    66,     0,     0,    71,
+      75,    77,    79,   130,     0,    65,     0,    54,    56,    57,
+      58,    64,    59,    60,    61,    62,    63,   151,     0,   154,
+     149,   148,     0,   142,   144,   145,   146,   147,   138,     0,
+     135,   136,   107,   109,   105,   104,     0,    99,   101,   102,
+     103,    95,     0,    92,    93,   127,     0,   125,   124,     0,
+     119,   121,   122,   123,   115,     0,   113,    35,     0,     0,
+      29,     0,     0,     0,     0,     0,    40,     0,    42,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    53,
+       0,     0,     0,     0,     0,   141,     0,   133,     0,     0,
+       0,     0,     0,    98,     0,    90,     0,     0,     0,     0,
+       0,   118,     0,     0,   112,    39,    32,     0,     0,     0,
+       0,     0,    44,     0,    68,    69,     0,     0,     0,     0,
+       0,    70,    55,     0,   153,     0,     0,   143,     0,   137,
+       0,     0,     0,   100,     0,    94,     0,   129,     0,   120,
+       0,   114,     0,   157,   159,     0,     0,    67,    73,    74,
+      72,    76,    81,    81,   134,   152,   155,   150,   139,   108,
+       0,   106,    96,   128,   126,   116,    33,     0,   165,     0,
+     162,   164,    87,    86,     0,    82,    83,    85,     0,     0,
+       0,    51,     0,     0,   161,     0,     0,    78,    80,   131,
+     110,     0,   163,     0,    84,     0,    91,   169,     0,   167,
+       0,     0,     0,   166,    88,   178,   183,     0,   181,   177,
+       0,   171,   173,   175,   176,   174,   168,     0,     0,     0,
+       0,     0,   170,     0,     0,   180,     0,   172,   179,     0,
+     182,   187,     0,   185,     0,     0,   184,   195,     0,     0,
+       0,     0,   189,   191,   192,   193,   194,   186,     0,     0,
+       0,     0,     0,   188,     0,   197,   198,   199,   190,   196
   };
 
   const signed char
   D2Parser::yypgoto_[] =
   {
-    -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,
-    -108,   -47,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,
-    -108,   -50,  -108,  -108,  -108,    13,  -108,  -108,  -108,  -108,
-     -25,    42,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,
-    -108,  -108,  -108,  -108,  -108,   -31,  -108,   -63,  -108,  -108,
-    -108,  -108,   -72,  -108,    28,  -108,  -108,  -108,    31,    36,
-    -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,   -33,    24,
-    -108,  -108,  -108,    27,    30,  -108,  -108,  -108,  -108,  -108,
-    -108,  -108,  -108,  -108,   -22,  -108,    44,  -108,  -108,  -108,
-      47,    55,  -108,  -108,  -108,  -108,  -108,  -108,  -108,  -108,
-    -108,  -108,  -108,  -108,  -108,  -108,   -46,  -108,  -108,  -108,
-     -61,  -108,  -108,   -79,  -108,  -108,  -108,  -108,  -108,  -108,
-    -108,  -108,   -91,  -108,  -108,  -107,  -108,  -108,  -108,  -108,
-    -108
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,   -47,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,   -50,  -106,  -106,  -106,    14,  -106,  -106,  -106,  -106,
+     -63,    43,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,  -106,  -106,  -106,  -106,  -106,   -31,  -106,   -62,  -106,
+    -106,  -106,  -106,   -73,  -106,    30,  -106,  -106,  -106,    31,
+      35,  -106,  -106,  -106,  -106,  -106,  -106,  -106,  -106,   -32,
+      28,  -106,  -106,  -106,    32,    41,  -106,  -106,  -106,  -106,
+    -106,  -106,  -106,  -106,  -106,   -25,  -106,    42,  -106,  -106,
+    -106,    49,    56,  -106,  -106,  -106,  -106,  -106,  -106,  -106,
+    -106,  -106,  -106,  -106,  -106,  -106,  -106,   -44,  -106,  -106,
+    -106,   -59,  -106,  -106,   -77,  -106,  -106,  -106,  -106,  -106,
+    -106,  -106,  -106,   -89,  -106,  -106,  -105,  -106,  -106,  -106,
+    -106,  -106
   };
 
-  const short int
+  const short
   D2Parser::yydefgoto_[] =
   {
-      -1,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       0,    10,    11,    12,    13,    14,    15,    16,    17,    18,
       19,    28,    29,    30,    49,    62,    63,    31,    48,    59,
-      60,    84,    33,    50,    70,    71,    72,   142,    35,    51,
-      85,    86,    87,   147,    88,    89,    90,   150,   226,    91,
-     151,    92,   152,    93,   153,   250,   251,   252,   253,   261,
-      43,    55,   120,   121,   122,   171,    41,    54,   114,   115,
-     116,   168,   117,   166,   118,   167,    47,    57,   133,   134,
-     179,    45,    56,   127,   128,   129,   176,   130,   174,   131,
-      94,   154,    39,    53,   107,   108,   109,   163,    37,    52,
-     100,   101,   102,   160,   103,   157,   104,   105,   159,    73,
-     140,    74,   141,    75,   143,   245,   246,   247,   258,   274,
-     275,   277,   286,   287,   288,   293,   289,   290,   296,   291,
-     294,   308,   309,   310,   317,   318,   319,   324,   320,   321,
-     322
+      60,    85,    33,    50,    70,    71,    72,   144,    35,    51,
+      86,    87,    88,   149,    89,    90,    91,    92,   152,   230,
+      93,   153,    94,   154,    95,   155,   254,   255,   256,   257,
+     265,    43,    55,   122,   123,   124,   174,    41,    54,   116,
+     117,   118,   171,   119,   169,   120,   170,    47,    57,   135,
+     136,   182,    45,    56,   129,   130,   131,   179,   132,   177,
+     133,    96,   156,    39,    53,   109,   110,   111,   166,    37,
+      52,   102,   103,   104,   163,   105,   160,   106,   107,   162,
+      73,   142,    74,   143,    75,   145,   249,   250,   251,   262,
+     278,   279,   281,   290,   291,   292,   297,   293,   294,   300,
+     295,   298,   312,   313,   314,   321,   322,   323,   328,   324,
+     325,   326
   };
 
-  const unsigned short int
+  const short
   D2Parser::yytable_[] =
   {
-      69,    58,    99,    21,   113,    22,   126,    23,   123,   124,
-     248,    20,    64,    65,    66,   145,    76,    77,    78,    79,
-     146,   125,    80,   313,    81,    82,   314,   315,   316,    32,
-      83,   110,   111,    67,    95,    96,    97,    68,   180,    98,
-     112,   181,    38,   281,   282,    68,   283,   284,    24,    25,
-      26,    27,    68,    68,   155,   180,    68,    68,   266,   156,
-      68,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-     161,   169,   177,   161,   169,   162,   170,   178,   234,   238,
-     177,   155,   259,   262,    61,   241,   257,   260,   263,   182,
-     183,   262,   297,   328,   136,    69,   264,   298,   329,   278,
-     311,    34,   279,   312,   224,   225,    36,    40,    42,    44,
-      46,    99,   135,    99,   106,   119,   132,   137,   138,   113,
-     139,   113,   144,   148,   149,   158,   165,   126,   164,   126,
-     172,   173,   184,   175,   185,   186,   187,   188,   219,   220,
-     190,   193,   194,   191,   192,   195,   196,   197,   199,   200,
-     201,   202,   206,   207,   208,   212,   214,   218,   189,   227,
-     230,   221,   213,   222,   223,   228,   229,   236,   267,   265,
-     269,   242,   271,   272,   295,   231,   232,   233,   249,   249,
-     273,   280,   299,   300,   235,   237,   302,   307,   305,   244,
-     239,   325,   326,   327,   330,   240,   243,   198,   254,   270,
-     276,   211,   210,   256,   217,   209,   216,   215,   255,   205,
-     204,   301,   249,   268,   331,   304,   203,   292,   303,   306,
-     323,   334,   332,   333,   335,     0,     0,   285,     0,     0,
+      69,    58,   101,    21,   115,    22,   128,    23,   125,   126,
+     252,   147,    64,    65,    66,    20,   148,    76,    77,    78,
+      79,   127,    61,    80,    32,    81,    82,   112,   113,   183,
+     183,    83,   184,   270,    67,    84,    34,   114,    68,    97,
+      98,    99,   158,   164,    36,   100,    68,   159,   165,    24,
+      25,    26,    27,    68,    68,    68,   285,   286,   282,   287,
+     288,   283,    68,     1,     2,     3,     4,     5,     6,     7,
+       8,     9,   317,    68,   172,   318,   319,   320,   180,   173,
+     164,   172,   180,   181,   158,   238,   242,   245,   263,   261,
+     266,   185,   186,   264,   266,   267,   301,    69,   332,   268,
+     137,   302,   315,   333,    40,   316,   228,   229,    38,    42,
+     138,    46,    44,   139,   101,   108,   101,   121,   134,   141,
+     140,   146,   115,   150,   115,   151,   157,   161,   178,   168,
+     128,   167,   128,   175,   176,   187,   188,   189,   190,   191,
+     193,   223,   224,   196,   194,   197,   198,   199,   195,   200,
+     201,   203,   204,   205,   206,   210,   211,   212,   216,   218,
+     222,   192,   247,   234,   225,   217,   226,   232,   231,   227,
+     233,   235,   240,   271,   269,   246,   273,   248,   275,   236,
+     237,   239,   253,   253,   276,   277,   284,   299,   241,   243,
+     303,   244,   304,   306,   311,   309,   329,   330,   305,   331,
+     334,   202,   258,   280,   274,   214,   215,   213,   260,   259,
+     209,   221,   308,   310,   220,   208,   253,   336,   335,   272,
+     207,   219,   337,   296,   307,   339,   327,   338,     0,     0,
+       0,   289,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   285
+       0,   289
   };
 
-  const short int
+  const short
   D2Parser::yycheck_[] =
   {
       50,    48,    52,     5,    54,     7,    56,     9,    13,    14,
-      23,     0,    10,    11,    12,     3,    13,    14,    15,    16,
-       8,    26,    19,    35,    21,    22,    38,    39,    40,     7,
-      27,    24,    25,    31,    28,    29,    30,    50,     3,    33,
-      33,     6,     5,    33,    34,    50,    36,    37,    50,    51,
-      52,    53,    50,    50,     3,     3,    50,    50,     6,     8,
-      50,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-       3,     3,     3,     3,     3,     8,     8,     8,     8,     8,
-       3,     3,     3,     3,    50,     8,     8,     8,     8,   136,
-     137,     3,     3,     3,     3,   145,     8,     8,     8,     3,
-       3,     7,     6,     6,    17,    18,     7,     7,     5,     7,
-       5,   161,     6,   163,     7,     7,     7,     4,     8,   169,
-       3,   171,     4,     4,     4,     4,     3,   177,     6,   179,
-       6,     3,    50,     4,     4,     4,     4,     4,   185,   186,
-       4,     4,     4,    51,    51,     4,     4,     4,     4,    51,
-       4,     4,     4,     4,     4,     4,     4,     4,   145,    20,
-       5,     7,    51,     7,    50,     7,     7,     5,     4,     6,
-       4,   218,     5,     5,     4,    50,    50,    50,   228,   229,
-       7,     6,     4,     4,    50,    50,     4,     7,     5,    32,
-      50,     4,     4,     4,     4,    50,   221,   155,   229,   262,
-     272,   173,   171,   236,   180,   169,   179,   177,   230,   165,
-     163,    51,   262,   259,    53,    50,   161,   278,   297,    50,
-     311,   328,    51,    51,    50,    -1,    -1,   277,    -1,    -1,
+      23,     3,    10,    11,    12,     0,     8,    13,    14,    15,
+      16,    26,    51,    19,     7,    21,    22,    24,    25,     3,
+       3,    27,     6,     6,    32,    31,     7,    34,    51,    28,
+      29,    30,     3,     3,     7,    34,    51,     8,     8,    51,
+      52,    53,    54,    51,    51,    51,    34,    35,     3,    37,
+      38,     6,    51,    42,    43,    44,    45,    46,    47,    48,
+      49,    50,    36,    51,     3,    39,    40,    41,     3,     8,
+       3,     3,     3,     8,     3,     8,     8,     8,     3,     8,
+       3,   138,   139,     8,     3,     8,     3,   147,     3,     8,
+       6,     8,     3,     8,     7,     6,    17,    18,     5,     5,
+       3,     5,     7,     4,   164,     7,   166,     7,     7,     3,
+       8,     4,   172,     4,   174,     4,     4,     4,     4,     3,
+     180,     6,   182,     6,     3,    51,     4,     4,     4,     4,
+       4,   188,   189,     4,    52,     4,     4,     4,    52,     4,
+      52,     4,    52,     4,     4,     4,     4,     4,     4,     4,
+       4,   147,   225,     5,     7,    52,     7,     7,    20,    51,
+       7,    51,     5,     4,     6,   222,     4,    33,     5,    51,
+      51,    51,   232,   233,     5,     7,     6,     4,    51,    51,
+       4,    51,     4,     4,     7,     5,     4,     4,    52,     4,
+       4,   158,   233,   276,   266,   174,   176,   172,   240,   234,
+     168,   183,    51,    51,   182,   166,   266,    52,    54,   263,
+     164,   180,    52,   282,   301,    51,   315,   332,    -1,    -1,
+      -1,   281,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   297
+      -1,   301
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    41,    42,    43,    44,    45,    46,    47,    48,    49,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-       0,     5,     7,     9,    50,    51,    52,    53,    65,    66,
-      67,    71,     7,    76,     7,    82,     7,   142,     5,   136,
-       7,   110,     5,   104,     7,   125,     5,   120,    72,    68,
-      77,    83,   143,   137,   111,   105,   126,   121,    65,    73,
-      74,    50,    69,    70,    10,    11,    12,    31,    50,    75,
-      78,    79,    80,   153,   155,   157,    13,    14,    15,    16,
-      19,    21,    22,    27,    75,    84,    85,    86,    88,    89,
-      90,    93,    95,    97,   134,    28,    29,    30,    33,    75,
-     144,   145,   146,   148,   150,   151,     7,   138,   139,   140,
-      24,    25,    33,    75,   112,   113,   114,   116,   118,     7,
-     106,   107,   108,    13,    14,    26,    75,   127,   128,   129,
-     131,   133,     7,   122,   123,     6,     3,     4,     8,     3,
-     154,   156,    81,   158,     4,     3,     8,    87,     4,     4,
-      91,    94,    96,    98,   135,     3,     8,   149,     4,   152,
-     147,     3,     8,   141,     6,     3,   117,   119,   115,     3,
-       8,   109,     6,     3,   132,     4,   130,     3,     8,   124,
-       3,     6,    65,    65,    50,     4,     4,     4,     4,    79,
-       4,    51,    51,     4,     4,     4,     4,     4,    85,     4,
-      51,     4,     4,   145,   144,   140,     4,     4,     4,   113,
-     112,   108,     4,    51,     4,   128,   127,   123,     4,    65,
-      65,     7,     7,    50,    17,    18,    92,    20,     7,     7,
-       5,    50,    50,    50,     8,    50,     5,    50,     8,    50,
-      50,     8,    65,    84,    32,   159,   160,   161,    23,    75,
-      99,   100,   101,   102,    99,   138,   122,     8,   162,     3,
-       8,   103,     3,     8,     8,     6,     6,     4,   160,     4,
-     101,     5,     5,     7,   163,   164,   106,   165,     3,     6,
-       6,    33,    34,    36,    37,    75,   166,   167,   168,   170,
-     171,   173,   164,   169,   174,     4,   172,     3,     8,     4,
-       4,    51,     4,   167,    50,     5,    50,     7,   175,   176,
-     177,     3,     6,    35,    38,    39,    40,   178,   179,   180,
-     182,   183,   184,   176,   181,     4,     4,     4,     3,     8,
-       4,    53,    51,    51,   179,    50
+       0,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+      56,    57,    58,    59,    60,    61,    62,    63,    64,    65,
+       0,     5,     7,     9,    51,    52,    53,    54,    66,    67,
+      68,    72,     7,    77,     7,    83,     7,   144,     5,   138,
+       7,   112,     5,   106,     7,   127,     5,   122,    73,    69,
+      78,    84,   145,   139,   113,   107,   128,   123,    66,    74,
+      75,    51,    70,    71,    10,    11,    12,    32,    51,    76,
+      79,    80,    81,   155,   157,   159,    13,    14,    15,    16,
+      19,    21,    22,    27,    31,    76,    85,    86,    87,    89,
+      90,    91,    92,    95,    97,    99,   136,    28,    29,    30,
+      34,    76,   146,   147,   148,   150,   152,   153,     7,   140,
+     141,   142,    24,    25,    34,    76,   114,   115,   116,   118,
+     120,     7,   108,   109,   110,    13,    14,    26,    76,   129,
+     130,   131,   133,   135,     7,   124,   125,     6,     3,     4,
+       8,     3,   156,   158,    82,   160,     4,     3,     8,    88,
+       4,     4,    93,    96,    98,   100,   137,     4,     3,     8,
+     151,     4,   154,   149,     3,     8,   143,     6,     3,   119,
+     121,   117,     3,     8,   111,     6,     3,   134,     4,   132,
+       3,     8,   126,     3,     6,    66,    66,    51,     4,     4,
+       4,     4,    80,     4,    52,    52,     4,     4,     4,     4,
+       4,    52,    86,     4,    52,     4,     4,   147,   146,   142,
+       4,     4,     4,   115,   114,   110,     4,    52,     4,   130,
+     129,   125,     4,    66,    66,     7,     7,    51,    17,    18,
+      94,    20,     7,     7,     5,    51,    51,    51,     8,    51,
+       5,    51,     8,    51,    51,     8,    66,    85,    33,   161,
+     162,   163,    23,    76,   101,   102,   103,   104,   101,   140,
+     124,     8,   164,     3,     8,   105,     3,     8,     8,     6,
+       6,     4,   162,     4,   103,     5,     5,     7,   165,   166,
+     108,   167,     3,     6,     6,    34,    35,    37,    38,    76,
+     168,   169,   170,   172,   173,   175,   166,   171,   176,     4,
+     174,     3,     8,     4,     4,    52,     4,   169,    51,     5,
+      51,     7,   177,   178,   179,     3,     6,    36,    39,    40,
+      41,   180,   181,   182,   184,   185,   186,   178,   183,     4,
+       4,     4,     3,     8,     4,    54,    52,    52,   181,    51
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    54,    56,    55,    57,    55,    58,    55,    59,    55,
-      60,    55,    61,    55,    62,    55,    63,    55,    64,    55,
-      65,    65,    65,    65,    65,    65,    65,    66,    68,    67,
-      69,    69,    70,    70,    72,    71,    73,    73,    74,    74,
-      75,    77,    76,    78,    78,    79,    79,    79,    79,    79,
-      81,    80,    83,    82,    84,    84,    85,    85,    85,    85,
-      85,    85,    85,    85,    85,    87,    86,    88,    89,    91,
-      90,    92,    92,    94,    93,    96,    95,    98,    97,    99,
-      99,   100,   100,   101,   101,   103,   102,   105,   104,   106,
-     106,   107,   107,   109,   108,   111,   110,   112,   112,   113,
-     113,   113,   113,   115,   114,   117,   116,   119,   118,   121,
-     120,   122,   122,   124,   123,   126,   125,   127,   127,   128,
-     128,   128,   128,   130,   129,   132,   131,   133,   135,   134,
-     137,   136,   138,   138,   139,   139,   141,   140,   143,   142,
-     144,   144,   145,   145,   145,   145,   145,   147,   146,   149,
-     148,   150,   152,   151,   154,   153,   156,   155,   158,   157,
-     159,   159,   160,   162,   161,   163,   163,   165,   164,   166,
-     166,   167,   167,   167,   167,   167,   169,   168,   170,   172,
-     171,   174,   173,   175,   175,   177,   176,   178,   178,   179,
-     179,   179,   179,   181,   180,   182,   183,   184
+       0,    55,    57,    56,    58,    56,    59,    56,    60,    56,
+      61,    56,    62,    56,    63,    56,    64,    56,    65,    56,
+      66,    66,    66,    66,    66,    66,    66,    67,    69,    68,
+      70,    70,    71,    71,    73,    72,    74,    74,    75,    75,
+      76,    78,    77,    79,    79,    80,    80,    80,    80,    80,
+      82,    81,    84,    83,    85,    85,    86,    86,    86,    86,
+      86,    86,    86,    86,    86,    86,    88,    87,    89,    90,
+      91,    93,    92,    94,    94,    96,    95,    98,    97,   100,
+      99,   101,   101,   102,   102,   103,   103,   105,   104,   107,
+     106,   108,   108,   109,   109,   111,   110,   113,   112,   114,
+     114,   115,   115,   115,   115,   117,   116,   119,   118,   121,
+     120,   123,   122,   124,   124,   126,   125,   128,   127,   129,
+     129,   130,   130,   130,   130,   132,   131,   134,   133,   135,
+     137,   136,   139,   138,   140,   140,   141,   141,   143,   142,
+     145,   144,   146,   146,   147,   147,   147,   147,   147,   149,
+     148,   151,   150,   152,   154,   153,   156,   155,   158,   157,
+     160,   159,   161,   161,   162,   164,   163,   165,   165,   167,
+     166,   168,   168,   169,   169,   169,   169,   169,   171,   170,
+     172,   174,   173,   176,   175,   177,   177,   179,   178,   180,
+     180,   181,   181,   181,   181,   183,   182,   184,   185,   186
   };
 
-  const unsigned char
+  const signed char
   D2Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -2118,52 +2284,53 @@ namespace isc { namespace d2 {
        0,     1,     3,     5,     0,     4,     0,     1,     1,     3,
        2,     0,     4,     1,     3,     1,     1,     1,     1,     1,
        0,     6,     0,     4,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     3,     3,     0,
-       4,     1,     1,     0,     4,     0,     6,     0,     6,     0,
-       1,     1,     3,     1,     1,     0,     6,     0,     4,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     0,     4,     0,     6,     0,
-       4,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     0,     4,     3,     0,     6,
-       0,     4,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     3,     0,     4,     0,     4,     0,     4,     0,     6,
-       1,     3,     1,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     0,     4,     3,     0,
-       4,     0,     6,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     3,     3,     3
+       1,     1,     1,     1,     1,     1,     0,     4,     3,     3,
+       3,     0,     4,     1,     1,     0,     4,     0,     6,     0,
+       6,     0,     1,     1,     3,     1,     1,     0,     6,     0,
+       4,     0,     1,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       6,     0,     4,     1,     3,     0,     4,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     0,     4,     3,
+       0,     6,     0,     4,     0,     1,     1,     3,     0,     4,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     3,     0,     4,     0,     4,     0,     4,
+       0,     6,     1,     3,     1,     0,     6,     1,     3,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     0,     4,
+       3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
   };
 
 
-
+#if D2_PARSER_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const D2Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
   "\"DhcpDdns\"", "\"ip-address\"", "\"port\"", "\"dns-server-timeout\"",
   "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"", "\"ncr-format\"", "\"JSON\"",
   "\"forward-ddns\"", "\"reverse-ddns\"", "\"ddns-domains\"",
   "\"key-name\"", "\"dns-servers\"", "\"hostname\"", "\"tsig-keys\"",
-  "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"Logging\"",
-  "\"loggers\"", "\"name\"", "\"output_options\"", "\"output\"",
-  "\"debuglevel\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
-  "\"maxver\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS",
-  "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS",
-  "SUB_DNS_SERVER", "SUB_DNS_SERVERS", "\"constant string\"",
-  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
-  "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value",
-  "sub_json", "map2", "$@10", "map_content", "not_empty_map",
-  "list_generic", "$@11", "list_content", "not_empty_list",
-  "unknown_map_entry", "syntax_map", "$@12", "global_objects",
-  "global_object", "dhcpddns_object", "$@13", "sub_dhcpddns", "$@14",
-  "dhcpddns_params", "dhcpddns_param", "ip_address", "$@15", "port",
-  "dns_server_timeout", "ncr_protocol", "$@16", "ncr_protocol_value",
-  "ncr_format", "$@17", "forward_ddns", "$@18", "reverse_ddns", "$@19",
-  "ddns_mgr_params", "not_empty_ddns_mgr_params", "ddns_mgr_param",
-  "ddns_domains", "$@20", "sub_ddns_domains", "$@21", "ddns_domain_list",
+  "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"worker-threads\"",
+  "\"Logging\"", "\"loggers\"", "\"name\"", "\"output_options\"",
+  "\"output\"", "\"debuglevel\"", "\"severity\"", "\"flush\"",
+  "\"maxsize\"", "\"maxver\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS",
+  "SUB_DHCPDDNS", "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN",
+  "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER", "SUB_DNS_SERVERS",
+  "\"constant string\"", "\"integer\"", "\"floating point\"",
+  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
+  "$@6", "$@7", "$@8", "$@9", "value", "sub_json", "map2", "$@10",
+  "map_content", "not_empty_map", "list_generic", "$@11", "list_content",
+  "not_empty_list", "unknown_map_entry", "syntax_map", "$@12",
+  "global_objects", "global_object", "dhcpddns_object", "$@13",
+  "sub_dhcpddns", "$@14", "dhcpddns_params", "dhcpddns_param",
+  "ip_address", "$@15", "port", "dns_server_timeout", "worker_threads",
+  "ncr_protocol", "$@16", "ncr_protocol_value", "ncr_format", "$@17",
+  "forward_ddns", "$@18", "reverse_ddns", "$@19", "ddns_mgr_params",
+  "not_empty_ddns_mgr_params", "ddns_mgr_param", "ddns_domains", "$@20",
+  "sub_ddns_domains", "$@21", "ddns_domain_list",
   "not_empty_ddns_domain_list", "ddns_domain", "$@22", "sub_ddns_domain",
   "$@23", "ddns_domain_params", "ddns_domain_param", "ddns_domain_name",
   "$@24", "ddns_domain_key_name", "$@25", "dns_servers", "$@26",
@@ -2183,55 +2350,55 @@ namespace isc { namespace d2 {
   "output_params_list", "output_params", "output", "$@48", "flush",
   "maxsize", "maxver", YY_NULLPTR
   };
+#endif
+
 
 #if D2_PARSER_DEBUG
-  const unsigned short int
+  const short
   D2Parser::yyrline_[] =
   {
-       0,   116,   116,   116,   117,   117,   118,   118,   119,   119,
-     120,   120,   121,   121,   122,   122,   123,   123,   124,   124,
-     132,   133,   134,   135,   136,   137,   138,   141,   146,   146,
-     158,   159,   162,   166,   173,   173,   180,   181,   184,   188,
-     199,   209,   209,   221,   222,   226,   227,   228,   229,   230,
-     235,   235,   245,   245,   253,   254,   258,   259,   260,   261,
-     262,   263,   264,   265,   266,   269,   269,   277,   285,   294,
-     294,   302,   303,   306,   306,   314,   314,   324,   324,   334,
-     335,   338,   339,   342,   343,   348,   348,   358,   358,   365,
-     366,   369,   370,   373,   373,   381,   381,   388,   389,   392,
-     393,   394,   395,   399,   399,   411,   411,   423,   423,   433,
-     433,   440,   441,   444,   444,   452,   452,   459,   460,   463,
-     464,   465,   466,   469,   469,   481,   481,   489,   503,   503,
-     513,   513,   520,   521,   524,   525,   528,   528,   536,   536,
-     545,   546,   549,   550,   551,   552,   553,   556,   556,   568,
-     568,   579,   587,   587,   602,   602,   609,   609,   621,   621,
-     634,   635,   639,   643,   643,   655,   656,   660,   660,   668,
-     669,   672,   673,   674,   675,   676,   679,   679,   687,   691,
-     691,   699,   699,   709,   710,   713,   713,   721,   722,   725,
-     726,   727,   728,   731,   731,   739,   744,   749
+       0,   117,   117,   117,   118,   118,   119,   119,   120,   120,
+     121,   121,   122,   122,   123,   123,   124,   124,   125,   125,
+     133,   134,   135,   136,   137,   138,   139,   142,   147,   147,
+     159,   160,   163,   167,   174,   174,   182,   183,   186,   190,
+     201,   211,   211,   224,   225,   229,   230,   231,   232,   233,
+     238,   238,   248,   248,   256,   257,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   270,   273,   273,   281,   289,
+     298,   307,   307,   315,   316,   319,   319,   327,   327,   337,
+     337,   347,   348,   351,   352,   355,   356,   361,   361,   371,
+     371,   378,   379,   382,   383,   386,   386,   394,   394,   401,
+     402,   405,   406,   407,   408,   412,   412,   424,   424,   436,
+     436,   446,   446,   453,   454,   457,   457,   465,   465,   472,
+     473,   476,   477,   478,   479,   482,   482,   494,   494,   502,
+     516,   516,   526,   526,   533,   534,   537,   538,   541,   541,
+     549,   549,   558,   559,   562,   563,   564,   565,   566,   569,
+     569,   581,   581,   592,   600,   600,   615,   615,   622,   622,
+     635,   635,   648,   649,   653,   657,   657,   669,   670,   674,
+     674,   682,   683,   686,   687,   688,   689,   690,   693,   693,
+     701,   706,   706,   714,   714,   724,   725,   728,   728,   736,
+     737,   740,   741,   742,   743,   746,   746,   754,   759,   764
   };
 
-  // Print the state stack on the debug stream.
   void
-  D2Parser::yystack_print_ ()
+  D2Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  D2Parser::yy_reduce_print_ (int yyrule)
+  D2Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -2240,10 +2407,11 @@ namespace isc { namespace d2 {
 #endif // D2_PARSER_DEBUG
 
 
-#line 14 "d2_parser.yy" // lalr1.cc:1167
+#line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2246 "d2_parser.cc" // lalr1.cc:1167
-#line 754 "d2_parser.yy" // lalr1.cc:1168
+#line 2413 "d2_parser.cc"
+
+#line 769 "d2_parser.yy"
 
 
 void
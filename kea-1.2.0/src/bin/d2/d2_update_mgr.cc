@@ -10,6 +10,9 @@
 #include <d2/nc_add.h>
 #include <d2/nc_remove.h>
 
+#include <boost/bind.hpp>
+#include <boost/functional/hash.hpp>
+
 #include <sstream>
 #include <iostream>
 #include <vector>
@@ -36,18 +39,26 @@ D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
         isc_throw(D2UpdateMgrError, "IOServicePtr cannot be null");
     }
 
+    timing_wheel_.reset(new asiolink::TimingWheel(*io_service_));
+
     // Use setter to do validation.
     setMaxTransactions(max_transactions);
 }
 
 D2UpdateMgr::~D2UpdateMgr() {
+    // The shards' threads must not run while the transactions are destroyed.
+    stopShards();
     transaction_list_.clear();
+    shards_.clear();
 }
 
 void D2UpdateMgr::sweep() {
     // cleanup finished transactions;
     checkFinishedTransactions();
 
+    // Apply the worker threads configuration if it has changed.
+    configureShards();
+
     // if the queue isn't empty, find the next suitable job and
     // start a transaction for it.
     // @todo - Do we want to queue max transactions? The logic here will only
@@ -64,7 +75,15 @@ void D2UpdateMgr::sweep() {
         }
 
         // We are not at maximum transactions, so pick and start the next job.
-        pickNextJob();
+        // The IO of the transactions run by the shards doesn't wake this
+        // thread up, so start as many jobs as permitted.
+        size_t queue_count = 0;
+        do {
+            queue_count = getQueueCount();
+            pickNextJob();
+        } while (!shards_.empty() && (getQueueCount() > 0) &&
+                 (getQueueCount() < queue_count) &&
+                 (getTransactionCount() < max_transactions_));
     }
 }
 
@@ -78,6 +97,12 @@ D2UpdateMgr::checkFinishedTransactions() {
     // to erase.  This replaces the old iterator which becomes invalid by the
     // erase with a the next valid iterator.  Prefix incrementing will not
     // work.
+    // The transactions run by the shards are removed by transactionDone,
+    // as polling them from this thread is not safe.
+    if (!shards_.empty()) {
+        return;
+    }
+
     TransactionList::iterator it = transaction_list_.begin();
     while (it != transaction_list_.end()) {
         NameChangeTransactionPtr trans = (*it).second;
@@ -91,6 +116,52 @@ D2UpdateMgr::checkFinishedTransactions() {
     }
 }
 
+void
+D2UpdateMgr::configureShards() {
+    const size_t worker_threads = cfg_mgr_->getD2Params()->getWorkerThreads();
+    if ((worker_threads == shards_.size()) || !transaction_list_.empty()) {
+        return;
+    }
+
+    shards_.clear();
+    for (size_t i = 0; i < worker_threads; ++i) {
+        shards_.push_back(D2UpdateShardPtr(new D2UpdateShard()));
+    }
+}
+
+void
+D2UpdateMgr::stopShards() {
+    for (std::vector<D2UpdateShardPtr>::iterator shard = shards_.begin();
+         shard != shards_.end(); ++shard) {
+        (*shard)->stop();
+    }
+}
+
+void
+D2UpdateMgr::shardTransactionDone(asiolink::IOService* shard_io,
+                                  const TransactionKey& key,
+                                  const NameChangeTransactionWeakPtr& trans) {
+    boost::function<void()> done = boost::bind(&D2UpdateMgr::transactionDone,
+                                               this, key, trans);
+    shard_io->post(boost::bind(&asiolink::IOService::post, io_service_.get(),
+                               done));
+}
+
+void
+D2UpdateMgr::transactionDone(const TransactionKey& key,
+                             const NameChangeTransactionWeakPtr& trans) {
+    // The transaction is gone if the list has been cleared meanwhile.
+    NameChangeTransactionPtr done = trans.lock();
+    if (!done) {
+        return;
+    }
+
+    TransactionList::iterator pos = findTransaction(key);
+    if ((pos != transactionListEnd()) && (pos->second == done)) {
+        transaction_list_.erase(pos);
+    }
+}
+
 void D2UpdateMgr::pickNextJob() {
     // Start at the front of the queue, looking for the first entry for
     // which no transaction is in progress.  If we find an eligible entry
@@ -191,26 +262,54 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     }
 
     // We matched to the required servers, so construct the transaction.
-    // @todo If multi-threading is implemented, one would pass in an
-    // empty IOServicePtr, rather than our instance value.  This would cause
-    // the transaction to instantiate its own, separate IOService to handle
-    // the transaction's IO.
+    // If there are worker shards, the transaction runs on the shard selected
+    // by its DHCID, otherwise it shares our IOService.
+    D2UpdateShardPtr shard;
+    if (!shards_.empty()) {
+        const std::vector<uint8_t>& dhcid = key.getBytes();
+        size_t hash = boost::hash_range(dhcid.begin(), dhcid.end());
+        shard = shards_[hash % shards_.size()];
+    }
+
+    asiolink::IOServicePtr& io_service = (shard ? shard->getIOService()
+                                          : io_service_);
+
+    // The domains, their servers and TSIG keys are not modified once they
+    // are configured, so the transactions run by the shards share them with
+    // the main thread. Each transaction signs and verifies its messages with
+    // its own copy of the pre-keyed HMAC (see dns::TSIGKey::createHMAC).
     NameChangeTransactionPtr trans;
     if (next_ncr->getChangeType() == dhcp_ddns::CHG_ADD) {
-        trans.reset(new NameAddTransaction(io_service_, next_ncr,
+        trans.reset(new NameAddTransaction(io_service, next_ncr,
                                            forward_domain, reverse_domain,
                                            cfg_mgr_));
     } else {
-        trans.reset(new NameRemoveTransaction(io_service_, next_ncr,
+        trans.reset(new NameRemoveTransaction(io_service, next_ncr,
                                               forward_domain, reverse_domain,
                                               cfg_mgr_));
     }
 
+    // The DNS update timeouts are measured on the shared timing wheel.
+    trans->setTimingWheel(shard ? shard->getTimingWheel() : timing_wheel_);
+
     // Add the new transaction to the list.
     transaction_list_[key] = trans;
 
     // Start it.
-    trans->startTransaction();
+    if (!shard) {
+        trans->startTransaction();
+        return;
+    }
+
+    // From now on the transaction belongs to the shard's thread, until
+    // it reports the completion.  The posted handler holds a reference to
+    // the transaction, so it outlives the removal from the list.  The done
+    // handler is owned by the transaction, so it refers to it weakly.
+    trans->setDoneHandler(boost::bind(&D2UpdateMgr::shardTransactionDone,
+                                      this, io_service.get(), key,
+                                      NameChangeTransactionWeakPtr(trans)));
+    io_service->post(boost::bind(&NameChangeTransaction::startTransaction,
+                                 trans));
 }
 
 TransactionList::iterator
@@ -245,7 +344,11 @@ void
 D2UpdateMgr::clearTransactionList() {
     // @todo for now this just wipes them out. We might need something
     // more elegant, that allows a cancel first.
+    // The shards may be running the transactions, so they are discarded
+    // too. They are recreated by the next sweep.
+    stopShards();
     transaction_list_.clear();
+    shards_.clear();
 }
 
 void
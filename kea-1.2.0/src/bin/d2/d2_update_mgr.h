@@ -10,15 +10,18 @@
 /// @file d2_update_mgr.h This file defines the class D2UpdateMgr.
 
 #include <asiolink/io_service.h>
+#include <asiolink/timing_wheel.h>
 #include <exceptions/exceptions.h>
 #include <d2/d2_log.h>
 #include <d2/d2_queue_mgr.h>
 #include <d2/d2_cfg_mgr.h>
+#include <d2/d2_update_shard.h>
 #include <d2/nc_trans.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
+#include <vector>
 
 namespace isc {
 namespace d2 {
@@ -62,6 +65,16 @@ typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 /// The upper layer(s) are responsible for calling sweep in a timely and cyclic
 /// manner.
 ///
+/// By default the transactions are carried out by the upper layer's
+/// IOService, i.e. on the main thread.  If the configuration specifies
+/// worker threads, D2UpdateMgr creates one D2UpdateShard per thread and
+/// runs each transaction on the IOService of one of the shards.  The shard
+/// is selected by hashing the DHCID, so updates for a given client are never
+/// carried out concurrently and keep their order.  The queue and the list of
+/// transactions remain owned by the main thread: the shards report finished
+/// transactions by posting to the main IOService, which also wakes up the
+/// upper layer to call sweep() again.
+///
 class D2UpdateMgr : public boost::noncopyable {
 public:
     /// @brief Maximum number of concurrent transactions
@@ -111,7 +124,9 @@ public:
     /// a request from the queue.
     ///
     /// - If a request was selected, start a new transaction for it and
-    /// add the transaction to the list of transactions.
+    /// add the transaction to the list of transactions.  When worker threads
+    /// are used, requests are selected until none is eligible or the
+    /// maximum number of transactions is reached.
     void sweep();
 
 protected:
@@ -122,6 +137,15 @@ protected:
     /// disappear altogether as the implementation matures.
     void checkFinishedTransactions();
 
+    /// @brief Creates the worker shards as configured.
+    ///
+    /// Compares the number of the shards with the number of worker threads
+    /// in the current configuration.  If they differ and there are no
+    /// transactions in progress, the existing shards are stopped and the
+    /// configured number of shards is created.  Otherwise the change is
+    /// deferred until all transactions in progress are finished.
+    void configureShards();
+
     /// @brief Starts a transaction for the next eligible request in the queue.
     ///
     /// This method will scan the request queue for the next request to
@@ -225,7 +249,39 @@ public:
     /// @brief Returns the current number of transactions.
     size_t getTransactionCount() const;
 
+    /// @brief Returns the number of worker shards.
+    size_t getShardCount() const {
+        return (shards_.size());
+    }
+
 private:
+    /// @brief Stops all the worker shards.
+    void stopShards();
+
+    /// @brief Hands a finished transaction over to the main thread.
+    ///
+    /// Invoked by a shard's thread, from within the transaction, when
+    /// the transaction completes.  It defers the hand over until the
+    /// transaction's handlers have returned.
+    ///
+    /// @param shard_io IOService of the shard running the transaction.
+    /// @param key DHCID of the transaction.
+    /// @param trans the finished transaction.  It is referred to weakly,
+    /// as the handler invoking this method is owned by the transaction.
+    void shardTransactionDone(asiolink::IOService* shard_io,
+                              const TransactionKey& key,
+                              const NameChangeTransactionWeakPtr& trans);
+
+    /// @brief Removes a finished transaction from the transaction list.
+    ///
+    /// Invoked by the main thread.
+    ///
+    /// @param key DHCID of the transaction.
+    /// @param trans the finished transaction.  The entry is removed only if
+    /// it still refers to this transaction.
+    void transactionDone(const TransactionKey& key,
+                         const NameChangeTransactionWeakPtr& trans);
+
     /// @brief Pointer to the queue manager.
     D2QueueMgrPtr queue_mgr_;
 
@@ -235,16 +291,25 @@ private:
     /// @brief Primary IOService instance.
     /// This is the IOService that the upper layer(s) use for IO events, such
     /// as shutdown and configuration commands.  It is the IOService that is
-    /// passed into transactions to manager their IO events.
-    /// (For future reference, multi-threaded transactions would each use their
-    /// own IOService instance.)
+    /// passed into transactions to manager their IO events, unless worker
+    /// threads are configured, in which case the transactions use the
+    /// IOServices of the shards.
     asiolink::IOServicePtr io_service_;
 
+    /// @brief Timing wheel shared by the transactions.
+    ///
+    /// All DNS update timeouts are measured on this wheel, rather than
+    /// each one arming its own timer in the IOService.
+    asiolink::TimingWheelPtr timing_wheel_;
+
     /// @brief Maximum number of concurrent transactions.
     size_t max_transactions_;
 
     /// @brief List of transactions.
     TransactionList transaction_list_;
+
+    /// @brief Worker shards (empty if the updates use the main thread).
+    std::vector<D2UpdateShardPtr> shards_;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
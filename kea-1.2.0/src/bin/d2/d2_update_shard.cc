@@ -0,0 +1,39 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <d2/d2_update_shard.h>
+
+#include <boost/bind.hpp>
+
+using namespace isc::asiolink;
+using namespace isc::util::thread;
+
+namespace isc {
+namespace d2 {
+
+D2UpdateShard::D2UpdateShard()
+    : io_service_(new IOService()),
+      timing_wheel_(new TimingWheel(*io_service_)), thread_() {
+    thread_.reset(new Thread(boost::bind(&IOService::run, io_service_.get())));
+}
+
+D2UpdateShard::~D2UpdateShard() {
+    stop();
+}
+
+void
+D2UpdateShard::stop() {
+    if (thread_) {
+        io_service_->stop();
+        thread_->wait();
+        thread_.reset();
+    }
+}
+
+} // namespace isc::d2
+} // namespace isc
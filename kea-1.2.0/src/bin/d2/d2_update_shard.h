@@ -0,0 +1,83 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef D2_UPDATE_SHARD_H
+#define D2_UPDATE_SHARD_H
+
+/// @file d2_update_shard.h This file defines the class D2UpdateShard.
+
+#include <asiolink/io_service.h>
+#include <asiolink/timing_wheel.h>
+#include <util/threads/thread.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace isc {
+namespace d2 {
+
+/// @brief Worker thread carrying out a share of the DNS updates.
+///
+/// When D2 is configured to use worker threads, D2UpdateMgr creates one
+/// shard per thread and assigns each new transaction to one of them. The
+/// shard owns an IOService run by its thread, on which the transaction's
+/// state model, TSIG signing and DNS I/O are carried out, and a timing
+/// wheel measuring the DNS update timeouts of its transactions.
+///
+/// Transactions are assigned to the shards by their DHCID, so all updates
+/// for the same client are always carried out by the same thread, in
+/// order.
+///
+/// The thread is started by the constructor and runs until the shard is
+/// stopped or destroyed. The pending handlers are discarded at that point.
+class D2UpdateShard : public boost::noncopyable {
+public:
+    /// @brief Constructor
+    ///
+    /// Creates the IOService and the timing wheel and starts the thread.
+    D2UpdateShard();
+
+    /// @brief Destructor
+    ///
+    /// Stops the thread if it is still running.
+    ~D2UpdateShard();
+
+    /// @brief Stops the IOService and waits for the thread to terminate.
+    ///
+    /// Once this method returns, none of the shard's handlers is running
+    /// nor will run, so the transactions assigned to the shard may be
+    /// safely destroyed.  The shard can't be restarted.
+    void stop();
+
+    /// @brief Returns the IOService run by the shard's thread.
+    asiolink::IOServicePtr& getIOService() {
+        return (io_service_);
+    }
+
+    /// @brief Returns the timing wheel driven by the shard's IOService.
+    const asiolink::TimingWheelPtr& getTimingWheel() const {
+        return (timing_wheel_);
+    }
+
+private:
+    /// @brief IOService run by the thread.
+    asiolink::IOServicePtr io_service_;
+
+    /// @brief Timing wheel shared by the shard's transactions.
+    asiolink::TimingWheelPtr timing_wheel_;
+
+    /// @brief Thread running the IOService.
+    boost::scoped_ptr<util::thread::Thread> thread_;
+};
+
+/// @brief Defines a pointer to a D2UpdateShard.
+typedef boost::shared_ptr<D2UpdateShard> D2UpdateShardPtr;
+
+} // namespace isc::d2
+} // namespace isc
+
+#endif
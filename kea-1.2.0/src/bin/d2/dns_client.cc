@@ -74,7 +74,8 @@ public:
                   const uint16_t ns_port,
                   D2UpdateMessage& update,
                   const unsigned int wait,
-                  const dns::TSIGKeyPtr& tsig_key);
+                  const dns::TSIGKeyPtr& tsig_key,
+                  const asiolink::TimingWheelPtr& wheel);
 
     // This function maps the IO error to the DNSClient error.
     DNSClient::Status getStatus(const asiodns::IOFetch::Result);
@@ -180,7 +181,8 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
                         const uint16_t ns_port,
                         D2UpdateMessage& update,
                         const unsigned int wait,
-                        const dns::TSIGKeyPtr& tsig_key) {
+                        const dns::TSIGKeyPtr& tsig_key,
+                        const asiolink::TimingWheelPtr& wheel) {
     // The underlying implementation which we use to send DNS Updates uses
     // signed integers for timeout. If we want to avoid overflows we need to
     // respect this limitation here.
@@ -222,7 +224,7 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     // overflows when doing implicit cast. It should have been checked by the
     // caller that the unsigned timeout value will fit into int.
     IOFetch io_fetch(IOFetch::UDP, io_service, msg_buf, ns_addr, ns_port,
-                     in_buf_, this, static_cast<int>(wait));
+                     in_buf_, this, static_cast<int>(wait), wheel);
 
     // Post the task to the task queue in the IO service. Caller will actually
     // run these tasks by executing IOService::run.
@@ -250,8 +252,10 @@ DNSClient::doUpdate(asiolink::IOService& io_service,
                     const uint16_t ns_port,
                     D2UpdateMessage& update,
                     const unsigned int wait,
-                    const dns::TSIGKeyPtr& tsig_key) {
-    impl_->doUpdate(io_service, ns_addr, ns_port, update, wait, tsig_key);
+                    const dns::TSIGKeyPtr& tsig_key,
+                    const asiolink::TimingWheelPtr& wheel) {
+    impl_->doUpdate(io_service, ns_addr, ns_port, update, wait, tsig_key,
+                    wheel);
 }
 
 } // namespace d2
@@ -10,6 +10,7 @@
 #include <d2/d2_update_message.h>
 
 #include <asiolink/io_service.h>
+#include <asiolink/timing_wheel.h>
 #include <util/buffer.h>
 
 #include <asiodns/io_fetch.h>
@@ -141,12 +142,16 @@ public:
     /// @param tsig_key A pointer to an @c isc::dns::TSIGKey object that will
     /// (if not null) be used to sign the DNS Update message and verify the
     /// response.
+    /// @param wheel A timing wheel used to measure the timeout. If null, the
+    /// exchange uses its own timer.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
                   const uint16_t ns_port,
                   D2UpdateMessage& update,
                   const unsigned int wait,
-                  const dns::TSIGKeyPtr& tsig_key = dns::TSIGKeyPtr());
+                  const dns::TSIGKeyPtr& tsig_key = dns::TSIGKeyPtr(),
+                  const asiolink::TimingWheelPtr& wheel =
+                  asiolink::TimingWheelPtr());
 
 private:
     DNSClientImpl* impl_;  ///< Pointer to DNSClient implementation.
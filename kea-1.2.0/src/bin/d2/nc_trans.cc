@@ -52,7 +52,8 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
      dns_update_status_(DNSClient::OTHER), dns_update_response_(),
      forward_change_completed_(false), reverse_change_completed_(false),
      current_server_list_(), current_server_(), next_server_pos_(0),
-     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_() {
+     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_(), timing_wheel_(),
+     d2_params_(), done_handler_() {
     /// @todo if io_service is NULL we are multi-threading and should
     /// instantiate our own
     if (!io_service_) {
@@ -78,6 +79,8 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
         isc_throw(NameChangeTransactionError,
                   "Configuration manager cannot be null");
     }
+
+    d2_params_ = cfg_mgr_->getD2Params();
 }
 
 NameChangeTransaction::~NameChangeTransaction(){
@@ -91,6 +94,7 @@ NameChangeTransaction::startTransaction() {
 
     setNcrStatus(dhcp_ddns::ST_PENDING);
     startModel(READY_ST);
+    notifyDone();
 }
 
 void
@@ -107,6 +111,14 @@ NameChangeTransaction::operator()(DNSClient::Status status) {
               .arg(responseString());
 
     runModel(IO_COMPLETED_EVT);
+    notifyDone();
+}
+
+void
+NameChangeTransaction::notifyDone() {
+    if (done_handler_ && isModelDone()) {
+        done_handler_();
+    }
 }
 
 std::string
@@ -173,10 +185,10 @@ NameChangeTransaction::sendUpdate(const std::string& comment) {
         // use_tsig_ is true. We should be able to navigate to the TSIG key
         // for the current server.  If not we would need to add that.
 
-        D2ParamsPtr d2_params = cfg_mgr_->getD2Params();
         dns_client_->doUpdate(*io_service_, current_server_->getIpAddress(),
                               current_server_->getPort(), *dns_update_request_,
-                              d2_params->getDnsServerTimeout(), tsig_key_);
+                              d2_params_->getDnsServerTimeout(), tsig_key_,
+                              timing_wheel_);
         // Message is on its way, so the next event should be NOP_EVT.
         postNextEvent(NOP_EVT);
         LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
@@ -10,6 +10,7 @@
 /// @file nc_trans.h This file defines the class NameChangeTransaction.
 
 #include <asiolink/io_service.h>
+#include <asiolink/timing_wheel.h>
 #include <exceptions/exceptions.h>
 #include <d2/d2_cfg_mgr.h>
 #include <d2/dns_client.h>
@@ -17,7 +18,9 @@
 #include <dns/tsig.h>
 #include <util/state_model.h>
 
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
 #include <map>
 
 namespace isc {
@@ -153,6 +156,9 @@ public:
     /// @brief Maximum times to attempt a single update on a given server.
     static const unsigned int MAX_UPDATE_TRIES_PER_SERVER = 3;
 
+    /// @brief Defines the type of the transaction completion handler.
+    typedef boost::function<void()> DoneHandler;
+
     /// @brief Constructor
     ///
     /// Instantiates a transaction that is ready to be started.
@@ -182,6 +188,27 @@ public:
     /// with the state handler for READY_ST.
     void startTransaction();
 
+    /// @brief Sets the timing wheel used to measure the DNS update timeouts.
+    ///
+    /// If not set, each DNS update uses its own timer.
+    ///
+    /// @param wheel is the timing wheel shared by the transactions.
+    void setTimingWheel(const asiolink::TimingWheelPtr& wheel) {
+        timing_wheel_ = wheel;
+    }
+
+    /// @brief Sets the handler invoked when the transaction completes.
+    ///
+    /// The handler is invoked by the thread running the transaction's
+    /// IOService, as soon as the state model reaches its end.  This allows
+    /// the owner of a transaction running on another thread to learn about
+    /// its completion without polling @c isModelDone().
+    ///
+    /// @param handler is the function to invoke, it must not throw.
+    void setDoneHandler(const DoneHandler& handler) {
+        done_handler_ = handler;
+    }
+
     /// @brief Serves as the DNSClient IO completion event handler.
     ///
     /// This is the implementation of the method inherited by our derivation
@@ -524,6 +551,9 @@ public:
     const dns::RRType& getAddressRRType() const;
 
 private:
+    /// @brief Invokes the completion handler if the transaction is done.
+    void notifyDone();
+
     /// @brief The IOService which should be used to for IO processing.
     asiolink::IOServicePtr io_service_;
 
@@ -582,11 +612,26 @@ private:
 
     /// @brief Pointer to the TSIG key which should be used (if any).
     dns::TSIGKeyPtr tsig_key_;
+
+    /// @brief Timing wheel used to measure the DNS update timeouts (if any).
+    asiolink::TimingWheelPtr timing_wheel_;
+
+    /// @brief Global parameters in force when the transaction was created.
+    ///
+    /// The transaction may run on a worker thread, so it must not access
+    /// the configuration manager which is updated by the main thread.
+    D2ParamsPtr d2_params_;
+
+    /// @brief Handler invoked when the transaction completes (if any).
+    DoneHandler done_handler_;
 };
 
 /// @brief Defines a pointer to a NameChangeTransaction.
 typedef boost::shared_ptr<NameChangeTransaction> NameChangeTransactionPtr;
 
+/// @brief Defines a weak pointer to a NameChangeTransaction.
+typedef boost::weak_ptr<NameChangeTransaction> NameChangeTransactionWeakPtr;
+
 } // namespace isc::d2
 } // namespace isc
 #endif
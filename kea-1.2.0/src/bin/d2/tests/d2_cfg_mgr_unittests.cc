@@ -731,6 +731,57 @@ TEST_F(D2CfgMgrTest, matchNoWildcard) {
     EXPECT_FALSE(cfg_mgr_->matchForward("shouldbe.wildcard", match));
 }
 
+/// @brief Tests that domain matching compares whole labels.
+/// This test verifies that a domain matches only FQDNs ending with all of
+/// its labels, regardless of case, and that the longest match wins.
+TEST_F(D2CfgMgrTest, matchLabels) {
+    std::string config = "{ "
+                        "\"ip-address\" : \"192.168.1.33\" , "
+                        "\"port\" : 88 , "
+                        "\"tsig-keys\": [] ,"
+                        "\"forward-ddns\" : {"
+                        "\"ddns-domains\": [ "
+                        "{ \"name\": \"two.net\" , "
+                        "  \"dns-servers\" : [ "
+                        "  { \"ip-address\": \"127.0.0.1\" } "
+                        "  ] } "
+                        ", "
+                        "{ \"name\": \"Three.Two.Net\" , "
+                        "  \"dns-servers\" : [ "
+                        "  { \"ip-address\": \"127.0.0.2\" } "
+                        "  ] } "
+                        ", "
+                        "{ \"name\": \"example.org.\" , "
+                        "  \"dns-servers\" : [ "
+                        "  { \"ip-address\": \"127.0.0.3\" } "
+                        "  ] } "
+                        "] }, "
+                        "\"reverse-ddns\" : {} "
+                        " }";
+
+    // Verify that we can parse the configuration.
+    RUN_CONFIG_OK(config);
+
+    DdnsDomainPtr match;
+    // Verify that a domain does not match a partial label.
+    EXPECT_FALSE(cfg_mgr_->matchForward("onetwo.net", match));
+    EXPECT_FALSE(cfg_mgr_->matchForward("net", match));
+
+    // Verify that the longest match wins regardless of case.
+    EXPECT_TRUE(cfg_mgr_->matchForward("ONE.TWO.NET", match));
+    EXPECT_EQ("two.net", match->getName());
+    EXPECT_TRUE(cfg_mgr_->matchForward("one.three.two.net", match));
+    EXPECT_EQ("Three.Two.Net", match->getName());
+    EXPECT_TRUE(cfg_mgr_->matchForward("fourthree.two.net", match));
+    EXPECT_EQ("two.net", match->getName());
+
+    // Verify that the trailing dot of a name is significant.
+    EXPECT_TRUE(cfg_mgr_->matchForward("www.example.org.", match));
+    EXPECT_EQ("example.org.", match->getName());
+    EXPECT_FALSE(cfg_mgr_->matchForward("www.example.org", match));
+    EXPECT_FALSE(cfg_mgr_->matchForward("one.two.net.", match));
+}
+
 /// @brief Tests domain matching when there is ONLY a wild card domain.
 /// This test verifies that any FQDN matches the wild card.
 TEST_F(D2CfgMgrTest, matchAll) {
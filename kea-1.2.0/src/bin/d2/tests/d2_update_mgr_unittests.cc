@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 #include <gtest/gtest.h>
 #include <algorithm>
+#include <sstream>
 #include <vector>
 
 using namespace std;
@@ -113,11 +114,17 @@ public:
     }
 
     /// @brief Seeds configuration manager with a valid DHCP_DDNS configuration.
-    void makeCannedConfig() {
+    ///
+    /// @param worker_threads number of worker threads to configure.
+    void makeCannedConfig(const size_t worker_threads = 0) {
+        std::ostringstream threads;
+        if (worker_threads > 0) {
+            threads << "\"worker-threads\" : " << worker_threads << " , ";
+        }
         std::string canned_config_ =
                  "{ "
                   "\"ip-address\" : \"192.168.1.33\" , "
-                  "\"port\" : 88 , "
+                  "\"port\" : 88 , " + threads.str() +
                   "\"tsig-keys\": [] ,"
                   "\"forward-ddns\" : {"
                   "\"ddns-domains\": [ "
@@ -148,6 +155,35 @@ public:
         ASSERT_TRUE(checkAnswer(0));
     }
 
+    /// @brief Process events until all requests have been completed by
+    /// the worker threads.
+    ///
+    /// The transactions run by the worker threads must not be inspected
+    /// by the test, so unlike @c processAll this method only runs the
+    /// IOService until the update manager learns that the transactions
+    /// have completed.
+    ///
+    /// @param run_time maximum time in milliseconds to wait for a single
+    /// event.
+    void processAllThreaded(const int run_time) {
+        size_t passes = 0;
+        while (update_mgr_->getQueueCount() ||
+            update_mgr_->getTransactionCount()) {
+            update_mgr_->sweep();
+            if (update_mgr_->getTransactionCount() &&
+                (runTimedIO(run_time) == 0)) {
+                ADD_FAILURE() << "processAllThreaded: IO service stopped"
+                    " unexpectedly";
+                return;
+            }
+
+            if (++passes > 100) {
+                ADD_FAILURE() << "processAllThreaded failed, too many passes";
+                return;
+            }
+        }
+    }
+
     /// @brief Fakes the completion of a given transaction.
     ///
     /// @param index index of the request from which the transaction was formed.
@@ -860,4 +896,95 @@ TEST_F(D2UpdateMgrTest, multiTransactionTimeout) {
     }
 }
 
+/// @brief Tests that the worker shards follow the configuration.
+TEST_F(D2UpdateMgrTest, workerThreads) {
+    // By default the transactions run on the main thread.
+    EXPECT_EQ(0, cfg_mgr_->getD2Params()->getWorkerThreads());
+    update_mgr_->sweep();
+    EXPECT_EQ(0, update_mgr_->getShardCount());
+
+    // The shards are created by the sweep.
+    makeCannedConfig(3);
+    EXPECT_EQ(3, cfg_mgr_->getD2Params()->getWorkerThreads());
+    isc::data::ConstElementPtr threads =
+        cfg_mgr_->getD2CfgContext()->toElement()->get("DhcpDdns")->
+        get("worker-threads");
+    ASSERT_TRUE(threads);
+    EXPECT_EQ(3, threads->intValue());
+    EXPECT_EQ(0, update_mgr_->getShardCount());
+    update_mgr_->sweep();
+    EXPECT_EQ(3, update_mgr_->getShardCount());
+
+    // The shards are not replaced while a transaction is in progress.
+    canned_ncrs_[0]->setReverseChange(true);
+    ASSERT_NO_THROW(update_mgr_->makeTransaction(canned_ncrs_[0]));
+    EXPECT_EQ(1, update_mgr_->getTransactionCount());
+
+    // The transaction shares the configured domains.
+    TransactionList::iterator pos =
+        update_mgr_->findTransaction(canned_ncrs_[0]->getDhcid());
+    ASSERT_TRUE(pos != update_mgr_->transactionListEnd());
+    DdnsDomainPtr domain;
+    ASSERT_TRUE(cfg_mgr_->matchReverse(canned_ncrs_[0]->getIpAddress(),
+                                       domain));
+    EXPECT_TRUE(pos->second->getReverseDomain() == domain);
+    makeCannedConfig();
+    update_mgr_->sweep();
+    EXPECT_EQ(3, update_mgr_->getShardCount());
+
+    // Discarding the transactions discards the shards.
+    update_mgr_->clearTransactionList();
+    EXPECT_EQ(0, update_mgr_->getShardCount());
+    EXPECT_EQ(0, update_mgr_->getTransactionCount());
+    update_mgr_->sweep();
+    EXPECT_EQ(0, update_mgr_->getShardCount());
+}
+
+/// @brief Tests processing of multiple transactions by the worker threads.
+/// This test verifies that the transactions run by the worker threads
+/// complete and are removed from the transaction list, using a fake server
+/// running on the main thread that responds to all requests with NOERROR.
+TEST_F(D2UpdateMgrTest, multiTransactionWorkerThreads) {
+    makeCannedConfig(2);
+
+    // Queue up all the requests.
+    int test_count = canned_count_;
+    for (int i = test_count; i > 0; i--) {
+        canned_ncrs_[i-1]->setReverseChange(true);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i-1]));
+    }
+
+    asiolink::IOAddress server_ip("127.0.0.1");
+    FauxServer server(*io_service_, server_ip, 5301);
+    server.receive(FauxServer::USE_RCODE, dns::Rcode::NOERROR());
+
+    // Run sweep and IO until everything is done.
+    processAllThreaded(1000);
+    EXPECT_EQ(2, update_mgr_->getShardCount());
+
+    for (int i = 0; i < test_count; i++) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, canned_ncrs_[i]->getStatus());
+    }
+}
+
+/// @brief Tests that the worker threads measure the DNS update timeouts.
+/// No server is running, so all the updates time out on the worker threads.
+TEST_F(D2UpdateMgrTest, multiTransactionTimeoutWorkerThreads) {
+    makeCannedConfig(2);
+
+    // Queue up all the requests.
+    int test_count = canned_count_;
+    for (int i = test_count; i > 0; i--) {
+        canned_ncrs_[i-1]->setReverseChange(true);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i-1]));
+    }
+
+    // Run sweep and IO until everything is done.
+    processAllThreaded(5000);
+
+    for (int i = 0; i < test_count; i++) {
+        EXPECT_EQ(dhcp_ddns::ST_FAILED, canned_ncrs_[i]->getStatus());
+    }
+}
+
 }
@@ -540,6 +540,24 @@ TEST(ParserTest, errors) {
               "\"totally-bogus\" in DhcpDdns map.");
 }
 
+// Check that the worker-threads parameter is accepted by the DhcpDdns
+// map and that a negative number of threads is rejected.
+TEST(ParserTest, workerThreads) {
+    string txt =
+        "{ \"DhcpDdns\" : \n"
+           "{ \n"
+            " \"ip-address\": \"192.168.77.1\", \n"
+            " \"worker-threads\": 4 \n"
+            "} \n"
+         "} \n";
+    testParser(txt, D2ParserContext::PARSER_DHCPDDNS);
+
+    testError("{ \"DhcpDdns\":{\n"
+              " \"worker-threads\":-1 }}\n",
+              D2ParserContext::PARSER_DHCPDDNS,
+              "<string>:2.19-20: worker-threads must not be negative");
+}
+
 // Check unicode escapes
 TEST(ParserTest, unicodeEscapes) {
     ConstElementPtr result;
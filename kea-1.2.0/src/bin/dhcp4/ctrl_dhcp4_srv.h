@@ -11,6 +11,7 @@
 #include <asiolink/asiolink.h>
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
+#include <config/command_mgr.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp4/dhcp4_srv.h>
 
@@ -169,12 +170,16 @@ private:
     /// @brief handler for processing 'get-config' command
     ///
     /// This handler processes get-config command, which retrieves
-    /// the current configuration and returns it in response.
+    /// the current configuration and returns it in response. The
+    /// configuration is converted to JSON right away, while the response
+    /// may be serialized and sent by the worker thread of the command
+    /// manager.
     ///
     /// @param command (ignored)
     /// @param args (ignored)
-    /// @return current configuration wrapped in a response
-    isc::data::ConstElementPtr
+    /// @return function returning the current configuration wrapped in a
+    /// response
+    isc::config::CommandMgr::ResponseGenerator
     commandConfigGetHandler(const std::string& command,
                             isc::data::ConstElementPtr args);
 
@@ -188,13 +193,28 @@ private:
     /// always relative and .. is not allowed in the filename. This is
     /// a security measure against exploiting file writes remotely.
     ///
+    /// The arguments are checked and the configuration is converted to
+    /// JSON right away, while the configuration is written by the returned
+    /// function, which may be called by the worker thread of the command
+    /// manager.
+    ///
     /// @param command (ignored)
     /// @param args may contain optional string argument filename
-    /// @return status of the configuration file write
-    isc::data::ConstElementPtr
+    /// @return function returning the status of the configuration file write
+    isc::config::CommandMgr::ResponseGenerator
     commandConfigWriteHandler(const std::string& command,
                               isc::data::ConstElementPtr args);
 
+    /// @brief Writes the configuration and returns the response to
+    /// 'config-write' command
+    ///
+    /// @param filename name of the file to write the configuration to
+    /// @param cfg configuration to be written, converted to JSON
+    /// @return status of the configuration file write
+    isc::data::ConstElementPtr
+    configWriteResponse(const std::string& filename,
+                        const isc::data::ConstElementPtr& cfg) const;
+
     /// @brief handler for processing 'config-set' command
     ///
     /// This handler processes config-set command, which processes
@@ -265,6 +285,25 @@ private:
     commandLeasesReclaimHandler(const std::string& command,
                                 isc::data::ConstElementPtr args);
 
+    /// @brief Handler for processing 'lease4-get-page' command
+    ///
+    /// This handler returns a page of the IPv4 leases belonging to
+    /// a subnet, in the ascending order of their addresses. A relay or
+    /// a CMTS rebuilding its lease table walks the subnet by sending the
+    /// address of the last lease of the previous page as "from", until
+    /// an empty page is returned.
+    ///
+    /// @param command (parameter ignored)
+    /// @param args arguments map { "subnet-id": <integer>,
+    ///        "limit": <integer>, "from": <string> }, where "from" is
+    ///        "start" (default) or the address after which the page starts.
+    ///
+    /// @return status of the command with the "leases" list and the
+    ///         "count" of the returned leases.
+    isc::data::ConstElementPtr
+    commandLease4GetPageHandler(const std::string& command,
+                                 isc::data::ConstElementPtr args);
+
     /// @brief Reclaims expired IPv4 leases and reschedules timer.
     ///
     /// This is a wrapper method for @c AllocEngine::reclaimExpiredLeases4.
@@ -1368,9 +1368,9 @@ static const flex_int16_t yy_rule_linenum[147] =
 
      1014, 1023, 1032, 1041, 1050, 1059, 1068, 1077, 1086, 1095,
      1105, 1115, 1125, 1135, 1145, 1155, 1165, 1175, 1185, 1194,
-     1203, 1212, 1221, 1230, 1240, 1250, 1262, 1273, 1286, 1384,
-     1389, 1394, 1399, 1400, 1401, 1402, 1403, 1404, 1406, 1424,
-     1437, 1442, 1446, 1448, 1450, 1452
+     1203, 1212, 1221, 1230, 1240, 1250, 1262, 1273, 1286, 1425,
+     1430, 1435, 1440, 1441, 1442, 1443, 1444, 1445, 1447, 1465,
+     1478, 1483, 1487, 1489, 1491, 1493
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -3485,13 +3485,54 @@ YY_RULE_SETUP
         }
     }
 
+    // Keywords which have no rule of their own above are recognized here,
+    // from the decoded string, in the context they belong to.
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::INTERFACES_CONFIG:
+        if (decoded == "receive-ring") {
+            return isc::dhcp::Dhcp4Parser::make_RECEIVE_RING(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::CONTROL_SOCKET:
+        if (decoded == "background-commands") {
+            return isc::dhcp::Dhcp4Parser::make_BACKGROUND_COMMANDS(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::SUBNET4:
+        if (decoded == "cache-threshold") {
+            return isc::dhcp::Dhcp4Parser::make_CACHE_THRESHOLD(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::DHCP4:
+        if (decoded == "response-cache-ttl") {
+            return isc::dhcp::Dhcp4Parser::make_RESPONSE_CACHE_TTL(driver.loc_);
+        }
+        if (decoded == "receive-queue") {
+            return isc::dhcp::Dhcp4Parser::make_RECEIVE_QUEUE(driver.loc_);
+        }
+        if (decoded == "rate-limit") {
+            return isc::dhcp::Dhcp4Parser::make_RATE_LIMIT(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        if (decoded == "load-threads") {
+            return isc::dhcp::Dhcp4Parser::make_LOAD_THREADS(driver.loc_);
+        }
+        if (decoded == "lfc-max-leases") {
+            return isc::dhcp::Dhcp4Parser::make_LFC_MAX_LEASES(driver.loc_);
+        }
+        break;
+    default:
+        break;
+    }
+
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
 case 130:
 /* rule 130 can match eol */
 YY_RULE_SETUP
-#line 1384 "dhcp4_lexer.ll"
+#line 1425 "dhcp4_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
@@ -3500,7 +3541,7 @@ YY_RULE_SETUP
 case 131:
 /* rule 131 can match eol */
 YY_RULE_SETUP
-#line 1389 "dhcp4_lexer.ll"
+#line 1430 "dhcp4_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
@@ -3508,7 +3549,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
-#line 1394 "dhcp4_lexer.ll"
+#line 1435 "dhcp4_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
@@ -3516,37 +3557,37 @@ YY_RULE_SETUP
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
-#line 1399 "dhcp4_lexer.ll"
+#line 1440 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
-#line 1400 "dhcp4_lexer.ll"
+#line 1441 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
-#line 1401 "dhcp4_lexer.ll"
+#line 1442 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
-#line 1402 "dhcp4_lexer.ll"
+#line 1443 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
-#line 1403 "dhcp4_lexer.ll"
+#line 1444 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
-#line 1404 "dhcp4_lexer.ll"
+#line 1445 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
-#line 1406 "dhcp4_lexer.ll"
+#line 1447 "dhcp4_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -3567,7 +3608,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
-#line 1424 "dhcp4_lexer.ll"
+#line 1465 "dhcp4_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -3583,7 +3624,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
-#line 1437 "dhcp4_lexer.ll"
+#line 1478 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
@@ -3591,33 +3632,33 @@ YY_RULE_SETUP
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
-#line 1442 "dhcp4_lexer.ll"
+#line 1483 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
-#line 1446 "dhcp4_lexer.ll"
+#line 1487 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
-#line 1448 "dhcp4_lexer.ll"
+#line 1489 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
-#line 1450 "dhcp4_lexer.ll"
+#line 1491 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
-#line 1452 "dhcp4_lexer.ll"
+#line 1493 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1454 "dhcp4_lexer.ll"
+#line 1495 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -3643,10 +3684,10 @@ case YY_STATE_EOF(INITIAL):
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
-#line 1477 "dhcp4_lexer.ll"
+#line 1518 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 3649 "dhcp4_lexer.cc"
+#line 3690 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4747,7 +4788,7 @@ void parser4_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1477 "dhcp4_lexer.ll"
+#line 1518 "dhcp4_lexer.ll"
 
 
 using namespace isc::dhcp;
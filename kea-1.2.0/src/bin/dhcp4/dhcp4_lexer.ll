@@ -1377,6 +1377,47 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
         }
     }
 
+    // Keywords which have no rule of their own above are recognized here,
+    // from the decoded string, in the context they belong to.
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::INTERFACES_CONFIG:
+        if (decoded == "receive-ring") {
+            return isc::dhcp::Dhcp4Parser::make_RECEIVE_RING(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::CONTROL_SOCKET:
+        if (decoded == "background-commands") {
+            return isc::dhcp::Dhcp4Parser::make_BACKGROUND_COMMANDS(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::SUBNET4:
+        if (decoded == "cache-threshold") {
+            return isc::dhcp::Dhcp4Parser::make_CACHE_THRESHOLD(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::DHCP4:
+        if (decoded == "response-cache-ttl") {
+            return isc::dhcp::Dhcp4Parser::make_RESPONSE_CACHE_TTL(driver.loc_);
+        }
+        if (decoded == "receive-queue") {
+            return isc::dhcp::Dhcp4Parser::make_RECEIVE_QUEUE(driver.loc_);
+        }
+        if (decoded == "rate-limit") {
+            return isc::dhcp::Dhcp4Parser::make_RATE_LIMIT(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+        if (decoded == "load-threads") {
+            return isc::dhcp::Dhcp4Parser::make_LOAD_THREADS(driver.loc_);
+        }
+        if (decoded == "lfc-max-leases") {
+            return isc::dhcp::Dhcp4Parser::make_LFC_MAX_LEASES(driver.loc_);
+        }
+        break;
+    default:
+        break;
+    }
+
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 
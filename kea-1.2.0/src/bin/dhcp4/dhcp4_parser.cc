@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   parser4_lex
 
-// First part of user declarations.
-
-#line 39 "dhcp4_parser.cc" // lalr1.cc:404
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "dhcp4_parser.h"
 
-// User implementation prologue.
 
-#line 53 "dhcp4_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "dhcp4_parser.yy" // lalr1.cc:413
+#line 34 "dhcp4_parser.yy"
 
 #include <dhcp4/parser_context.h>
 
-#line 59 "dhcp4_parser.cc" // lalr1.cc:413
+#line 52 "dhcp4_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER4_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER4_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !PARSER4_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:479
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 145 "dhcp4_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp4Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp4_parser.cc"
 
   /// Build a parser object.
   Dhcp4Parser::Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg)
-    :
 #if PARSER4_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::~Dhcp4Parser ()
   {}
 
+  Dhcp4Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  Dhcp4Parser::by_state::by_state ()
+  Dhcp4Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  Dhcp4Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp4Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  Dhcp4Parser::by_state::clear ()
+  Dhcp4Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   Dhcp4Parser::by_state::move (by_state& that)
   {
@@ -227,55 +188,90 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  inline
-  Dhcp4Parser::by_state::by_state (state_type s)
+  Dhcp4Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  Dhcp4Parser::symbol_number_type
-  Dhcp4Parser::by_state::type_get () const
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   Dhcp4Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  Dhcp4Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
+
+  Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
-    {
-      case 152: // value
-      case 156: // map_value
-      case 194: // socket_type
-      case 203: // db_type
-      case 411: // ncr_protocol_value
-      case 419: // replace_client_name_value
-        value.move< ElementPtr > (that.value);
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 138: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 137: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 136: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 135: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -283,38 +279,38 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   Dhcp4Parser::stack_symbol_type&
   Dhcp4Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
-    {
-      case 152: // value
-      case 156: // map_value
-      case 194: // socket_type
-      case 203: // db_type
-      case 411: // ncr_protocol_value
-      case 419: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 138: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 137: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 136: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 135: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -326,9 +322,49 @@ namespace isc { namespace dhcp {
     return *this;
   }
 
+  Dhcp4Parser::stack_symbol_type&
+  Dhcp4Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   Dhcp4Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -339,119 +375,109 @@ namespace isc { namespace dhcp {
 #if PARSER4_DEBUG
   template <typename Base>
   void
-  Dhcp4Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp4Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 135: // "constant string"
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 362 "dhcp4_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 396 "dhcp4_parser.cc"
         break;
 
-      case 136: // "integer"
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 369 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 402 "dhcp4_parser.cc"
         break;
 
-      case 137: // "floating point"
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 376 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 408 "dhcp4_parser.cc"
         break;
 
-      case 138: // "boolean"
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 383 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 414 "dhcp4_parser.cc"
         break;
 
-      case 152: // value
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 390 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "dhcp4_parser.cc"
         break;
 
-      case 156: // map_value
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 397 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_map_value: // map_value
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 426 "dhcp4_parser.cc"
         break;
 
-      case 194: // socket_type
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 404 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_socket_type: // socket_type
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 432 "dhcp4_parser.cc"
         break;
 
-      case 203: // db_type
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 411 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_db_type: // db_type
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 438 "dhcp4_parser.cc"
         break;
 
-      case 411: // ncr_protocol_value
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 418 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 444 "dhcp4_parser.cc"
         break;
 
-      case 419: // replace_client_name_value
-
-#line 210 "dhcp4_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 425 "dhcp4_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 218 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 450 "dhcp4_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  Dhcp4Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  Dhcp4Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  Dhcp4Parser::yypush_ (const char* m, stack_symbol_type& s)
+  Dhcp4Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  Dhcp4Parser::yypop_ (unsigned int n)
+  Dhcp4Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -483,32 +509,37 @@ namespace isc { namespace dhcp {
   }
 #endif // PARSER4_DEBUG
 
-  inline Dhcp4Parser::state_type
+  Dhcp4Parser::state_type
   Dhcp4Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  Dhcp4Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   Dhcp4Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -526,11 +557,11 @@ namespace isc { namespace dhcp {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -538,48 +569,70 @@ namespace isc { namespace dhcp {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -596,54 +649,56 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
-    {
-      case 152: // value
-      case 156: // map_value
-      case 194: // socket_type
-      case 203: // db_type
-      case 411: // ncr_protocol_value
-      case 419: // replace_client_name_value
-        yylhs.value.build< ElementPtr > ();
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 138: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 137: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 136: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 135: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -651,286 +706,289 @@ namespace isc { namespace dhcp {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 219 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 670 "dhcp4_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 227 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 728 "dhcp4_parser.cc"
     break;
 
-  case 4:
-#line 220 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 676 "dhcp4_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 228 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 734 "dhcp4_parser.cc"
     break;
 
-  case 6:
-#line 221 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP4; }
-#line 682 "dhcp4_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 229 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP4; }
+#line 740 "dhcp4_parser.cc"
     break;
 
-  case 8:
-#line 222 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 688 "dhcp4_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 230 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 746 "dhcp4_parser.cc"
     break;
 
-  case 10:
-#line 223 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.SUBNET4; }
-#line 694 "dhcp4_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 231 "dhcp4_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET4; }
+#line 752 "dhcp4_parser.cc"
     break;
 
-  case 12:
-#line 224 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.POOLS; }
-#line 700 "dhcp4_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 232 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 758 "dhcp4_parser.cc"
     break;
 
-  case 14:
-#line 225 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 706 "dhcp4_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 233 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 764 "dhcp4_parser.cc"
     break;
 
-  case 16:
-#line 226 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 712 "dhcp4_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 234 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 770 "dhcp4_parser.cc"
     break;
 
-  case 18:
-#line 227 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 718 "dhcp4_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 235 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 776 "dhcp4_parser.cc"
     break;
 
-  case 20:
-#line 228 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 724 "dhcp4_parser.cc" // lalr1.cc:859
+  case 20: // $@10: %empty
+#line 236 "dhcp4_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 782 "dhcp4_parser.cc"
     break;
 
-  case 22:
-#line 229 "dhcp4_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 730 "dhcp4_parser.cc" // lalr1.cc:859
+  case 22: // $@11: %empty
+#line 237 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 788 "dhcp4_parser.cc"
     break;
 
-  case 24:
-#line 237 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 736 "dhcp4_parser.cc" // lalr1.cc:859
+  case 24: // value: "integer"
+#line 245 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 794 "dhcp4_parser.cc"
     break;
 
-  case 25:
-#line 238 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 742 "dhcp4_parser.cc" // lalr1.cc:859
+  case 25: // value: "floating point"
+#line 246 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 800 "dhcp4_parser.cc"
     break;
 
-  case 26:
-#line 239 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 748 "dhcp4_parser.cc" // lalr1.cc:859
+  case 26: // value: "boolean"
+#line 247 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 806 "dhcp4_parser.cc"
     break;
 
-  case 27:
-#line 240 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 754 "dhcp4_parser.cc" // lalr1.cc:859
+  case 27: // value: "constant string"
+#line 248 "dhcp4_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 812 "dhcp4_parser.cc"
     break;
 
-  case 28:
-#line 241 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 760 "dhcp4_parser.cc" // lalr1.cc:859
+  case 28: // value: "null"
+#line 249 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 818 "dhcp4_parser.cc"
     break;
 
-  case 29:
-#line 242 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 766 "dhcp4_parser.cc" // lalr1.cc:859
+  case 29: // value: map2
+#line 250 "dhcp4_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 824 "dhcp4_parser.cc"
     break;
 
-  case 30:
-#line 243 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 772 "dhcp4_parser.cc" // lalr1.cc:859
+  case 30: // value: list_generic
+#line 251 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 830 "dhcp4_parser.cc"
     break;
 
-  case 31:
-#line 246 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 31: // sub_json: value
+#line 254 "dhcp4_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 781 "dhcp4_parser.cc" // lalr1.cc:859
+#line 839 "dhcp4_parser.cc"
     break;
 
-  case 32:
-#line 251 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 32: // $@12: %empty
+#line 259 "dhcp4_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 792 "dhcp4_parser.cc" // lalr1.cc:859
+#line 850 "dhcp4_parser.cc"
     break;
 
-  case 33:
-#line 256 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 33: // map2: "{" $@12 map_content "}"
+#line 264 "dhcp4_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 802 "dhcp4_parser.cc" // lalr1.cc:859
+#line 860 "dhcp4_parser.cc"
     break;
 
-  case 34:
-#line 262 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 808 "dhcp4_parser.cc" // lalr1.cc:859
+  case 34: // map_value: map2
+#line 270 "dhcp4_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 866 "dhcp4_parser.cc"
     break;
 
-  case 37:
-#line 269 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 37: // not_empty_map: "constant string" ":" value
+#line 277 "dhcp4_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 817 "dhcp4_parser.cc" // lalr1.cc:859
+#line 875 "dhcp4_parser.cc"
     break;
 
-  case 38:
-#line 273 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 38: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 281 "dhcp4_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 827 "dhcp4_parser.cc" // lalr1.cc:859
+#line 885 "dhcp4_parser.cc"
     break;
 
-  case 39:
-#line 280 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 39: // $@13: %empty
+#line 288 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 836 "dhcp4_parser.cc" // lalr1.cc:859
+#line 894 "dhcp4_parser.cc"
     break;
 
-  case 40:
-#line 283 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 40: // list_generic: "[" $@13 list_content "]"
+#line 291 "dhcp4_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 844 "dhcp4_parser.cc" // lalr1.cc:859
+#line 902 "dhcp4_parser.cc"
     break;
 
-  case 43:
-#line 291 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 43: // not_empty_list: value
+#line 299 "dhcp4_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 853 "dhcp4_parser.cc" // lalr1.cc:859
+#line 911 "dhcp4_parser.cc"
     break;
 
-  case 44:
-#line 295 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 44: // not_empty_list: not_empty_list "," value
+#line 303 "dhcp4_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 862 "dhcp4_parser.cc" // lalr1.cc:859
+#line 920 "dhcp4_parser.cc"
     break;
 
-  case 45:
-#line 302 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 45: // $@14: %empty
+#line 310 "dhcp4_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 870 "dhcp4_parser.cc" // lalr1.cc:859
+#line 928 "dhcp4_parser.cc"
     break;
 
-  case 46:
-#line 304 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 46: // list_strings: "[" $@14 list_strings_content "]"
+#line 312 "dhcp4_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 879 "dhcp4_parser.cc" // lalr1.cc:859
+#line 937 "dhcp4_parser.cc"
     break;
 
-  case 49:
-#line 313 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 49: // not_empty_list_strings: "constant string"
+#line 321 "dhcp4_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 888 "dhcp4_parser.cc" // lalr1.cc:859
+#line 946 "dhcp4_parser.cc"
     break;
 
-  case 50:
-#line 317 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 50: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 325 "dhcp4_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 897 "dhcp4_parser.cc" // lalr1.cc:859
+#line 955 "dhcp4_parser.cc"
     break;
 
-  case 51:
-#line 328 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 51: // unknown_map_entry: "constant string" ":"
+#line 336 "dhcp4_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 908 "dhcp4_parser.cc" // lalr1.cc:859
+#line 966 "dhcp4_parser.cc"
     break;
 
-  case 52:
-#line 338 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 52: // $@15: %empty
+#line 346 "dhcp4_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 919 "dhcp4_parser.cc" // lalr1.cc:859
+#line 977 "dhcp4_parser.cc"
     break;
 
-  case 53:
-#line 343 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 53: // syntax_map: "{" $@15 global_objects "}"
+#line 351 "dhcp4_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 929 "dhcp4_parser.cc" // lalr1.cc:859
+#line 987 "dhcp4_parser.cc"
     break;
 
-  case 61:
-#line 362 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 61: // $@16: %empty
+#line 370 "dhcp4_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -938,677 +996,747 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP4);
 }
-#line 942 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1000 "dhcp4_parser.cc"
     break;
 
-  case 62:
-#line 369 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 62: // dhcp4_object: "Dhcp4" $@16 ":" "{" global_params "}"
+#line 377 "dhcp4_parser.yy"
+                                                    {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 954 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1012 "dhcp4_parser.cc"
     break;
 
-  case 63:
-#line 379 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 63: // $@17: %empty
+#line 387 "dhcp4_parser.yy"
+                          {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 964 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1022 "dhcp4_parser.cc"
     break;
 
-  case 64:
-#line 383 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 64: // sub_dhcp4: "{" $@17 global_params "}"
+#line 391 "dhcp4_parser.yy"
+                               {
     // parsing completed
 }
-#line 972 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1030 "dhcp4_parser.cc"
     break;
 
-  case 88:
-#line 416 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 91: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 427 "dhcp4_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 981 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1039 "dhcp4_parser.cc"
     break;
 
-  case 89:
-#line 421 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 92: // renew_timer: "renew-timer" ":" "integer"
+#line 432 "dhcp4_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 990 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1048 "dhcp4_parser.cc"
     break;
 
-  case 90:
-#line 426 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 93: // rebind_timer: "rebind-timer" ":" "integer"
+#line 437 "dhcp4_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 999 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1057 "dhcp4_parser.cc"
     break;
 
-  case 91:
-#line 431 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 94: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 442 "dhcp4_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1008 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1066 "dhcp4_parser.cc"
     break;
 
-  case 92:
-#line 436 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr echo(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 95: // response_cache_ttl: "response-cache-ttl" ":" "integer"
+#line 447 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr ttl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("response-cache-ttl", ttl);
+}
+#line 1075 "dhcp4_parser.cc"
+    break;
+
+  case 96: // $@18: %empty
+#line 454 "dhcp4_parser.yy"
+                             {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1083 "dhcp4_parser.cc"
+    break;
+
+  case 97: // receive_queue: "receive-queue" $@18 ":" map_value
+#line 456 "dhcp4_parser.yy"
+                  {
+    ctx.stack_.back()->set("receive-queue", yystack_[0].value.as < ElementPtr > ());
+    ctx.leave();
+}
+#line 1092 "dhcp4_parser.cc"
+    break;
+
+  case 98: // $@19: %empty
+#line 462 "dhcp4_parser.yy"
+                       {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1100 "dhcp4_parser.cc"
+    break;
+
+  case 99: // rate_limit: "rate-limit" $@19 ":" map_value
+#line 464 "dhcp4_parser.yy"
+                  {
+    ctx.stack_.back()->set("rate-limit", yystack_[0].value.as < ElementPtr > ());
+    ctx.leave();
+}
+#line 1109 "dhcp4_parser.cc"
+    break;
+
+  case 100: // echo_client_id: "echo-client-id" ":" "boolean"
+#line 469 "dhcp4_parser.yy"
+                                             {
+    ElementPtr echo(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
 }
-#line 1017 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1118 "dhcp4_parser.cc"
     break;
 
-  case 93:
-#line 441 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr match(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 101: // match_client_id: "match-client-id" ":" "boolean"
+#line 474 "dhcp4_parser.yy"
+                                               {
+    ElementPtr match(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
 }
-#line 1026 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1127 "dhcp4_parser.cc"
     break;
 
-  case 94:
-#line 447 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 102: // $@20: %empty
+#line 480 "dhcp4_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1037 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1138 "dhcp4_parser.cc"
     break;
 
-  case 95:
-#line 452 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 103: // interfaces_config: "interfaces-config" $@20 ":" "{" interfaces_config_params "}"
+#line 485 "dhcp4_parser.yy"
+                                                               {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1046 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1147 "dhcp4_parser.cc"
     break;
 
-  case 100:
-#line 465 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 109: // $@21: %empty
+#line 499 "dhcp4_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1056 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1157 "dhcp4_parser.cc"
     break;
 
-  case 101:
-#line 469 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 110: // sub_interfaces4: "{" $@21 interfaces_config_params "}"
+#line 503 "dhcp4_parser.yy"
+                                          {
     // parsing completed
 }
-#line 1064 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1165 "dhcp4_parser.cc"
     break;
 
-  case 102:
-#line 473 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 111: // $@22: %empty
+#line 507 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1075 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1176 "dhcp4_parser.cc"
     break;
 
-  case 103:
-#line 478 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 112: // interfaces_list: "interfaces" $@22 ":" list_strings
+#line 512 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1084 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1185 "dhcp4_parser.cc"
     break;
 
-  case 104:
-#line 483 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 113: // $@23: %empty
+#line 517 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
-#line 1092 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1193 "dhcp4_parser.cc"
     break;
 
-  case 105:
-#line 485 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as< ElementPtr > ());
+  case 114: // dhcp_socket_type: "dhcp-socket-type" $@23 ":" socket_type
+#line 519 "dhcp4_parser.yy"
+                    {
+    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1101 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1202 "dhcp4_parser.cc"
     break;
 
-  case 106:
-#line 490 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
-#line 1107 "dhcp4_parser.cc" // lalr1.cc:859
+  case 115: // socket_type: "raw"
+#line 524 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
+#line 1208 "dhcp4_parser.cc"
     break;
 
-  case 107:
-#line 491 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
-#line 1113 "dhcp4_parser.cc" // lalr1.cc:859
+  case 116: // socket_type: "udp"
+#line 525 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
+#line 1214 "dhcp4_parser.cc"
     break;
 
-  case 108:
-#line 494 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 117: // receive_ring: "receive-ring" ":" "boolean"
+#line 528 "dhcp4_parser.yy"
+                                         {
+    ElementPtr ring(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("receive-ring", ring);
+}
+#line 1223 "dhcp4_parser.cc"
+    break;
+
+  case 118: // $@24: %empty
+#line 533 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1124 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1234 "dhcp4_parser.cc"
     break;
 
-  case 109:
-#line 499 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 119: // lease_database: "lease-database" $@24 ":" "{" database_map_params "}"
+#line 538 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1133 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1243 "dhcp4_parser.cc"
     break;
 
-  case 110:
-#line 504 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 120: // $@25: %empty
+#line 543 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1144 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1254 "dhcp4_parser.cc"
     break;
 
-  case 111:
-#line 509 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 121: // hosts_database: "hosts-database" $@25 ":" "{" database_map_params "}"
+#line 548 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1153 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1263 "dhcp4_parser.cc"
     break;
 
-  case 127:
-#line 533 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 139: // $@26: %empty
+#line 574 "dhcp4_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1161 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1271 "dhcp4_parser.cc"
     break;
 
-  case 128:
-#line 535 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 140: // database_type: "type" $@26 ":" db_type
+#line 576 "dhcp4_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1170 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1280 "dhcp4_parser.cc"
     break;
 
-  case 129:
-#line 540 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1176 "dhcp4_parser.cc" // lalr1.cc:859
+  case 141: // db_type: "memfile"
+#line 581 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1286 "dhcp4_parser.cc"
     break;
 
-  case 130:
-#line 541 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1182 "dhcp4_parser.cc" // lalr1.cc:859
+  case 142: // db_type: "mysql"
+#line 582 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1292 "dhcp4_parser.cc"
     break;
 
-  case 131:
-#line 542 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1188 "dhcp4_parser.cc" // lalr1.cc:859
+  case 143: // db_type: "postgresql"
+#line 583 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1298 "dhcp4_parser.cc"
     break;
 
-  case 132:
-#line 543 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1194 "dhcp4_parser.cc" // lalr1.cc:859
+  case 144: // db_type: "cql"
+#line 584 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1304 "dhcp4_parser.cc"
     break;
 
-  case 133:
-#line 546 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 145: // $@27: %empty
+#line 587 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1202 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1312 "dhcp4_parser.cc"
     break;
 
-  case 134:
-#line 548 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 146: // user: "user" $@27 ":" "constant string"
+#line 589 "dhcp4_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1212 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1322 "dhcp4_parser.cc"
     break;
 
-  case 135:
-#line 554 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 147: // $@28: %empty
+#line 595 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1220 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1330 "dhcp4_parser.cc"
     break;
 
-  case 136:
-#line 556 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 148: // password: "password" $@28 ":" "constant string"
+#line 597 "dhcp4_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1230 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1340 "dhcp4_parser.cc"
     break;
 
-  case 137:
-#line 562 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 149: // $@29: %empty
+#line 603 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1238 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1348 "dhcp4_parser.cc"
     break;
 
-  case 138:
-#line 564 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 150: // host: "host" $@29 ":" "constant string"
+#line 605 "dhcp4_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1248 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1358 "dhcp4_parser.cc"
     break;
 
-  case 139:
-#line 570 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 151: // port: "port" ":" "integer"
+#line 611 "dhcp4_parser.yy"
+                         {
+    ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1257 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1367 "dhcp4_parser.cc"
     break;
 
-  case 140:
-#line 575 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 152: // $@30: %empty
+#line 616 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1265 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1375 "dhcp4_parser.cc"
     break;
 
-  case 141:
-#line 577 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 153: // name: "name" $@30 ":" "constant string"
+#line 618 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1275 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1385 "dhcp4_parser.cc"
     break;
 
-  case 142:
-#line 583 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 154: // persist: "persist" ":" "boolean"
+#line 624 "dhcp4_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1284 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1394 "dhcp4_parser.cc"
     break;
 
-  case 143:
-#line 588 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 155: // lfc_interval: "lfc-interval" ":" "integer"
+#line 629 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1293 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1403 "dhcp4_parser.cc"
     break;
 
-  case 144:
-#line 593 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 156: // load_threads: "load-threads" ":" "integer"
+#line 634 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("load-threads", n);
+}
+#line 1412 "dhcp4_parser.cc"
+    break;
+
+  case 157: // lfc_max_leases: "lfc-max-leases" ":" "integer"
+#line 639 "dhcp4_parser.yy"
+                                             {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-max-leases", n);
+}
+#line 1421 "dhcp4_parser.cc"
+    break;
+
+  case 158: // readonly: "readonly" ":" "boolean"
+#line 644 "dhcp4_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1302 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1430 "dhcp4_parser.cc"
     break;
 
-  case 145:
-#line 598 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 159: // connect_timeout: "connect-timeout" ":" "integer"
+#line 649 "dhcp4_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1311 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1439 "dhcp4_parser.cc"
     break;
 
-  case 146:
-#line 603 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 160: // $@31: %empty
+#line 654 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1319 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1447 "dhcp4_parser.cc"
     break;
 
-  case 147:
-#line 605 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 161: // contact_points: "contact-points" $@31 ":" "constant string"
+#line 656 "dhcp4_parser.yy"
+               {
+    ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1329 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1457 "dhcp4_parser.cc"
     break;
 
-  case 148:
-#line 611 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 162: // $@32: %empty
+#line 662 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1337 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1465 "dhcp4_parser.cc"
     break;
 
-  case 149:
-#line 613 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 163: // keyspace: "keyspace" $@32 ":" "constant string"
+#line 664 "dhcp4_parser.yy"
+               {
+    ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1347 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1475 "dhcp4_parser.cc"
     break;
 
-  case 150:
-#line 620 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 164: // $@33: %empty
+#line 671 "dhcp4_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1358 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1486 "dhcp4_parser.cc"
     break;
 
-  case 151:
-#line 625 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 165: // host_reservation_identifiers: "host-reservation-identifiers" $@33 ":" "[" host_reservation_identifiers_list "]"
+#line 676 "dhcp4_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1367 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1495 "dhcp4_parser.cc"
     break;
 
-  case 159:
-#line 641 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 173: // duid_id: "duid"
+#line 692 "dhcp4_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1376 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1504 "dhcp4_parser.cc"
     break;
 
-  case 160:
-#line 646 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 174: // hw_address_id: "hw-address"
+#line 697 "dhcp4_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1385 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1513 "dhcp4_parser.cc"
     break;
 
-  case 161:
-#line 651 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 175: // circuit_id: "circuit-id"
+#line 702 "dhcp4_parser.yy"
+                        {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1394 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1522 "dhcp4_parser.cc"
     break;
 
-  case 162:
-#line 656 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 176: // client_id: "client-id"
+#line 707 "dhcp4_parser.yy"
+                      {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1403 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1531 "dhcp4_parser.cc"
     break;
 
-  case 163:
-#line 661 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 177: // flex_id: "flex-id"
+#line 712 "dhcp4_parser.yy"
+                 {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1412 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1540 "dhcp4_parser.cc"
     break;
 
-  case 164:
-#line 666 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 178: // $@34: %empty
+#line 717 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1423 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1551 "dhcp4_parser.cc"
     break;
 
-  case 165:
-#line 671 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 179: // hooks_libraries: "hooks-libraries" $@34 ":" "[" hooks_libraries_list "]"
+#line 722 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1432 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1560 "dhcp4_parser.cc"
     break;
 
-  case 170:
-#line 684 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 184: // $@35: %empty
+#line 735 "dhcp4_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1442 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1570 "dhcp4_parser.cc"
     break;
 
-  case 171:
-#line 688 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 185: // hooks_library: "{" $@35 hooks_params "}"
+#line 739 "dhcp4_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1450 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1578 "dhcp4_parser.cc"
     break;
 
-  case 172:
-#line 692 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 186: // $@36: %empty
+#line 743 "dhcp4_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1460 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1588 "dhcp4_parser.cc"
     break;
 
-  case 173:
-#line 696 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 187: // sub_hooks_library: "{" $@36 hooks_params "}"
+#line 747 "dhcp4_parser.yy"
+                              {
     // parsing completed
 }
-#line 1468 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1596 "dhcp4_parser.cc"
     break;
 
-  case 179:
-#line 709 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 193: // $@37: %empty
+#line 760 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1476 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1604 "dhcp4_parser.cc"
     break;
 
-  case 180:
-#line 711 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 194: // library: "library" $@37 ":" "constant string"
+#line 762 "dhcp4_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1486 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1614 "dhcp4_parser.cc"
     break;
 
-  case 181:
-#line 717 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 195: // $@38: %empty
+#line 768 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1494 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1622 "dhcp4_parser.cc"
     break;
 
-  case 182:
-#line 719 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 196: // parameters: "parameters" $@38 ":" value
+#line 770 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1503 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1631 "dhcp4_parser.cc"
     break;
 
-  case 183:
-#line 725 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 197: // $@39: %empty
+#line 776 "dhcp4_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1514 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1642 "dhcp4_parser.cc"
     break;
 
-  case 184:
-#line 730 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 198: // expired_leases_processing: "expired-leases-processing" $@39 ":" "{" expired_leases_params "}"
+#line 781 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1523 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1651 "dhcp4_parser.cc"
     break;
 
-  case 193:
-#line 747 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 207: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 798 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1532 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1660 "dhcp4_parser.cc"
     break;
 
-  case 194:
-#line 752 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 208: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 803 "dhcp4_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1541 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1669 "dhcp4_parser.cc"
     break;
 
-  case 195:
-#line 757 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 209: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 808 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1550 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1678 "dhcp4_parser.cc"
     break;
 
-  case 196:
-#line 762 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 210: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 813 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1559 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1687 "dhcp4_parser.cc"
     break;
 
-  case 197:
-#line 767 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 211: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 818 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1568 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1696 "dhcp4_parser.cc"
     break;
 
-  case 198:
-#line 772 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 212: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 823 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1577 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1705 "dhcp4_parser.cc"
     break;
 
-  case 199:
-#line 780 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 213: // $@40: %empty
+#line 831 "dhcp4_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 1588 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1716 "dhcp4_parser.cc"
     break;
 
-  case 200:
-#line 785 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 214: // subnet4_list: "subnet4" $@40 ":" "[" subnet4_list_content "]"
+#line 836 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1597 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1725 "dhcp4_parser.cc"
     break;
 
-  case 205:
-#line 805 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 219: // $@41: %empty
+#line 856 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1607 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1735 "dhcp4_parser.cc"
     break;
 
-  case 206:
-#line 809 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 220: // subnet4: "{" $@41 subnet4_params "}"
+#line 860 "dhcp4_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1626,1425 +1754,1447 @@ namespace isc { namespace dhcp {
     // }
     ctx.stack_.pop_back();
 }
-#line 1630 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1758 "dhcp4_parser.cc"
     break;
 
-  case 207:
-#line 828 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 221: // $@42: %empty
+#line 879 "dhcp4_parser.yy"
+                            {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1640 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1768 "dhcp4_parser.cc"
     break;
 
-  case 208:
-#line 832 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 222: // sub_subnet4: "{" $@42 subnet4_params "}"
+#line 883 "dhcp4_parser.yy"
+                                {
     // parsing completed
 }
-#line 1648 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1776 "dhcp4_parser.cc"
     break;
 
-  case 231:
-#line 864 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 246: // $@43: %empty
+#line 916 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1656 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1784 "dhcp4_parser.cc"
     break;
 
-  case 232:
-#line 866 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 247: // subnet: "subnet" $@43 ":" "constant string"
+#line 918 "dhcp4_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1666 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1794 "dhcp4_parser.cc"
     break;
 
-  case 233:
-#line 872 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 248: // $@44: %empty
+#line 924 "dhcp4_parser.yy"
+                                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1674 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1802 "dhcp4_parser.cc"
     break;
 
-  case 234:
-#line 874 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 249: // subnet_4o6_interface: "4o6-interface" $@44 ":" "constant string"
+#line 926 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 1684 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1812 "dhcp4_parser.cc"
     break;
 
-  case 235:
-#line 880 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 250: // $@45: %empty
+#line 932 "dhcp4_parser.yy"
+                                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1692 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1820 "dhcp4_parser.cc"
     break;
 
-  case 236:
-#line 882 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 251: // subnet_4o6_interface_id: "4o6-interface-id" $@45 ":" "constant string"
+#line 934 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 1702 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1830 "dhcp4_parser.cc"
     break;
 
-  case 237:
-#line 888 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 252: // $@46: %empty
+#line 940 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1710 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1838 "dhcp4_parser.cc"
     break;
 
-  case 238:
-#line 890 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 253: // subnet_4o6_subnet: "4o6-subnet" $@46 ":" "constant string"
+#line 942 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 1720 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1848 "dhcp4_parser.cc"
     break;
 
-  case 239:
-#line 896 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 254: // $@47: %empty
+#line 948 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1728 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1856 "dhcp4_parser.cc"
     break;
 
-  case 240:
-#line 898 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 255: // interface: "interface" $@47 ":" "constant string"
+#line 950 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1738 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1866 "dhcp4_parser.cc"
     break;
 
-  case 241:
-#line 904 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 256: // $@48: %empty
+#line 956 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1746 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1874 "dhcp4_parser.cc"
     break;
 
-  case 242:
-#line 906 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 257: // interface_id: "interface-id" $@48 ":" "constant string"
+#line 958 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1756 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1884 "dhcp4_parser.cc"
     break;
 
-  case 243:
-#line 912 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 258: // $@49: %empty
+#line 964 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1764 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1892 "dhcp4_parser.cc"
     break;
 
-  case 244:
-#line 914 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 259: // client_class: "client-class" $@49 ":" "constant string"
+#line 966 "dhcp4_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1774 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1902 "dhcp4_parser.cc"
     break;
 
-  case 245:
-#line 920 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 260: // $@50: %empty
+#line 972 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1782 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1910 "dhcp4_parser.cc"
     break;
 
-  case 246:
-#line 922 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rm(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 261: // reservation_mode: "reservation-mode" $@50 ":" "constant string"
+#line 974 "dhcp4_parser.yy"
+               {
+    ElementPtr rm(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservation-mode", rm);
     ctx.leave();
 }
-#line 1792 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1920 "dhcp4_parser.cc"
     break;
 
-  case 247:
-#line 928 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 262: // cache_threshold: "cache-threshold" ":" "floating point"
+#line 980 "dhcp4_parser.yy"
+                                             {
+    ElementPtr ct(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+}
+#line 1929 "dhcp4_parser.cc"
+    break;
+
+  case 263: // id: "id" ":" "integer"
+#line 985 "dhcp4_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1801 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1938 "dhcp4_parser.cc"
     break;
 
-  case 248:
-#line 933 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 264: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 990 "dhcp4_parser.yy"
+                                         {
+    ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1810 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1947 "dhcp4_parser.cc"
     break;
 
-  case 249:
-#line 942 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 265: // $@51: %empty
+#line 999 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1821 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1958 "dhcp4_parser.cc"
     break;
 
-  case 250:
-#line 947 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 266: // option_def_list: "option-def" $@51 ":" "[" option_def_list_content "]"
+#line 1004 "dhcp4_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1830 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1967 "dhcp4_parser.cc"
     break;
 
-  case 255:
-#line 964 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 271: // $@52: %empty
+#line 1021 "dhcp4_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1840 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1977 "dhcp4_parser.cc"
     break;
 
-  case 256:
-#line 968 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 272: // option_def_entry: "{" $@52 option_def_params "}"
+#line 1025 "dhcp4_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1848 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1985 "dhcp4_parser.cc"
     break;
 
-  case 257:
-#line 975 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 273: // $@53: %empty
+#line 1032 "dhcp4_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1858 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1995 "dhcp4_parser.cc"
     break;
 
-  case 258:
-#line 979 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 274: // sub_option_def: "{" $@53 option_def_params "}"
+#line 1036 "dhcp4_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1866 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2003 "dhcp4_parser.cc"
     break;
 
-  case 272:
-#line 1005 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 288: // code: "code" ":" "integer"
+#line 1062 "dhcp4_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 1875 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2012 "dhcp4_parser.cc"
     break;
 
-  case 274:
-#line 1012 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 290: // $@54: %empty
+#line 1069 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1883 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2020 "dhcp4_parser.cc"
     break;
 
-  case 275:
-#line 1014 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 291: // option_def_type: "type" $@54 ":" "constant string"
+#line 1071 "dhcp4_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 1893 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2030 "dhcp4_parser.cc"
     break;
 
-  case 276:
-#line 1020 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 292: // $@55: %empty
+#line 1077 "dhcp4_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1901 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2038 "dhcp4_parser.cc"
     break;
 
-  case 277:
-#line 1022 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 293: // option_def_record_types: "record-types" $@55 ":" "constant string"
+#line 1079 "dhcp4_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 1911 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2048 "dhcp4_parser.cc"
     break;
 
-  case 278:
-#line 1028 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 294: // $@56: %empty
+#line 1085 "dhcp4_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1919 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2056 "dhcp4_parser.cc"
     break;
 
-  case 279:
-#line 1030 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 295: // space: "space" $@56 ":" "constant string"
+#line 1087 "dhcp4_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 1929 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2066 "dhcp4_parser.cc"
     break;
 
-  case 281:
-#line 1038 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 297: // $@57: %empty
+#line 1095 "dhcp4_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1937 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2074 "dhcp4_parser.cc"
     break;
 
-  case 282:
-#line 1040 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 298: // option_def_encapsulate: "encapsulate" $@57 ":" "constant string"
+#line 1097 "dhcp4_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 1947 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2084 "dhcp4_parser.cc"
     break;
 
-  case 283:
-#line 1046 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 299: // option_def_array: "array" ":" "boolean"
+#line 1103 "dhcp4_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 1956 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2093 "dhcp4_parser.cc"
     break;
 
-  case 284:
-#line 1055 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 300: // $@58: %empty
+#line 1112 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 1967 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2104 "dhcp4_parser.cc"
     break;
 
-  case 285:
-#line 1060 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 301: // option_data_list: "option-data" $@58 ":" "[" option_data_list_content "]"
+#line 1117 "dhcp4_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1976 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2113 "dhcp4_parser.cc"
     break;
 
-  case 290:
-#line 1079 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 306: // $@59: %empty
+#line 1136 "dhcp4_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1986 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2123 "dhcp4_parser.cc"
     break;
 
-  case 291:
-#line 1083 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 307: // option_data_entry: "{" $@59 option_data_params "}"
+#line 1140 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1994 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2131 "dhcp4_parser.cc"
     break;
 
-  case 292:
-#line 1090 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 308: // $@60: %empty
+#line 1147 "dhcp4_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2004 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2141 "dhcp4_parser.cc"
     break;
 
-  case 293:
-#line 1094 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 309: // sub_option_data: "{" $@60 option_data_params "}"
+#line 1151 "dhcp4_parser.yy"
+                                    {
     // parsing completed
 }
-#line 2012 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2149 "dhcp4_parser.cc"
     break;
 
-  case 305:
-#line 1123 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 321: // $@61: %empty
+#line 1180 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2020 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2157 "dhcp4_parser.cc"
     break;
 
-  case 306:
-#line 1125 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 322: // option_data_data: "data" $@61 ":" "constant string"
+#line 1182 "dhcp4_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2030 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2167 "dhcp4_parser.cc"
     break;
 
-  case 309:
-#line 1135 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 325: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1192 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2039 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2176 "dhcp4_parser.cc"
     break;
 
-  case 310:
-#line 1143 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 326: // $@62: %empty
+#line 1200 "dhcp4_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2050 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2187 "dhcp4_parser.cc"
     break;
 
-  case 311:
-#line 1148 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 327: // pools_list: "pools" $@62 ":" "[" pools_list_content "]"
+#line 1205 "dhcp4_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2059 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2196 "dhcp4_parser.cc"
     break;
 
-  case 316:
-#line 1163 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 332: // $@63: %empty
+#line 1220 "dhcp4_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2069 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2206 "dhcp4_parser.cc"
     break;
 
-  case 317:
-#line 1167 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 333: // pool_list_entry: "{" $@63 pool_params "}"
+#line 1224 "dhcp4_parser.yy"
+                             {
     ctx.stack_.pop_back();
 }
-#line 2077 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2214 "dhcp4_parser.cc"
     break;
 
-  case 318:
-#line 1171 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 334: // $@64: %empty
+#line 1228 "dhcp4_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2087 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2224 "dhcp4_parser.cc"
     break;
 
-  case 319:
-#line 1175 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 335: // sub_pool4: "{" $@64 pool_params "}"
+#line 1232 "dhcp4_parser.yy"
+                             {
     // parsing completed
 }
-#line 2095 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2232 "dhcp4_parser.cc"
     break;
 
-  case 326:
-#line 1189 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 342: // $@65: %empty
+#line 1246 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2103 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2240 "dhcp4_parser.cc"
     break;
 
-  case 327:
-#line 1191 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 343: // pool_entry: "pool" $@65 ":" "constant string"
+#line 1248 "dhcp4_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2113 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2250 "dhcp4_parser.cc"
     break;
 
-  case 328:
-#line 1197 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 344: // $@66: %empty
+#line 1254 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2121 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2258 "dhcp4_parser.cc"
     break;
 
-  case 329:
-#line 1199 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
+  case 345: // user_context: "user-context" $@66 ":" map_value
+#line 1256 "dhcp4_parser.yy"
+                  {
+    ctx.stack_.back()->set("user-context", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2130 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2267 "dhcp4_parser.cc"
     break;
 
-  case 330:
-#line 1207 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 346: // $@67: %empty
+#line 1264 "dhcp4_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2141 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2278 "dhcp4_parser.cc"
     break;
 
-  case 331:
-#line 1212 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 347: // reservations: "reservations" $@67 ":" "[" reservations_list "]"
+#line 1269 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2150 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2287 "dhcp4_parser.cc"
     break;
 
-  case 336:
-#line 1225 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 352: // $@68: %empty
+#line 1282 "dhcp4_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2160 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2297 "dhcp4_parser.cc"
     break;
 
-  case 337:
-#line 1229 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 353: // reservation: "{" $@68 reservation_params "}"
+#line 1286 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 2168 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2305 "dhcp4_parser.cc"
     break;
 
-  case 338:
-#line 1233 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 354: // $@69: %empty
+#line 1290 "dhcp4_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2178 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2315 "dhcp4_parser.cc"
     break;
 
-  case 339:
-#line 1237 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 355: // sub_reservation: "{" $@69 reservation_params "}"
+#line 1294 "dhcp4_parser.yy"
+                                    {
     // parsing completed
 }
-#line 2186 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2323 "dhcp4_parser.cc"
     break;
 
-  case 357:
-#line 1265 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 373: // $@70: %empty
+#line 1322 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2194 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2331 "dhcp4_parser.cc"
     break;
 
-  case 358:
-#line 1267 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr next_server(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 374: // next_server: "next-server" $@70 ":" "constant string"
+#line 1324 "dhcp4_parser.yy"
+               {
+    ElementPtr next_server(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2204 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2341 "dhcp4_parser.cc"
     break;
 
-  case 359:
-#line 1273 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 375: // $@71: %empty
+#line 1330 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2212 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2349 "dhcp4_parser.cc"
     break;
 
-  case 360:
-#line 1275 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr srv(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 376: // server_hostname: "server-hostname" $@71 ":" "constant string"
+#line 1332 "dhcp4_parser.yy"
+               {
+    ElementPtr srv(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2222 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2359 "dhcp4_parser.cc"
     break;
 
-  case 361:
-#line 1281 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 377: // $@72: %empty
+#line 1338 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2230 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2367 "dhcp4_parser.cc"
     break;
 
-  case 362:
-#line 1283 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr bootfile(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 378: // boot_file_name: "boot-file-name" $@72 ":" "constant string"
+#line 1340 "dhcp4_parser.yy"
+               {
+    ElementPtr bootfile(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2240 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2377 "dhcp4_parser.cc"
     break;
 
-  case 363:
-#line 1289 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 379: // $@73: %empty
+#line 1346 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2248 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2385 "dhcp4_parser.cc"
     break;
 
-  case 364:
-#line 1291 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 380: // ip_address: "ip-address" $@73 ":" "constant string"
+#line 1348 "dhcp4_parser.yy"
+               {
+    ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2258 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2395 "dhcp4_parser.cc"
     break;
 
-  case 365:
-#line 1297 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 381: // $@74: %empty
+#line 1354 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2266 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2403 "dhcp4_parser.cc"
     break;
 
-  case 366:
-#line 1299 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 382: // duid: "duid" $@74 ":" "constant string"
+#line 1356 "dhcp4_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2276 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2413 "dhcp4_parser.cc"
     break;
 
-  case 367:
-#line 1305 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 383: // $@75: %empty
+#line 1362 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2284 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2421 "dhcp4_parser.cc"
     break;
 
-  case 368:
-#line 1307 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 384: // hw_address: "hw-address" $@75 ":" "constant string"
+#line 1364 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2294 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2431 "dhcp4_parser.cc"
     break;
 
-  case 369:
-#line 1313 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 385: // $@76: %empty
+#line 1370 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2302 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2439 "dhcp4_parser.cc"
     break;
 
-  case 370:
-#line 1315 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 386: // client_id_value: "client-id" $@76 ":" "constant string"
+#line 1372 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 2312 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2449 "dhcp4_parser.cc"
     break;
 
-  case 371:
-#line 1321 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 387: // $@77: %empty
+#line 1378 "dhcp4_parser.yy"
+                             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2320 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2457 "dhcp4_parser.cc"
     break;
 
-  case 372:
-#line 1323 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 388: // circuit_id_value: "circuit-id" $@77 ":" "constant string"
+#line 1380 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 2330 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2467 "dhcp4_parser.cc"
     break;
 
-  case 373:
-#line 1329 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 389: // $@78: %empty
+#line 1386 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2338 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2475 "dhcp4_parser.cc"
     break;
 
-  case 374:
-#line 1331 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 390: // flex_id_value: "flex-id" $@78 ":" "constant string"
+#line 1388 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2348 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2485 "dhcp4_parser.cc"
     break;
 
-  case 375:
-#line 1337 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 391: // $@79: %empty
+#line 1394 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2356 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2493 "dhcp4_parser.cc"
     break;
 
-  case 376:
-#line 1339 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 392: // hostname: "hostname" $@79 ":" "constant string"
+#line 1396 "dhcp4_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2366 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2503 "dhcp4_parser.cc"
     break;
 
-  case 377:
-#line 1345 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 393: // $@80: %empty
+#line 1402 "dhcp4_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2377 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2514 "dhcp4_parser.cc"
     break;
 
-  case 378:
-#line 1350 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 394: // reservation_client_classes: "client-classes" $@80 ":" list_strings
+#line 1407 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2386 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2523 "dhcp4_parser.cc"
     break;
 
-  case 379:
-#line 1358 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 395: // $@81: %empty
+#line 1415 "dhcp4_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2397 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2534 "dhcp4_parser.cc"
     break;
 
-  case 380:
-#line 1363 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 396: // relay: "relay" $@81 ":" "{" relay_map "}"
+#line 1420 "dhcp4_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2406 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2543 "dhcp4_parser.cc"
     break;
 
-  case 381:
-#line 1368 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 397: // $@82: %empty
+#line 1425 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2414 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2551 "dhcp4_parser.cc"
     break;
 
-  case 382:
-#line 1370 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 398: // relay_map: "ip-address" $@82 ":" "constant string"
+#line 1427 "dhcp4_parser.yy"
+               {
+    ElementPtr ip(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2424 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2561 "dhcp4_parser.cc"
     break;
 
-  case 383:
-#line 1379 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 399: // $@83: %empty
+#line 1436 "dhcp4_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2435 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2572 "dhcp4_parser.cc"
     break;
 
-  case 384:
-#line 1384 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 400: // client_classes: "client-classes" $@83 ":" "[" client_classes_list "]"
+#line 1441 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2444 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2581 "dhcp4_parser.cc"
     break;
 
-  case 387:
-#line 1393 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 403: // $@84: %empty
+#line 1450 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2454 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2591 "dhcp4_parser.cc"
     break;
 
-  case 388:
-#line 1397 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 404: // client_class: "{" $@84 client_class_params "}"
+#line 1454 "dhcp4_parser.yy"
+                                     {
     ctx.stack_.pop_back();
 }
-#line 2462 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2599 "dhcp4_parser.cc"
     break;
 
-  case 401:
-#line 1420 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 417: // $@85: %empty
+#line 1477 "dhcp4_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2470 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2607 "dhcp4_parser.cc"
     break;
 
-  case 402:
-#line 1422 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 418: // client_class_test: "test" $@85 ":" "constant string"
+#line 1479 "dhcp4_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2480 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2617 "dhcp4_parser.cc"
     break;
 
-  case 403:
-#line 1432 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 419: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1489 "dhcp4_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2489 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2626 "dhcp4_parser.cc"
     break;
 
-  case 404:
-#line 1439 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 420: // $@86: %empty
+#line 1496 "dhcp4_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2500 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2637 "dhcp4_parser.cc"
     break;
 
-  case 405:
-#line 1444 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 421: // control_socket: "control-socket" $@86 ":" "{" control_socket_params "}"
+#line 1501 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2509 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2646 "dhcp4_parser.cc"
     break;
 
-  case 410:
-#line 1457 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 427: // $@87: %empty
+#line 1515 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2517 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2654 "dhcp4_parser.cc"
     break;
 
-  case 411:
-#line 1459 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 428: // control_socket_type: "socket-type" $@87 ":" "constant string"
+#line 1517 "dhcp4_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2527 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2664 "dhcp4_parser.cc"
     break;
 
-  case 412:
-#line 1465 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 429: // $@88: %empty
+#line 1523 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2535 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2672 "dhcp4_parser.cc"
     break;
 
-  case 413:
-#line 1467 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 430: // control_socket_name: "socket-name" $@88 ":" "constant string"
+#line 1525 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2545 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2682 "dhcp4_parser.cc"
     break;
 
-  case 414:
-#line 1475 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 431: // background_commands: "background-commands" ":" "boolean"
+#line 1531 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr bg(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("background-commands", bg);
+}
+#line 2691 "dhcp4_parser.cc"
+    break;
+
+  case 432: // $@89: %empty
+#line 1538 "dhcp4_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2556 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2702 "dhcp4_parser.cc"
     break;
 
-  case 415:
-#line 1480 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 433: // dhcp_ddns: "dhcp-ddns" $@89 ":" "{" dhcp_ddns_params "}"
+#line 1543 "dhcp4_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2565 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2711 "dhcp4_parser.cc"
     break;
 
-  case 416:
-#line 1485 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 434: // $@90: %empty
+#line 1548 "dhcp4_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2575 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2721 "dhcp4_parser.cc"
     break;
 
-  case 417:
-#line 1489 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 435: // sub_dhcp_ddns: "{" $@90 dhcp_ddns_params "}"
+#line 1552 "dhcp4_parser.yy"
+                                  {
     // parsing completed
 }
-#line 2583 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2729 "dhcp4_parser.cc"
     break;
 
-  case 435:
-#line 1514 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 453: // enable_updates: "enable-updates" ":" "boolean"
+#line 1577 "dhcp4_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2592 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2738 "dhcp4_parser.cc"
     break;
 
-  case 436:
-#line 1519 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 454: // $@91: %empty
+#line 1582 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2600 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2746 "dhcp4_parser.cc"
     break;
 
-  case 437:
-#line 1521 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 455: // qualifying_suffix: "qualifying-suffix" $@91 ":" "constant string"
+#line 1584 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2610 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2756 "dhcp4_parser.cc"
     break;
 
-  case 438:
-#line 1527 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 456: // $@92: %empty
+#line 1590 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2618 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2764 "dhcp4_parser.cc"
     break;
 
-  case 439:
-#line 1529 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 457: // server_ip: "server-ip" $@92 ":" "constant string"
+#line 1592 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2628 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2774 "dhcp4_parser.cc"
     break;
 
-  case 440:
-#line 1535 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 458: // server_port: "server-port" ":" "integer"
+#line 1598 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2637 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2783 "dhcp4_parser.cc"
     break;
 
-  case 441:
-#line 1540 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 459: // $@93: %empty
+#line 1603 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2645 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2791 "dhcp4_parser.cc"
     break;
 
-  case 442:
-#line 1542 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 460: // sender_ip: "sender-ip" $@93 ":" "constant string"
+#line 1605 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2655 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2801 "dhcp4_parser.cc"
     break;
 
-  case 443:
-#line 1548 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 461: // sender_port: "sender-port" ":" "integer"
+#line 1611 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2664 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2810 "dhcp4_parser.cc"
     break;
 
-  case 444:
-#line 1553 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 462: // max_queue_size: "max-queue-size" ":" "integer"
+#line 1616 "dhcp4_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2673 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2819 "dhcp4_parser.cc"
     break;
 
-  case 445:
-#line 1558 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 463: // $@94: %empty
+#line 1621 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2681 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2827 "dhcp4_parser.cc"
     break;
 
-  case 446:
-#line 1560 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 464: // ncr_protocol: "ncr-protocol" $@94 ":" ncr_protocol_value
+#line 1623 "dhcp4_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2690 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2836 "dhcp4_parser.cc"
     break;
 
-  case 447:
-#line 1566 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2696 "dhcp4_parser.cc" // lalr1.cc:859
+  case 465: // ncr_protocol_value: "udp"
+#line 1629 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 2842 "dhcp4_parser.cc"
     break;
 
-  case 448:
-#line 1567 "dhcp4_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2702 "dhcp4_parser.cc" // lalr1.cc:859
+  case 466: // ncr_protocol_value: "tcp"
+#line 1630 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 2848 "dhcp4_parser.cc"
     break;
 
-  case 449:
-#line 1570 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 467: // $@95: %empty
+#line 1633 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2710 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2856 "dhcp4_parser.cc"
     break;
 
-  case 450:
-#line 1572 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 468: // ncr_format: "ncr-format" $@95 ":" "JSON"
+#line 1635 "dhcp4_parser.yy"
+             {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 2720 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2866 "dhcp4_parser.cc"
     break;
 
-  case 451:
-#line 1578 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 469: // always_include_fqdn: "always-include-fqdn" ":" "boolean"
+#line 1641 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2729 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2875 "dhcp4_parser.cc"
     break;
 
-  case 452:
-#line 1583 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 470: // override_no_update: "override-no-update" ":" "boolean"
+#line 1646 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2738 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2884 "dhcp4_parser.cc"
     break;
 
-  case 453:
-#line 1588 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 471: // override_client_update: "override-client-update" ":" "boolean"
+#line 1651 "dhcp4_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2747 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2893 "dhcp4_parser.cc"
     break;
 
-  case 454:
-#line 1593 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 472: // $@96: %empty
+#line 1656 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 2755 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2901 "dhcp4_parser.cc"
     break;
 
-  case 455:
-#line 1595 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 473: // replace_client_name: "replace-client-name" $@96 ":" replace_client_name_value
+#line 1658 "dhcp4_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2764 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2910 "dhcp4_parser.cc"
     break;
 
-  case 456:
-#line 1601 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
+  case 474: // replace_client_name_value: "when-present"
+#line 1664 "dhcp4_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 2772 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2918 "dhcp4_parser.cc"
     break;
 
-  case 457:
-#line 1604 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 475: // replace_client_name_value: "never"
+#line 1667 "dhcp4_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2780 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2926 "dhcp4_parser.cc"
     break;
 
-  case 458:
-#line 1607 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 476: // replace_client_name_value: "always"
+#line 1670 "dhcp4_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2788 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2934 "dhcp4_parser.cc"
     break;
 
-  case 459:
-#line 1610 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 477: // replace_client_name_value: "when-not-present"
+#line 1673 "dhcp4_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2796 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2942 "dhcp4_parser.cc"
     break;
 
-  case 460:
-#line 1613 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 478: // replace_client_name_value: "boolean"
+#line 1676 "dhcp4_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 2805 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2951 "dhcp4_parser.cc"
     break;
 
-  case 461:
-#line 1619 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 479: // $@97: %empty
+#line 1682 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2813 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2959 "dhcp4_parser.cc"
     break;
 
-  case 462:
-#line 1621 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 480: // generated_prefix: "generated-prefix" $@97 ":" "constant string"
+#line 1684 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 2823 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2969 "dhcp4_parser.cc"
     break;
 
-  case 463:
-#line 1629 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 481: // $@98: %empty
+#line 1692 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2831 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2977 "dhcp4_parser.cc"
     break;
 
-  case 464:
-#line 1631 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 482: // dhcp6_json_object: "Dhcp6" $@98 ":" value
+#line 1694 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2840 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2986 "dhcp4_parser.cc"
     break;
 
-  case 465:
-#line 1636 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 483: // $@99: %empty
+#line 1699 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2848 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2994 "dhcp4_parser.cc"
     break;
 
-  case 466:
-#line 1638 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 484: // dhcpddns_json_object: "DhcpDdns" $@99 ":" value
+#line 1701 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2857 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3003 "dhcp4_parser.cc"
     break;
 
-  case 467:
-#line 1648 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 485: // $@100: %empty
+#line 1711 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 2868 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3014 "dhcp4_parser.cc"
     break;
 
-  case 468:
-#line 1653 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 486: // logging_object: "Logging" $@100 ":" "{" logging_params "}"
+#line 1716 "dhcp4_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2877 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3023 "dhcp4_parser.cc"
     break;
 
-  case 472:
-#line 1670 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 490: // $@101: %empty
+#line 1733 "dhcp4_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 2888 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3034 "dhcp4_parser.cc"
     break;
 
-  case 473:
-#line 1675 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 491: // loggers: "loggers" $@101 ":" "[" loggers_entries "]"
+#line 1738 "dhcp4_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2897 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3043 "dhcp4_parser.cc"
     break;
 
-  case 476:
-#line 1687 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 494: // $@102: %empty
+#line 1750 "dhcp4_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 2907 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3053 "dhcp4_parser.cc"
     break;
 
-  case 477:
-#line 1691 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 495: // logger_entry: "{" $@102 logger_params "}"
+#line 1754 "dhcp4_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 2915 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3061 "dhcp4_parser.cc"
     break;
 
-  case 485:
-#line 1706 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 503: // debuglevel: "debuglevel" ":" "integer"
+#line 1769 "dhcp4_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 2924 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3070 "dhcp4_parser.cc"
     break;
 
-  case 486:
-#line 1711 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 504: // $@103: %empty
+#line 1774 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2932 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3078 "dhcp4_parser.cc"
     break;
 
-  case 487:
-#line 1713 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 505: // severity: "severity" $@103 ":" "constant string"
+#line 1776 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 2942 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3088 "dhcp4_parser.cc"
     break;
 
-  case 488:
-#line 1719 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 506: // $@104: %empty
+#line 1782 "dhcp4_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 2953 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3099 "dhcp4_parser.cc"
     break;
 
-  case 489:
-#line 1724 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 507: // output_options_list: "output_options" $@104 ":" "[" output_options_list_content "]"
+#line 1787 "dhcp4_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2962 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3108 "dhcp4_parser.cc"
     break;
 
-  case 492:
-#line 1733 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 510: // $@105: %empty
+#line 1796 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2972 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3118 "dhcp4_parser.cc"
     break;
 
-  case 493:
-#line 1737 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 511: // output_entry: "{" $@105 output_params_list "}"
+#line 1800 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 2980 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3126 "dhcp4_parser.cc"
     break;
 
-  case 500:
-#line 1751 "dhcp4_parser.yy" // lalr1.cc:859
-    {
+  case 518: // $@106: %empty
+#line 1814 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2988 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3134 "dhcp4_parser.cc"
     break;
 
-  case 501:
-#line 1753 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 519: // output: "output" $@106 ":" "constant string"
+#line 1816 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 2998 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3144 "dhcp4_parser.cc"
     break;
 
-  case 502:
-#line 1759 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 520: // flush: "flush" ":" "boolean"
+#line 1822 "dhcp4_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3007 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3153 "dhcp4_parser.cc"
     break;
 
-  case 503:
-#line 1764 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 521: // maxsize: "maxsize" ":" "integer"
+#line 1827 "dhcp4_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3016 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3162 "dhcp4_parser.cc"
     break;
 
-  case 504:
-#line 1769 "dhcp4_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 522: // maxver: "maxver" ":" "integer"
+#line 1832 "dhcp4_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3025 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3171 "dhcp4_parser.cc"
     break;
 
 
-#line 3029 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3175 "dhcp4_parser.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -3053,7 +3203,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3064,7 +3216,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3081,69 +3233,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3151,6 +3315,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3159,12 +3324,12 @@ namespace isc { namespace dhcp {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -3175,26 +3340,112 @@ namespace isc { namespace dhcp {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   Dhcp4Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp4Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp4Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp4Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp4Parser::context.
+  Dhcp4Parser::context::context (const Dhcp4Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp4Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
 
+
+
+  int
+  Dhcp4Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3213,41 +3464,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp4Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3256,22 +3498,23 @@ namespace isc { namespace dhcp {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -3280,566 +3523,587 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp4Parser::yypact_ninf_ = -473;
+  const short Dhcp4Parser::yypact_ninf_ = -496;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   Dhcp4Parser::yypact_[] =
   {
-      92,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,    34,    19,    31,    36,   108,   116,   127,   134,
-     143,   152,   175,   182,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,    19,   -94,    17,    80,
-     168,    18,    -7,   113,    16,   -19,   -35,   229,  -473,    53,
-      69,    79,    84,   188,  -473,  -473,  -473,  -473,   189,  -473,
-      52,  -473,  -473,  -473,  -473,  -473,  -473,   196,   202,  -473,
-    -473,  -473,   210,   241,   259,   260,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   262,  -473,  -473,  -473,    65,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,    81,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   263,   265,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,    82,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,    85,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,   231,   268,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,   269,  -473,  -473,
-    -473,   270,  -473,  -473,   267,   274,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,   276,  -473,  -473,
-    -473,  -473,   273,   275,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   139,  -473,  -473,  -473,   280,  -473,  -473,
-     281,  -473,   283,   287,  -473,  -473,   288,   289,   290,  -473,
-    -473,  -473,   140,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,    19,
-      19,  -473,   160,   296,   297,   299,   300,  -473,    17,  -473,
-     301,   169,   170,   302,   305,   306,   176,   178,   179,   180,
-     313,   314,   315,   316,   332,   333,   334,   203,   336,   337,
-      80,  -473,   338,   339,   168,  -473,    28,   340,   341,   342,
-     343,   344,   345,   348,   217,   216,   351,   352,   353,   354,
-      18,  -473,   355,   356,    -7,  -473,   357,   358,   359,   361,
-     362,   363,   364,   365,   366,   367,  -473,   113,   368,   369,
-     238,   371,   372,   373,   240,  -473,    16,   375,   242,  -473,
-     -19,   377,   378,   172,  -473,   246,   379,   381,   250,   383,
-     252,   253,   386,   387,   254,   255,   256,   391,   392,   229,
-    -473,  -473,  -473,   393,   394,   395,    19,    19,  -473,   396,
-    -473,  -473,   264,   397,   398,  -473,  -473,  -473,  -473,   401,
-     402,   403,   404,   405,   406,   407,  -473,   408,   409,  -473,
-     412,   245,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-     390,   410,  -473,  -473,  -473,   277,   284,   285,   413,   286,
-     293,   295,  -473,  -473,   298,   303,   417,   416,  -473,   304,
-     418,  -473,   307,   308,   412,   310,   312,   317,   318,   319,
-     320,   322,  -473,   323,   325,  -473,   326,   327,   328,  -473,
-    -473,   329,  -473,  -473,   330,    19,  -473,  -473,   331,   335,
-    -473,   346,  -473,  -473,    22,   292,  -473,  -473,  -473,    26,
-     347,  -473,    19,    80,   321,  -473,  -473,   168,  -473,    76,
-      76,   427,   429,   430,   126,    35,   433,    91,   171,   229,
-    -473,  -473,  -473,  -473,  -473,   420,  -473,    28,  -473,  -473,
-    -473,   441,  -473,  -473,  -473,  -473,  -473,   443,   374,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,   141,  -473,   159,  -473,  -473,
-     162,  -473,  -473,  -473,  -473,   463,   464,   465,   467,   468,
-    -473,  -473,  -473,   163,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,   199,  -473,   469,
-     470,  -473,  -473,   471,   473,  -473,  -473,   472,   476,  -473,
-    -473,  -473,  -473,  -473,  -473,   111,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   235,  -473,   474,   480,  -473,   481,   482,
-     483,   484,   485,   486,   200,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,   201,  -473,  -473,  -473,   224,   349,
-     360,  -473,  -473,   487,   488,  -473,  -473,   490,   489,  -473,
-    -473,   466,  -473,   493,   321,  -473,  -473,   494,   495,   496,
-     497,   370,   376,   380,   382,   385,   498,   499,    76,  -473,
-    -473,    18,  -473,   427,    16,  -473,   429,   -19,  -473,   430,
-     126,  -473,    35,  -473,   -35,  -473,   433,   388,   389,   399,
-     400,   411,   414,    91,  -473,   500,   501,   171,  -473,  -473,
-    -473,   502,   491,  -473,    -7,  -473,   441,   113,  -473,   443,
-     503,  -473,   504,  -473,   230,   384,   419,   421,  -473,  -473,
-    -473,  -473,  -473,   422,   423,  -473,   225,  -473,   505,  -473,
-     507,  -473,  -473,  -473,   226,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   424,   425,  -473,  -473,   426,   228,  -473,
-     509,  -473,   428,   511,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,   243,  -473,    77,   511,  -473,
-    -473,   506,  -473,  -473,  -473,   232,  -473,  -473,  -473,  -473,
-    -473,   508,   415,   518,    77,  -473,   521,  -473,   431,  -473,
-     516,  -473,  -473,   244,  -473,   -67,   516,  -473,  -473,   523,
-     524,   525,   234,  -473,  -473,  -473,  -473,  -473,  -473,   526,
-     432,   435,   436,   -67,  -473,   434,  -473,  -473,  -473,  -473,
-    -473
+     109,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,    74,    19,    71,    84,    88,    98,   105,   107,
+     111,   130,   138,   160,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,    19,   -27,    17,    81,
+     276,    18,   -22,    29,    16,   -11,   -53,   125,  -496,   150,
+     168,   174,   176,   182,  -496,  -496,  -496,  -496,   197,  -496,
+     112,  -496,  -496,  -496,  -496,  -496,  -496,   204,   217,  -496,
+    -496,  -496,   221,   258,   291,   292,   295,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,   296,  -496,  -496,  -496,
+     149,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,   306,   165,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,   311,   312,  -496,   314,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,   167,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,   171,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,   211,   209,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,   315,  -496,  -496,
+    -496,   316,  -496,  -496,   269,   318,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,   319,  -496,  -496,
+    -496,  -496,   317,   321,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,   179,  -496,  -496,  -496,   323,  -496,  -496,
+     325,  -496,   326,   327,  -496,  -496,   328,   329,   330,  -496,
+    -496,  -496,   207,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,    19,
+      19,  -496,   141,   331,   333,   334,   335,  -496,    17,  -496,
+     336,   195,   196,   339,   340,   341,   178,   202,   203,   205,
+     206,   344,   347,   348,   349,   350,   351,   352,   353,   354,
+     216,   355,   357,    81,  -496,   358,   359,   218,   276,  -496,
+      43,   363,   364,   365,   366,   367,   368,   369,   230,   229,
+     372,   232,   374,   375,   376,    18,  -496,   377,   378,   -22,
+    -496,   379,   380,   381,   382,   383,   384,   385,   386,   387,
+     388,  -496,    29,   389,   390,   251,   392,   393,   394,   254,
+    -496,    16,   395,   257,  -496,   -11,   397,   398,   -21,  -496,
+     259,   400,   402,   264,   403,   265,   267,   406,   408,   268,
+     271,   274,   409,   411,   125,  -496,  -496,  -496,   412,   414,
+     415,    19,    19,  -496,   416,  -496,  -496,   275,   417,   418,
+    -496,  -496,  -496,  -496,  -496,   419,   419,   422,   423,   424,
+     425,   426,   427,   428,  -496,   429,   430,  -496,   433,    24,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,   431,
+     437,  -496,  -496,  -496,   290,   298,   299,   438,   301,   302,
+     305,  -496,  -496,   307,  -496,   310,   449,   448,  -496,   313,
+     419,  -496,   320,   322,   433,   332,   337,   338,   342,   343,
+     345,   346,  -496,   356,   360,  -496,   361,   362,   370,  -496,
+    -496,   371,  -496,  -496,   373,    19,  -496,  -496,   391,   396,
+    -496,   399,  -496,  -496,    15,   303,  -496,  -496,  -496,   -65,
+     401,  -496,    19,    81,   404,  -496,  -496,   276,  -496,   159,
+     159,  -496,  -496,  -496,   450,   451,   452,   127,    44,   453,
+      50,   -41,   125,  -496,  -496,  -496,  -496,  -496,   457,  -496,
+      43,  -496,  -496,  -496,   455,  -496,  -496,  -496,  -496,  -496,
+     461,   407,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,   208,  -496,   215,
+    -496,  -496,   249,  -496,  -496,  -496,  -496,   465,   466,   467,
+     469,   470,   472,   473,  -496,  -496,  -496,   252,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,   253,  -496,   477,   475,  -496,  -496,   478,
+     484,  -496,  -496,   486,   487,  -496,  -496,  -496,  -496,  -496,
+    -496,    26,  -496,  -496,  -496,  -496,  -496,  -496,  -496,   152,
+    -496,   488,   490,  -496,   491,   492,   493,   494,   496,   497,
+     255,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+     498,   256,  -496,  -496,  -496,  -496,   262,   405,   410,  -496,
+    -496,   500,   504,  -496,  -496,   502,   506,  -496,  -496,   503,
+    -496,   508,   404,  -496,  -496,   511,   513,   514,   515,   413,
+     288,   420,   421,   432,   434,   435,   516,   517,   159,  -496,
+    -496,    18,  -496,   450,    16,  -496,   451,   -11,  -496,   452,
+     127,  -496,    44,  -496,   -53,  -496,   453,   439,   440,   441,
+     442,   443,   444,    50,  -496,   518,   519,   436,   -41,  -496,
+    -496,  -496,   521,   507,  -496,   -22,  -496,   455,    29,  -496,
+     461,   520,  -496,   523,  -496,   281,   446,   447,   454,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,   456,   458,  -496,   263,
+    -496,   522,  -496,   524,  -496,  -496,  -496,   266,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,   459,   460,  -496,  -496,
+    -496,   462,   270,  -496,   525,  -496,   463,   528,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,   280,
+    -496,    77,   528,  -496,  -496,   527,  -496,  -496,  -496,   272,
+    -496,  -496,  -496,  -496,  -496,   532,   464,   533,    77,  -496,
+     535,  -496,   468,  -496,   531,  -496,  -496,   287,  -496,    22,
+     531,  -496,  -496,   537,   539,   541,   273,  -496,  -496,  -496,
+    -496,  -496,  -496,   542,   445,   471,   474,    22,  -496,   476,
+    -496,  -496,  -496,  -496,  -496
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
       20,    22,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     1,    39,    32,    28,    27,    24,
       25,    26,    31,     3,    29,    30,    52,     5,    63,     7,
-     100,     9,   207,    11,   318,    13,   338,    15,   257,    17,
-     292,    19,   172,    21,   416,    23,    41,    35,     0,     0,
-       0,     0,     0,   340,   259,   294,     0,     0,    43,     0,
-      42,     0,     0,    36,    61,   467,   463,   465,     0,    60,
-       0,    54,    56,    58,    59,    57,    94,     0,     0,   357,
-     108,   110,     0,     0,     0,     0,   199,   249,   284,   150,
-     383,   164,   183,     0,   404,   414,    87,     0,    65,    67,
-      68,    69,    70,    84,    85,    72,    73,    74,    75,    79,
-      80,    71,    77,    78,    86,    76,    81,    82,    83,   102,
-     104,     0,    96,    98,    99,   387,   233,   235,   237,   310,
-     231,   239,   241,     0,     0,   245,   243,   330,   379,   230,
-     211,   212,   213,   225,     0,   209,   216,   227,   228,   229,
-     217,   218,   221,   223,   219,   220,   214,   215,   222,   226,
-     224,   326,   328,   325,   323,     0,   320,   322,   324,   359,
-     361,   377,   365,   367,   371,   369,   375,   373,   363,   356,
-     352,     0,   341,   342,   353,   354,   355,   349,   344,   350,
-     346,   347,   348,   351,   345,   274,   140,     0,   278,   276,
-     281,     0,   270,   271,     0,   260,   261,   263,   273,   264,
-     265,   266,   280,   267,   268,   269,   305,     0,   303,   304,
-     307,   308,     0,   295,   296,   298,   299,   300,   301,   302,
-     179,   181,   176,     0,   174,   177,   178,     0,   436,   438,
-       0,   441,     0,     0,   445,   449,     0,     0,     0,   454,
-     461,   434,     0,   418,   420,   421,   422,   423,   424,   425,
-     426,   427,   428,   429,   430,   431,   432,   433,    40,     0,
+     109,     9,   221,    11,   334,    13,   354,    15,   273,    17,
+     308,    19,   186,    21,   434,    23,    41,    35,     0,     0,
+       0,     0,     0,   356,   275,   310,     0,     0,    43,     0,
+      42,     0,     0,    36,    61,   485,   481,   483,     0,    60,
+       0,    54,    56,    58,    59,    57,   102,     0,     0,   373,
+     118,   120,     0,     0,     0,     0,     0,    96,    98,   213,
+     265,   300,   164,   399,   178,   197,     0,   420,   432,    90,
+       0,    65,    67,    68,    69,    70,    71,    72,    73,    87,
+      88,    75,    76,    77,    78,    82,    83,    74,    80,    81,
+      89,    79,    84,    85,    86,   111,   113,     0,     0,   104,
+     106,   107,   108,   403,   248,   250,   252,   326,   246,   254,
+     256,     0,     0,   260,     0,   258,   346,   395,   245,   225,
+     226,   227,   239,     0,   223,   230,   241,   242,   243,   231,
+     232,   235,   237,   244,   233,   234,   228,   229,   236,   240,
+     238,   342,   344,   341,   339,     0,   336,   338,   340,   375,
+     377,   393,   381,   383,   387,   385,   391,   389,   379,   372,
+     368,     0,   357,   358,   369,   370,   371,   365,   360,   366,
+     362,   363,   364,   367,   361,   290,   152,     0,   294,   292,
+     297,     0,   286,   287,     0,   276,   277,   279,   289,   280,
+     281,   282,   296,   283,   284,   285,   321,     0,   319,   320,
+     323,   324,     0,   311,   312,   314,   315,   316,   317,   318,
+     193,   195,   190,     0,   188,   191,   192,     0,   454,   456,
+       0,   459,     0,     0,   463,   467,     0,     0,     0,   472,
+     479,   452,     0,   436,   438,   439,   440,   441,   442,   443,
+     444,   445,   446,   447,   448,   449,   450,   451,    40,     0,
        0,    33,     0,     0,     0,     0,     0,    51,     0,    53,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    64,     0,     0,     0,   101,   389,     0,     0,     0,
+       0,     0,     0,     0,    64,     0,     0,     0,     0,   110,
+     405,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   222,     0,     0,     0,
+     335,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   355,     0,     0,     0,     0,     0,     0,     0,     0,
+     274,     0,     0,     0,   309,     0,     0,     0,     0,   187,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   208,     0,     0,     0,   319,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   339,     0,     0,     0,
-       0,     0,     0,     0,     0,   258,     0,     0,     0,   293,
-       0,     0,     0,     0,   173,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     417,    44,    37,     0,     0,     0,     0,     0,    55,     0,
-      92,    93,     0,     0,     0,    88,    89,    90,    91,     0,
-       0,     0,     0,     0,     0,     0,   403,     0,     0,    66,
-       0,     0,    97,   401,   399,   400,   395,   396,   397,   398,
-       0,   390,   391,   393,   394,     0,     0,     0,     0,     0,
-       0,     0,   247,   248,     0,     0,     0,     0,   210,     0,
-       0,   321,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   343,     0,     0,   272,     0,     0,     0,   283,
-     262,     0,   309,   297,     0,     0,   175,   435,     0,     0,
-     440,     0,   443,   444,     0,     0,   451,   452,   453,     0,
-       0,   419,     0,     0,     0,   464,   466,     0,   358,     0,
-       0,   201,   251,   286,     0,     0,   166,     0,     0,     0,
-      45,   103,   106,   107,   105,     0,   388,     0,   234,   236,
-     238,   312,   232,   240,   242,   246,   244,   332,     0,   327,
-      34,   329,   360,   362,   378,   366,   368,   372,   370,   376,
-     374,   364,   275,   141,   279,   277,   282,   306,   180,   182,
-     437,   439,   442,   447,   448,   446,   450,   456,   457,   458,
-     459,   460,   455,   462,    38,     0,   472,     0,   469,   471,
-       0,   127,   133,   135,   137,     0,     0,     0,     0,     0,
-     146,   148,   126,     0,   112,   114,   115,   116,   117,   118,
-     119,   120,   121,   122,   123,   124,   125,     0,   205,     0,
-     202,   203,   255,     0,   252,   253,   290,     0,   287,   288,
-     159,   160,   161,   162,   163,     0,   152,   154,   155,   156,
-     157,   158,   385,     0,   170,     0,   167,   168,     0,     0,
-       0,     0,     0,     0,     0,   185,   187,   188,   189,   190,
-     191,   192,   410,   412,     0,   406,   408,   409,     0,    47,
-       0,   392,   316,     0,   313,   314,   336,     0,   333,   334,
-     381,     0,    62,     0,     0,   468,    95,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   109,
-     111,     0,   200,     0,   259,   250,     0,   294,   285,     0,
-       0,   151,     0,   384,     0,   165,     0,     0,     0,     0,
-       0,     0,     0,     0,   184,     0,     0,     0,   405,   415,
-      49,     0,    48,   402,     0,   311,     0,   340,   331,     0,
-       0,   380,     0,   470,     0,     0,     0,     0,   139,   142,
-     143,   144,   145,     0,     0,   113,     0,   204,     0,   254,
-       0,   289,   153,   386,     0,   169,   193,   194,   195,   196,
-     197,   198,   186,     0,     0,   407,    46,     0,     0,   315,
-       0,   335,     0,     0,   129,   130,   131,   132,   128,   134,
-     136,   138,   147,   149,   206,   256,   291,   171,   411,   413,
-      50,   317,   337,   382,   476,     0,   474,     0,     0,   473,
-     488,     0,   486,   484,   480,     0,   478,   482,   483,   481,
-     475,     0,     0,     0,     0,   477,     0,   485,     0,   479,
-       0,   487,   492,     0,   490,     0,     0,   489,   500,     0,
-       0,     0,     0,   494,   496,   497,   498,   499,   491,     0,
-       0,     0,     0,     0,   493,     0,   502,   503,   504,   495,
-     501
+       0,     0,     0,     0,     0,   435,    44,    37,     0,     0,
+       0,     0,     0,    55,     0,   100,   101,     0,     0,     0,
+      91,    92,    93,    94,    95,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   419,     0,     0,    66,     0,     0,
+     117,   105,   417,   415,   416,   411,   412,   413,   414,     0,
+     406,   407,   409,   410,     0,     0,     0,     0,     0,     0,
+       0,   263,   264,     0,   262,     0,     0,     0,   224,     0,
+       0,   337,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   359,     0,     0,   288,     0,     0,     0,   299,
+     278,     0,   325,   313,     0,     0,   189,   453,     0,     0,
+     458,     0,   461,   462,     0,     0,   469,   470,   471,     0,
+       0,   437,     0,     0,     0,   482,   484,     0,   374,     0,
+       0,    34,    97,    99,   215,   267,   302,     0,     0,   180,
+       0,     0,     0,    45,   112,   115,   116,   114,     0,   404,
+       0,   249,   251,   253,   328,   247,   255,   257,   261,   259,
+     348,     0,   343,   345,   376,   378,   394,   382,   384,   388,
+     386,   392,   390,   380,   291,   153,   295,   293,   298,   322,
+     194,   196,   455,   457,   460,   465,   466,   464,   468,   474,
+     475,   476,   477,   478,   473,   480,    38,     0,   490,     0,
+     487,   489,     0,   139,   145,   147,   149,     0,     0,     0,
+       0,     0,     0,     0,   160,   162,   138,     0,   122,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,     0,   219,     0,   216,   217,   271,     0,
+     268,   269,   306,     0,   303,   304,   173,   174,   175,   176,
+     177,     0,   166,   168,   169,   170,   171,   172,   401,     0,
+     184,     0,   181,   182,     0,     0,     0,     0,     0,     0,
+       0,   199,   201,   202,   203,   204,   205,   206,   427,   429,
+       0,     0,   422,   424,   425,   426,     0,    47,     0,   408,
+     332,     0,   329,   330,   352,     0,   349,   350,   397,     0,
+      62,     0,     0,   486,   103,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   119,
+     121,     0,   214,     0,   275,   266,     0,   310,   301,     0,
+       0,   165,     0,   400,     0,   179,     0,     0,     0,     0,
+       0,     0,     0,     0,   198,     0,     0,     0,     0,   421,
+     433,    49,     0,    48,   418,     0,   327,     0,   356,   347,
+       0,     0,   396,     0,   488,     0,     0,     0,     0,   151,
+     154,   155,   156,   157,   158,   159,     0,     0,   123,     0,
+     218,     0,   270,     0,   305,   167,   402,     0,   183,   207,
+     208,   209,   210,   211,   212,   200,     0,     0,   431,   423,
+      46,     0,     0,   331,     0,   351,     0,     0,   141,   142,
+     143,   144,   140,   146,   148,   150,   161,   163,   220,   272,
+     307,   185,   428,   430,    50,   333,   353,   398,   494,     0,
+     492,     0,     0,   491,   506,     0,   504,   502,   498,     0,
+     496,   500,   501,   499,   493,     0,     0,     0,     0,   495,
+       0,   503,     0,   497,     0,   505,   510,     0,   508,     0,
+       0,   507,   518,     0,     0,     0,     0,   512,   514,   515,
+     516,   517,   509,     0,     0,     0,     0,     0,   511,     0,
+     520,   521,   522,   513,   519
   };
 
-  const short int
+  const short
   Dhcp4Parser::yypgoto_[] =
   {
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,   -36,  -473,    71,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,    87,  -473,  -473,  -473,   -58,  -473,
-    -473,  -473,   249,  -473,  -473,  -473,  -473,    49,   223,   -60,
-     -44,   -42,  -473,  -473,   -40,  -473,  -473,    47,   227,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-      48,  -129,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,   -63,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -140,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -144,  -473,  -473,  -473,  -141,
-     181,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -148,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -127,
-    -473,  -473,  -473,  -123,   219,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -472,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -124,  -473,  -473,
-    -473,  -121,  -473,   206,  -473,   -49,  -473,  -473,  -473,  -473,
-    -473,   -47,  -473,  -473,  -473,  -473,  -473,   -51,  -473,  -473,
-    -473,  -115,  -473,  -473,  -473,  -122,  -473,   205,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -139,  -473,
-    -473,  -473,  -136,   239,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -135,  -473,  -473,  -473,  -132,  -473,   233,   -48,
-    -473,  -302,  -473,  -294,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,    70,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -119,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,    83,   197,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-    -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,  -473,
-     -75,  -473,  -473,  -473,  -197,  -473,  -473,  -211,  -473,  -473,
-    -473,  -473,  -473,  -473,  -222,  -473,  -473,  -238,  -473,  -473,
-    -473,  -473,  -473
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,   -36,  -496,  -280,  -496,  -381,  -496,  -496,
+    -496,  -496,  -496,  -496,    61,  -496,  -496,  -496,   -58,  -496,
+    -496,  -496,   231,  -496,  -496,  -496,  -496,    46,   224,   -60,
+     -44,   -42,  -496,  -496,  -496,  -496,  -496,  -496,  -496,   -40,
+    -496,  -496,    45,   222,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,    41,  -144,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,   -63,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -155,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -160,  -496,  -496,  -496,  -156,   181,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -163,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -142,  -496,  -496,
+    -496,  -139,   223,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -495,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -143,  -496,  -496,  -496,
+    -138,  -496,   198,  -496,   -49,  -496,  -496,  -496,  -496,  -496,
+     -47,  -496,  -496,  -496,  -496,  -496,   -51,  -496,  -496,  -496,
+    -137,  -496,  -496,  -496,  -140,  -496,   199,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -167,  -496,  -496,
+    -496,  -164,   226,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -162,  -496,  -496,  -496,  -165,  -496,   219,   -48,  -496,
+    -316,  -496,  -308,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+      47,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -136,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,    72,   201,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+    -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,  -496,
+     -89,  -496,  -496,  -496,  -216,  -496,  -496,  -230,  -496,  -496,
+    -496,  -496,  -496,  -496,  -240,  -496,  -496,  -253,  -496,  -496,
+    -496,  -496,  -496
   };
 
-  const short int
+  const short
   Dhcp4Parser::yydefgoto_[] =
   {
-      -1,    12,    13,    14,    15,    16,    17,    18,    19,    20,
-      21,    22,    23,    32,    33,    34,    57,   521,    72,    73,
-      35,    56,    69,    70,   501,   639,   701,   702,   106,    37,
-      58,    80,    81,    82,   283,    39,    59,   107,   108,   109,
-     110,   111,   112,   113,   114,   115,   290,   131,   132,    41,
-      60,   133,   312,   134,   313,   504,   116,   294,   117,   295,
-     573,   574,   575,   657,   758,   576,   658,   577,   659,   578,
-     660,   579,   213,   349,   581,   582,   583,   584,   585,   666,
-     586,   667,   118,   303,   605,   606,   607,   608,   609,   610,
-     611,   119,   305,   615,   616,   617,   684,    53,    66,   243,
-     244,   245,   361,   246,   362,   120,   306,   624,   625,   626,
-     627,   628,   629,   630,   631,   121,   300,   589,   590,   591,
-     671,    43,    61,   154,   155,   156,   321,   157,   317,   158,
-     318,   159,   319,   160,   322,   161,   323,   162,   327,   163,
-     326,   164,   165,   122,   301,   593,   594,   595,   674,    49,
-      64,   214,   215,   216,   217,   218,   219,   220,   348,   221,
-     352,   222,   351,   223,   224,   353,   225,   123,   302,   597,
-     598,   599,   677,    51,    65,   232,   233,   234,   235,   236,
-     357,   237,   238,   239,   167,   320,   643,   644,   645,   704,
-      45,    62,   175,   176,   177,   332,   178,   333,   168,   328,
-     647,   648,   649,   707,    47,    63,   191,   192,   193,   124,
-     293,   195,   336,   196,   337,   197,   345,   198,   339,   199,
-     340,   200,   342,   201,   341,   202,   344,   203,   343,   204,
-     338,   170,   329,   651,   710,   125,   304,   613,   316,   420,
-     421,   422,   423,   424,   505,   126,   127,   308,   634,   635,
-     636,   695,   637,   696,   128,   309,    55,    67,   262,   263,
-     264,   265,   366,   266,   367,   267,   268,   369,   269,   270,
-     271,   372,   545,   272,   373,   273,   274,   275,   276,   377,
-     552,   277,   378,    83,   285,    84,   286,    85,   284,   557,
-     558,   559,   653,   775,   776,   777,   785,   786,   787,   788,
-     793,   789,   791,   803,   804,   805,   812,   813,   814,   819,
-     815,   816,   817
+       0,    12,    13,    14,    15,    16,    17,    18,    19,    20,
+      21,    22,    23,    32,    33,    34,    57,   512,    72,    73,
+      35,    56,    69,    70,   524,   667,   732,   733,   109,    37,
+      58,    80,    81,    82,   293,    39,    59,   110,   111,   112,
+     113,   114,   115,   116,   117,   311,   118,   312,   119,   120,
+     121,   300,   138,   139,    41,    60,   140,   325,   141,   326,
+     527,   142,   122,   304,   123,   305,   597,   598,   599,   685,
+     792,   600,   686,   601,   687,   602,   688,   603,   223,   364,
+     605,   606,   607,   608,   609,   610,   611,   696,   612,   697,
+     124,   316,   631,   632,   633,   634,   635,   636,   637,   125,
+     318,   641,   642,   643,   714,    53,    66,   253,   254,   255,
+     376,   256,   377,   126,   319,   650,   651,   652,   653,   654,
+     655,   656,   657,   127,   313,   615,   616,   617,   701,    43,
+      61,   163,   164,   165,   335,   166,   331,   167,   332,   168,
+     333,   169,   336,   170,   337,   171,   342,   172,   340,   173,
+     174,   175,   128,   314,   619,   620,   621,   704,    49,    64,
+     224,   225,   226,   227,   228,   229,   230,   363,   231,   367,
+     232,   366,   233,   234,   368,   235,   129,   315,   623,   624,
+     625,   707,    51,    65,   242,   243,   244,   245,   246,   372,
+     247,   248,   249,   177,   334,   671,   672,   673,   735,    45,
+      62,   185,   186,   187,   347,   188,   348,   178,   343,   675,
+     676,   677,   738,    47,    63,   201,   202,   203,   130,   303,
+     205,   351,   206,   352,   207,   360,   208,   354,   209,   355,
+     210,   357,   211,   356,   212,   359,   213,   358,   214,   353,
+     180,   344,   679,   741,   131,   317,   639,   330,   439,   440,
+     441,   442,   443,   528,   132,   133,   321,   661,   662,   663,
+     725,   664,   726,   665,   134,   322,    55,    67,   272,   273,
+     274,   275,   381,   276,   382,   277,   278,   384,   279,   280,
+     281,   387,   567,   282,   388,   283,   284,   285,   286,   392,
+     574,   287,   393,    83,   295,    84,   296,    85,   294,   579,
+     580,   581,   681,   809,   810,   811,   819,   820,   821,   822,
+     827,   823,   825,   837,   838,   839,   846,   847,   848,   853,
+     849,   850,   851
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yytable_[] =
   {
-      79,   150,   229,   149,   173,   189,   212,   228,   242,   261,
-     166,   174,   190,   169,   418,   194,   230,   151,   231,   152,
-      68,   153,   419,   612,    25,   135,    26,    74,    27,   206,
-     226,   207,   208,   227,    24,    88,    89,   543,    36,   205,
-      98,    71,   135,    38,   240,   241,    89,   179,   180,   808,
-     171,   172,   809,   810,   811,   288,    92,    93,    94,   278,
-     289,   136,   137,   138,   206,    98,   207,   208,   310,   209,
-     210,   211,   279,   311,   139,    98,   206,   140,   141,   142,
-     143,   144,   145,   280,   314,   330,   146,   147,   334,   315,
-     331,    86,   281,   335,   148,   413,    87,    88,    89,   561,
-      78,    90,    91,   146,   562,   563,   564,   565,   566,   567,
-     568,   569,   570,   571,   680,    40,    78,   681,    92,    93,
-      94,    95,    96,    42,   206,   206,    97,    98,    78,   544,
-      75,    89,   179,   180,    44,   547,   548,   549,   550,    76,
-      77,    46,   363,   379,   310,    99,   100,   364,   380,   652,
-      48,    78,    78,    78,    28,    29,    30,    31,   101,    50,
-      98,   102,   654,    78,   551,   314,   668,   655,   103,   104,
-     656,   669,   105,   618,   619,   620,   621,   622,   623,   181,
-     129,   130,    52,   182,   183,   184,   185,   186,   187,    54,
-     188,   282,   780,   287,   781,   782,   600,   601,   602,   603,
-     291,   604,   668,   693,   697,   418,   292,   670,   694,   698,
-     733,    78,    78,   419,   296,    78,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,   379,   330,   363,
-      79,   334,   699,   764,   767,   794,   771,   823,   682,   346,
-     795,   683,   824,   381,   382,   297,   778,   806,    78,   779,
-     807,   240,   241,   415,   754,   755,   756,   757,   414,   502,
-     503,   632,   633,   298,   299,   416,   307,   324,   417,   325,
-     150,   347,   149,   350,   354,   355,   173,   356,   360,   166,
-     358,   359,   169,   174,   365,   368,   151,   370,   152,   189,
-     153,   371,   374,   375,   376,   383,   190,   229,   212,   194,
-     384,   385,   228,   386,   387,   389,   392,   390,   391,   393,
-     394,   230,   395,   231,   396,   397,   398,   399,   400,   401,
-     402,   261,   247,   248,   249,   250,   251,   252,   253,   254,
-     255,   256,   257,   258,   259,   260,   403,   404,   405,   406,
-     407,   408,   410,   411,   425,   426,   427,   428,   429,   430,
-     485,   486,   431,   432,   433,   434,   435,   436,   437,   439,
-     440,   442,   443,   444,    78,   445,   446,   447,   448,   449,
-     450,   451,   453,   454,   455,   456,   457,   458,   459,   461,
-     462,   464,   465,   468,   467,   469,   470,   471,   472,   473,
-     474,   475,   476,   477,   478,   479,   480,   482,   506,   488,
-     546,   483,   484,   487,   489,   490,   491,   492,   493,   494,
-     495,   496,   508,   507,   497,   498,   499,   500,   511,   509,
-     510,   512,   517,   518,   640,    26,   580,   580,   513,   539,
-     514,   572,   572,   515,   588,   556,   592,   596,   516,   519,
-     614,   261,   522,   523,   415,   525,   554,   526,   642,   414,
-     646,   650,   527,   528,   529,   530,   416,   531,   532,   417,
-     533,   534,   535,   536,   537,   538,   540,   661,   662,   663,
-     541,   664,   665,   673,   711,   672,   676,   675,   678,   679,
-     685,   542,   553,   686,   700,   687,   688,   689,   690,   691,
-     692,   706,   709,   705,   747,   703,   708,   712,   714,   715,
-     716,   717,   723,   724,   743,   744,   718,   752,   746,   753,
-     792,   520,   796,   765,   719,   766,   720,   772,   774,   759,
-     721,   722,   798,   802,   736,   737,   800,   820,   821,   822,
-     825,   524,   555,   409,   560,   738,   739,   388,   587,   725,
-     732,   412,   735,   734,   466,   742,   727,   740,   726,   438,
-     741,   797,   729,   728,   760,   730,   761,   762,   763,   768,
-     769,   770,   460,   773,   731,   463,   801,   749,   748,   830,
-     826,   827,   828,   441,   751,   750,   481,   641,   745,   713,
-     452,   790,   638,   799,   818,   829,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   580,     0,     0,     0,     0,
-     572,   150,     0,   149,   229,     0,   212,     0,     0,   228,
-     166,     0,     0,   169,     0,     0,   242,   151,   230,   152,
-     231,   153,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   173,     0,     0,   189,
-       0,     0,     0,   174,     0,     0,   190,     0,     0,   194,
+      79,   159,   239,   158,   183,   199,   222,   238,   252,   271,
+     176,   184,   200,   179,   437,   204,   240,   160,   241,   161,
+      68,   162,   438,   638,    25,   143,    26,    74,    27,   710,
+     565,   101,   711,   250,   251,   513,    88,    89,   525,   526,
+     215,   181,   182,   216,   236,   217,   218,   237,    89,   189,
+     190,   143,   569,   570,   571,   572,   658,   659,   660,    92,
+      93,    94,    89,   189,   190,   250,   251,   144,   145,   146,
+     216,   101,   217,   218,    24,   219,   220,   221,    36,   543,
+     147,   573,   101,   148,   149,   150,   151,   152,   153,   154,
+      78,    38,    86,   155,   156,    40,   101,   216,    87,    88,
+      89,   157,   191,    90,    91,    42,   192,   193,   194,   195,
+     196,   197,    44,   198,    46,   298,    71,   432,    48,   155,
+     299,    78,    92,    93,    94,    95,    96,    97,    98,    99,
+     566,   216,    78,   100,   101,   511,   511,    50,    75,   644,
+     645,   646,   647,   648,   649,    52,   842,    76,    77,   843,
+     844,   845,   323,   102,   103,   712,   288,   324,   713,    78,
+      78,    78,    28,    29,    30,    31,   104,    54,   328,   105,
+     345,   289,    78,   329,   349,   346,   106,   107,   290,   350,
+     511,   108,   378,   583,   291,   292,    78,   379,   584,   585,
+     586,   587,   588,   589,   590,   591,   592,   593,   594,   595,
+     814,   297,   815,   816,   626,   627,   628,   629,   301,   630,
+     394,   323,   362,   216,   437,   395,   680,   766,   682,   361,
+      78,   302,   438,   683,    78,   306,   257,   258,   259,   260,
+     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
+      79,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,   328,   396,   397,   698,   698,   684,   723,   728,
+     699,   700,   307,   724,   729,   394,   345,   434,    78,   378,
+     730,   798,   433,   349,   801,   828,   857,   370,   805,   435,
+     829,   858,   436,   812,   398,   159,   813,   158,   135,   136,
+     840,   183,   137,   841,   176,   308,   309,   179,   184,   310,
+     320,   160,    78,   161,   199,   162,   788,   789,   790,   791,
+     327,   200,   239,   222,   204,   338,   339,   238,   341,   365,
+     369,   371,   410,   373,   375,   374,   240,   380,   241,   383,
+     385,   386,   389,   390,   391,   399,   271,   400,   401,   402,
+     404,   405,   406,   407,   408,   409,   411,   412,   415,   413,
+     414,   416,   417,   418,   419,   420,   421,   422,   423,   425,
+     424,   426,   428,   429,   430,   505,   506,   444,   445,   446,
+     447,   448,   449,   450,   451,   452,   453,   454,   455,   456,
+     457,   459,   460,   462,   463,   464,   465,   466,   467,   468,
+     469,   470,   471,   473,   474,   475,   476,   477,   478,   481,
+     479,   484,   485,   482,   488,   487,   489,   491,   490,   492,
+     494,   493,   495,   499,   496,   500,   502,   497,   508,   568,
+     498,   503,   504,   507,   509,   510,    26,   514,   515,   516,
+     517,   518,   519,   531,   750,   520,   521,   522,   523,   529,
+     530,   532,   533,   534,   535,   536,   604,   604,   537,   561,
+     538,   596,   596,   539,   540,   541,   542,   614,   618,   622,
+     640,   668,   670,   544,   271,   545,   576,   434,   674,   689,
+     690,   691,   433,   692,   693,   547,   694,   695,   703,   435,
+     548,   549,   436,   702,   705,   550,   551,   706,   552,   553,
+     709,   678,   708,   716,   715,   717,   718,   719,   720,   554,
+     721,   722,   727,   555,   556,   557,   736,   737,   739,   740,
+     781,   742,   743,   558,   559,   745,   560,   746,   747,   748,
+     756,   757,   776,   777,   786,   546,   578,   780,   787,   403,
+     799,   826,   800,   806,   562,   808,   830,   832,   836,   563,
+     834,   854,   564,   855,   575,   856,   859,   427,   731,   577,
+     431,   613,   582,   734,   758,   765,   768,   749,   767,   486,
+     775,   760,   759,   762,   751,   752,   761,   763,   458,   480,
+     783,   782,   764,   784,   483,   461,   753,   669,   785,   755,
+     754,   472,   778,   769,   770,   771,   772,   773,   774,   793,
+     794,   860,   779,   744,   666,   501,   824,   795,   833,   796,
+     852,   797,   802,   803,   863,   804,   807,     0,   831,     0,
+       0,   835,     0,     0,     0,   861,     0,     0,   862,   864,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   604,     0,     0,     0,     0,
+     596,   159,     0,   158,   239,     0,   222,     0,     0,   238,
+     176,     0,     0,   179,     0,     0,   252,   160,   240,   161,
+     241,   162,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   183,     0,     0,
+     199,     0,     0,     0,   184,     0,     0,   200,     0,     0,
+     204,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   784,     0,     0,     0,     0,   783,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   784,     0,     0,     0,     0,   783
+       0,     0,     0,     0,     0,     0,     0,     0,   818,     0,
+       0,     0,     0,   817,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   818,     0,     0,     0,     0,
+     817
   };
 
-  const short int
+  const short
   Dhcp4Parser::yycheck_[] =
   {
       58,    61,    65,    61,    62,    63,    64,    65,    66,    67,
-      61,    62,    63,    61,   316,    63,    65,    61,    65,    61,
-      56,    61,   316,   495,     5,     7,     7,    10,     9,    48,
-      49,    50,    51,    52,     0,    17,    18,    15,     7,    23,
-      47,   135,     7,     7,    79,    80,    18,    19,    20,   116,
-      57,    58,   119,   120,   121,     3,    38,    39,    40,     6,
-       8,    43,    44,    45,    48,    47,    50,    51,     3,    53,
-      54,    55,     3,     8,    56,    47,    48,    59,    60,    61,
-      62,    63,    64,     4,     3,     3,    68,    69,     3,     8,
-       8,    11,     8,     8,    76,    67,    16,    17,    18,    23,
-     135,    21,    22,    68,    28,    29,    30,    31,    32,    33,
-      34,    35,    36,    37,     3,     7,   135,     6,    38,    39,
-      40,    41,    42,     7,    48,    48,    46,    47,   135,   107,
-     113,    18,    19,    20,     7,   109,   110,   111,   112,   122,
-     123,     7,     3,     3,     3,    65,    66,     8,     8,     8,
-       7,   135,   135,   135,   135,   136,   137,   138,    78,     7,
-      47,    81,     3,   135,   138,     3,     3,     8,    88,    89,
-       8,     8,    92,    82,    83,    84,    85,    86,    87,    66,
-      12,    13,     7,    70,    71,    72,    73,    74,    75,     7,
-      77,     3,   115,     4,   117,   118,    70,    71,    72,    73,
-       4,    75,     3,     3,     3,   507,     4,     8,     8,     8,
-     682,   135,   135,   507,     4,   135,   124,   125,   126,   127,
-     128,   129,   130,   131,   132,   133,   134,     3,     3,     3,
-     288,     3,     8,     8,     8,     3,     8,     3,     3,     8,
-       8,     6,     8,   279,   280,     4,     3,     3,   135,     6,
-       6,    79,    80,   316,    24,    25,    26,    27,   316,    14,
-      15,    90,    91,     4,     4,   316,     4,     4,   316,     4,
-     330,     3,   330,     4,     4,     8,   334,     3,     3,   330,
-       4,     8,   330,   334,     4,     4,   330,     4,   330,   347,
-     330,     4,     4,     4,     4,   135,   347,   360,   356,   347,
-       4,     4,   360,     4,     4,     4,     4,   138,   138,     4,
-       4,   360,   136,   360,   136,   136,   136,     4,     4,     4,
-       4,   379,    93,    94,    95,    96,    97,    98,    99,   100,
-     101,   102,   103,   104,   105,   106,     4,     4,     4,   136,
+      61,    62,    63,    61,   330,    63,    65,    61,    65,    61,
+      56,    61,   330,   518,     5,     7,     7,    10,     9,     3,
+      15,    53,     6,    86,    87,   416,    18,    19,    14,    15,
+      24,    63,    64,    54,    55,    56,    57,    58,    19,    20,
+      21,     7,   117,   118,   119,   120,    97,    98,    99,    41,
+      42,    43,    19,    20,    21,    86,    87,    49,    50,    51,
+      54,    53,    56,    57,     0,    59,    60,    61,     7,   460,
+      62,   146,    53,    65,    66,    67,    68,    69,    70,    71,
+     143,     7,    11,    75,    76,     7,    53,    54,    17,    18,
+      19,    83,    73,    22,    23,     7,    77,    78,    79,    80,
+      81,    82,     7,    84,     7,     3,   143,    74,     7,    75,
+       8,   143,    41,    42,    43,    44,    45,    46,    47,    48,
+     115,    54,   143,    52,    53,   415,   416,     7,   121,    89,
+      90,    91,    92,    93,    94,     7,   124,   130,   131,   127,
+     128,   129,     3,    72,    73,     3,     6,     8,     6,   143,
+     143,   143,   143,   144,   145,   146,    85,     7,     3,    88,
+       3,     3,   143,     8,     3,     8,    95,    96,     4,     8,
+     460,   100,     3,    24,     8,     3,   143,     8,    29,    30,
+      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
+     123,     4,   125,   126,    77,    78,    79,    80,     4,    82,
+       3,     3,     3,    54,   530,     8,     8,   712,     3,     8,
+     143,     4,   530,     8,   143,     4,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     298,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,     3,   289,   290,     3,     3,     8,     3,     3,
+       8,     8,     4,     8,     8,     3,     3,   330,   143,     3,
+       8,     8,   330,     3,     8,     3,     3,     8,     8,   330,
+       8,     8,   330,     3,   143,   345,     6,   345,    12,    13,
+       3,   349,    16,     6,   345,     4,     4,   345,   349,     4,
+       4,   345,   143,   345,   362,   345,    25,    26,    27,    28,
+       4,   362,   375,   371,   362,     4,     4,   375,     4,     4,
+       4,     3,   144,     4,     3,     8,   375,     4,   375,     4,
+       4,     4,     4,     4,     4,     4,   394,     4,     4,     4,
+       4,   146,   146,     4,     4,     4,   144,   144,     4,   144,
+     144,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+     144,     4,     4,     4,   146,   401,   402,     4,     4,     4,
+       4,     4,     4,     4,   144,   146,     4,   145,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-     386,   387,     4,   136,   138,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   135,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   136,     4,     4,     4,   138,     4,
-     138,     4,     4,     4,   138,     4,   136,     4,   136,   136,
-       4,     4,   138,   138,   138,     4,     4,     4,     8,   135,
-     108,     7,     7,     7,     7,     7,     5,     5,     5,     5,
-       5,     5,   135,     3,     7,     7,     7,     5,     5,   135,
-     135,   135,     5,     7,     4,     7,   489,   490,   135,   465,
-     135,   489,   490,   135,     7,   114,     7,     7,   135,   135,
-       7,   499,   135,   135,   507,   135,   482,   135,     7,   507,
-       7,    77,   135,   135,   135,   135,   507,   135,   135,   507,
-     135,   135,   135,   135,   135,   135,   135,     4,     4,     4,
-     135,     4,     4,     3,     8,     6,     3,     6,     6,     3,
-       6,   135,   135,     3,   135,     4,     4,     4,     4,     4,
-       4,     3,     3,     6,     3,   135,     6,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,   136,     4,     6,     5,
-       4,   440,     4,     8,   138,     8,   136,     8,     7,   135,
-     138,   136,     4,     7,   136,   136,     5,     4,     4,     4,
-       4,   444,   483,   310,   487,   136,   136,   288,   490,   668,
-     680,   314,   686,   684,   363,   693,   673,   136,   671,   330,
-     136,   136,   676,   674,   135,   677,   135,   135,   135,   135,
-     135,   135,   356,   135,   679,   360,   135,   706,   704,   135,
-     138,   136,   136,   334,   709,   707,   379,   507,   697,   654,
-     347,   778,   499,   794,   806,   823,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   668,    -1,    -1,    -1,    -1,
-     668,   671,    -1,   671,   677,    -1,   674,    -1,    -1,   677,
-     671,    -1,    -1,   671,    -1,    -1,   684,   671,   677,   671,
-     677,   671,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   704,    -1,    -1,   707,
-      -1,    -1,    -1,   704,    -1,    -1,   707,    -1,    -1,   707,
+       4,     4,     4,     4,     4,   144,     4,     4,     4,     4,
+     146,     4,     4,   146,     4,   146,     4,     4,   144,   144,
+       4,   144,     4,     4,   146,     4,     4,   146,   143,   116,
+     146,     7,     7,     7,     7,     7,     7,     5,     5,     5,
+       5,     5,     5,   143,   146,     7,     7,     7,     5,     8,
+       3,   143,   143,     5,   143,   143,   509,   510,   143,   485,
+     143,   509,   510,   143,     5,     7,   143,     7,     7,     7,
+       7,     4,     7,   143,   522,   143,   502,   530,     7,     4,
+       4,     4,   530,     4,     4,   143,     4,     4,     3,   530,
+     143,   143,   530,     6,     6,   143,   143,     3,   143,   143,
+       3,    84,     6,     3,     6,     4,     4,     4,     4,   143,
+       4,     4,     4,   143,   143,   143,     6,     3,     6,     3,
+       3,     8,     4,   143,   143,     4,   143,     4,     4,     4,
+       4,     4,     4,     4,     4,   464,   122,     6,     5,   298,
+       8,     4,     8,     8,   143,     7,     4,     4,     7,   143,
+       5,     4,   143,     4,   143,     4,     4,   323,   143,   503,
+     328,   510,   507,   143,   698,   710,   716,   144,   714,   378,
+     723,   703,   701,   706,   144,   144,   704,   707,   345,   371,
+     737,   735,   709,   738,   375,   349,   144,   530,   740,   144,
+     146,   362,   146,   144,   144,   144,   144,   144,   144,   143,
+     143,   146,   728,   682,   522,   394,   812,   143,   828,   143,
+     840,   143,   143,   143,   857,   143,   143,    -1,   144,    -1,
+      -1,   143,    -1,    -1,    -1,   144,    -1,    -1,   144,   143,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   698,    -1,    -1,    -1,    -1,
+     698,   701,    -1,   701,   707,    -1,   704,    -1,    -1,   707,
+     701,    -1,    -1,   701,    -1,    -1,   714,   701,   707,   701,
+     707,   701,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   735,    -1,    -1,
+     738,    -1,    -1,    -1,   735,    -1,    -1,   738,    -1,    -1,
+     738,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   777,    -1,    -1,    -1,    -1,   777,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   794,    -1,    -1,    -1,    -1,   794
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   811,    -1,
+      -1,    -1,    -1,   811,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   828,    -1,    -1,    -1,    -1,
+     828
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yystos_[] =
   {
-       0,   124,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   140,   141,   142,   143,   144,   145,   146,   147,
-     148,   149,   150,   151,     0,     5,     7,     9,   135,   136,
-     137,   138,   152,   153,   154,   159,     7,   168,     7,   174,
-       7,   188,     7,   260,     7,   329,     7,   343,     7,   288,
-       7,   312,     7,   236,     7,   395,   160,   155,   169,   175,
-     189,   261,   330,   344,   289,   313,   237,   396,   152,   161,
-     162,   135,   157,   158,    10,   113,   122,   123,   135,   167,
-     170,   171,   172,   422,   424,   426,    11,    16,    17,    18,
-      21,    22,    38,    39,    40,    41,    42,    46,    47,    65,
-      66,    78,    81,    88,    89,    92,   167,   176,   177,   178,
-     179,   180,   181,   182,   183,   184,   195,   197,   221,   230,
-     244,   254,   282,   306,   348,   374,   384,   385,   393,    12,
-      13,   186,   187,   190,   192,     7,    43,    44,    45,    56,
-      59,    60,    61,    62,    63,    64,    68,    69,    76,   167,
-     178,   179,   180,   183,   262,   263,   264,   266,   268,   270,
-     272,   274,   276,   278,   280,   281,   306,   323,   337,   348,
-     370,    57,    58,   167,   306,   331,   332,   333,   335,    19,
-      20,    66,    70,    71,    72,    73,    74,    75,    77,   167,
-     306,   345,   346,   347,   348,   350,   352,   354,   356,   358,
-     360,   362,   364,   366,   368,    23,    48,    50,    51,    53,
-      54,    55,   167,   211,   290,   291,   292,   293,   294,   295,
-     296,   298,   300,   302,   303,   305,    49,    52,   167,   211,
-     294,   300,   314,   315,   316,   317,   318,   320,   321,   322,
-      79,    80,   167,   238,   239,   240,   242,    93,    94,    95,
-      96,    97,    98,    99,   100,   101,   102,   103,   104,   105,
-     106,   167,   397,   398,   399,   400,   402,   404,   405,   407,
-     408,   409,   412,   414,   415,   416,   417,   420,     6,     3,
-       4,     8,     3,   173,   427,   423,   425,     4,     3,     8,
-     185,     4,     4,   349,   196,   198,     4,     4,     4,     4,
-     255,   283,   307,   222,   375,   231,   245,     4,   386,   394,
-       3,     8,   191,   193,     3,     8,   377,   267,   269,   271,
-     324,   265,   273,   275,     4,     4,   279,   277,   338,   371,
-       3,     8,   334,   336,     3,     8,   351,   353,   369,   357,
-     359,   363,   361,   367,   365,   355,     8,     3,   297,   212,
-       4,   301,   299,   304,     4,     8,     3,   319,     4,     8,
-       3,   241,   243,     3,     8,     4,   401,   403,     4,   406,
-       4,     4,   410,   413,     4,     4,     4,   418,   421,     3,
-       8,   152,   152,   135,     4,     4,     4,     4,   171,     4,
-     138,   138,     4,     4,     4,   136,   136,   136,   136,     4,
-       4,     4,     4,     4,     4,     4,   136,     4,     4,   177,
-       4,     4,   187,    67,   167,   211,   306,   348,   350,   352,
-     378,   379,   380,   381,   382,     4,     4,     4,     4,     4,
-       4,     4,   136,   138,     4,     4,     4,     4,   263,     4,
-       4,   332,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,   347,     4,     4,   136,     4,     4,     4,   138,
-     292,     4,   138,   316,     4,     4,   239,   138,     4,     4,
-     136,     4,   136,   136,     4,     4,   138,   138,   138,     4,
-       4,   398,     4,     7,     7,   152,   152,     7,   135,     7,
-       7,     5,     5,     5,     5,     5,     5,     7,     7,     7,
-       5,   163,    14,    15,   194,   383,     8,     3,   135,   135,
-     135,     5,   135,   135,   135,   135,   135,     5,     7,   135,
-     154,   156,   135,   135,   163,   135,   135,   135,   135,   135,
-     135,   135,   135,   135,   135,   135,   135,   135,   135,   152,
-     135,   135,   135,    15,   107,   411,   108,   109,   110,   111,
-     112,   138,   419,   135,   152,   176,   114,   428,   429,   430,
-     186,    23,    28,    29,    30,    31,    32,    33,    34,    35,
-      36,    37,   167,   199,   200,   201,   204,   206,   208,   210,
-     211,   213,   214,   215,   216,   217,   219,   199,     7,   256,
-     257,   258,     7,   284,   285,   286,     7,   308,   309,   310,
-      70,    71,    72,    73,    75,   223,   224,   225,   226,   227,
-     228,   229,   276,   376,     7,   232,   233,   234,    82,    83,
-      84,    85,    86,    87,   246,   247,   248,   249,   250,   251,
-     252,   253,    90,    91,   387,   388,   389,   391,   397,   164,
-       4,   380,     7,   325,   326,   327,     7,   339,   340,   341,
-      77,   372,     8,   431,     3,     8,     8,   202,   205,   207,
-     209,     4,     4,     4,     4,     4,   218,   220,     3,     8,
-       8,   259,     6,     3,   287,     6,     3,   311,     6,     3,
-       3,     6,     3,     6,   235,     6,     3,     4,     4,     4,
-       4,     4,     4,     3,     8,   390,   392,     3,     8,     8,
-     135,   165,   166,   135,   328,     6,     3,   342,     6,     3,
-     373,     8,     4,   429,     4,     4,     4,     4,   136,   138,
-     136,   138,   136,     4,     4,   200,   262,   258,   290,   286,
-     314,   310,   224,   276,   238,   234,   136,   136,   136,   136,
-     136,   136,   247,     4,     4,   388,     6,     3,   331,   327,
-     345,   341,     4,     5,    24,    25,    26,    27,   203,   135,
-     135,   135,   135,   135,     8,     8,     8,     8,   135,   135,
-     135,     8,     8,   135,     7,   432,   433,   434,     3,     6,
-     115,   117,   118,   167,   211,   435,   436,   437,   438,   440,
-     433,   441,     4,   439,     3,     8,     4,   136,     4,   436,
-       5,   135,     7,   442,   443,   444,     3,     6,   116,   119,
-     120,   121,   445,   446,   447,   449,   450,   451,   443,   448,
-       4,     4,     4,     3,     8,     4,   138,   136,   136,   446,
-     135
+       0,   132,   133,   134,   135,   136,   137,   138,   139,   140,
+     141,   142,   148,   149,   150,   151,   152,   153,   154,   155,
+     156,   157,   158,   159,     0,     5,     7,     9,   143,   144,
+     145,   146,   160,   161,   162,   167,     7,   176,     7,   182,
+       7,   201,     7,   276,     7,   346,     7,   360,     7,   305,
+       7,   329,     7,   252,     7,   413,   168,   163,   177,   183,
+     202,   277,   347,   361,   306,   330,   253,   414,   160,   169,
+     170,   143,   165,   166,    10,   121,   130,   131,   143,   175,
+     178,   179,   180,   440,   442,   444,    11,    17,    18,    19,
+      22,    23,    41,    42,    43,    44,    45,    46,    47,    48,
+      52,    53,    72,    73,    85,    88,    95,    96,   100,   175,
+     184,   185,   186,   187,   188,   189,   190,   191,   193,   195,
+     196,   197,   209,   211,   237,   246,   260,   270,   299,   323,
+     365,   391,   401,   402,   411,    12,    13,    16,   199,   200,
+     203,   205,   208,     7,    49,    50,    51,    62,    65,    66,
+      67,    68,    69,    70,    71,    75,    76,    83,   175,   186,
+     187,   188,   196,   278,   279,   280,   282,   284,   286,   288,
+     290,   292,   294,   296,   297,   298,   323,   340,   354,   365,
+     387,    63,    64,   175,   323,   348,   349,   350,   352,    20,
+      21,    73,    77,    78,    79,    80,    81,    82,    84,   175,
+     323,   362,   363,   364,   365,   367,   369,   371,   373,   375,
+     377,   379,   381,   383,   385,    24,    54,    56,    57,    59,
+      60,    61,   175,   225,   307,   308,   309,   310,   311,   312,
+     313,   315,   317,   319,   320,   322,    55,    58,   175,   225,
+     311,   317,   331,   332,   333,   334,   335,   337,   338,   339,
+      86,    87,   175,   254,   255,   256,   258,   101,   102,   103,
+     104,   105,   106,   107,   108,   109,   110,   111,   112,   113,
+     114,   175,   415,   416,   417,   418,   420,   422,   423,   425,
+     426,   427,   430,   432,   433,   434,   435,   438,     6,     3,
+       4,     8,     3,   181,   445,   441,   443,     4,     3,     8,
+     198,     4,     4,   366,   210,   212,     4,     4,     4,     4,
+       4,   192,   194,   271,   300,   324,   238,   392,   247,   261,
+       4,   403,   412,     3,     8,   204,   206,     4,     3,     8,
+     394,   283,   285,   287,   341,   281,   289,   291,     4,     4,
+     295,     4,   293,   355,   388,     3,     8,   351,   353,     3,
+       8,   368,   370,   386,   374,   376,   380,   378,   384,   382,
+     372,     8,     3,   314,   226,     4,   318,   316,   321,     4,
+       8,     3,   336,     4,     8,     3,   257,   259,     3,     8,
+       4,   419,   421,     4,   424,     4,     4,   428,   431,     4,
+       4,     4,   436,   439,     3,     8,   160,   160,   143,     4,
+       4,     4,     4,   179,     4,   146,   146,     4,     4,     4,
+     144,   144,   144,   144,   144,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,   144,     4,     4,   185,     4,     4,
+     146,   200,    74,   175,   225,   323,   365,   367,   369,   395,
+     396,   397,   398,   399,     4,     4,     4,     4,     4,     4,
+       4,   144,   146,     4,   145,     4,     4,     4,   279,     4,
+       4,   349,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,   364,     4,     4,   144,     4,     4,     4,   146,
+     309,     4,   146,   333,     4,     4,   255,   146,     4,     4,
+     144,     4,   144,   144,     4,     4,   146,   146,   146,     4,
+       4,   416,     4,     7,     7,   160,   160,     7,   143,     7,
+       7,   162,   164,   164,     5,     5,     5,     5,     5,     5,
+       7,     7,     7,     5,   171,    14,    15,   207,   400,     8,
+       3,   143,   143,   143,     5,   143,   143,   143,   143,   143,
+       5,     7,   143,   164,   143,   143,   171,   143,   143,   143,
+     143,   143,   143,   143,   143,   143,   143,   143,   143,   143,
+     143,   160,   143,   143,   143,    15,   115,   429,   116,   117,
+     118,   119,   120,   146,   437,   143,   160,   184,   122,   446,
+     447,   448,   199,    24,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,   175,   213,   214,   215,
+     218,   220,   222,   224,   225,   227,   228,   229,   230,   231,
+     232,   233,   235,   213,     7,   272,   273,   274,     7,   301,
+     302,   303,     7,   325,   326,   327,    77,    78,    79,    80,
+      82,   239,   240,   241,   242,   243,   244,   245,   292,   393,
+       7,   248,   249,   250,    89,    90,    91,    92,    93,    94,
+     262,   263,   264,   265,   266,   267,   268,   269,    97,    98,
+      99,   404,   405,   406,   408,   410,   415,   172,     4,   397,
+       7,   342,   343,   344,     7,   356,   357,   358,    84,   389,
+       8,   449,     3,     8,     8,   216,   219,   221,   223,     4,
+       4,     4,     4,     4,     4,     4,   234,   236,     3,     8,
+       8,   275,     6,     3,   304,     6,     3,   328,     6,     3,
+       3,     6,     3,     6,   251,     6,     3,     4,     4,     4,
+       4,     4,     4,     3,     8,   407,   409,     4,     3,     8,
+       8,   143,   173,   174,   143,   345,     6,     3,   359,     6,
+       3,   390,     8,     4,   447,     4,     4,     4,     4,   144,
+     146,   144,   144,   144,   146,   144,     4,     4,   214,   278,
+     274,   307,   303,   331,   327,   240,   292,   254,   250,   144,
+     144,   144,   144,   144,   144,   263,     4,     4,   146,   405,
+       6,     3,   348,   344,   362,   358,     4,     5,    25,    26,
+      27,    28,   217,   143,   143,   143,   143,   143,     8,     8,
+       8,     8,   143,   143,   143,     8,     8,   143,     7,   450,
+     451,   452,     3,     6,   123,   125,   126,   175,   225,   453,
+     454,   455,   456,   458,   451,   459,     4,   457,     3,     8,
+       4,   144,     4,   454,     5,   143,     7,   460,   461,   462,
+       3,     6,   124,   127,   128,   129,   463,   464,   465,   467,
+     468,   469,   461,   466,     4,     4,     4,     3,     8,     4,
+     146,   144,   144,   464,   143
   };
 
-  const unsigned short int
+  const short
   Dhcp4Parser::yyr1_[] =
   {
-       0,   139,   141,   140,   142,   140,   143,   140,   144,   140,
-     145,   140,   146,   140,   147,   140,   148,   140,   149,   140,
-     150,   140,   151,   140,   152,   152,   152,   152,   152,   152,
-     152,   153,   155,   154,   156,   157,   157,   158,   158,   160,
-     159,   161,   161,   162,   162,   164,   163,   165,   165,   166,
-     166,   167,   169,   168,   170,   170,   171,   171,   171,   171,
-     171,   173,   172,   175,   174,   176,   176,   177,   177,   177,
-     177,   177,   177,   177,   177,   177,   177,   177,   177,   177,
-     177,   177,   177,   177,   177,   177,   177,   177,   178,   179,
-     180,   181,   182,   183,   185,   184,   186,   186,   187,   187,
-     189,   188,   191,   190,   193,   192,   194,   194,   196,   195,
-     198,   197,   199,   199,   200,   200,   200,   200,   200,   200,
-     200,   200,   200,   200,   200,   200,   200,   202,   201,   203,
-     203,   203,   203,   205,   204,   207,   206,   209,   208,   210,
-     212,   211,   213,   214,   215,   216,   218,   217,   220,   219,
-     222,   221,   223,   223,   224,   224,   224,   224,   224,   225,
-     226,   227,   228,   229,   231,   230,   232,   232,   233,   233,
-     235,   234,   237,   236,   238,   238,   238,   239,   239,   241,
-     240,   243,   242,   245,   244,   246,   246,   247,   247,   247,
-     247,   247,   247,   248,   249,   250,   251,   252,   253,   255,
-     254,   256,   256,   257,   257,   259,   258,   261,   260,   262,
-     262,   263,   263,   263,   263,   263,   263,   263,   263,   263,
-     263,   263,   263,   263,   263,   263,   263,   263,   263,   263,
-     263,   265,   264,   267,   266,   269,   268,   271,   270,   273,
-     272,   275,   274,   277,   276,   279,   278,   280,   281,   283,
-     282,   284,   284,   285,   285,   287,   286,   289,   288,   290,
-     290,   291,   291,   292,   292,   292,   292,   292,   292,   292,
-     292,   293,   294,   295,   297,   296,   299,   298,   301,   300,
-     302,   304,   303,   305,   307,   306,   308,   308,   309,   309,
-     311,   310,   313,   312,   314,   314,   315,   315,   316,   316,
-     316,   316,   316,   316,   317,   319,   318,   320,   321,   322,
+       0,   147,   149,   148,   150,   148,   151,   148,   152,   148,
+     153,   148,   154,   148,   155,   148,   156,   148,   157,   148,
+     158,   148,   159,   148,   160,   160,   160,   160,   160,   160,
+     160,   161,   163,   162,   164,   165,   165,   166,   166,   168,
+     167,   169,   169,   170,   170,   172,   171,   173,   173,   174,
+     174,   175,   177,   176,   178,   178,   179,   179,   179,   179,
+     179,   181,   180,   183,   182,   184,   184,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   186,   187,   188,   189,   190,   192,   191,   194,   193,
+     195,   196,   198,   197,   199,   199,   200,   200,   200,   202,
+     201,   204,   203,   206,   205,   207,   207,   208,   210,   209,
+     212,   211,   213,   213,   214,   214,   214,   214,   214,   214,
+     214,   214,   214,   214,   214,   214,   214,   214,   214,   216,
+     215,   217,   217,   217,   217,   219,   218,   221,   220,   223,
+     222,   224,   226,   225,   227,   228,   229,   230,   231,   232,
+     234,   233,   236,   235,   238,   237,   239,   239,   240,   240,
+     240,   240,   240,   241,   242,   243,   244,   245,   247,   246,
+     248,   248,   249,   249,   251,   250,   253,   252,   254,   254,
+     254,   255,   255,   257,   256,   259,   258,   261,   260,   262,
+     262,   263,   263,   263,   263,   263,   263,   264,   265,   266,
+     267,   268,   269,   271,   270,   272,   272,   273,   273,   275,
+     274,   277,   276,   278,   278,   279,   279,   279,   279,   279,
+     279,   279,   279,   279,   279,   279,   279,   279,   279,   279,
+     279,   279,   279,   279,   279,   279,   281,   280,   283,   282,
+     285,   284,   287,   286,   289,   288,   291,   290,   293,   292,
+     295,   294,   296,   297,   298,   300,   299,   301,   301,   302,
+     302,   304,   303,   306,   305,   307,   307,   308,   308,   309,
+     309,   309,   309,   309,   309,   309,   309,   310,   311,   312,
+     314,   313,   316,   315,   318,   317,   319,   321,   320,   322,
      324,   323,   325,   325,   326,   326,   328,   327,   330,   329,
-     331,   331,   332,   332,   332,   332,   334,   333,   336,   335,
-     338,   337,   339,   339,   340,   340,   342,   341,   344,   343,
-     345,   345,   346,   346,   347,   347,   347,   347,   347,   347,
-     347,   347,   347,   347,   347,   347,   347,   349,   348,   351,
-     350,   353,   352,   355,   354,   357,   356,   359,   358,   361,
-     360,   363,   362,   365,   364,   367,   366,   369,   368,   371,
-     370,   373,   372,   375,   374,   376,   376,   377,   276,   378,
-     378,   379,   379,   380,   380,   380,   380,   380,   380,   380,
-     381,   383,   382,   384,   386,   385,   387,   387,   388,   388,
-     390,   389,   392,   391,   394,   393,   396,   395,   397,   397,
-     398,   398,   398,   398,   398,   398,   398,   398,   398,   398,
-     398,   398,   398,   398,   398,   399,   401,   400,   403,   402,
-     404,   406,   405,   407,   408,   410,   409,   411,   411,   413,
-     412,   414,   415,   416,   418,   417,   419,   419,   419,   419,
-     419,   421,   420,   423,   422,   425,   424,   427,   426,   428,
-     428,   429,   431,   430,   432,   432,   434,   433,   435,   435,
-     436,   436,   436,   436,   436,   437,   439,   438,   441,   440,
-     442,   442,   444,   443,   445,   445,   446,   446,   446,   446,
-     448,   447,   449,   450,   451
+     331,   331,   332,   332,   333,   333,   333,   333,   333,   333,
+     334,   336,   335,   337,   338,   339,   341,   340,   342,   342,
+     343,   343,   345,   344,   347,   346,   348,   348,   349,   349,
+     349,   349,   351,   350,   353,   352,   355,   354,   356,   356,
+     357,   357,   359,   358,   361,   360,   362,   362,   363,   363,
+     364,   364,   364,   364,   364,   364,   364,   364,   364,   364,
+     364,   364,   364,   366,   365,   368,   367,   370,   369,   372,
+     371,   374,   373,   376,   375,   378,   377,   380,   379,   382,
+     381,   384,   383,   386,   385,   388,   387,   390,   389,   392,
+     391,   393,   393,   394,   292,   395,   395,   396,   396,   397,
+     397,   397,   397,   397,   397,   397,   398,   400,   399,   401,
+     403,   402,   404,   404,   405,   405,   405,   407,   406,   409,
+     408,   410,   412,   411,   414,   413,   415,   415,   416,   416,
+     416,   416,   416,   416,   416,   416,   416,   416,   416,   416,
+     416,   416,   416,   417,   419,   418,   421,   420,   422,   424,
+     423,   425,   426,   428,   427,   429,   429,   431,   430,   432,
+     433,   434,   436,   435,   437,   437,   437,   437,   437,   439,
+     438,   441,   440,   443,   442,   445,   444,   446,   446,   447,
+     449,   448,   450,   450,   452,   451,   453,   453,   454,   454,
+     454,   454,   454,   455,   457,   456,   459,   458,   460,   460,
+     462,   461,   463,   463,   464,   464,   464,   464,   466,   465,
+     467,   468,   469
   };
 
-  const unsigned char
+  const signed char
   Dhcp4Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -3850,75 +4114,80 @@ namespace isc { namespace dhcp {
        3,     2,     0,     4,     1,     3,     1,     1,     1,     1,
        1,     0,     6,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     3,
-       3,     3,     3,     3,     0,     6,     1,     3,     1,     1,
-       0,     4,     0,     4,     0,     4,     1,     1,     0,     6,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     1,
-       1,     1,     1,     0,     4,     0,     4,     0,     4,     3,
-       0,     4,     3,     3,     3,     3,     0,     4,     0,     4,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     3,     3,     3,     3,     3,     0,     4,     0,     4,
+       3,     3,     0,     6,     1,     3,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     1,     1,     3,     0,     6,
        0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     1,     3,     1,     1,     1,     0,
-       4,     0,     4,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     1,     3,     3,     3,     3,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       4,     3,     0,     4,     3,     3,     3,     3,     3,     3,
+       0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
+       1,     1,     1,     0,     4,     0,     4,     0,     6,     1,
+       3,     1,     1,     1,     1,     1,     1,     3,     3,     3,
+       3,     3,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     0,     4,     0,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     1,     0,     4,     0,     4,     0,     4,
-       1,     0,     4,     3,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     0,     1,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     1,     1,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     0,     4,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     3,     3,     3,     0,     6,     0,     1,     1,
+       3,     0,     4,     0,     4,     0,     1,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     3,     1,
+       0,     4,     0,     4,     0,     4,     1,     0,     4,     3,
        0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
        0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       1,     0,     4,     1,     1,     3,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     1,     0,     4,     0,     4,     0,     6,     0,     1,
+       1,     3,     0,     4,     0,     4,     0,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
        4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       6,     0,     4,     0,     6,     1,     3,     0,     4,     0,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     3,     0,     6,     1,     3,     1,     1,
-       0,     4,     0,     4,     0,     6,     0,     4,     1,     3,
+       4,     0,     4,     0,     4,     0,     6,     0,     4,     0,
+       6,     1,     3,     0,     4,     0,     1,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
+       0,     6,     1,     3,     1,     1,     1,     0,     4,     0,
+       4,     3,     0,     6,     0,     4,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     3,     0,     4,     0,     4,
-       3,     0,     4,     3,     3,     0,     4,     1,     1,     0,
-       4,     3,     3,     3,     0,     4,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     0,     4,     0,     6,     1,
-       3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     3,     0,     4,     0,     6,
-       1,     3,     0,     4,     1,     3,     1,     1,     1,     1,
-       0,     4,     3,     3,     3
+       1,     1,     1,     3,     0,     4,     0,     4,     3,     0,
+       4,     3,     3,     0,     4,     1,     1,     0,     4,     3,
+       3,     3,     0,     4,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     0,     6,     1,     3,     1,
+       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     3,     0,     4,     0,     6,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     0,     4,
+       3,     3,     3
   };
 
 
-
+#if PARSER4_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp4Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
   "\"interfaces-config\"", "\"interfaces\"", "\"dhcp-socket-type\"",
-  "\"raw\"", "\"udp\"", "\"echo-client-id\"", "\"match-client-id\"",
-  "\"next-server\"", "\"server-hostname\"", "\"boot-file-name\"",
-  "\"lease-database\"", "\"hosts-database\"", "\"type\"", "\"memfile\"",
-  "\"mysql\"", "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"",
-  "\"host\"", "\"port\"", "\"persist\"", "\"lfc-interval\"",
+  "\"raw\"", "\"udp\"", "\"receive-ring\"", "\"echo-client-id\"",
+  "\"match-client-id\"", "\"next-server\"", "\"server-hostname\"",
+  "\"boot-file-name\"", "\"lease-database\"", "\"hosts-database\"",
+  "\"type\"", "\"memfile\"", "\"mysql\"", "\"postgresql\"", "\"cql\"",
+  "\"user\"", "\"password\"", "\"host\"", "\"port\"", "\"persist\"",
+  "\"lfc-interval\"", "\"load-threads\"", "\"lfc-max-leases\"",
   "\"readonly\"", "\"connect-timeout\"", "\"contact-points\"",
   "\"keyspace\"", "\"valid-lifetime\"", "\"renew-timer\"",
-  "\"rebind-timer\"", "\"decline-probation-period\"", "\"subnet4\"",
-  "\"4o6-interface\"", "\"4o6-interface-id\"", "\"4o6-subnet\"",
-  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
-  "\"space\"", "\"csv-format\"", "\"record-types\"", "\"encapsulate\"",
-  "\"array\"", "\"pools\"", "\"pool\"", "\"user-context\"", "\"subnet\"",
-  "\"interface\"", "\"interface-id\"", "\"id\"", "\"rapid-commit\"",
-  "\"reservation-mode\"", "\"host-reservation-identifiers\"",
+  "\"rebind-timer\"", "\"decline-probation-period\"",
+  "\"response-cache-ttl\"", "\"receive-queue\"", "\"rate-limit\"",
+  "\"subnet4\"", "\"4o6-interface\"", "\"4o6-interface-id\"",
+  "\"4o6-subnet\"", "\"option-def\"", "\"option-data\"", "\"name\"",
+  "\"data\"", "\"code\"", "\"space\"", "\"csv-format\"",
+  "\"record-types\"", "\"encapsulate\"", "\"array\"", "\"pools\"",
+  "\"pool\"", "\"user-context\"", "\"subnet\"", "\"interface\"",
+  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
+  "\"cache-threshold\"", "\"host-reservation-identifiers\"",
   "\"client-classes\"", "\"test\"", "\"client-class\"", "\"reservations\"",
   "\"duid\"", "\"hw-address\"", "\"circuit-id\"", "\"client-id\"",
   "\"hostname\"", "\"flex-id\"", "\"relay\"", "\"ip-address\"",
@@ -3927,9 +4196,9 @@ namespace isc { namespace dhcp {
   "\"flush-reclaimed-timer-wait-time\"", "\"hold-reclaimed-time\"",
   "\"max-reclaim-leases\"", "\"max-reclaim-time\"",
   "\"unwarned-reclaim-cycles\"", "\"dhcp4o6-port\"", "\"control-socket\"",
-  "\"socket-type\"", "\"socket-name\"", "\"dhcp-ddns\"",
-  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
-  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
+  "\"socket-type\"", "\"socket-name\"", "\"background-commands\"",
+  "\"dhcp-ddns\"", "\"enable-updates\"", "\"qualifying-suffix\"",
+  "\"server-ip\"", "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
   "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
   "\"always-include-fqdn\"", "\"override-no-update\"",
   "\"override-client-update\"", "\"replace-client-name\"",
@@ -3949,155 +4218,159 @@ namespace isc { namespace dhcp {
   "unknown_map_entry", "syntax_map", "$@15", "global_objects",
   "global_object", "dhcp4_object", "$@16", "sub_dhcp4", "$@17",
   "global_params", "global_param", "valid_lifetime", "renew_timer",
-  "rebind_timer", "decline_probation_period", "echo_client_id",
-  "match_client_id", "interfaces_config", "$@18",
+  "rebind_timer", "decline_probation_period", "response_cache_ttl",
+  "receive_queue", "$@18", "rate_limit", "$@19", "echo_client_id",
+  "match_client_id", "interfaces_config", "$@20",
   "interfaces_config_params", "interfaces_config_param", "sub_interfaces4",
-  "$@19", "interfaces_list", "$@20", "dhcp_socket_type", "$@21",
-  "socket_type", "lease_database", "$@22", "hosts_database", "$@23",
-  "database_map_params", "database_map_param", "database_type", "$@24",
-  "db_type", "user", "$@25", "password", "$@26", "host", "$@27", "port",
-  "name", "$@28", "persist", "lfc_interval", "readonly", "connect_timeout",
-  "contact_points", "$@29", "keyspace", "$@30",
-  "host_reservation_identifiers", "$@31",
+  "$@21", "interfaces_list", "$@22", "dhcp_socket_type", "$@23",
+  "socket_type", "receive_ring", "lease_database", "$@24",
+  "hosts_database", "$@25", "database_map_params", "database_map_param",
+  "database_type", "$@26", "db_type", "user", "$@27", "password", "$@28",
+  "host", "$@29", "port", "name", "$@30", "persist", "lfc_interval",
+  "load_threads", "lfc_max_leases", "readonly", "connect_timeout",
+  "contact_points", "$@31", "keyspace", "$@32",
+  "host_reservation_identifiers", "$@33",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "duid_id", "hw_address_id", "circuit_id", "client_id", "flex_id",
-  "hooks_libraries", "$@32", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@33",
-  "sub_hooks_library", "$@34", "hooks_params", "hooks_param", "library",
-  "$@35", "parameters", "$@36", "expired_leases_processing", "$@37",
+  "hooks_libraries", "$@34", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@35",
+  "sub_hooks_library", "$@36", "hooks_params", "hooks_param", "library",
+  "$@37", "parameters", "$@38", "expired_leases_processing", "$@39",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet4_list", "$@38",
-  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@39",
-  "sub_subnet4", "$@40", "subnet4_params", "subnet4_param", "subnet",
-  "$@41", "subnet_4o6_interface", "$@42", "subnet_4o6_interface_id",
-  "$@43", "subnet_4o6_subnet", "$@44", "interface", "$@45", "interface_id",
-  "$@46", "client_class", "$@47", "reservation_mode", "$@48", "id",
-  "rapid_commit", "option_def_list", "$@49", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@50",
-  "sub_option_def", "$@51", "option_def_params",
-  "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@52",
-  "option_def_record_types", "$@53", "space", "$@54", "option_def_space",
-  "option_def_encapsulate", "$@55", "option_def_array", "option_data_list",
-  "$@56", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@57", "sub_option_data", "$@58",
+  "unwarned_reclaim_cycles", "subnet4_list", "$@40",
+  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@41",
+  "sub_subnet4", "$@42", "subnet4_params", "subnet4_param", "subnet",
+  "$@43", "subnet_4o6_interface", "$@44", "subnet_4o6_interface_id",
+  "$@45", "subnet_4o6_subnet", "$@46", "interface", "$@47", "interface_id",
+  "$@48", "client_class", "$@49", "reservation_mode", "$@50",
+  "cache_threshold", "id", "rapid_commit", "option_def_list", "$@51",
+  "option_def_list_content", "not_empty_option_def_list",
+  "option_def_entry", "$@52", "sub_option_def", "$@53",
+  "option_def_params", "not_empty_option_def_params", "option_def_param",
+  "option_def_name", "code", "option_def_code", "option_def_type", "$@54",
+  "option_def_record_types", "$@55", "space", "$@56", "option_def_space",
+  "option_def_encapsulate", "$@57", "option_def_array", "option_data_list",
+  "$@58", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@59", "sub_option_data", "$@60",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@59",
+  "option_data_param", "option_data_name", "option_data_data", "$@61",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "pools_list", "$@60", "pools_list_content", "not_empty_pools_list",
-  "pool_list_entry", "$@61", "sub_pool4", "$@62", "pool_params",
-  "pool_param", "pool_entry", "$@63", "user_context", "$@64",
-  "reservations", "$@65", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@66", "sub_reservation",
-  "$@67", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "next_server", "$@68", "server_hostname", "$@69",
-  "boot_file_name", "$@70", "ip_address", "$@71", "duid", "$@72",
-  "hw_address", "$@73", "client_id_value", "$@74", "circuit_id_value",
-  "$@75", "flex_id_value", "$@76", "hostname", "$@77",
-  "reservation_client_classes", "$@78", "relay", "$@79", "relay_map",
-  "$@80", "client_classes", "$@81", "client_classes_list", "$@82",
+  "pools_list", "$@62", "pools_list_content", "not_empty_pools_list",
+  "pool_list_entry", "$@63", "sub_pool4", "$@64", "pool_params",
+  "pool_param", "pool_entry", "$@65", "user_context", "$@66",
+  "reservations", "$@67", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@68", "sub_reservation",
+  "$@69", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "next_server", "$@70", "server_hostname", "$@71",
+  "boot_file_name", "$@72", "ip_address", "$@73", "duid", "$@74",
+  "hw_address", "$@75", "client_id_value", "$@76", "circuit_id_value",
+  "$@77", "flex_id_value", "$@78", "hostname", "$@79",
+  "reservation_client_classes", "$@80", "relay", "$@81", "relay_map",
+  "$@82", "client_classes", "$@83", "client_classes_list", "$@84",
   "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@83",
-  "dhcp4o6_port", "control_socket", "$@84", "control_socket_params",
-  "control_socket_param", "control_socket_type", "$@85",
-  "control_socket_name", "$@86", "dhcp_ddns", "$@87", "sub_dhcp_ddns",
-  "$@88", "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
-  "qualifying_suffix", "$@89", "server_ip", "$@90", "server_port",
-  "sender_ip", "$@91", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@92", "ncr_protocol_value", "ncr_format", "$@93",
+  "client_class_param", "client_class_name", "client_class_test", "$@85",
+  "dhcp4o6_port", "control_socket", "$@86", "control_socket_params",
+  "control_socket_param", "control_socket_type", "$@87",
+  "control_socket_name", "$@88", "background_commands", "dhcp_ddns",
+  "$@89", "sub_dhcp_ddns", "$@90", "dhcp_ddns_params", "dhcp_ddns_param",
+  "enable_updates", "qualifying_suffix", "$@91", "server_ip", "$@92",
+  "server_port", "sender_ip", "$@93", "sender_port", "max_queue_size",
+  "ncr_protocol", "$@94", "ncr_protocol_value", "ncr_format", "$@95",
   "always_include_fqdn", "override_no_update", "override_client_update",
-  "replace_client_name", "$@94", "replace_client_name_value",
-  "generated_prefix", "$@95", "dhcp6_json_object", "$@96",
-  "dhcpddns_json_object", "$@97", "logging_object", "$@98",
-  "logging_params", "logging_param", "loggers", "$@99", "loggers_entries",
-  "logger_entry", "$@100", "logger_params", "logger_param", "debuglevel",
-  "severity", "$@101", "output_options_list", "$@102",
-  "output_options_list_content", "output_entry", "$@103",
-  "output_params_list", "output_params", "output", "$@104", "flush",
+  "replace_client_name", "$@96", "replace_client_name_value",
+  "generated_prefix", "$@97", "dhcp6_json_object", "$@98",
+  "dhcpddns_json_object", "$@99", "logging_object", "$@100",
+  "logging_params", "logging_param", "loggers", "$@101", "loggers_entries",
+  "logger_entry", "$@102", "logger_params", "logger_param", "debuglevel",
+  "severity", "$@103", "output_options_list", "$@104",
+  "output_options_list_content", "output_entry", "$@105",
+  "output_params_list", "output_params", "output", "$@106", "flush",
   "maxsize", "maxver", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER4_DEBUG
-  const unsigned short int
+  const short
   Dhcp4Parser::yyrline_[] =
   {
-       0,   219,   219,   219,   220,   220,   221,   221,   222,   222,
-     223,   223,   224,   224,   225,   225,   226,   226,   227,   227,
-     228,   228,   229,   229,   237,   238,   239,   240,   241,   242,
-     243,   246,   251,   251,   262,   265,   266,   269,   273,   280,
-     280,   287,   288,   291,   295,   302,   302,   309,   310,   313,
-     317,   328,   338,   338,   350,   351,   355,   356,   357,   358,
-     359,   362,   362,   379,   379,   387,   388,   393,   394,   395,
-     396,   397,   398,   399,   400,   401,   402,   403,   404,   405,
-     406,   407,   408,   409,   410,   411,   412,   413,   416,   421,
-     426,   431,   436,   441,   447,   447,   457,   458,   461,   462,
-     465,   465,   473,   473,   483,   483,   490,   491,   494,   494,
-     504,   504,   514,   515,   518,   519,   520,   521,   522,   523,
-     524,   525,   526,   527,   528,   529,   530,   533,   533,   540,
-     541,   542,   543,   546,   546,   554,   554,   562,   562,   570,
-     575,   575,   583,   588,   593,   598,   603,   603,   611,   611,
-     620,   620,   630,   631,   634,   635,   636,   637,   638,   641,
-     646,   651,   656,   661,   666,   666,   676,   677,   680,   681,
-     684,   684,   692,   692,   700,   701,   702,   705,   706,   709,
-     709,   717,   717,   725,   725,   735,   736,   739,   740,   741,
-     742,   743,   744,   747,   752,   757,   762,   767,   772,   780,
-     780,   793,   794,   797,   798,   805,   805,   828,   828,   837,
-     838,   842,   843,   844,   845,   846,   847,   848,   849,   850,
-     851,   852,   853,   854,   855,   856,   857,   858,   859,   860,
-     861,   864,   864,   872,   872,   880,   880,   888,   888,   896,
-     896,   904,   904,   912,   912,   920,   920,   928,   933,   942,
-     942,   954,   955,   958,   959,   964,   964,   975,   975,   985,
-     986,   989,   990,   993,   994,   995,   996,   997,   998,   999,
-    1000,  1003,  1005,  1010,  1012,  1012,  1020,  1020,  1028,  1028,
-    1036,  1038,  1038,  1046,  1055,  1055,  1067,  1068,  1073,  1074,
-    1079,  1079,  1090,  1090,  1101,  1102,  1107,  1108,  1113,  1114,
-    1115,  1116,  1117,  1118,  1121,  1123,  1123,  1131,  1133,  1135,
-    1143,  1143,  1155,  1156,  1159,  1160,  1163,  1163,  1171,  1171,
-    1179,  1180,  1183,  1184,  1185,  1186,  1189,  1189,  1197,  1197,
-    1207,  1207,  1217,  1218,  1221,  1222,  1225,  1225,  1233,  1233,
-    1241,  1242,  1245,  1246,  1250,  1251,  1252,  1253,  1254,  1255,
-    1256,  1257,  1258,  1259,  1260,  1261,  1262,  1265,  1265,  1273,
-    1273,  1281,  1281,  1289,  1289,  1297,  1297,  1305,  1305,  1313,
-    1313,  1321,  1321,  1329,  1329,  1337,  1337,  1345,  1345,  1358,
-    1358,  1368,  1368,  1379,  1379,  1389,  1390,  1393,  1393,  1401,
-    1402,  1405,  1406,  1409,  1410,  1411,  1412,  1413,  1414,  1415,
-    1418,  1420,  1420,  1432,  1439,  1439,  1449,  1450,  1453,  1454,
-    1457,  1457,  1465,  1465,  1475,  1475,  1485,  1485,  1493,  1494,
-    1497,  1498,  1499,  1500,  1501,  1502,  1503,  1504,  1505,  1506,
-    1507,  1508,  1509,  1510,  1511,  1514,  1519,  1519,  1527,  1527,
-    1535,  1540,  1540,  1548,  1553,  1558,  1558,  1566,  1567,  1570,
-    1570,  1578,  1583,  1588,  1593,  1593,  1601,  1604,  1607,  1610,
-    1613,  1619,  1619,  1629,  1629,  1636,  1636,  1648,  1648,  1661,
-    1662,  1666,  1670,  1670,  1682,  1683,  1687,  1687,  1695,  1696,
-    1699,  1700,  1701,  1702,  1703,  1706,  1711,  1711,  1719,  1719,
-    1729,  1730,  1733,  1733,  1741,  1742,  1745,  1746,  1747,  1748,
-    1751,  1751,  1759,  1764,  1769
+       0,   227,   227,   227,   228,   228,   229,   229,   230,   230,
+     231,   231,   232,   232,   233,   233,   234,   234,   235,   235,
+     236,   236,   237,   237,   245,   246,   247,   248,   249,   250,
+     251,   254,   259,   259,   270,   273,   274,   277,   281,   288,
+     288,   295,   296,   299,   303,   310,   310,   317,   318,   321,
+     325,   336,   346,   346,   358,   359,   363,   364,   365,   366,
+     367,   370,   370,   387,   387,   395,   396,   401,   402,   403,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     414,   415,   416,   417,   418,   419,   420,   421,   422,   423,
+     424,   427,   432,   437,   442,   447,   454,   454,   462,   462,
+     469,   474,   480,   480,   490,   491,   494,   495,   496,   499,
+     499,   507,   507,   517,   517,   524,   525,   528,   533,   533,
+     543,   543,   553,   554,   557,   558,   559,   560,   561,   562,
+     563,   564,   565,   566,   567,   568,   569,   570,   571,   574,
+     574,   581,   582,   583,   584,   587,   587,   595,   595,   603,
+     603,   611,   616,   616,   624,   629,   634,   639,   644,   649,
+     654,   654,   662,   662,   671,   671,   681,   682,   685,   686,
+     687,   688,   689,   692,   697,   702,   707,   712,   717,   717,
+     727,   728,   731,   732,   735,   735,   743,   743,   751,   752,
+     753,   756,   757,   760,   760,   768,   768,   776,   776,   786,
+     787,   790,   791,   792,   793,   794,   795,   798,   803,   808,
+     813,   818,   823,   831,   831,   844,   845,   848,   849,   856,
+     856,   879,   879,   888,   889,   893,   894,   895,   896,   897,
+     898,   899,   900,   901,   902,   903,   904,   905,   906,   907,
+     908,   909,   910,   911,   912,   913,   916,   916,   924,   924,
+     932,   932,   940,   940,   948,   948,   956,   956,   964,   964,
+     972,   972,   980,   985,   990,   999,   999,  1011,  1012,  1015,
+    1016,  1021,  1021,  1032,  1032,  1042,  1043,  1046,  1047,  1050,
+    1051,  1052,  1053,  1054,  1055,  1056,  1057,  1060,  1062,  1067,
+    1069,  1069,  1077,  1077,  1085,  1085,  1093,  1095,  1095,  1103,
+    1112,  1112,  1124,  1125,  1130,  1131,  1136,  1136,  1147,  1147,
+    1158,  1159,  1164,  1165,  1170,  1171,  1172,  1173,  1174,  1175,
+    1178,  1180,  1180,  1188,  1190,  1192,  1200,  1200,  1212,  1213,
+    1216,  1217,  1220,  1220,  1228,  1228,  1236,  1237,  1240,  1241,
+    1242,  1243,  1246,  1246,  1254,  1254,  1264,  1264,  1274,  1275,
+    1278,  1279,  1282,  1282,  1290,  1290,  1298,  1299,  1302,  1303,
+    1307,  1308,  1309,  1310,  1311,  1312,  1313,  1314,  1315,  1316,
+    1317,  1318,  1319,  1322,  1322,  1330,  1330,  1338,  1338,  1346,
+    1346,  1354,  1354,  1362,  1362,  1370,  1370,  1378,  1378,  1386,
+    1386,  1394,  1394,  1402,  1402,  1415,  1415,  1425,  1425,  1436,
+    1436,  1446,  1447,  1450,  1450,  1458,  1459,  1462,  1463,  1466,
+    1467,  1468,  1469,  1470,  1471,  1472,  1475,  1477,  1477,  1489,
+    1496,  1496,  1506,  1507,  1510,  1511,  1512,  1515,  1515,  1523,
+    1523,  1531,  1538,  1538,  1548,  1548,  1556,  1557,  1560,  1561,
+    1562,  1563,  1564,  1565,  1566,  1567,  1568,  1569,  1570,  1571,
+    1572,  1573,  1574,  1577,  1582,  1582,  1590,  1590,  1598,  1603,
+    1603,  1611,  1616,  1621,  1621,  1629,  1630,  1633,  1633,  1641,
+    1646,  1651,  1656,  1656,  1664,  1667,  1670,  1673,  1676,  1682,
+    1682,  1692,  1692,  1699,  1699,  1711,  1711,  1724,  1725,  1729,
+    1733,  1733,  1745,  1746,  1750,  1750,  1758,  1759,  1762,  1763,
+    1764,  1765,  1766,  1769,  1774,  1774,  1782,  1782,  1792,  1793,
+    1796,  1796,  1804,  1805,  1808,  1809,  1810,  1811,  1814,  1814,
+    1822,  1827,  1832
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp4Parser::yystack_print_ ()
+  Dhcp4Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp4Parser::yy_reduce_print_ (int yyrule)
+  Dhcp4Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -4106,10 +4379,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER4_DEBUG
 
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:1167
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 4112 "dhcp4_parser.cc" // lalr1.cc:1167
-#line 1774 "dhcp4_parser.yy" // lalr1.cc:1168
+#line 4385 "dhcp4_parser.cc"
+
+#line 1837 "dhcp4_parser.yy"
 
 
 void
@@ -55,6 +55,7 @@ using namespace std;
   DHCP_SOCKET_TYPE "dhcp-socket-type"
   RAW "raw"
   UDP "udp"
+  RECEIVE_RING "receive-ring"
 
   ECHO_CLIENT_ID "echo-client-id"
   MATCH_CLIENT_ID "match-client-id"
@@ -75,6 +76,8 @@ using namespace std;
   PORT "port"
   PERSIST "persist"
   LFC_INTERVAL "lfc-interval"
+  LOAD_THREADS "load-threads"
+  LFC_MAX_LEASES "lfc-max-leases"
   READONLY "readonly"
   CONNECT_TIMEOUT "connect-timeout"
   CONTACT_POINTS "contact-points"
@@ -84,6 +87,9 @@ using namespace std;
   RENEW_TIMER "renew-timer"
   REBIND_TIMER "rebind-timer"
   DECLINE_PROBATION_PERIOD "decline-probation-period"
+  RESPONSE_CACHE_TTL "response-cache-ttl"
+  RECEIVE_QUEUE "receive-queue"
+  RATE_LIMIT "rate-limit"
   SUBNET4 "subnet4"
   SUBNET_4O6_INTERFACE "4o6-interface"
   SUBNET_4O6_INTERFACE_ID "4o6-interface-id"
@@ -109,6 +115,7 @@ using namespace std;
   ID "id"
   RAPID_COMMIT "rapid-commit"
   RESERVATION_MODE "reservation-mode"
+  CACHE_THRESHOLD "cache-threshold"
 
   HOST_RESERVATION_IDENTIFIERS "host-reservation-identifiers"
 
@@ -144,6 +151,7 @@ using namespace std;
   CONTROL_SOCKET "control-socket"
   SOCKET_TYPE "socket-type"
   SOCKET_NAME "socket-name"
+  BACKGROUND_COMMANDS "background-commands"
 
   DHCP_DDNS "dhcp-ddns"
   ENABLE_UPDATES "enable-updates"
@@ -394,6 +402,9 @@ global_param: valid_lifetime
             | renew_timer
             | rebind_timer
             | decline_probation_period
+            | response_cache_ttl
+            | receive_queue
+            | rate_limit
             | subnet4_list
             | interfaces_config
             | lease_database
@@ -433,6 +444,28 @@ decline_probation_period: DECLINE_PROBATION_PERIOD COLON INTEGER {
     ctx.stack_.back()->set("decline-probation-period", dpp);
 };
 
+response_cache_ttl: RESPONSE_CACHE_TTL COLON INTEGER {
+    ElementPtr ttl(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("response-cache-ttl", ttl);
+};
+
+// The contents of the receive-queue map are checked by the
+// ReceiveQueueParser.
+receive_queue: RECEIVE_QUEUE {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON map_value {
+    ctx.stack_.back()->set("receive-queue", $4);
+    ctx.leave();
+};
+
+// The contents of the rate-limit map are checked by the RateLimitParser.
+rate_limit: RATE_LIMIT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON map_value {
+    ctx.stack_.back()->set("rate-limit", $4);
+    ctx.leave();
+};
+
 echo_client_id: ECHO_CLIENT_ID COLON BOOLEAN {
     ElementPtr echo(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("echo-client-id", echo);
@@ -460,6 +493,7 @@ interfaces_config_params: interfaces_config_param
 
 interfaces_config_param: interfaces_list
                        | dhcp_socket_type
+                       | receive_ring
                        ;
 
 sub_interfaces4: LCURLY_BRACKET {
@@ -491,6 +525,11 @@ socket_type: RAW { $$ = ElementPtr(new StringElement("raw", ctx.loc2pos(@1))); }
            | UDP { $$ = ElementPtr(new StringElement("udp", ctx.loc2pos(@1))); }
            ;
 
+receive_ring: RECEIVE_RING COLON BOOLEAN {
+    ElementPtr ring(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("receive-ring", ring);
+};
+
 lease_database: LEASE_DATABASE {
     ElementPtr i(new MapElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("lease-database", i);
@@ -523,6 +562,8 @@ database_map_param: database_type
                   | name
                   | persist
                   | lfc_interval
+                  | load_threads
+                  | lfc_max_leases
                   | readonly
                   | connect_timeout
                   | contact_points
@@ -590,6 +631,16 @@ lfc_interval: LFC_INTERVAL COLON INTEGER {
     ctx.stack_.back()->set("lfc-interval", n);
 };
 
+load_threads: LOAD_THREADS COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("load-threads", n);
+};
+
+lfc_max_leases: LFC_MAX_LEASES COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-max-leases", n);
+};
+
 readonly: READONLY COLON BOOLEAN {
     ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("readonly", n);
@@ -858,6 +909,7 @@ subnet4_param: valid_lifetime
              | subnet_4o6_interface
              | subnet_4o6_interface_id
              | subnet_4o6_subnet
+             | cache_threshold
              | unknown_map_entry
              ;
 
@@ -925,6 +977,11 @@ reservation_mode: RESERVATION_MODE {
     ctx.leave();
 };
 
+cache_threshold: CACHE_THRESHOLD COLON FLOAT {
+    ElementPtr ct(new DoubleElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+};
+
 id: ID COLON INTEGER {
     ElementPtr id(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("id", id);
@@ -1452,6 +1509,7 @@ control_socket_params: control_socket_param
 
 control_socket_param: control_socket_type
                     | control_socket_name
+                    | background_commands
                     ;
 
 control_socket_type: SOCKET_TYPE {
@@ -1470,6 +1528,11 @@ control_socket_name: SOCKET_NAME {
     ctx.leave();
 };
 
+background_commands: BACKGROUND_COMMANDS COLON BOOLEAN {
+    ElementPtr bg(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("background-commands", bg);
+};
+
 // --- dhcp ddns ---------------------------------------------
 
 dhcp_ddns: DHCP_DDNS {
@@ -418,7 +418,8 @@ const std::string Dhcpv4Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 
 Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
                      const bool direct_response_desired)
-    : shutdown_(true), alloc_engine_(), port_(port),
+    : shutdown_(true), alloc_engine_(), receive_queue_(),
+      receive_queue_drops_(0), rate_limiter_(), port_(port),
       use_bcast_(use_bcast) {
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET).arg(port);
@@ -707,6 +708,53 @@ Dhcpv4Srv::receivePacket(int timeout) {
     return (IfaceMgr::instance().receive4(timeout));
 }
 
+Pkt4Ptr
+Dhcpv4Srv::receiveQueuedPacket(int timeout) {
+    receive_queue_.configure(CfgMgr::instance().getCurrentCfg()->
+                             getReceiveQueueConfig());
+    if (!receive_queue_.enabled()) {
+        return (receivePacket(timeout));
+    }
+
+    // Don't wait for new packets when there are queued packets to process.
+    if (!receive_queue_.empty()) {
+        timeout = 0;
+    }
+
+    // Move the packets waiting in the socket buffers to the queue, so as
+    // the drop policy is applied to them rather than to the packets which
+    // the kernel would drop when its buffers get full. The number of reads
+    // is limited to let the server process packets under constant load.
+    const size_t capacity = receive_queue_.getConfig().capacity_;
+    for (size_t reads = 0; reads < capacity; ++reads) {
+        Pkt4Ptr pkt = receivePacket(timeout);
+        if (!pkt) {
+            break;
+        }
+        receive_queue_.push(pkt);
+        timeout = 0;
+    }
+
+    Pkt4Ptr query = receive_queue_.pop();
+    updateReceiveQueueStats();
+    return (query);
+}
+
+void
+Dhcpv4Srv::updateReceiveQueueStats() {
+    const uint64_t drops = receive_queue_.getDropped();
+    if (drops > receive_queue_drops_) {
+        const int64_t dropped = drops - receive_queue_drops_;
+        receive_queue_drops_ = drops;
+        LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_QUEUE_DROP)
+            .arg(dropped)
+            .arg(receive_queue_.size());
+        isc::stats::StatsMgr::instance().addValue("pkt4-queue-drop", dropped);
+    }
+    isc::stats::StatsMgr::instance().setValue("pkt4-queue-size",
+        static_cast<int64_t>(receive_queue_.size()));
+}
+
 void
 Dhcpv4Srv::sendPacket(const Pkt4Ptr& packet) {
     IfaceMgr::instance().send(packet);
@@ -742,7 +790,7 @@ Dhcpv4Srv::run_one() {
     try {
         uint32_t timeout = 1000;
         LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL, DHCP4_BUFFER_WAIT).arg(timeout);
-        query = receivePacket(timeout);
+        query = receiveQueuedPacket(timeout);
 
         // Log if packet has arrived. We can't log the detailed information
         // about the DHCP message because it hasn't been unpacked/parsed
@@ -949,6 +997,23 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
+    // Drop the packets from the clients and relays exceeding their rates
+    // before spending any time on classification and lease lookups.
+    rate_limiter_.configure(CfgMgr::instance().getCurrentCfg()->
+                            getRateLimitConfig());
+    RateLimiter::Source source = rate_limiter_.check(query);
+    if (source != RateLimiter::NONE) {
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL,
+                  DHCP4_PACKET_DROP_0008)
+            .arg(query->getLabel())
+            .arg(RateLimiter::sourceToText(source));
+        isc::stats::StatsMgr::instance().addValue("pkt4-rate-limit-drop",
+                                                  static_cast<int64_t>(1));
+        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+                                                  static_cast<int64_t>(1));
+        return;
+    }
+
     // Assign this packet to one or more classes if needed. We need to do
     // this before calling accept(), because getSubnet4() may need client
     // class information.
@@ -1009,6 +1074,27 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         callout_handle->getArgument("query4", query);
     }
 
+    // The client retransmits its query when the response is late. If the
+    // response to the previous copy of this query has been sent recently,
+    // send a copy of it again rather than going through the allocation
+    // once more. The pkt4_receive callouts have been called, but the
+    // subnet4_select, lease4_* and pkt4_send callouts are skipped. The
+    // buffer4_send callouts are called with the copy of the response.
+    response_cache_.setTTL(CfgMgr::instance().getCurrentCfg()->
+                           getResponseCacheTTL());
+    const bool cacheable = ((query->getType() == DHCPDISCOVER) ||
+                            (query->getType() == DHCPREQUEST));
+    if (cacheable) {
+        rsp = response_cache_.get(query);
+        if (rsp) {
+            LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC,
+                      DHCP4_PACKET_RETRANSMITTED)
+                .arg(query->getLabel())
+                .arg(query->getName());
+            return;
+        }
+    }
+
     try {
         switch (query->getType()) {
         case DHCPDISCOVER:
@@ -1108,6 +1194,11 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             LOG_DEBUG(options4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_PACK)
                 .arg(rsp->getLabel());
             rsp->pack();
+
+            if (cacheable) {
+                response_cache_.add(query, rsp);
+            }
+
         } catch (const std::exception& e) {
             LOG_ERROR(options4_logger, DHCP4_PACKET_PACK_FAIL)
                 .arg(rsp->getLabel())
@@ -1618,10 +1709,12 @@ Dhcpv4Srv::createNameChangeRequests(const Lease4Ptr& lease,
         isc_throw(isc::Unexpected,
                   "NULL lease specified when creating NameChangeRequest");
 
-    } else if (!old_lease || !lease->hasIdenticalFqdn(*old_lease)) {
+    } else if (!old_lease || !hasIdenticalDnsData(*lease, *old_lease)) {
         // We may need to generate the NameChangeRequest for the new lease. It
         // will be generated only if hostname is set and if forward or reverse
-        // update has been requested.
+        // update has been requested. A renewal which changes neither the
+        // FQDN data nor the client's identifier needs no DNS update, so the
+        // DHCID isn't computed for it.
         queueNCR(CHG_ADD, lease);
     }
 }
@@ -1841,16 +1934,24 @@ Dhcpv4Srv::assignLease(Dhcpv4Exchange& ex) {
             }
         }
 
-        // IP Address Lease time (type 51)
+        // IP Address Lease time (type 51). If the existing lease has been
+        // reused, the client gets the remaining lifetime of the lease.
+        uint32_t valid_lft = (lease->reuseable_valid_lft_ > 0 ?
+                              lease->reuseable_valid_lft_ : lease->valid_lft_);
         OptionPtr opt(new OptionUint32(Option::V4, DHO_DHCP_LEASE_TIME,
-                                       lease->valid_lft_));
+                                       valid_lft));
         resp->addOption(opt);
 
         // Subnet mask (type 1)
         resp->addOption(getNetmaskOption(subnet));
 
+        // The timers which would not fire before the reused lease expires
+        // are omitted and the client falls back to the default ones.
+        bool reused = (lease->reuseable_valid_lft_ > 0);
+
         // renewal-timer (type 58)
-        if (!subnet->getT1().unspecified()) {
+        if (!subnet->getT1().unspecified() &&
+            (!reused || (subnet->getT1() < valid_lft))) {
             OptionUint32Ptr t1(new OptionUint32(Option::V4,
                                                 DHO_DHCP_RENEWAL_TIME,
                                                 subnet->getT1()));
@@ -1858,7 +1959,8 @@ Dhcpv4Srv::assignLease(Dhcpv4Exchange& ex) {
         }
 
         // rebind timer (type 59)
-        if (!subnet->getT2().unspecified()) {
+        if (!subnet->getT2().unspecified() &&
+            (!reused || (subnet->getT2() < valid_lft))) {
             OptionUint32Ptr t2(new OptionUint32(Option::V4,
                                                 DHO_DHCP_REBINDING_TIME,
                                                 subnet->getT2()));
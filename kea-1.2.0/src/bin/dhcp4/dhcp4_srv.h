@@ -13,11 +13,14 @@
 #include <dhcp/option_string.h>
 #include <dhcp/option4_client_fqdn.h>
 #include <dhcp/option_custom.h>
+#include <dhcp/packet_queue.h>
 #include <dhcp_ddns/ncr_msg.h>
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/rate_limiter.h>
+#include <dhcpsrv/response_cache.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
 
@@ -775,6 +778,23 @@ protected:
     /// simulates reception of a packet. For that purpose it is protected.
     virtual Pkt4Ptr receivePacket(int timeout);
 
+    /// @brief Receives the next packet to be processed.
+    ///
+    /// If the receive queue is enabled, all packets waiting in the socket
+    /// buffers are read into the queue and the packet from the front of
+    /// the queue is returned. The packets which don't fit into the queue
+    /// or have been waiting there for too long are dropped. Otherwise,
+    /// this method simply calls @ref receivePacket.
+    ///
+    /// @param timeout Timeout for the first read, used when the queue is
+    /// empty.
+    ///
+    /// @return Packet to be processed or null pointer if there is none.
+    Pkt4Ptr receiveQueuedPacket(int timeout);
+
+    /// @brief Updates the receive queue statistics.
+    void updateReceiveQueueStats();
+
     /// @brief dummy wrapper around IfaceMgr::send()
     ///
     /// This method is useful for testing purposes, where its replacement
@@ -799,6 +819,25 @@ protected:
     /// during normal operation (e.g. to use different allocators)
     boost::shared_ptr<AllocEngine> alloc_engine_;
 
+    /// @brief Responses sent to the recent DHCPDISCOVER and DHCPREQUEST
+    /// messages.
+    ///
+    /// Retransmitted messages are answered with the cached responses
+    /// rather than being processed again. The cache is cleared when a new
+    /// configuration is committed.
+    ResponseCache response_cache_;
+
+    /// @brief Queue holding the received packets until they are processed.
+    PacketQueue<Pkt4Ptr> receive_queue_;
+
+    /// @brief Number of packets dropped from the receive queue, which has
+    /// been accounted for in the statistics.
+    uint64_t receive_queue_drops_;
+
+    /// @brief Limits the rate of packets accepted from each client and
+    /// relay.
+    RateLimiter rate_limiter_;
+
 private:
 
     /// @public
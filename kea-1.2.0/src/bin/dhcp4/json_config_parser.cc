@@ -329,6 +329,7 @@ public:
     /// - echo-client-id
     /// - decline-probation-period
     /// - dhcp4o6-port
+    /// - response-cache-ttl (optional)
     ///
     /// @throw DhcpConfigError if parameters are missing or
     /// or having incorrect values.
@@ -347,6 +348,11 @@ public:
         // Set the DHCPv4-over-DHCPv6 interserver port.
         uint16_t dhcp4o6_port = getUint16(global, "dhcp4o6-port");
         cfg->setDhcp4o6Port(dhcp4o6_port);
+
+        // Set the lifetime of the cached responses, if specified.
+        if (global->contains("response-cache-ttl")) {
+            cfg->setResponseCacheTTL(getUint32(global, "response-cache-ttl"));
+        }
     }
 };
 
@@ -482,6 +488,18 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
                 continue;
             }
 
+            if (config_pair.first == "receive-queue") {
+                ReceiveQueueParser parser;
+                parser.parse(*srv_cfg, config_pair.second);
+                continue;
+            }
+
+            if (config_pair.first == "rate-limit") {
+                RateLimitParser parser;
+                parser.parse(*srv_cfg, config_pair.second);
+                continue;
+            }
+
             if (config_pair.first == "host-reservation-identifiers") {
                 HostReservationIdsParser4 parser;
                 parser.parse(config_pair.second);
@@ -552,8 +570,9 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
 
             // Timers are not used in the global scope. Their values are derived
             // to specific subnets (see SimpleParser6::deriveParameters).
-            // decline-probation-period, dhcp4o6-port, echo-client-id are
-            // handled in global_parser.parse() which sets global parameters.
+            // decline-probation-period, dhcp4o6-port, echo-client-id,
+            // response-cache-ttl are handled in global_parser.parse() which
+            // sets global parameters.
             // match-client-id is derived to subnet scope level.
             if ( (config_pair.first == "renew-timer") ||
                  (config_pair.first == "rebind-timer") ||
@@ -561,6 +580,7 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
                  (config_pair.first == "decline-probation-period") ||
                  (config_pair.first == "dhcp4o6-port") ||
                  (config_pair.first == "echo-client-id") ||
+                 (config_pair.first == "response-cache-ttl") ||
                  (config_pair.first == "match-client-id") ||
                  (config_pair.first == "next-server")) {
                 continue;
@@ -53,6 +53,7 @@ public:
 
     /// Expose internal methods for the sake of testing
     using Dhcpv4Srv::receivePacket;
+    using Dhcpv4Srv::response_cache_;
 };
 
 /// @brief Fixture class intended for testin control channel in the DHCPv4Srv
@@ -385,6 +386,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"config-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-set\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-write\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"lease4-get-page\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"leases-reclaim\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"libreload\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"shutdown\"") != string::npos);
@@ -548,6 +550,100 @@ TEST_F(CtrlChannelDhcpv4SrvTest, controlLeasesReclaimRemove) {
     EXPECT_FALSE(lease1);
 }
 
+// This test verifies that the leases of a subnet are returned in pages
+// on lease4-get-page command.
+TEST_F(CtrlChannelDhcpv4SrvTest, controlLease4GetPage) {
+    createUnixChannelServer();
+
+    // Create leases in two subnets.
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    const char* addresses[] = { "10.0.0.3", "10.0.0.1", "10.0.1.1", "10.0.0.2" };
+    for (int i = 0; i < 4; ++i) {
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, i), HTYPE_ETHER));
+        Lease4Ptr lease(new Lease4(IOAddress(addresses[i]), hwaddr,
+                                   ClientIdPtr(), 60, 10, 20, time(NULL),
+                                   SubnetID(i == 2 ? 2 : 1)));
+        ASSERT_NO_THROW(lease_mgr.addLease(lease));
+    }
+
+    // Missing or bogus arguments.
+    std::string response;
+    sendUnixCommand("{ \"command\": \"lease4-get-page\" }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"Missing mandatory 'subnet-id' parameter.\" }", response);
+
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1 } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"Missing mandatory 'limit' parameter.\" }", response);
+
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 0 } }",
+                    response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"'limit' parameter expected to be a positive integer.\" }",
+              response);
+
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"2001:db8::1\" } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"'from' parameter expected to be 'start' or an IPv4 address.\" }",
+              response);
+
+    // The first page holds two lowest addresses of the subnet 1.
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"start\" } }", response);
+    ConstElementPtr rsp;
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    int status;
+    ConstElementPtr args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(2, args->get("count")->intValue());
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("10.0.0.1", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("10.0.0.2", leases->get(1)->get("ip-address")->stringValue());
+
+    // The next page starts after the last returned address.
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"10.0.0.2\" } }", response);
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    EXPECT_EQ("10.0.0.3", leases->get(0)->get("ip-address")->stringValue());
+
+    // There are no more leases in this subnet.
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"10.0.0.3\" } }", response);
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(0, args->get("count")->intValue());
+
+    // The other subnet holds one lease.
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 2, \"limit\": 10 } }",
+                    response);
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    EXPECT_EQ("10.0.1.1", leases->get(0)->get("ip-address")->stringValue());
+}
+
 // Tests that the server properly responds to statistics commands.  Note this
 // is really only intended to verify that the appropriate Statistics handler
 // is called based on the command.  It is not intended to be an exhaustive
@@ -665,6 +761,16 @@ TEST_F(CtrlChannelDhcpv4SrvTest, configSet) {
         << logger_txt
         << "}}";
 
+    // Cache a response. It must be dropped when the new configuration
+    // is committed.
+    server_->response_cache_.setTTL(10000);
+    Pkt4Ptr query(new Pkt4(DHCPDISCOVER, 1234));
+    query->setHWAddr(HTYPE_ETHER, 6, std::vector<uint8_t>(6, 1));
+    Pkt4Ptr offer(new Pkt4(DHCPOFFER, 1234));
+    ASSERT_NO_THROW(offer->pack());
+    server_->response_cache_.add(query, offer);
+    ASSERT_EQ(1, server_->response_cache_.size());
+
     // Send the config-set command
     std::string response;
     sendUnixCommand(os.str(), response);
@@ -678,6 +784,9 @@ TEST_F(CtrlChannelDhcpv4SrvTest, configSet) {
         CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getAll();
     EXPECT_EQ(1, subnets->size());
 
+    // The cached response has been removed.
+    EXPECT_EQ(0, server_->response_cache_.size());
+
     // Create a config with malformed subnet that should fail to parse.
     os.str("");
     os << set_config_txt << ","
@@ -756,6 +865,7 @@ TEST_F(CtrlChannelDhcpv4SrvTest, listCommands) {
     checkListCommands(rsp, "config-set");
     checkListCommands(rsp, "config-write");
     checkListCommands(rsp, "list-commands");
+    checkListCommands(rsp, "lease4-get-page");
     checkListCommands(rsp, "leases-reclaim");
     checkListCommands(rsp, "libreload");
     checkListCommands(rsp, "shutdown");
@@ -1059,6 +1059,173 @@ TEST_F(Dhcpv4SrvTest, relayAgentInfoEcho) {
     EXPECT_TRUE(rai_response->equals(rai_query));
 }
 
+// Checks that the retransmitted DHCPDISCOVER is answered with the cached
+// response when the response cache is enabled.
+TEST_F(Dhcpv4SrvTest, responseCache) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    NakedDhcpv4Srv srv(0);
+
+    // This is the configuration 0 with the response cache enabled.
+    configure("{ \"interfaces-config\": {"
+              "    \"interfaces\": [ \"*\" ]"
+              "},"
+              "\"rebind-timer\": 2000, "
+              "\"renew-timer\": 1000, "
+              "\"response-cache-ttl\": 10000, "
+              "\"subnet4\": [ { "
+              "    \"pools\": [ { \"pool\": \"10.254.226.0/25\" } ],"
+              "    \"subnet\": \"10.254.226.0/24\", "
+              "    \"rebind-timer\": 2000, "
+              "    \"renew-timer\": 1000, "
+              "    \"valid-lifetime\": 4000,"
+              "    \"interface\": \"eth0\" "
+              " } ],"
+              "\"valid-lifetime\": 4000 }", srv);
+    ASSERT_EQ(10000, CfgMgr::instance().getCurrentCfg()->getResponseCacheTTL());
+
+    // Simulate that the client has sent the same DISCOVER twice and
+    // then the same one has been received from another relay.
+    srv.fakeReceive(PktCaptures::captureRelayedDiscover());
+    srv.fakeReceive(PktCaptures::captureRelayedDiscover());
+    Pkt4Ptr dis = PktCaptures::captureRelayedDiscover();
+    dis->setRemoteAddr(IOAddress("10.0.0.3"));
+    srv.fakeReceive(dis);
+
+    srv.run();
+
+    // All queries should have been answered.
+    ASSERT_EQ(3, srv.fake_sent_.size());
+    Pkt4Ptr offer1 = srv.fake_sent_.front();
+    srv.fake_sent_.pop_front();
+    Pkt4Ptr offer2 = srv.fake_sent_.front();
+    srv.fake_sent_.pop_front();
+    Pkt4Ptr offer3 = srv.fake_sent_.front();
+
+    // The retransmission is answered with a copy of the response to the
+    // first query, so the sent packets don't share a buffer.
+    EXPECT_FALSE(offer1 == offer2);
+    ASSERT_EQ(offer1->getBuffer().getLength(), offer2->getBuffer().getLength());
+    EXPECT_EQ(0, memcmp(offer1->getBuffer().getData(),
+                        offer2->getBuffer().getData(),
+                        offer1->getBuffer().getLength()));
+    EXPECT_EQ(offer1->getTransid(), offer2->getTransid());
+    // The query received from another relay has been processed and
+    // cached separately.
+    EXPECT_EQ(2, srv.response_cache_.size());
+}
+
+// This test verifies that the packets which don't fit into the receive
+// queue are dropped and the remaining ones are processed.
+TEST_F(Dhcpv4SrvTest, receiveQueue) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    NakedDhcpv4Srv srv(0);
+
+    // This is the configuration 0 with the receive queue holding at most
+    // two packets.
+    configure("{ \"interfaces-config\": {"
+              "    \"interfaces\": [ \"*\" ]"
+              "},"
+              "\"rebind-timer\": 2000, "
+              "\"renew-timer\": 1000, "
+              "\"receive-queue\": { \"capacity\": 2 },"
+              "\"subnet4\": [ { "
+              "    \"pools\": [ { \"pool\": \"10.254.226.0/25\" } ],"
+              "    \"subnet\": \"10.254.226.0/24\", "
+              "    \"rebind-timer\": 2000, "
+              "    \"renew-timer\": 1000, "
+              "    \"valid-lifetime\": 4000,"
+              "    \"interface\": \"eth0\" "
+              " } ],"
+              "\"valid-lifetime\": 4000 }", srv);
+    ASSERT_EQ(2, CfgMgr::instance().getCurrentCfg()->
+              getReceiveQueueConfig().capacity_);
+
+    // Simulate that four packets are waiting in the socket buffers.
+    for (int i = 0; i < 4; ++i) {
+        srv.fakeReceive(PktCaptures::captureRelayedDiscover());
+    }
+
+    // The first call reads as many packets as fit into the queue and
+    // processes the first one.
+    srv.run_one();
+    ASSERT_EQ(1, srv.fake_sent_.size());
+
+    // The next call reads the remaining packets. The oldest packet is
+    // dropped to make room for the last one.
+    srv.run_one();
+    ASSERT_EQ(2, srv.fake_sent_.size());
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    ObservationPtr drop_stat = mgr.getObservation("pkt4-queue-drop");
+    ASSERT_TRUE(drop_stat);
+    EXPECT_EQ(1, drop_stat->getInteger().first);
+    ObservationPtr size_stat = mgr.getObservation("pkt4-queue-size");
+    ASSERT_TRUE(size_stat);
+    EXPECT_EQ(1, size_stat->getInteger().first);
+
+    // The next call processes the queued packet.
+    srv.run_one();
+    EXPECT_EQ(3, srv.fake_sent_.size());
+    EXPECT_EQ(0, size_stat->getInteger().first);
+
+    // There is nothing more to process.
+    srv.run_one();
+    EXPECT_EQ(3, srv.fake_sent_.size());
+}
+
+// This test verifies that the packets from the client exceeding its rate
+// are dropped.
+TEST_F(Dhcpv4SrvTest, rateLimit) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    NakedDhcpv4Srv srv(0);
+
+    // This is the configuration 0 with the client allowed to send two
+    // packets at once.
+    configure("{ \"interfaces-config\": {"
+              "    \"interfaces\": [ \"*\" ]"
+              "},"
+              "\"rebind-timer\": 2000, "
+              "\"renew-timer\": 1000, "
+              "\"rate-limit\": { \"client-rate\": 1, \"client-burst\": 2 },"
+              "\"subnet4\": [ { "
+              "    \"pools\": [ { \"pool\": \"10.254.226.0/25\" } ],"
+              "    \"subnet\": \"10.254.226.0/24\", "
+              "    \"rebind-timer\": 2000, "
+              "    \"renew-timer\": 1000, "
+              "    \"valid-lifetime\": 4000,"
+              "    \"interface\": \"eth0\" "
+              " } ],"
+              "\"valid-lifetime\": 4000 }", srv);
+    ASSERT_TRUE(CfgMgr::instance().getCurrentCfg()->
+                getRateLimitConfig().enabled());
+
+    // Simulate that the client has sent the same DISCOVER three times.
+    for (int i = 0; i < 3; ++i) {
+        srv.fakeReceive(PktCaptures::captureRelayedDiscover());
+    }
+
+    srv.run();
+
+    // The third query should have been dropped.
+    EXPECT_EQ(2, srv.fake_sent_.size());
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    ObservationPtr rate_stat = mgr.getObservation("pkt4-rate-limit-drop");
+    ASSERT_TRUE(rate_stat);
+    EXPECT_EQ(1, rate_stat->getInteger().first);
+    ObservationPtr drop_stat = mgr.getObservation("pkt4-receive-drop");
+    ASSERT_TRUE(drop_stat);
+    EXPECT_EQ(1, drop_stat->getInteger().first);
+}
+
 /// @todo move vendor options tests to a separate file.
 /// @todo Add more extensive vendor options tests, including multiple
 ///       vendor options
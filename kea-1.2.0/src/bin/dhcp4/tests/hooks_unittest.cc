@@ -944,6 +944,40 @@ TEST_F(HooksDhcpv4SrvTest, pkt4ReceiveSkip) {
     ASSERT_EQ(0, srv_->fake_sent_.size());
 }
 
+// Checks that the pkt4_receive callouts are called for a retransmitted
+// query which has a cached response and that they can drop it.
+TEST_F(HooksDhcpv4SrvTest, pkt4ReceiveSkipCachedResponse) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    // Enable the response cache.
+    CfgMgr::instance().clear();
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet_);
+    CfgMgr::instance().getStagingCfg()->setResponseCacheTTL(10000);
+    CfgMgr::instance().commit();
+
+    // The first DISCOVER is processed and its response is cached.
+    srv_->fakeReceive(generateSimpleDiscover());
+    srv_->run();
+    ASSERT_EQ(1, srv_->fake_sent_.size());
+    ASSERT_EQ(1, srv_->response_cache_.size());
+    srv_->fake_sent_.clear();
+
+    // Install pkt4_receive_callout
+    EXPECT_NO_THROW(HooksManager::preCalloutsLibraryHandle().registerCallout(
+                        "pkt4_receive", pkt4_receive_skip));
+
+    // Simulate that the client has retransmitted the DISCOVER.
+    srv_->shutdown_ = false;
+    srv_->fakeReceive(generateSimpleDiscover());
+    srv_->run();
+
+    // The callout has been called and the retransmission has been dropped
+    // rather than answered from the cache.
+    EXPECT_EQ("pkt4_receive", callback_name_);
+    EXPECT_EQ(0, srv_->fake_sent_.size());
+}
+
 
 // Checks if callouts installed on pkt4_send are indeed called and the
 // all necessary parameters are passed.
@@ -503,6 +503,113 @@ TEST(ParserTest, errors) {
               "\"valid_lifetime\" in Dhcp4 map.");
 }
 
+// Check that background-commands is a keyword of the control-socket map
+// only.
+TEST(ParserTest, backgroundCommands) {
+    string txt = "{ \"Dhcp4\": { \"control-socket\": {"
+                 " \"socket-type\": \"unix\","
+                 " \"socket-name\": \"/tmp/kea4-ctrl-socket\","
+                 " \"background-commands\": true } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"background-commands\": true } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.14-34: got unexpected keyword "
+              "\"background-commands\" in Dhcp4 map.");
+}
+
+// Check that receive-ring is a keyword of the interfaces-config map only.
+TEST(ParserTest, receiveRing) {
+    string txt = "{ \"Dhcp4\": { \"interfaces-config\": {"
+                 " \"interfaces\": [ \"receive-ring\" ],"
+                 " \"dhcp-socket-type\": \"raw\","
+                 " \"receive-ring\": true } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"receive-ring\": true } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.14-27: got unexpected keyword "
+              "\"receive-ring\" in Dhcp4 map.");
+}
+
+// Check that cache-threshold is a keyword of the subnet map only.
+TEST(ParserTest, cacheThreshold) {
+    string txt = "{ \"Dhcp4\": { \"subnet4\": [ {"
+                 " \"subnet\": \"192.0.2.0/24\","
+                 " \"cache-threshold\": 0.25 } ] } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"cache-threshold\": 0.25 } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.14-30: got unexpected keyword "
+              "\"cache-threshold\" in Dhcp4 map.");
+}
+
+// Check that response-cache-ttl is a global keyword only.
+TEST(ParserTest, responseCacheTTL) {
+    string txt = "{ \"Dhcp4\": { \"response-cache-ttl\": 500 } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"subnet4\": [ {"
+              " \"response-cache-ttl\": 500 } ] } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.29-48: got unexpected keyword "
+              "\"response-cache-ttl\" in subnet4 map.");
+}
+
+// Check that receive-queue is a global map.
+TEST(ParserTest, receiveQueue) {
+    string txt = "{ \"Dhcp4\": { \"receive-queue\": {"
+                 " \"capacity\": 100, \"drop-policy\": \"drop-oldest\","
+                 " \"max-age\": 2 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"receive-queue\": 100 } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.31-33: syntax error, unexpected integer, "
+              "expecting {");
+}
+
+// Check that rate-limit is a global map.
+TEST(ParserTest, rateLimit) {
+    string txt = "{ \"Dhcp4\": { \"rate-limit\": {"
+                 " \"client-rate\": 10, \"client-burst\": 20,"
+                 " \"relay-rate\": 1000, \"relay-burst\": 2000,"
+                 " \"max-sources\": 1024 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"rate-limit\": 10 } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.28-29: syntax error, unexpected integer, "
+              "expecting {");
+}
+
+// Check that load-threads is a keyword of the lease-database map only.
+TEST(ParserTest, loadThreads) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\", \"load-threads\": 4 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"hosts-database\": {"
+              " \"load-threads\": 4 } } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.34-47: got unexpected keyword "
+              "\"load-threads\" in hosts-database map.");
+}
+
+// Check that lfc-max-leases is a keyword of the lease-database map only.
+TEST(ParserTest, lfcMaxLeases) {
+    string txt = "{ \"Dhcp4\": { \"lease-database\": {"
+                 " \"type\": \"memfile\", \"lfc-max-leases\": 1000 } } }";
+    testParser(txt, Parser4Context::PARSER_DHCP4);
+
+    testError("{ \"Dhcp4\": { \"hosts-database\": {"
+              " \"lfc-max-leases\": 1000 } } }",
+              Parser4Context::PARSER_DHCP4,
+              "<string>:1.34-49: got unexpected keyword "
+              "\"lfc-max-leases\" in hosts-database map.");
+}
+
 // Check unicode escapes
 TEST(ParserTest, unicodeEscapes) {
     ConstElementPtr result;
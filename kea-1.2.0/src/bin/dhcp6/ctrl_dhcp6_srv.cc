@@ -11,6 +11,7 @@
 #include <dhcp/libdhcp++.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcp6/ctrl_dhcp6_srv.h>
 #include <dhcp6/dhcp6to4_ipc.h>
 #include <dhcp6/dhcp6_log.h>
@@ -21,6 +22,10 @@
 #include <cfgrpt/config_report.h>
 #include <signal.h>
 
+#include <limits>
+#include <sstream>
+
+using namespace isc::asiolink;
 using namespace isc::config;
 using namespace isc::dhcp;
 using namespace isc::data;
@@ -219,27 +224,32 @@ ControlledDhcpv6Srv::commandConfigReloadHandler(const string&,
     }
 }
 
-ConstElementPtr
+CommandMgr::ResponseGenerator
 ControlledDhcpv6Srv::commandConfigGetHandler(const string&,
                                              ConstElementPtr /*args*/) {
+    // The configuration is converted to JSON here, as the conversion uses
+    // CfgMgr. Only the serialization of the response is left to the worker.
     ConstElementPtr config = CfgMgr::instance().getCurrentCfg()->toElement();
 
-    return (createAnswer(0, config));
+    return (CommandMgr::respondWith(createAnswer(0, config)));
 }
 
-ConstElementPtr
+CommandMgr::ResponseGenerator
 ControlledDhcpv6Srv::commandConfigWriteHandler(const string&, ConstElementPtr args) {
     string filename;
 
     if (args) {
         if (args->getType() != Element::map) {
-            return (createAnswer(CONTROL_RESULT_ERROR, "Argument must be a map"));
+            return (CommandMgr::respondWith(
+                        createAnswer(CONTROL_RESULT_ERROR,
+                                     "Argument must be a map")));
         }
         ConstElementPtr filename_param = args->get("filename");
         if (filename_param) {
             if (filename_param->getType() != Element::string) {
-                return (createAnswer(CONTROL_RESULT_ERROR,
-                                     "passed parameter 'filename' is not a string"));
+                return (CommandMgr::respondWith(
+                            createAnswer(CONTROL_RESULT_ERROR,
+                                         "passed parameter 'filename' is not a string")));
             }
             filename = filename_param->stringValue();
         }
@@ -252,14 +262,27 @@ ControlledDhcpv6Srv::commandConfigWriteHandler(const string&, ConstElementPtr ar
     }
 
     if (filename.empty()) {
-        return (createAnswer(CONTROL_RESULT_ERROR, "Unable to determine filename."
-                             "Please specify filename explicitly."));
+        return (CommandMgr::respondWith(
+                    createAnswer(CONTROL_RESULT_ERROR,
+                                 "Unable to determine filename."
+                                 "Please specify filename explicitly.")));
     }
 
+    // The configuration is written as it is now. It is converted to JSON
+    // here, as the conversion uses CfgMgr.
+    ConstElementPtr cfg = CfgMgr::instance().getCurrentCfg()->toElement();
+
+    return (boost::bind(&ControlledDhcpv6Srv::configWriteResponse, this,
+                        filename, cfg));
+}
+
+ConstElementPtr
+ControlledDhcpv6Srv::configWriteResponse(const string& filename,
+                                         const ConstElementPtr& cfg) const {
     // Ok, it's time to write the file.
     size_t size = 0;
     try {
-        size = writeConfigFile(filename);
+        size = writeConfigFile(filename, cfg);
     } catch (const isc::Exception& ex) {
         return (createAnswer(CONTROL_RESULT_ERROR, string("Error during write-config:")
                              + ex.what()));
@@ -334,6 +357,9 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
 
         // Use new configuration.
         CfgMgr::instance().commit();
+
+        // The cached responses may not match the new configuration.
+        response_cache_.clear();
     }
 
     return (result);
@@ -421,6 +447,83 @@ ControlledDhcpv6Srv::commandLeasesReclaimHandler(const string&,
     return (answer);
 }
 
+ConstElementPtr
+ControlledDhcpv6Srv::commandLease6GetPageHandler(const string&,
+                                                 ConstElementPtr args) {
+    // args must be { "subnet-id": <int>, "limit": <int>, "from": <string> }
+    ConstElementPtr subnet_id;
+    if (args && (args->getType() == Element::map)) {
+        subnet_id = args->get("subnet-id");
+    }
+    if (!subnet_id) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "Missing mandatory 'subnet-id' parameter."));
+    }
+    if ((subnet_id->getType() != Element::integer) ||
+        (subnet_id->intValue() < 0) ||
+        (subnet_id->intValue() > std::numeric_limits<SubnetID>::max())) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "'subnet-id' parameter expected to be a subnet"
+                             " identifier."));
+    }
+
+    ConstElementPtr limit = args->get("limit");
+    if (!limit) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "Missing mandatory 'limit' parameter."));
+    }
+    if ((limit->getType() != Element::integer) || (limit->intValue() <= 0)) {
+        return (createAnswer(CONTROL_RESULT_ERROR,
+                             "'limit' parameter expected to be a positive"
+                             " integer."));
+    }
+
+    // The page starts after this address, i.e. at the beginning of the
+    // subnet by default.
+    IOAddress from("::");
+    ConstElementPtr from_elem = args->get("from");
+    if (from_elem) {
+        bool valid = (from_elem->getType() == Element::string);
+        if (valid && (from_elem->stringValue() != "start")) {
+            try {
+                from = IOAddress(from_elem->stringValue());
+                valid = from.isV6();
+            } catch (const std::exception&) {
+                valid = false;
+            }
+        }
+        if (!valid) {
+            return (createAnswer(CONTROL_RESULT_ERROR,
+                                 "'from' parameter expected to be 'start' or"
+                                 " an IPv6 address."));
+        }
+    }
+
+    // Not all lease database backends can page through the leases.
+    Lease6Collection leases;
+    try {
+        leases = LeaseMgrFactory::instance().
+            getSubnetLeases6(static_cast<SubnetID>(subnet_id->intValue()),
+                             from, static_cast<size_t>(limit->intValue()));
+    } catch (const NotImplemented& ex) {
+        return (createAnswer(CONTROL_RESULT_COMMAND_UNSUPPORTED, ex.what()));
+    }
+
+    ElementPtr leases_list = Element::createList();
+    for (Lease6Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        leases_list->add((*lease)->toElement());
+    }
+
+    ElementPtr arguments = Element::createMap();
+    arguments->set("leases", leases_list);
+    arguments->set("count", Element::create(static_cast<long int>(leases.size())));
+
+    std::ostringstream message;
+    message << leases.size() << " IPv6 lease(s) found.";
+    return (createAnswer(CONTROL_RESULT_SUCCESS, message.str(), arguments));
+}
+
 isc::data::ConstElementPtr
 ControlledDhcpv6Srv::processCommand(const std::string& command,
                                     isc::data::ConstElementPtr args) {
@@ -452,7 +555,7 @@ ControlledDhcpv6Srv::processCommand(const std::string& command,
             return (srv->commandConfigSetHandler(command, args));
 
         } else if (command == "config-get") {
-            return (srv->commandConfigGetHandler(command, args));
+            return (srv->commandConfigGetHandler(command, args)());
 
         } else if (command == "config-test") {
             return (srv->commandConfigTestHandler(command, args));
@@ -463,11 +566,14 @@ ControlledDhcpv6Srv::processCommand(const std::string& command,
         } else if (command == "build-report") {
             return (srv->commandBuildReportHandler(command, args));
 
+        } else if (command == "lease6-get-page") {
+            return (srv->commandLease6GetPageHandler(command, args));
+
         } else if (command == "leases-reclaim") {
             return (srv->commandLeasesReclaimHandler(command, args));
 
         } else if (command == "config-write") {
-            return (srv->commandConfigWriteHandler(command, args));
+            return (srv->commandConfigWriteHandler(command, args)());
 
         }
 
@@ -643,7 +749,7 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
     CommandMgr::instance().registerCommand("build-report",
         boost::bind(&ControlledDhcpv6Srv::commandBuildReportHandler, this, _1, _2));
 
-    CommandMgr::instance().registerCommand("config-get",
+    CommandMgr::instance().registerBackgroundCommand("config-get",
         boost::bind(&ControlledDhcpv6Srv::commandConfigGetHandler, this, _1, _2));
 
     CommandMgr::instance().registerCommand("config-reload",
@@ -652,9 +758,12 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
     CommandMgr::instance().registerCommand("config-test",
         boost::bind(&ControlledDhcpv6Srv::commandConfigTestHandler, this, _1, _2));
 
-    CommandMgr::instance().registerCommand("config-write",
+    CommandMgr::instance().registerBackgroundCommand("config-write",
         boost::bind(&ControlledDhcpv6Srv::commandConfigWriteHandler, this, _1, _2));
 
+    CommandMgr::instance().registerCommand("lease6-get-page",
+        boost::bind(&ControlledDhcpv6Srv::commandLease6GetPageHandler, this, _1, _2));
+
     CommandMgr::instance().registerCommand("leases-reclaim",
         boost::bind(&ControlledDhcpv6Srv::commandLeasesReclaimHandler, this, _1, _2));
 
@@ -674,8 +783,11 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
     CommandMgr::instance().registerCommand("statistic-get",
         boost::bind(&StatsMgr::statisticGetHandler, _1, _2));
 
-    CommandMgr::instance().registerCommand("statistic-get-all",
-        boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
+    // The statistics are collected right away, but the response is sent
+    // in background.
+    CommandMgr::instance().registerBackgroundCommand("statistic-get-all",
+        boost::bind(&CommandMgr::respondWith,
+                    boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2)));
 
     CommandMgr::instance().registerCommand("statistic-reset",
         boost::bind(&StatsMgr::statisticResetHandler, _1, _2));
@@ -714,6 +826,7 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("config-reload");
         CommandMgr::instance().deregisterCommand("config-test");
         CommandMgr::instance().deregisterCommand("config-write");
+        CommandMgr::instance().deregisterCommand("lease6-get-page");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("shutdown");
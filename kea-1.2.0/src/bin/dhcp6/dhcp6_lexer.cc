@@ -1380,9 +1380,9 @@ static const flex_int16_t yy_rule_linenum[153] =
      1025, 1034, 1044, 1054, 1063, 1072, 1081, 1090, 1099, 1108,
      1118, 1127, 1136, 1145, 1154, 1163, 1172, 1181, 1190, 1199,
      1208, 1217, 1226, 1235, 1244, 1253, 1262, 1271, 1280, 1289,
-     1298, 1307, 1316, 1325, 1334, 1432, 1437, 1442, 1447, 1448,
-     1449, 1450, 1451, 1452, 1454, 1472, 1485, 1490, 1494, 1496,
-     1498, 1500
+     1298, 1307, 1316, 1325, 1334, 1468, 1473, 1478, 1483, 1484,
+     1485, 1486, 1487, 1488, 1490, 1508, 1521, 1526, 1530, 1532,
+     1534, 1536
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -3564,13 +3564,49 @@ YY_RULE_SETUP
         }
     }
 
+    // Keywords which have no rule of their own above are recognized here,
+    // from the decoded string, in the context they belong to.
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::CONTROL_SOCKET:
+        if (decoded == "background-commands") {
+            return isc::dhcp::Dhcp6Parser::make_BACKGROUND_COMMANDS(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser6Context::SUBNET6:
+        if (decoded == "cache-threshold") {
+            return isc::dhcp::Dhcp6Parser::make_CACHE_THRESHOLD(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser6Context::DHCP6:
+        if (decoded == "response-cache-ttl") {
+            return isc::dhcp::Dhcp6Parser::make_RESPONSE_CACHE_TTL(driver.loc_);
+        }
+        if (decoded == "receive-queue") {
+            return isc::dhcp::Dhcp6Parser::make_RECEIVE_QUEUE(driver.loc_);
+        }
+        if (decoded == "rate-limit") {
+            return isc::dhcp::Dhcp6Parser::make_RATE_LIMIT(driver.loc_);
+        }
+        break;
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+        if (decoded == "load-threads") {
+            return isc::dhcp::Dhcp6Parser::make_LOAD_THREADS(driver.loc_);
+        }
+        if (decoded == "lfc-max-leases") {
+            return isc::dhcp::Dhcp6Parser::make_LFC_MAX_LEASES(driver.loc_);
+        }
+        break;
+    default:
+        break;
+    }
+
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
 case 136:
 /* rule 136 can match eol */
 YY_RULE_SETUP
-#line 1432 "dhcp6_lexer.ll"
+#line 1468 "dhcp6_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
@@ -3579,7 +3615,7 @@ YY_RULE_SETUP
 case 137:
 /* rule 137 can match eol */
 YY_RULE_SETUP
-#line 1437 "dhcp6_lexer.ll"
+#line 1473 "dhcp6_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
@@ -3587,7 +3623,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
-#line 1442 "dhcp6_lexer.ll"
+#line 1478 "dhcp6_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
@@ -3595,37 +3631,37 @@ YY_RULE_SETUP
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
-#line 1447 "dhcp6_lexer.ll"
+#line 1483 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
-#line 1448 "dhcp6_lexer.ll"
+#line 1484 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
-#line 1449 "dhcp6_lexer.ll"
+#line 1485 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
-#line 1450 "dhcp6_lexer.ll"
+#line 1486 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
-#line 1451 "dhcp6_lexer.ll"
+#line 1487 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
-#line 1452 "dhcp6_lexer.ll"
+#line 1488 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
-#line 1454 "dhcp6_lexer.ll"
+#line 1490 "dhcp6_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -3646,7 +3682,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
-#line 1472 "dhcp6_lexer.ll"
+#line 1508 "dhcp6_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -3662,7 +3698,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
-#line 1485 "dhcp6_lexer.ll"
+#line 1521 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
@@ -3670,33 +3706,33 @@ YY_RULE_SETUP
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
-#line 1490 "dhcp6_lexer.ll"
+#line 1526 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
-#line 1494 "dhcp6_lexer.ll"
+#line 1530 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
-#line 1496 "dhcp6_lexer.ll"
+#line 1532 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
-#line 1498 "dhcp6_lexer.ll"
+#line 1534 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
-#line 1500 "dhcp6_lexer.ll"
+#line 1536 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1502 "dhcp6_lexer.ll"
+#line 1538 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -3722,10 +3758,10 @@ case YY_STATE_EOF(INITIAL):
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
-#line 1525 "dhcp6_lexer.ll"
+#line 1561 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 3728 "dhcp6_lexer.cc"
+#line 3764 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4826,7 +4862,7 @@ void parser6_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1525 "dhcp6_lexer.ll"
+#line 1561 "dhcp6_lexer.ll"
 
 
 using namespace isc::dhcp;
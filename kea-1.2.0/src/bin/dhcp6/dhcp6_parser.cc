@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.0.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,32 +30,25 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
+
+
 // Take the name prefix into account.
 #define yylex   parser6_lex
 
-// First part of user declarations.
-
-#line 39 "dhcp6_parser.cc" // lalr1.cc:404
 
-# ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
-#  else
-#   define YY_NULLPTR 0
-#  endif
-# endif
 
 #include "dhcp6_parser.h"
 
-// User implementation prologue.
 
-#line 53 "dhcp6_parser.cc" // lalr1.cc:412
 // Unqualified %code blocks.
-#line 34 "dhcp6_parser.yy" // lalr1.cc:413
+#line 34 "dhcp6_parser.yy"
 
 #include <dhcp6/parser_context.h>
 
-#line 59 "dhcp6_parser.cc" // lalr1.cc:413
+#line 52 "dhcp6_parser.cc"
 
 
 #ifndef YY_
@@ -70,6 +63,16 @@
 # endif
 #endif
 
+
+// Whether we are compiled with exception support.
+#ifndef YY_EXCEPTIONS
+# if defined __GNUC__ && !defined __EXCEPTIONS
+#  define YY_EXCEPTIONS 0
+# else
+#  define YY_EXCEPTIONS 1
+# endif
+#endif
+
 #define YYRHSLOC(Rhs, K) ((Rhs)[K].location)
 /* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
    If N is 0, then set CURRENT to the empty location which ends
@@ -87,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER6_DEBUG
 
@@ -106,7 +106,7 @@
     {                                           \
       *yycdebug_ << Title << ' ';               \
       yy_print_ (*yycdebug_, Symbol);           \
-      *yycdebug_ << std::endl;                  \
+      *yycdebug_ << '\n';                       \
     }                                           \
   } while (false)
 
@@ -119,15 +119,15 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER6_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE(Symbol)
-# define YY_REDUCE_PRINT(Rule)           static_cast<void>(0)
-# define YY_STACK_PRINT()                static_cast<void>(0)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
+# define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
+# define YY_STACK_PRINT()                static_cast<void> (0)
 
 #endif // !PARSER6_DEBUG
 
@@ -139,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:479
+#line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 145 "dhcp6_parser.cc" // lalr1.cc:479
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp6Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp6_parser.cc"
 
   /// Build a parser object.
   Dhcp6Parser::Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg)
-    :
 #if PARSER6_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -194,32 +157,30 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::~Dhcp6Parser ()
   {}
 
+  Dhcp6Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  inline
-  Dhcp6Parser::by_state::by_state ()
+  Dhcp6Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  inline
-  Dhcp6Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp6Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
-  inline
   void
-  Dhcp6Parser::by_state::clear ()
+  Dhcp6Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
 
-  inline
   void
   Dhcp6Parser::by_state::move (by_state& that)
   {
@@ -227,55 +188,90 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  inline
-  Dhcp6Parser::by_state::by_state (state_type s)
+  Dhcp6Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  inline
-  Dhcp6Parser::symbol_number_type
-  Dhcp6Parser::by_state::type_get () const
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
-  inline
   Dhcp6Parser::stack_symbol_type::stack_symbol_type ()
   {}
 
+  Dhcp6Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
+    : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
+  {
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+#if 201103L <= YY_CPLUSPLUS
+    // that is emptied.
+    that.state = empty_state;
+#endif
+  }
 
-  inline
-  Dhcp6Parser::stack_symbol_type::stack_symbol_type (state_type s, symbol_type& that)
-    : super_type (s, that.location)
+  Dhcp6Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
+    : super_type (s, YY_MOVE (that.location))
   {
-      switch (that.type_get ())
-    {
-      case 161: // value
-      case 165: // map_value
-      case 206: // db_type
-      case 401: // duid_type
-      case 434: // ncr_protocol_value
-      case 442: // replace_client_name_value
-        value.move< ElementPtr > (that.value);
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 146: // "boolean"
-        value.move< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 145: // "floating point"
-        value.move< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 144: // "integer"
-        value.move< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 143: // "constant string"
-        value.move< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -283,38 +279,38 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
-  inline
+#if YY_CPLUSPLUS < 201103L
   Dhcp6Parser::stack_symbol_type&
   Dhcp6Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
   {
     state = that.state;
-      switch (that.type_get ())
-    {
-      case 161: // value
-      case 165: // map_value
-      case 206: // db_type
-      case 401: // duid_type
-      case 434: // ncr_protocol_value
-      case 442: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 146: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 145: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 144: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 143: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -326,9 +322,49 @@ namespace isc { namespace dhcp {
     return *this;
   }
 
+  Dhcp6Parser::stack_symbol_type&
+  Dhcp6Parser::stack_symbol_type::operator= (stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    // that is emptied.
+    that.state = empty_state;
+    return *this;
+  }
+#endif
 
   template <typename Base>
-  inline
   void
   Dhcp6Parser::yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const
   {
@@ -339,119 +375,109 @@ namespace isc { namespace dhcp {
 #if PARSER6_DEBUG
   template <typename Base>
   void
-  Dhcp6Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp6Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 143: // "constant string"
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 362 "dhcp6_parser.cc" // lalr1.cc:636
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 396 "dhcp6_parser.cc"
         break;
 
-      case 144: // "integer"
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 369 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_INTEGER: // "integer"
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 402 "dhcp6_parser.cc"
         break;
 
-      case 145: // "floating point"
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< double > (); }
-#line 376 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 408 "dhcp6_parser.cc"
         break;
 
-      case 146: // "boolean"
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 383 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 414 "dhcp6_parser.cc"
         break;
 
-      case 161: // value
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 390 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_value: // value
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "dhcp6_parser.cc"
         break;
 
-      case 165: // map_value
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 397 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_map_value: // map_value
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 426 "dhcp6_parser.cc"
         break;
 
-      case 206: // db_type
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 404 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_db_type: // db_type
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 432 "dhcp6_parser.cc"
         break;
 
-      case 401: // duid_type
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 411 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_duid_type: // duid_type
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 438 "dhcp6_parser.cc"
         break;
 
-      case 434: // ncr_protocol_value
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 418 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 444 "dhcp6_parser.cc"
         break;
 
-      case 442: // replace_client_name_value
-
-#line 218 "dhcp6_parser.yy" // lalr1.cc:636
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 425 "dhcp6_parser.cc" // lalr1.cc:636
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 225 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 450 "dhcp6_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
-  inline
   void
-  Dhcp6Parser::yypush_ (const char* m, state_type s, symbol_type& sym)
+  Dhcp6Parser::yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym)
   {
-    stack_symbol_type t (s, sym);
-    yypush_ (m, t);
+    if (m)
+      YY_SYMBOL_PRINT (m, sym);
+    yystack_.push (YY_MOVE (sym));
   }
 
-  inline
   void
-  Dhcp6Parser::yypush_ (const char* m, stack_symbol_type& s)
+  Dhcp6Parser::yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym)
   {
-    if (m)
-      YY_SYMBOL_PRINT (m, s);
-    yystack_.push (s);
+#if 201103L <= YY_CPLUSPLUS
+    yypush_ (m, stack_symbol_type (s, std::move (sym)));
+#else
+    stack_symbol_type ss (s, sym);
+    yypush_ (m, ss);
+#endif
   }
 
-  inline
   void
-  Dhcp6Parser::yypop_ (unsigned int n)
+  Dhcp6Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -483,32 +509,37 @@ namespace isc { namespace dhcp {
   }
 #endif // PARSER6_DEBUG
 
-  inline Dhcp6Parser::state_type
+  Dhcp6Parser::state_type
   Dhcp6Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
-  inline bool
-  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue)
+  bool
+  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
-  inline bool
-  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue)
+  bool
+  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
 
+  int
+  Dhcp6Parser::operator() ()
+  {
+    return parse ();
+  }
+
   int
   Dhcp6Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -526,11 +557,11 @@ namespace isc { namespace dhcp {
     /// The return value of parse ().
     int yyresult;
 
-    // FIXME: This shoud be completely indented.  It is not yet to
-    // avoid gratuitous conflicts when merging into the master branch.
+#if YY_EXCEPTIONS
     try
+#endif // YY_EXCEPTIONS
       {
-    YYCDEBUG << "Starting parse" << std::endl;
+    YYCDEBUG << "Starting parse\n";
 
 
     /* Initialize the stack.  The initial state will be set in
@@ -538,48 +569,70 @@ namespace isc { namespace dhcp {
        location values to have been already stored, initialize these
        stacks with a primary value.  */
     yystack_.clear ();
-    yypush_ (YY_NULLPTR, 0, yyla);
+    yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << std::endl;
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
-  yybackup:
 
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
+  yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
+#if YY_EXCEPTIONS
         try
+#endif // YY_EXCEPTIONS
           {
             symbol_type yylookahead (yylex (ctx));
             yyla.move (yylookahead);
           }
+#if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
+#endif // YY_EXCEPTIONS
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -596,54 +649,56 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, yyla);
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
     {
       stack_symbol_type yylhs;
-      yylhs.state = yy_lr_goto_state_(yystack_[yylen].state, yyr1_[yyn]);
+      yylhs.state = yy_lr_goto_state_ (yystack_[yylen].state, yyr1_[yyn]);
       /* Variants are always initialized to an empty instance of the
          correct type. The default '$$ = $1' action is NOT applied
          when using variants.  */
-        switch (yyr1_[yyn])
-    {
-      case 161: // value
-      case 165: // map_value
-      case 206: // db_type
-      case 401: // duid_type
-      case 434: // ncr_protocol_value
-      case 442: // replace_client_name_value
-        yylhs.value.build< ElementPtr > ();
+      switch (yyr1_[yyn])
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 146: // "boolean"
-        yylhs.value.build< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        yylhs.value.emplace< bool > ();
         break;
 
-      case 145: // "floating point"
-        yylhs.value.build< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        yylhs.value.emplace< double > ();
         break;
 
-      case 144: // "integer"
-        yylhs.value.build< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        yylhs.value.emplace< int64_t > ();
         break;
 
-      case 143: // "constant string"
-        yylhs.value.build< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        yylhs.value.emplace< std::string > ();
         break;
 
       default:
@@ -651,292 +706,295 @@ namespace isc { namespace dhcp {
     }
 
 
-      // Compute the default @$.
+      // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
+        yyerror_range[1].location = yylhs.location;
       }
 
       // Perform the reduction.
       YY_REDUCE_PRINT (yyn);
+#if YY_EXCEPTIONS
       try
+#endif // YY_EXCEPTIONS
         {
           switch (yyn)
             {
-  case 2:
-#line 227 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 670 "dhcp6_parser.cc" // lalr1.cc:859
+  case 2: // $@1: %empty
+#line 234 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 728 "dhcp6_parser.cc"
     break;
 
-  case 4:
-#line 228 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 676 "dhcp6_parser.cc" // lalr1.cc:859
+  case 4: // $@2: %empty
+#line 235 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 734 "dhcp6_parser.cc"
     break;
 
-  case 6:
-#line 229 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 682 "dhcp6_parser.cc" // lalr1.cc:859
+  case 6: // $@3: %empty
+#line 236 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP6; }
+#line 740 "dhcp6_parser.cc"
     break;
 
-  case 8:
-#line 230 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 688 "dhcp6_parser.cc" // lalr1.cc:859
+  case 8: // $@4: %empty
+#line 237 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 746 "dhcp6_parser.cc"
     break;
 
-  case 10:
-#line 231 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.SUBNET6; }
-#line 694 "dhcp6_parser.cc" // lalr1.cc:859
+  case 10: // $@5: %empty
+#line 238 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET6; }
+#line 752 "dhcp6_parser.cc"
     break;
 
-  case 12:
-#line 232 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.POOLS; }
-#line 700 "dhcp6_parser.cc" // lalr1.cc:859
+  case 12: // $@6: %empty
+#line 239 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 758 "dhcp6_parser.cc"
     break;
 
-  case 14:
-#line 233 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.PD_POOLS; }
-#line 706 "dhcp6_parser.cc" // lalr1.cc:859
+  case 14: // $@7: %empty
+#line 240 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.PD_POOLS; }
+#line 764 "dhcp6_parser.cc"
     break;
 
-  case 16:
-#line 234 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 712 "dhcp6_parser.cc" // lalr1.cc:859
+  case 16: // $@8: %empty
+#line 241 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 770 "dhcp6_parser.cc"
     break;
 
-  case 18:
-#line 235 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 718 "dhcp6_parser.cc" // lalr1.cc:859
+  case 18: // $@9: %empty
+#line 242 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 776 "dhcp6_parser.cc"
     break;
 
-  case 20:
-#line 236 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 724 "dhcp6_parser.cc" // lalr1.cc:859
+  case 20: // $@10: %empty
+#line 243 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 782 "dhcp6_parser.cc"
     break;
 
-  case 22:
-#line 237 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 730 "dhcp6_parser.cc" // lalr1.cc:859
+  case 22: // $@11: %empty
+#line 244 "dhcp6_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 788 "dhcp6_parser.cc"
     break;
 
-  case 24:
-#line 238 "dhcp6_parser.yy" // lalr1.cc:859
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 736 "dhcp6_parser.cc" // lalr1.cc:859
+  case 24: // $@12: %empty
+#line 245 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 794 "dhcp6_parser.cc"
     break;
 
-  case 26:
-#line 246 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 742 "dhcp6_parser.cc" // lalr1.cc:859
+  case 26: // value: "integer"
+#line 253 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 800 "dhcp6_parser.cc"
     break;
 
-  case 27:
-#line 247 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 748 "dhcp6_parser.cc" // lalr1.cc:859
+  case 27: // value: "floating point"
+#line 254 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 806 "dhcp6_parser.cc"
     break;
 
-  case 28:
-#line 248 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 754 "dhcp6_parser.cc" // lalr1.cc:859
+  case 28: // value: "boolean"
+#line 255 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 812 "dhcp6_parser.cc"
     break;
 
-  case 29:
-#line 249 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 760 "dhcp6_parser.cc" // lalr1.cc:859
+  case 29: // value: "constant string"
+#line 256 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 818 "dhcp6_parser.cc"
     break;
 
-  case 30:
-#line 250 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 766 "dhcp6_parser.cc" // lalr1.cc:859
+  case 30: // value: "null"
+#line 257 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 824 "dhcp6_parser.cc"
     break;
 
-  case 31:
-#line 251 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 772 "dhcp6_parser.cc" // lalr1.cc:859
+  case 31: // value: map2
+#line 258 "dhcp6_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 830 "dhcp6_parser.cc"
     break;
 
-  case 32:
-#line 252 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 778 "dhcp6_parser.cc" // lalr1.cc:859
+  case 32: // value: list_generic
+#line 259 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 836 "dhcp6_parser.cc"
     break;
 
-  case 33:
-#line 255 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 33: // sub_json: value
+#line 262 "dhcp6_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 787 "dhcp6_parser.cc" // lalr1.cc:859
+#line 845 "dhcp6_parser.cc"
     break;
 
-  case 34:
-#line 260 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 34: // $@13: %empty
+#line 267 "dhcp6_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 798 "dhcp6_parser.cc" // lalr1.cc:859
+#line 856 "dhcp6_parser.cc"
     break;
 
-  case 35:
-#line 265 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 35: // map2: "{" $@13 map_content "}"
+#line 272 "dhcp6_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 808 "dhcp6_parser.cc" // lalr1.cc:859
+#line 866 "dhcp6_parser.cc"
     break;
 
-  case 36:
-#line 271 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 814 "dhcp6_parser.cc" // lalr1.cc:859
+  case 36: // map_value: map2
+#line 278 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 872 "dhcp6_parser.cc"
     break;
 
-  case 39:
-#line 278 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 39: // not_empty_map: "constant string" ":" value
+#line 285 "dhcp6_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 823 "dhcp6_parser.cc" // lalr1.cc:859
+#line 881 "dhcp6_parser.cc"
     break;
 
-  case 40:
-#line 282 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 40: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 289 "dhcp6_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 833 "dhcp6_parser.cc" // lalr1.cc:859
+#line 891 "dhcp6_parser.cc"
     break;
 
-  case 41:
-#line 289 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 41: // $@14: %empty
+#line 296 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 842 "dhcp6_parser.cc" // lalr1.cc:859
+#line 900 "dhcp6_parser.cc"
     break;
 
-  case 42:
-#line 292 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 42: // list_generic: "[" $@14 list_content "]"
+#line 299 "dhcp6_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 850 "dhcp6_parser.cc" // lalr1.cc:859
+#line 908 "dhcp6_parser.cc"
     break;
 
-  case 45:
-#line 300 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 45: // not_empty_list: value
+#line 307 "dhcp6_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 859 "dhcp6_parser.cc" // lalr1.cc:859
+#line 917 "dhcp6_parser.cc"
     break;
 
-  case 46:
-#line 304 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 46: // not_empty_list: not_empty_list "," value
+#line 311 "dhcp6_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 868 "dhcp6_parser.cc" // lalr1.cc:859
+#line 926 "dhcp6_parser.cc"
     break;
 
-  case 47:
-#line 311 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 47: // $@15: %empty
+#line 318 "dhcp6_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 876 "dhcp6_parser.cc" // lalr1.cc:859
+#line 934 "dhcp6_parser.cc"
     break;
 
-  case 48:
-#line 313 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 48: // list_strings: "[" $@15 list_strings_content "]"
+#line 320 "dhcp6_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 885 "dhcp6_parser.cc" // lalr1.cc:859
+#line 943 "dhcp6_parser.cc"
     break;
 
-  case 51:
-#line 322 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 51: // not_empty_list_strings: "constant string"
+#line 329 "dhcp6_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 894 "dhcp6_parser.cc" // lalr1.cc:859
+#line 952 "dhcp6_parser.cc"
     break;
 
-  case 52:
-#line 326 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 52: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 333 "dhcp6_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 903 "dhcp6_parser.cc" // lalr1.cc:859
+#line 961 "dhcp6_parser.cc"
     break;
 
-  case 53:
-#line 337 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 53: // unknown_map_entry: "constant string" ":"
+#line 344 "dhcp6_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 914 "dhcp6_parser.cc" // lalr1.cc:859
+#line 972 "dhcp6_parser.cc"
     break;
 
-  case 54:
-#line 347 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 54: // $@16: %empty
+#line 354 "dhcp6_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 925 "dhcp6_parser.cc" // lalr1.cc:859
+#line 983 "dhcp6_parser.cc"
     break;
 
-  case 55:
-#line 352 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 55: // syntax_map: "{" $@16 global_objects "}"
+#line 359 "dhcp6_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 935 "dhcp6_parser.cc" // lalr1.cc:859
+#line 993 "dhcp6_parser.cc"
     break;
 
-  case 63:
-#line 371 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 63: // $@17: %empty
+#line 378 "dhcp6_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -944,670 +1002,731 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP6);
 }
-#line 948 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1006 "dhcp6_parser.cc"
     break;
 
-  case 64:
-#line 378 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 64: // dhcp6_object: "Dhcp6" $@17 ":" "{" global_params "}"
+#line 385 "dhcp6_parser.yy"
+                                                    {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 960 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1018 "dhcp6_parser.cc"
     break;
 
-  case 65:
-#line 388 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 65: // $@18: %empty
+#line 395 "dhcp6_parser.yy"
+                          {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 970 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1028 "dhcp6_parser.cc"
     break;
 
-  case 66:
-#line 392 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 66: // sub_dhcp6: "{" $@18 global_params "}"
+#line 399 "dhcp6_parser.yy"
+                               {
     // parsing completed
 }
-#line 978 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1036 "dhcp6_parser.cc"
     break;
 
-  case 91:
-#line 426 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 94: // preferred_lifetime: "preferred-lifetime" ":" "integer"
+#line 436 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
 }
-#line 987 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1045 "dhcp6_parser.cc"
     break;
 
-  case 92:
-#line 431 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 95: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 441 "dhcp6_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 996 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1054 "dhcp6_parser.cc"
     break;
 
-  case 93:
-#line 436 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 96: // renew_timer: "renew-timer" ":" "integer"
+#line 446 "dhcp6_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1005 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1063 "dhcp6_parser.cc"
     break;
 
-  case 94:
-#line 441 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 97: // rebind_timer: "rebind-timer" ":" "integer"
+#line 451 "dhcp6_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1014 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1072 "dhcp6_parser.cc"
     break;
 
-  case 95:
-#line 446 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 98: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 456 "dhcp6_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1023 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1081 "dhcp6_parser.cc"
     break;
 
-  case 96:
-#line 451 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 99: // response_cache_ttl: "response-cache-ttl" ":" "integer"
+#line 461 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr ttl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("response-cache-ttl", ttl);
+}
+#line 1090 "dhcp6_parser.cc"
+    break;
+
+  case 100: // $@19: %empty
+#line 468 "dhcp6_parser.yy"
+                             {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1098 "dhcp6_parser.cc"
+    break;
+
+  case 101: // receive_queue: "receive-queue" $@19 ":" map_value
+#line 470 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("receive-queue", yystack_[0].value.as < ElementPtr > ());
+    ctx.leave();
+}
+#line 1107 "dhcp6_parser.cc"
+    break;
+
+  case 102: // $@20: %empty
+#line 476 "dhcp6_parser.yy"
+                       {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1115 "dhcp6_parser.cc"
+    break;
+
+  case 103: // rate_limit: "rate-limit" $@20 ":" map_value
+#line 478 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("rate-limit", yystack_[0].value.as < ElementPtr > ());
+    ctx.leave();
+}
+#line 1124 "dhcp6_parser.cc"
+    break;
+
+  case 104: // $@21: %empty
+#line 483 "dhcp6_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1034 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1135 "dhcp6_parser.cc"
     break;
 
-  case 97:
-#line 456 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 105: // interfaces_config: "interfaces-config" $@21 ":" "{" interface_config_map "}"
+#line 488 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1043 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1144 "dhcp6_parser.cc"
     break;
 
-  case 98:
-#line 461 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 106: // $@22: %empty
+#line 493 "dhcp6_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1053 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1154 "dhcp6_parser.cc"
     break;
 
-  case 99:
-#line 465 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 107: // sub_interfaces6: "{" $@22 interface_config_map "}"
+#line 497 "dhcp6_parser.yy"
+                                      {
     // parsing completed
 }
-#line 1061 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1162 "dhcp6_parser.cc"
     break;
 
-  case 100:
-#line 469 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 108: // $@23: %empty
+#line 501 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1072 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1173 "dhcp6_parser.cc"
     break;
 
-  case 101:
-#line 474 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 109: // interface_config_map: "interfaces" $@23 ":" list_strings
+#line 506 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1081 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1182 "dhcp6_parser.cc"
     break;
 
-  case 102:
-#line 479 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 110: // $@24: %empty
+#line 511 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1092 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1193 "dhcp6_parser.cc"
     break;
 
-  case 103:
-#line 484 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 111: // lease_database: "lease-database" $@24 ":" "{" database_map_params "}"
+#line 516 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1101 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1202 "dhcp6_parser.cc"
     break;
 
-  case 104:
-#line 489 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 112: // $@25: %empty
+#line 521 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1112 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1213 "dhcp6_parser.cc"
     break;
 
-  case 105:
-#line 494 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 113: // hosts_database: "hosts-database" $@25 ":" "{" database_map_params "}"
+#line 526 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1121 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1222 "dhcp6_parser.cc"
     break;
 
-  case 121:
-#line 518 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 131: // $@26: %empty
+#line 552 "dhcp6_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1129 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1230 "dhcp6_parser.cc"
     break;
 
-  case 122:
-#line 520 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 132: // database_type: "type" $@26 ":" db_type
+#line 554 "dhcp6_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1138 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1239 "dhcp6_parser.cc"
     break;
 
-  case 123:
-#line 525 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1144 "dhcp6_parser.cc" // lalr1.cc:859
+  case 133: // db_type: "memfile"
+#line 559 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1245 "dhcp6_parser.cc"
     break;
 
-  case 124:
-#line 526 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1150 "dhcp6_parser.cc" // lalr1.cc:859
+  case 134: // db_type: "mysql"
+#line 560 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1251 "dhcp6_parser.cc"
     break;
 
-  case 125:
-#line 527 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1156 "dhcp6_parser.cc" // lalr1.cc:859
+  case 135: // db_type: "postgresql"
+#line 561 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1257 "dhcp6_parser.cc"
     break;
 
-  case 126:
-#line 528 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1162 "dhcp6_parser.cc" // lalr1.cc:859
+  case 136: // db_type: "cql"
+#line 562 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1263 "dhcp6_parser.cc"
     break;
 
-  case 127:
-#line 531 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 137: // $@27: %empty
+#line 565 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1170 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1271 "dhcp6_parser.cc"
     break;
 
-  case 128:
-#line 533 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 138: // user: "user" $@27 ":" "constant string"
+#line 567 "dhcp6_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1180 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1281 "dhcp6_parser.cc"
     break;
 
-  case 129:
-#line 539 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 139: // $@28: %empty
+#line 573 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1188 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1289 "dhcp6_parser.cc"
     break;
 
-  case 130:
-#line 541 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 140: // password: "password" $@28 ":" "constant string"
+#line 575 "dhcp6_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1198 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1299 "dhcp6_parser.cc"
     break;
 
-  case 131:
-#line 547 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 141: // $@29: %empty
+#line 581 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1206 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1307 "dhcp6_parser.cc"
     break;
 
-  case 132:
-#line 549 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 142: // host: "host" $@29 ":" "constant string"
+#line 583 "dhcp6_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1216 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1317 "dhcp6_parser.cc"
     break;
 
-  case 133:
-#line 555 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 143: // port: "port" ":" "integer"
+#line 589 "dhcp6_parser.yy"
+                         {
+    ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1225 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1326 "dhcp6_parser.cc"
     break;
 
-  case 134:
-#line 560 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 144: // $@30: %empty
+#line 594 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1233 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1334 "dhcp6_parser.cc"
     break;
 
-  case 135:
-#line 562 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 145: // name: "name" $@30 ":" "constant string"
+#line 596 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1243 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1344 "dhcp6_parser.cc"
     break;
 
-  case 136:
-#line 568 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 146: // persist: "persist" ":" "boolean"
+#line 602 "dhcp6_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1252 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1353 "dhcp6_parser.cc"
     break;
 
-  case 137:
-#line 573 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 147: // lfc_interval: "lfc-interval" ":" "integer"
+#line 607 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1261 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1362 "dhcp6_parser.cc"
     break;
 
-  case 138:
-#line 578 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 148: // load_threads: "load-threads" ":" "integer"
+#line 612 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("load-threads", n);
+}
+#line 1371 "dhcp6_parser.cc"
+    break;
+
+  case 149: // lfc_max_leases: "lfc-max-leases" ":" "integer"
+#line 617 "dhcp6_parser.yy"
+                                             {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("lfc-max-leases", n);
+}
+#line 1380 "dhcp6_parser.cc"
+    break;
+
+  case 150: // readonly: "readonly" ":" "boolean"
+#line 622 "dhcp6_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1270 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1389 "dhcp6_parser.cc"
     break;
 
-  case 139:
-#line 583 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 151: // connect_timeout: "connect-timeout" ":" "integer"
+#line 627 "dhcp6_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1279 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1398 "dhcp6_parser.cc"
     break;
 
-  case 140:
-#line 588 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 152: // $@31: %empty
+#line 632 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1287 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1406 "dhcp6_parser.cc"
     break;
 
-  case 141:
-#line 590 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 153: // contact_points: "contact-points" $@31 ":" "constant string"
+#line 634 "dhcp6_parser.yy"
+               {
+    ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1297 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1416 "dhcp6_parser.cc"
     break;
 
-  case 142:
-#line 596 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 154: // $@32: %empty
+#line 640 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1305 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1424 "dhcp6_parser.cc"
     break;
 
-  case 143:
-#line 598 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 155: // keyspace: "keyspace" $@32 ":" "constant string"
+#line 642 "dhcp6_parser.yy"
+               {
+    ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1315 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1434 "dhcp6_parser.cc"
     break;
 
-  case 144:
-#line 605 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 156: // $@33: %empty
+#line 649 "dhcp6_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1326 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1445 "dhcp6_parser.cc"
     break;
 
-  case 145:
-#line 610 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 157: // mac_sources: "mac-sources" $@33 ":" "[" mac_sources_list "]"
+#line 654 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1335 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1454 "dhcp6_parser.cc"
     break;
 
-  case 150:
-#line 623 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 162: // duid_id: "duid"
+#line 667 "dhcp6_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1344 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1463 "dhcp6_parser.cc"
     break;
 
-  case 151:
-#line 628 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 163: // string_id: "constant string"
+#line 672 "dhcp6_parser.yy"
+                   {
+    ElementPtr duid(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1353 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1472 "dhcp6_parser.cc"
     break;
 
-  case 152:
-#line 633 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 164: // $@34: %empty
+#line 677 "dhcp6_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1364 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1483 "dhcp6_parser.cc"
     break;
 
-  case 153:
-#line 638 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 165: // host_reservation_identifiers: "host-reservation-identifiers" $@34 ":" "[" host_reservation_identifiers_list "]"
+#line 682 "dhcp6_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1373 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1492 "dhcp6_parser.cc"
     break;
 
-  case 159:
-#line 652 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 171: // hw_address_id: "hw-address"
+#line 696 "dhcp6_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1382 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1501 "dhcp6_parser.cc"
     break;
 
-  case 160:
-#line 657 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 172: // flex_id: "flex-id"
+#line 701 "dhcp6_parser.yy"
+                  {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1391 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1510 "dhcp6_parser.cc"
     break;
 
-  case 161:
-#line 664 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 173: // $@35: %empty
+#line 708 "dhcp6_parser.yy"
+                                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1402 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1521 "dhcp6_parser.cc"
     break;
 
-  case 162:
-#line 669 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 174: // relay_supplied_options: "relay-supplied-options" $@35 ":" "[" list_content "]"
+#line 713 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1411 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1530 "dhcp6_parser.cc"
     break;
 
-  case 163:
-#line 674 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 175: // $@36: %empty
+#line 718 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1422 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1541 "dhcp6_parser.cc"
     break;
 
-  case 164:
-#line 679 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 176: // hooks_libraries: "hooks-libraries" $@36 ":" "[" hooks_libraries_list "]"
+#line 723 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1431 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1550 "dhcp6_parser.cc"
     break;
 
-  case 169:
-#line 692 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 181: // $@37: %empty
+#line 736 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1441 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1560 "dhcp6_parser.cc"
     break;
 
-  case 170:
-#line 696 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 182: // hooks_library: "{" $@37 hooks_params "}"
+#line 740 "dhcp6_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1449 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1568 "dhcp6_parser.cc"
     break;
 
-  case 171:
-#line 700 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 183: // $@38: %empty
+#line 744 "dhcp6_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1459 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1578 "dhcp6_parser.cc"
     break;
 
-  case 172:
-#line 704 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 184: // sub_hooks_library: "{" $@38 hooks_params "}"
+#line 748 "dhcp6_parser.yy"
+                              {
     // parsing completed
 }
-#line 1467 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1586 "dhcp6_parser.cc"
     break;
 
-  case 178:
-#line 717 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 190: // $@39: %empty
+#line 761 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1475 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1594 "dhcp6_parser.cc"
     break;
 
-  case 179:
-#line 719 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 191: // library: "library" $@39 ":" "constant string"
+#line 763 "dhcp6_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1485 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1604 "dhcp6_parser.cc"
     break;
 
-  case 180:
-#line 725 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 192: // $@40: %empty
+#line 769 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1493 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1612 "dhcp6_parser.cc"
     break;
 
-  case 181:
-#line 727 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 193: // parameters: "parameters" $@40 ":" value
+#line 771 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1502 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1621 "dhcp6_parser.cc"
     break;
 
-  case 182:
-#line 733 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 194: // $@41: %empty
+#line 777 "dhcp6_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1513 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1632 "dhcp6_parser.cc"
     break;
 
-  case 183:
-#line 738 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 195: // expired_leases_processing: "expired-leases-processing" $@41 ":" "{" expired_leases_params "}"
+#line 782 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1522 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1641 "dhcp6_parser.cc"
     break;
 
-  case 192:
-#line 755 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 204: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 799 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1531 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1650 "dhcp6_parser.cc"
     break;
 
-  case 193:
-#line 760 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 205: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 804 "dhcp6_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1540 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1659 "dhcp6_parser.cc"
     break;
 
-  case 194:
-#line 765 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 206: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 809 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1549 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1668 "dhcp6_parser.cc"
     break;
 
-  case 195:
-#line 770 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 207: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 814 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1558 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1677 "dhcp6_parser.cc"
     break;
 
-  case 196:
-#line 775 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 208: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 819 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1567 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1686 "dhcp6_parser.cc"
     break;
 
-  case 197:
-#line 780 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 209: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 824 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1576 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1695 "dhcp6_parser.cc"
     break;
 
-  case 198:
-#line 788 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 210: // $@42: %empty
+#line 832 "dhcp6_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 1587 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1706 "dhcp6_parser.cc"
     break;
 
-  case 199:
-#line 793 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 211: // subnet6_list: "subnet6" $@42 ":" "[" subnet6_list_content "]"
+#line 837 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1596 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1715 "dhcp6_parser.cc"
     break;
 
-  case 204:
-#line 813 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 216: // $@43: %empty
+#line 857 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1606 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1725 "dhcp6_parser.cc"
     break;
 
-  case 205:
-#line 817 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 217: // subnet6: "{" $@43 subnet6_params "}"
+#line 861 "dhcp6_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1625,1522 +1744,1544 @@ namespace isc { namespace dhcp {
     // }
     ctx.stack_.pop_back();
 }
-#line 1629 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1748 "dhcp6_parser.cc"
     break;
 
-  case 206:
-#line 836 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 218: // $@44: %empty
+#line 880 "dhcp6_parser.yy"
+                            {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1639 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1758 "dhcp6_parser.cc"
     break;
 
-  case 207:
-#line 840 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 219: // sub_subnet6: "{" $@44 subnet6_params "}"
+#line 884 "dhcp6_parser.yy"
+                                {
     // parsing completed
 }
-#line 1647 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1766 "dhcp6_parser.cc"
     break;
 
-  case 227:
-#line 869 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 240: // $@45: %empty
+#line 914 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1655 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1774 "dhcp6_parser.cc"
     break;
 
-  case 228:
-#line 871 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 241: // subnet: "subnet" $@45 ":" "constant string"
+#line 916 "dhcp6_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1665 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1784 "dhcp6_parser.cc"
     break;
 
-  case 229:
-#line 877 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 242: // $@46: %empty
+#line 922 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1673 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1792 "dhcp6_parser.cc"
     break;
 
-  case 230:
-#line 879 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 243: // interface: "interface" $@46 ":" "constant string"
+#line 924 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1683 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1802 "dhcp6_parser.cc"
     break;
 
-  case 231:
-#line 885 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 244: // $@47: %empty
+#line 930 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1691 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1810 "dhcp6_parser.cc"
     break;
 
-  case 232:
-#line 887 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 245: // interface_id: "interface-id" $@47 ":" "constant string"
+#line 932 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1701 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1820 "dhcp6_parser.cc"
     break;
 
-  case 233:
-#line 893 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 246: // $@48: %empty
+#line 938 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1709 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1828 "dhcp6_parser.cc"
     break;
 
-  case 234:
-#line 895 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 247: // client_class: "client-class" $@48 ":" "constant string"
+#line 940 "dhcp6_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1719 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1838 "dhcp6_parser.cc"
     break;
 
-  case 235:
-#line 901 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 248: // $@49: %empty
+#line 946 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1727 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1846 "dhcp6_parser.cc"
     break;
 
-  case 236:
-#line 903 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rm(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 249: // reservation_mode: "reservation-mode" $@49 ":" "constant string"
+#line 948 "dhcp6_parser.yy"
+               {
+    ElementPtr rm(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservation-mode", rm);
     ctx.leave();
 }
-#line 1737 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1856 "dhcp6_parser.cc"
     break;
 
-  case 237:
-#line 909 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 250: // cache_threshold: "cache-threshold" ":" "floating point"
+#line 954 "dhcp6_parser.yy"
+                                             {
+    ElementPtr ct(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+}
+#line 1865 "dhcp6_parser.cc"
+    break;
+
+  case 251: // id: "id" ":" "integer"
+#line 959 "dhcp6_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1746 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1874 "dhcp6_parser.cc"
     break;
 
-  case 238:
-#line 914 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 252: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 964 "dhcp6_parser.yy"
+                                         {
+    ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1755 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1883 "dhcp6_parser.cc"
     break;
 
-  case 239:
-#line 923 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 253: // $@50: %empty
+#line 973 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1766 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1894 "dhcp6_parser.cc"
     break;
 
-  case 240:
-#line 928 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 254: // option_def_list: "option-def" $@50 ":" "[" option_def_list_content "]"
+#line 978 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1775 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1903 "dhcp6_parser.cc"
     break;
 
-  case 245:
-#line 945 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 259: // $@51: %empty
+#line 995 "dhcp6_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1785 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1913 "dhcp6_parser.cc"
     break;
 
-  case 246:
-#line 949 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 260: // option_def_entry: "{" $@51 option_def_params "}"
+#line 999 "dhcp6_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1793 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1921 "dhcp6_parser.cc"
     break;
 
-  case 247:
-#line 956 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 261: // $@52: %empty
+#line 1006 "dhcp6_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1803 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1931 "dhcp6_parser.cc"
     break;
 
-  case 248:
-#line 960 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 262: // sub_option_def: "{" $@52 option_def_params "}"
+#line 1010 "dhcp6_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1811 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1939 "dhcp6_parser.cc"
     break;
 
-  case 262:
-#line 986 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 276: // code: "code" ":" "integer"
+#line 1036 "dhcp6_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 1820 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1948 "dhcp6_parser.cc"
     break;
 
-  case 264:
-#line 993 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 278: // $@53: %empty
+#line 1043 "dhcp6_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1828 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1956 "dhcp6_parser.cc"
     break;
 
-  case 265:
-#line 995 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 279: // option_def_type: "type" $@53 ":" "constant string"
+#line 1045 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 1838 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1966 "dhcp6_parser.cc"
     break;
 
-  case 266:
-#line 1001 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 280: // $@54: %empty
+#line 1051 "dhcp6_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1846 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1974 "dhcp6_parser.cc"
     break;
 
-  case 267:
-#line 1003 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 281: // option_def_record_types: "record-types" $@54 ":" "constant string"
+#line 1053 "dhcp6_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 1856 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1984 "dhcp6_parser.cc"
     break;
 
-  case 268:
-#line 1009 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 282: // $@55: %empty
+#line 1059 "dhcp6_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1864 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1992 "dhcp6_parser.cc"
     break;
 
-  case 269:
-#line 1011 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 283: // space: "space" $@55 ":" "constant string"
+#line 1061 "dhcp6_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 1874 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2002 "dhcp6_parser.cc"
     break;
 
-  case 271:
-#line 1019 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 285: // $@56: %empty
+#line 1069 "dhcp6_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1882 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2010 "dhcp6_parser.cc"
     break;
 
-  case 272:
-#line 1021 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 286: // option_def_encapsulate: "encapsulate" $@56 ":" "constant string"
+#line 1071 "dhcp6_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 1892 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2020 "dhcp6_parser.cc"
     break;
 
-  case 273:
-#line 1027 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 287: // option_def_array: "array" ":" "boolean"
+#line 1077 "dhcp6_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 1901 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2029 "dhcp6_parser.cc"
     break;
 
-  case 274:
-#line 1036 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 288: // $@57: %empty
+#line 1086 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 1912 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2040 "dhcp6_parser.cc"
     break;
 
-  case 275:
-#line 1041 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 289: // option_data_list: "option-data" $@57 ":" "[" option_data_list_content "]"
+#line 1091 "dhcp6_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1921 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2049 "dhcp6_parser.cc"
     break;
 
-  case 280:
-#line 1060 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 294: // $@58: %empty
+#line 1110 "dhcp6_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1931 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2059 "dhcp6_parser.cc"
     break;
 
-  case 281:
-#line 1064 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 295: // option_data_entry: "{" $@58 option_data_params "}"
+#line 1114 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1939 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2067 "dhcp6_parser.cc"
     break;
 
-  case 282:
-#line 1071 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 296: // $@59: %empty
+#line 1121 "dhcp6_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1949 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2077 "dhcp6_parser.cc"
     break;
 
-  case 283:
-#line 1075 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 297: // sub_option_data: "{" $@59 option_data_params "}"
+#line 1125 "dhcp6_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1957 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2085 "dhcp6_parser.cc"
     break;
 
-  case 295:
-#line 1104 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 309: // $@60: %empty
+#line 1154 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1965 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2093 "dhcp6_parser.cc"
     break;
 
-  case 296:
-#line 1106 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 310: // option_data_data: "data" $@60 ":" "constant string"
+#line 1156 "dhcp6_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 1975 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2103 "dhcp6_parser.cc"
     break;
 
-  case 299:
-#line 1116 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 313: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1166 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 1984 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2112 "dhcp6_parser.cc"
     break;
 
-  case 300:
-#line 1124 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 314: // $@61: %empty
+#line 1174 "dhcp6_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 1995 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2123 "dhcp6_parser.cc"
     break;
 
-  case 301:
-#line 1129 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 315: // pools_list: "pools" $@61 ":" "[" pools_list_content "]"
+#line 1179 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2004 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2132 "dhcp6_parser.cc"
     break;
 
-  case 306:
-#line 1144 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 320: // $@62: %empty
+#line 1194 "dhcp6_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2014 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2142 "dhcp6_parser.cc"
     break;
 
-  case 307:
-#line 1148 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 321: // pool_list_entry: "{" $@62 pool_params "}"
+#line 1198 "dhcp6_parser.yy"
+                             {
     ctx.stack_.pop_back();
 }
-#line 2022 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2150 "dhcp6_parser.cc"
     break;
 
-  case 308:
-#line 1152 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 322: // $@63: %empty
+#line 1202 "dhcp6_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2032 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2160 "dhcp6_parser.cc"
     break;
 
-  case 309:
-#line 1156 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 323: // sub_pool6: "{" $@63 pool_params "}"
+#line 1206 "dhcp6_parser.yy"
+                             {
     // parsing completed
 }
-#line 2040 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2168 "dhcp6_parser.cc"
     break;
 
-  case 316:
-#line 1170 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 330: // $@64: %empty
+#line 1220 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2048 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2176 "dhcp6_parser.cc"
     break;
 
-  case 317:
-#line 1172 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 331: // pool_entry: "pool" $@64 ":" "constant string"
+#line 1222 "dhcp6_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2058 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2186 "dhcp6_parser.cc"
     break;
 
-  case 318:
-#line 1178 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 332: // $@65: %empty
+#line 1228 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2066 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2194 "dhcp6_parser.cc"
     break;
 
-  case 319:
-#line 1180 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
+  case 333: // user_context: "user-context" $@65 ":" map_value
+#line 1230 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("user-context", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2075 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2203 "dhcp6_parser.cc"
     break;
 
-  case 320:
-#line 1188 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 334: // $@66: %empty
+#line 1238 "dhcp6_parser.yy"
+                        {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2086 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2214 "dhcp6_parser.cc"
     break;
 
-  case 321:
-#line 1193 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 335: // pd_pools_list: "pd-pools" $@66 ":" "[" pd_pools_list_content "]"
+#line 1243 "dhcp6_parser.yy"
+                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2095 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2223 "dhcp6_parser.cc"
     break;
 
-  case 326:
-#line 1208 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 340: // $@67: %empty
+#line 1258 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2105 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2233 "dhcp6_parser.cc"
     break;
 
-  case 327:
-#line 1212 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 341: // pd_pool_entry: "{" $@67 pd_pool_params "}"
+#line 1262 "dhcp6_parser.yy"
+                                {
     ctx.stack_.pop_back();
 }
-#line 2113 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2241 "dhcp6_parser.cc"
     break;
 
-  case 328:
-#line 1216 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 342: // $@68: %empty
+#line 1266 "dhcp6_parser.yy"
+                            {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2123 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2251 "dhcp6_parser.cc"
     break;
 
-  case 329:
-#line 1220 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 343: // sub_pd_pool: "{" $@68 pd_pool_params "}"
+#line 1270 "dhcp6_parser.yy"
+                                {
     // parsing completed
 }
-#line 2131 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2259 "dhcp6_parser.cc"
     break;
 
-  case 340:
-#line 1238 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 354: // $@69: %empty
+#line 1288 "dhcp6_parser.yy"
+                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2139 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2267 "dhcp6_parser.cc"
     break;
 
-  case 341:
-#line 1240 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 355: // pd_prefix: "prefix" $@69 ":" "constant string"
+#line 1290 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2149 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2277 "dhcp6_parser.cc"
     break;
 
-  case 342:
-#line 1246 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 356: // pd_prefix_len: "prefix-len" ":" "integer"
+#line 1296 "dhcp6_parser.yy"
+                                        {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2158 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2286 "dhcp6_parser.cc"
     break;
 
-  case 343:
-#line 1251 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 357: // $@70: %empty
+#line 1301 "dhcp6_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2166 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2294 "dhcp6_parser.cc"
     break;
 
-  case 344:
-#line 1253 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 358: // excluded_prefix: "excluded-prefix" $@70 ":" "constant string"
+#line 1303 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2176 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2304 "dhcp6_parser.cc"
     break;
 
-  case 345:
-#line 1259 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 359: // excluded_prefix_len: "excluded-prefix-len" ":" "integer"
+#line 1309 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2185 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2313 "dhcp6_parser.cc"
     break;
 
-  case 346:
-#line 1264 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 360: // pd_delegated_len: "delegated-len" ":" "integer"
+#line 1314 "dhcp6_parser.yy"
+                                              {
+    ElementPtr deleg(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2194 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2322 "dhcp6_parser.cc"
     break;
 
-  case 347:
-#line 1272 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 361: // $@71: %empty
+#line 1322 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2205 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2333 "dhcp6_parser.cc"
     break;
 
-  case 348:
-#line 1277 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 362: // reservations: "reservations" $@71 ":" "[" reservations_list "]"
+#line 1327 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2214 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2342 "dhcp6_parser.cc"
     break;
 
-  case 353:
-#line 1290 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 367: // $@72: %empty
+#line 1340 "dhcp6_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2224 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2352 "dhcp6_parser.cc"
     break;
 
-  case 354:
-#line 1294 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 368: // reservation: "{" $@72 reservation_params "}"
+#line 1344 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 2232 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2360 "dhcp6_parser.cc"
     break;
 
-  case 355:
-#line 1298 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 369: // $@73: %empty
+#line 1348 "dhcp6_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2242 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2370 "dhcp6_parser.cc"
     break;
 
-  case 356:
-#line 1302 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 370: // sub_reservation: "{" $@73 reservation_params "}"
+#line 1352 "dhcp6_parser.yy"
+                                    {
     // parsing completed
 }
-#line 2250 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2378 "dhcp6_parser.cc"
     break;
 
-  case 370:
-#line 1326 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 384: // $@74: %empty
+#line 1376 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2261 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2389 "dhcp6_parser.cc"
     break;
 
-  case 371:
-#line 1331 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 385: // ip_addresses: "ip-addresses" $@74 ":" list_strings
+#line 1381 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2270 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2398 "dhcp6_parser.cc"
     break;
 
-  case 372:
-#line 1336 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 386: // $@75: %empty
+#line 1386 "dhcp6_parser.yy"
+                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2281 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2409 "dhcp6_parser.cc"
     break;
 
-  case 373:
-#line 1341 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 387: // prefixes: "prefixes" $@75 ":" list_strings
+#line 1391 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2290 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2418 "dhcp6_parser.cc"
     break;
 
-  case 374:
-#line 1346 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 388: // $@76: %empty
+#line 1396 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2298 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2426 "dhcp6_parser.cc"
     break;
 
-  case 375:
-#line 1348 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 389: // duid: "duid" $@76 ":" "constant string"
+#line 1398 "dhcp6_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2308 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2436 "dhcp6_parser.cc"
     break;
 
-  case 376:
-#line 1354 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 390: // $@77: %empty
+#line 1404 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2316 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2444 "dhcp6_parser.cc"
     break;
 
-  case 377:
-#line 1356 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 391: // hw_address: "hw-address" $@77 ":" "constant string"
+#line 1406 "dhcp6_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2326 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2454 "dhcp6_parser.cc"
     break;
 
-  case 378:
-#line 1362 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 392: // $@78: %empty
+#line 1412 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2334 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2462 "dhcp6_parser.cc"
     break;
 
-  case 379:
-#line 1364 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 393: // hostname: "hostname" $@78 ":" "constant string"
+#line 1414 "dhcp6_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2344 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2472 "dhcp6_parser.cc"
     break;
 
-  case 380:
-#line 1370 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 394: // $@79: %empty
+#line 1420 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2352 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2480 "dhcp6_parser.cc"
     break;
 
-  case 381:
-#line 1372 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 395: // flex_id_value: "flex-id" $@79 ":" "constant string"
+#line 1422 "dhcp6_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2362 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2490 "dhcp6_parser.cc"
     break;
 
-  case 382:
-#line 1378 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 396: // $@80: %empty
+#line 1428 "dhcp6_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2373 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2501 "dhcp6_parser.cc"
     break;
 
-  case 383:
-#line 1383 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 397: // reservation_client_classes: "client-classes" $@80 ":" list_strings
+#line 1433 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2382 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2510 "dhcp6_parser.cc"
     break;
 
-  case 384:
-#line 1391 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 398: // $@81: %empty
+#line 1441 "dhcp6_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2393 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2521 "dhcp6_parser.cc"
     break;
 
-  case 385:
-#line 1396 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 399: // relay: "relay" $@81 ":" "{" relay_map "}"
+#line 1446 "dhcp6_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2402 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2530 "dhcp6_parser.cc"
     break;
 
-  case 386:
-#line 1401 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 400: // $@82: %empty
+#line 1451 "dhcp6_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2410 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2538 "dhcp6_parser.cc"
     break;
 
-  case 387:
-#line 1403 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 401: // relay_map: "ip-address" $@82 ":" "constant string"
+#line 1453 "dhcp6_parser.yy"
+               {
+    ElementPtr ip(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2420 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2548 "dhcp6_parser.cc"
     break;
 
-  case 388:
-#line 1412 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 402: // $@83: %empty
+#line 1462 "dhcp6_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2431 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2559 "dhcp6_parser.cc"
     break;
 
-  case 389:
-#line 1417 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 403: // client_classes: "client-classes" $@83 ":" "[" client_classes_list "]"
+#line 1467 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2440 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2568 "dhcp6_parser.cc"
     break;
 
-  case 392:
-#line 1426 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 406: // $@84: %empty
+#line 1476 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2450 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2578 "dhcp6_parser.cc"
     break;
 
-  case 393:
-#line 1430 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 407: // client_class: "{" $@84 client_class_params "}"
+#line 1480 "dhcp6_parser.yy"
+                                     {
     ctx.stack_.pop_back();
 }
-#line 2458 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2586 "dhcp6_parser.cc"
     break;
 
-  case 403:
-#line 1450 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 417: // $@85: %empty
+#line 1500 "dhcp6_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2466 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2594 "dhcp6_parser.cc"
     break;
 
-  case 404:
-#line 1452 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 418: // client_class_test: "test" $@85 ":" "constant string"
+#line 1502 "dhcp6_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2476 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2604 "dhcp6_parser.cc"
     break;
 
-  case 405:
-#line 1461 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 419: // $@86: %empty
+#line 1511 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 2487 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2615 "dhcp6_parser.cc"
     break;
 
-  case 406:
-#line 1466 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 420: // server_id: "server-id" $@86 ":" "{" server_id_params "}"
+#line 1516 "dhcp6_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2496 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2624 "dhcp6_parser.cc"
     break;
 
-  case 416:
-#line 1484 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 430: // $@87: %empty
+#line 1534 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 2504 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2632 "dhcp6_parser.cc"
     break;
 
-  case 417:
-#line 1486 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 431: // server_id_type: "type" $@87 ":" duid_type
+#line 1536 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2513 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2641 "dhcp6_parser.cc"
     break;
 
-  case 418:
-#line 1491 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 2519 "dhcp6_parser.cc" // lalr1.cc:859
+  case 432: // duid_type: "LLT"
+#line 1541 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
+#line 2647 "dhcp6_parser.cc"
     break;
 
-  case 419:
-#line 1492 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 2525 "dhcp6_parser.cc" // lalr1.cc:859
+  case 433: // duid_type: "EN"
+#line 1542 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
+#line 2653 "dhcp6_parser.cc"
     break;
 
-  case 420:
-#line 1493 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 2531 "dhcp6_parser.cc" // lalr1.cc:859
+  case 434: // duid_type: "LL"
+#line 1543 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
+#line 2659 "dhcp6_parser.cc"
     break;
 
-  case 421:
-#line 1496 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 435: // htype: "htype" ":" "integer"
+#line 1546 "dhcp6_parser.yy"
+                           {
+    ElementPtr htype(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 2540 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2668 "dhcp6_parser.cc"
     break;
 
-  case 422:
-#line 1501 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 436: // $@88: %empty
+#line 1551 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2548 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2676 "dhcp6_parser.cc"
     break;
 
-  case 423:
-#line 1503 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 437: // identifier: "identifier" $@88 ":" "constant string"
+#line 1553 "dhcp6_parser.yy"
+               {
+    ElementPtr id(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 2558 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2686 "dhcp6_parser.cc"
     break;
 
-  case 424:
-#line 1509 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 438: // time: "time" ":" "integer"
+#line 1559 "dhcp6_parser.yy"
+                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 2567 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2695 "dhcp6_parser.cc"
     break;
 
-  case 425:
-#line 1514 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 439: // enterprise_id: "enterprise-id" ":" "integer"
+#line 1564 "dhcp6_parser.yy"
+                                           {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 2576 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2704 "dhcp6_parser.cc"
     break;
 
-  case 426:
-#line 1521 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 440: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1571 "dhcp6_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2585 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2713 "dhcp6_parser.cc"
     break;
 
-  case 427:
-#line 1528 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 441: // $@89: %empty
+#line 1578 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2596 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2724 "dhcp6_parser.cc"
     break;
 
-  case 428:
-#line 1533 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 442: // control_socket: "control-socket" $@89 ":" "{" control_socket_params "}"
+#line 1583 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2605 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2733 "dhcp6_parser.cc"
     break;
 
-  case 433:
-#line 1546 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 448: // $@90: %empty
+#line 1597 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2613 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2741 "dhcp6_parser.cc"
     break;
 
-  case 434:
-#line 1548 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 449: // socket_type: "socket-type" $@90 ":" "constant string"
+#line 1599 "dhcp6_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2623 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2751 "dhcp6_parser.cc"
     break;
 
-  case 435:
-#line 1554 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 450: // $@91: %empty
+#line 1605 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2631 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2759 "dhcp6_parser.cc"
     break;
 
-  case 436:
-#line 1556 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 451: // socket_name: "socket-name" $@91 ":" "constant string"
+#line 1607 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2641 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2769 "dhcp6_parser.cc"
     break;
 
-  case 437:
-#line 1564 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 452: // background_commands: "background-commands" ":" "boolean"
+#line 1613 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr bg(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("background-commands", bg);
+}
+#line 2778 "dhcp6_parser.cc"
+    break;
+
+  case 453: // $@92: %empty
+#line 1620 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2652 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2789 "dhcp6_parser.cc"
     break;
 
-  case 438:
-#line 1569 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 454: // dhcp_ddns: "dhcp-ddns" $@92 ":" "{" dhcp_ddns_params "}"
+#line 1625 "dhcp6_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2661 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2798 "dhcp6_parser.cc"
     break;
 
-  case 439:
-#line 1574 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 455: // $@93: %empty
+#line 1630 "dhcp6_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2671 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2808 "dhcp6_parser.cc"
     break;
 
-  case 440:
-#line 1578 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 456: // sub_dhcp_ddns: "{" $@93 dhcp_ddns_params "}"
+#line 1634 "dhcp6_parser.yy"
+                                  {
     // parsing completed
 }
-#line 2679 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2816 "dhcp6_parser.cc"
     break;
 
-  case 458:
-#line 1603 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 474: // enable_updates: "enable-updates" ":" "boolean"
+#line 1659 "dhcp6_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2688 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2825 "dhcp6_parser.cc"
     break;
 
-  case 459:
-#line 1608 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 475: // $@94: %empty
+#line 1664 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2696 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2833 "dhcp6_parser.cc"
     break;
 
-  case 460:
-#line 1610 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 476: // qualifying_suffix: "qualifying-suffix" $@94 ":" "constant string"
+#line 1666 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2706 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2843 "dhcp6_parser.cc"
     break;
 
-  case 461:
-#line 1616 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 477: // $@95: %empty
+#line 1672 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2714 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2851 "dhcp6_parser.cc"
     break;
 
-  case 462:
-#line 1618 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 478: // server_ip: "server-ip" $@95 ":" "constant string"
+#line 1674 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2724 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2861 "dhcp6_parser.cc"
     break;
 
-  case 463:
-#line 1624 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 479: // server_port: "server-port" ":" "integer"
+#line 1680 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2733 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2870 "dhcp6_parser.cc"
     break;
 
-  case 464:
-#line 1629 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 480: // $@96: %empty
+#line 1685 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2741 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2878 "dhcp6_parser.cc"
     break;
 
-  case 465:
-#line 1631 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 481: // sender_ip: "sender-ip" $@96 ":" "constant string"
+#line 1687 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2751 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2888 "dhcp6_parser.cc"
     break;
 
-  case 466:
-#line 1637 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 482: // sender_port: "sender-port" ":" "integer"
+#line 1693 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2760 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2897 "dhcp6_parser.cc"
     break;
 
-  case 467:
-#line 1642 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 483: // max_queue_size: "max-queue-size" ":" "integer"
+#line 1698 "dhcp6_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2769 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2906 "dhcp6_parser.cc"
     break;
 
-  case 468:
-#line 1647 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 484: // $@97: %empty
+#line 1703 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2777 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2914 "dhcp6_parser.cc"
     break;
 
-  case 469:
-#line 1649 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 485: // ncr_protocol: "ncr-protocol" $@97 ":" ncr_protocol_value
+#line 1705 "dhcp6_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2786 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2923 "dhcp6_parser.cc"
     break;
 
-  case 470:
-#line 1655 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2792 "dhcp6_parser.cc" // lalr1.cc:859
+  case 486: // ncr_protocol_value: "UDP"
+#line 1711 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 2929 "dhcp6_parser.cc"
     break;
 
-  case 471:
-#line 1656 "dhcp6_parser.yy" // lalr1.cc:859
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2798 "dhcp6_parser.cc" // lalr1.cc:859
+  case 487: // ncr_protocol_value: "TCP"
+#line 1712 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 2935 "dhcp6_parser.cc"
     break;
 
-  case 472:
-#line 1659 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 488: // $@98: %empty
+#line 1715 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2806 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2943 "dhcp6_parser.cc"
     break;
 
-  case 473:
-#line 1661 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 489: // ncr_format: "ncr-format" $@98 ":" "JSON"
+#line 1717 "dhcp6_parser.yy"
+             {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 2816 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2953 "dhcp6_parser.cc"
     break;
 
-  case 474:
-#line 1667 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 490: // always_include_fqdn: "always-include-fqdn" ":" "boolean"
+#line 1723 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2825 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2962 "dhcp6_parser.cc"
     break;
 
-  case 475:
-#line 1672 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 491: // override_no_update: "override-no-update" ":" "boolean"
+#line 1728 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2834 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2971 "dhcp6_parser.cc"
     break;
 
-  case 476:
-#line 1677 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 492: // override_client_update: "override-client-update" ":" "boolean"
+#line 1733 "dhcp6_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2843 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2980 "dhcp6_parser.cc"
     break;
 
-  case 477:
-#line 1682 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 493: // $@99: %empty
+#line 1738 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 2851 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2988 "dhcp6_parser.cc"
     break;
 
-  case 478:
-#line 1684 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 494: // replace_client_name: "replace-client-name" $@99 ":" replace_client_name_value
+#line 1740 "dhcp6_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2860 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2997 "dhcp6_parser.cc"
     break;
 
-  case 479:
-#line 1690 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
+  case 495: // replace_client_name_value: "when-present"
+#line 1746 "dhcp6_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 2868 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3005 "dhcp6_parser.cc"
     break;
 
-  case 480:
-#line 1693 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 496: // replace_client_name_value: "never"
+#line 1749 "dhcp6_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2876 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3013 "dhcp6_parser.cc"
     break;
 
-  case 481:
-#line 1696 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 497: // replace_client_name_value: "always"
+#line 1752 "dhcp6_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2884 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3021 "dhcp6_parser.cc"
     break;
 
-  case 482:
-#line 1699 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 498: // replace_client_name_value: "when-not-present"
+#line 1755 "dhcp6_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2892 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3029 "dhcp6_parser.cc"
     break;
 
-  case 483:
-#line 1702 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 499: // replace_client_name_value: "boolean"
+#line 1758 "dhcp6_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 2901 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3038 "dhcp6_parser.cc"
     break;
 
-  case 484:
-#line 1708 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 500: // $@100: %empty
+#line 1764 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2909 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3046 "dhcp6_parser.cc"
     break;
 
-  case 485:
-#line 1710 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 501: // generated_prefix: "generated-prefix" $@100 ":" "constant string"
+#line 1766 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 2919 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3056 "dhcp6_parser.cc"
     break;
 
-  case 486:
-#line 1718 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 502: // $@101: %empty
+#line 1774 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2927 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3064 "dhcp6_parser.cc"
     break;
 
-  case 487:
-#line 1720 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 503: // dhcp4_json_object: "Dhcp4" $@101 ":" value
+#line 1776 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2936 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3073 "dhcp6_parser.cc"
     break;
 
-  case 488:
-#line 1725 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 504: // $@102: %empty
+#line 1781 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2944 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3081 "dhcp6_parser.cc"
     break;
 
-  case 489:
-#line 1727 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 505: // dhcpddns_json_object: "DhcpDdns" $@102 ":" value
+#line 1783 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2953 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3090 "dhcp6_parser.cc"
     break;
 
-  case 490:
-#line 1737 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 506: // $@103: %empty
+#line 1793 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 2964 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3101 "dhcp6_parser.cc"
     break;
 
-  case 491:
-#line 1742 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 507: // logging_object: "Logging" $@103 ":" "{" logging_params "}"
+#line 1798 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2973 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3110 "dhcp6_parser.cc"
     break;
 
-  case 495:
-#line 1759 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 511: // $@104: %empty
+#line 1815 "dhcp6_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 2984 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3121 "dhcp6_parser.cc"
     break;
 
-  case 496:
-#line 1764 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 512: // loggers: "loggers" $@104 ":" "[" loggers_entries "]"
+#line 1820 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2993 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3130 "dhcp6_parser.cc"
     break;
 
-  case 499:
-#line 1776 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 515: // $@105: %empty
+#line 1832 "dhcp6_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3003 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3140 "dhcp6_parser.cc"
     break;
 
-  case 500:
-#line 1780 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 516: // logger_entry: "{" $@105 logger_params "}"
+#line 1836 "dhcp6_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 3011 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3148 "dhcp6_parser.cc"
     break;
 
-  case 508:
-#line 1795 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 524: // debuglevel: "debuglevel" ":" "integer"
+#line 1851 "dhcp6_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3020 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3157 "dhcp6_parser.cc"
     break;
 
-  case 509:
-#line 1800 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 525: // $@106: %empty
+#line 1856 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3028 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3165 "dhcp6_parser.cc"
     break;
 
-  case 510:
-#line 1802 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 526: // severity: "severity" $@106 ":" "constant string"
+#line 1858 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3038 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3175 "dhcp6_parser.cc"
     break;
 
-  case 511:
-#line 1808 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 527: // $@107: %empty
+#line 1864 "dhcp6_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3049 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3186 "dhcp6_parser.cc"
     break;
 
-  case 512:
-#line 1813 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 528: // output_options_list: "output_options" $@107 ":" "[" output_options_list_content "]"
+#line 1869 "dhcp6_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3058 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3195 "dhcp6_parser.cc"
     break;
 
-  case 515:
-#line 1822 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 531: // $@108: %empty
+#line 1878 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3068 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3205 "dhcp6_parser.cc"
     break;
 
-  case 516:
-#line 1826 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 532: // output_entry: "{" $@108 output_params_list "}"
+#line 1882 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 3076 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3213 "dhcp6_parser.cc"
     break;
 
-  case 523:
-#line 1840 "dhcp6_parser.yy" // lalr1.cc:859
-    {
+  case 539: // $@109: %empty
+#line 1896 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3084 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3221 "dhcp6_parser.cc"
     break;
 
-  case 524:
-#line 1842 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 540: // output: "output" $@109 ":" "constant string"
+#line 1898 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3094 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3231 "dhcp6_parser.cc"
     break;
 
-  case 525:
-#line 1848 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 541: // flush: "flush" ":" "boolean"
+#line 1904 "dhcp6_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3103 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3240 "dhcp6_parser.cc"
     break;
 
-  case 526:
-#line 1853 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 542: // maxsize: "maxsize" ":" "integer"
+#line 1909 "dhcp6_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3112 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3249 "dhcp6_parser.cc"
     break;
 
-  case 527:
-#line 1858 "dhcp6_parser.yy" // lalr1.cc:859
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 543: // maxver: "maxver" ":" "integer"
+#line 1914 "dhcp6_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3121 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3258 "dhcp6_parser.cc"
     break;
 
 
-#line 3125 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3262 "dhcp6_parser.cc"
+
             default:
               break;
             }
         }
+#if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
+#endif // YY_EXCEPTIONS
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
-      yypush_ (YY_NULLPTR, yylhs);
+      yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -3149,7 +3290,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3160,7 +3303,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3177,69 +3320,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
-    yyerror_range[1].location = yystack_[yylen - 1].location;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
-      yypush_ ("Shifting", error_token);
+      error_token.state = state_type (yyn);
+      yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3247,6 +3402,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3255,12 +3411,12 @@ namespace isc { namespace dhcp {
 
     return yyresult;
   }
+#if YY_EXCEPTIONS
     catch (...)
       {
-        YYCDEBUG << "Exception caught: cleaning lookahead and stack"
-                 << std::endl;
+        YYCDEBUG << "Exception caught: cleaning lookahead and stack\n";
         // Do not try to display the values of the reclaimed symbols,
-        // as their printer might throw an exception.
+        // as their printers might throw an exception.
         if (!yyla.empty ())
           yy_destroy_ (YY_NULLPTR, yyla);
 
@@ -3271,26 +3427,112 @@ namespace isc { namespace dhcp {
           }
         throw;
       }
+#endif // YY_EXCEPTIONS
   }
 
   void
   Dhcp6Parser::error (const syntax_error& yyexc)
   {
-    error (yyexc.location, yyexc.what());
+    error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp6Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp6Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
 
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp6Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp6Parser::context.
+  Dhcp6Parser::context::context (const Dhcp6Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp6Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  Dhcp6Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3309,41 +3551,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp6Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3352,22 +3585,23 @@ namespace isc { namespace dhcp {
         case N:                               \
           yyformat = S;                       \
         break
-        YYCASE_(0, YY_("syntax error"));
-        YYCASE_(1, YY_("syntax error, unexpected %s"));
-        YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-        YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-        YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-        YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
+      default: // Avoid compiler warnings.
+        YYCASE_ (0, YY_("syntax error"));
+        YYCASE_ (1, YY_("syntax error, unexpected %s"));
+        YYCASE_ (2, YY_("syntax error, unexpected %s, expecting %s"));
+        YYCASE_ (3, YY_("syntax error, unexpected %s, expecting %s or %s"));
+        YYCASE_ (4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
+        YYCASE_ (5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
 #undef YYCASE_
       }
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -3376,592 +3610,611 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp6Parser::yypact_ninf_ = -490;
+  const short Dhcp6Parser::yypact_ninf_ = -521;
 
   const signed char Dhcp6Parser::yytable_ninf_ = -1;
 
-  const short int
+  const short
   Dhcp6Parser::yypact_[] =
   {
-     180,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,    47,    20,    63,    80,    95,   102,   113,
-     153,   174,   188,   189,   216,   220,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-      20,   -32,    18,    27,   175,    19,    -1,    45,    81,    28,
-     117,   -33,    99,  -490,   223,   234,   241,   249,   263,  -490,
-    -490,  -490,  -490,   264,  -490,    29,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,   265,   268,   270,   272,   273,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   287,
-    -490,  -490,  -490,    97,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,   285,  -490,  -490,
-    -490,  -490,  -490,  -490,   293,   294,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,   104,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,   116,  -490,  -490,  -490,  -490,   295,  -490,
-     296,   298,  -490,  -490,  -490,   136,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,   299,   300,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,   319,  -490,  -490,  -490,   321,  -490,  -490,
-     318,   301,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,   323,  -490,  -490,  -490,  -490,   320,   326,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,   165,
-    -490,  -490,  -490,   327,  -490,  -490,   328,  -490,   329,   330,
-    -490,  -490,   331,   332,   333,  -490,  -490,  -490,   166,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,    20,    20,  -490,   187,   334,
-     335,   336,   337,  -490,    18,  -490,   338,   339,   340,   201,
-     202,   203,   204,   205,   346,   347,   348,   349,   350,   351,
-     352,   353,   354,   355,   217,   356,   358,    27,  -490,   359,
-    -490,    43,   360,   361,   362,   363,   364,   225,   224,   367,
-     368,   369,   370,    19,  -490,   371,   372,    -1,  -490,   373,
-     235,   374,   239,   242,    45,  -490,   376,   377,   378,   380,
-     381,   383,   384,  -490,    81,   385,   386,   247,   388,   389,
-     390,   250,  -490,    28,   391,   251,  -490,   117,   394,   395,
-     -23,  -490,   254,   397,   400,   262,   401,   266,   267,   403,
-     404,   269,   271,   274,   405,   408,    99,  -490,  -490,  -490,
-     409,   407,   411,    20,    20,  -490,   412,   414,   415,  -490,
-    -490,  -490,  -490,  -490,   418,   419,   420,   421,   422,   423,
-     424,   427,   426,   429,  -490,   430,   431,  -490,   434,  -490,
-    -490,  -490,  -490,   432,   413,  -490,  -490,  -490,   437,   439,
-     302,   303,   304,  -490,  -490,   306,   307,   446,   447,  -490,
-     310,   448,  -490,   313,  -490,   314,  -490,  -490,  -490,   434,
-     434,   434,   315,   316,   317,   322,  -490,   324,   325,  -490,
-     341,   342,   343,  -490,  -490,   344,  -490,  -490,   345,    20,
-    -490,  -490,   357,   365,  -490,   366,  -490,  -490,   -30,   375,
-    -490,  -490,  -490,    66,   379,  -490,    20,    27,   382,  -490,
-    -490,   175,   108,   108,   454,   456,   457,   -39,    20,    70,
-      35,   459,   109,    24,    30,    99,  -490,  -490,   465,  -490,
-      43,   463,   464,  -490,  -490,  -490,  -490,  -490,   466,   399,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,   169,  -490,   172,  -490,  -490,
-     467,  -490,  -490,  -490,  -490,   468,   472,   473,   475,   476,
-    -490,  -490,  -490,   210,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,   211,  -490,   477,
-     478,  -490,  -490,   483,   479,  -490,  -490,   485,   489,  -490,
-    -490,  -490,   244,  -490,  -490,  -490,   487,  -490,  -490,  -490,
-     246,  -490,  -490,  -490,  -490,   255,  -490,   488,   493,  -490,
-     494,   495,   497,   498,   500,   501,   212,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,   502,   503,   506,  -490,
-    -490,   213,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-     214,  -490,  -490,  -490,   222,   387,   392,  -490,  -490,   491,
-     508,  -490,  -490,   507,   509,  -490,  -490,   510,   511,  -490,
-    -490,   512,  -490,   513,   382,  -490,  -490,   514,   515,   517,
-     519,   393,   396,   402,   398,   406,   520,   521,   108,  -490,
-    -490,    19,  -490,   454,    28,  -490,   456,   117,  -490,   457,
-     -39,  -490,  -490,    70,  -490,    35,  -490,   -33,  -490,   459,
-     410,   416,   417,   425,   428,   433,   109,  -490,   522,   523,
-     435,   436,   438,    24,  -490,   524,   525,    30,  -490,  -490,
-    -490,   526,   528,  -490,    -1,  -490,   463,    45,  -490,   464,
-      81,  -490,   466,   529,  -490,   531,  -490,   237,   440,   441,
-     442,  -490,  -490,  -490,  -490,  -490,   443,   444,  -490,   228,
-    -490,   530,  -490,   532,  -490,  -490,  -490,  -490,   230,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,   192,   445,  -490,
-    -490,  -490,  -490,   449,   450,  -490,  -490,   451,   232,  -490,
-     236,  -490,   533,  -490,   452,   527,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,   259,  -490,    54,   527,  -490,  -490,   535,
-    -490,  -490,  -490,   238,  -490,  -490,  -490,  -490,  -490,   539,
-     453,   541,    54,  -490,   542,  -490,   455,  -490,   544,  -490,
-    -490,   261,  -490,   -93,   544,  -490,  -490,   545,   548,   549,
-     240,  -490,  -490,  -490,  -490,  -490,  -490,   551,   458,   461,
-     462,   -93,  -490,   460,  -490,  -490,  -490,  -490,  -490
+     115,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,    55,    20,    60,    62,    69,    80,    87,
+      95,    97,   134,   143,   149,   174,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+      20,     8,    16,    92,   156,    17,     5,   148,    44,    50,
+      28,     1,   102,  -521,   173,   192,   243,   227,   248,  -521,
+    -521,  -521,  -521,   261,  -521,   161,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,   274,   301,   310,   311,   314,   315,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,   325,  -521,  -521,  -521,   172,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,   269,  -521,  -521,  -521,  -521,  -521,  -521,
+     326,   327,  -521,   328,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,   180,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,   188,  -521,  -521,  -521,  -521,   329,  -521,   330,   331,
+    -521,  -521,  -521,   219,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,   289,
+     266,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,   333,  -521,  -521,  -521,   334,  -521,  -521,   332,   336,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,   337,  -521,  -521,  -521,  -521,   335,   339,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,   220,  -521,  -521,
+    -521,   340,  -521,  -521,   341,  -521,   342,   343,  -521,  -521,
+     344,   345,   346,  -521,  -521,  -521,   228,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,    20,    20,  -521,   201,   348,   349,   350,
+     351,  -521,    16,  -521,   352,   353,   354,   208,   209,   210,
+     211,   212,   213,   361,   362,   363,   364,   365,   366,   367,
+     368,   369,   370,   371,   372,   226,   374,   375,    92,  -521,
+     376,  -521,   -11,   377,   378,   379,   380,   381,   235,   234,
+     384,   237,   386,   387,   388,    17,  -521,   389,   390,     5,
+    -521,   391,   245,   393,   247,   249,   148,  -521,   395,   397,
+     398,   399,   400,   401,   402,  -521,    44,   403,   404,   258,
+     406,   407,   408,   260,  -521,    50,   410,   262,  -521,    28,
+     412,   413,   141,  -521,   268,   414,   418,   275,   419,   277,
+     278,   420,   421,   279,   280,   281,   423,   426,   102,  -521,
+    -521,  -521,   427,   428,   429,    20,    20,  -521,   430,   431,
+     432,  -521,  -521,  -521,  -521,  -521,  -521,   433,   433,   436,
+     437,   438,   439,   440,   443,   444,   447,   446,   448,  -521,
+     449,   450,  -521,   453,  -521,  -521,  -521,  -521,   451,   458,
+    -521,  -521,  -521,   459,   460,   304,   313,   316,  -521,  -521,
+     318,  -521,   319,   465,   466,  -521,   322,   433,  -521,   324,
+    -521,   338,  -521,  -521,  -521,   453,   453,   453,   347,   355,
+     356,   357,  -521,   358,   359,  -521,   360,   373,   382,  -521,
+    -521,   383,  -521,  -521,   385,    20,  -521,  -521,   392,   394,
+    -521,   396,  -521,  -521,   -87,   405,  -521,  -521,  -521,    23,
+     409,  -521,    20,    92,   411,  -521,  -521,   156,    15,    15,
+    -521,  -521,  -521,   468,   469,   470,   -10,    20,   122,    41,
+     471,    21,    39,   221,   102,  -521,  -521,   476,  -521,   -11,
+     474,   475,  -521,  -521,  -521,  -521,  -521,   477,   415,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,   229,  -521,   230,  -521,  -521,   478,  -521,
+    -521,  -521,  -521,   479,   481,   483,   485,   486,   487,   488,
+    -521,  -521,  -521,   231,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,   238,
+    -521,   489,   490,  -521,  -521,   492,   491,  -521,  -521,   494,
+     498,  -521,  -521,  -521,    85,  -521,  -521,  -521,   496,  -521,
+    -521,  -521,   151,  -521,  -521,  -521,  -521,   282,  -521,   497,
+     501,  -521,   507,   508,   509,   510,   511,   513,   240,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,   514,   515,
+     516,  -521,  -521,   241,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,   517,   242,  -521,  -521,  -521,  -521,   263,   416,
+     417,  -521,  -521,   518,   519,  -521,  -521,   520,   522,  -521,
+    -521,   523,   525,  -521,  -521,   526,  -521,   527,   411,  -521,
+    -521,   532,   533,   534,   536,   422,   424,   425,   434,   435,
+     441,   442,   537,   539,    15,  -521,  -521,    17,  -521,   468,
+      50,  -521,   469,    28,  -521,   470,   -10,  -521,  -521,   122,
+    -521,    41,  -521,     1,  -521,   471,   445,   452,   454,   455,
+     456,   457,    21,  -521,   541,   543,   461,   462,   463,    39,
+    -521,   544,   545,   464,   221,  -521,  -521,  -521,   524,   547,
+    -521,     5,  -521,   474,   148,  -521,   475,    44,  -521,   477,
+     548,  -521,   546,  -521,   293,   472,   473,   480,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,   482,   484,  -521,   264,  -521,
+     549,  -521,   550,  -521,  -521,  -521,  -521,   265,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,    22,   493,  -521,  -521,
+    -521,  -521,   495,   499,  -521,  -521,  -521,   500,   272,  -521,
+     273,  -521,   552,  -521,   503,   554,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,   286,  -521,    13,   554,  -521,  -521,   551,
+    -521,  -521,  -521,   276,  -521,  -521,  -521,  -521,  -521,   558,
+     467,   559,    13,  -521,   560,  -521,   504,  -521,   557,  -521,
+    -521,   290,  -521,    52,   557,  -521,  -521,   564,   565,   566,
+     283,  -521,  -521,  -521,  -521,  -521,  -521,   567,   506,   512,
+     528,    52,  -521,   530,  -521,  -521,  -521,  -521,  -521
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
       20,    22,    24,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     1,    41,    34,    30,
       29,    26,    27,    28,    33,     3,    31,    32,    54,     5,
-      65,     7,    98,     9,   206,    11,   308,    13,   328,    15,
-     355,    17,   247,    19,   282,    21,   171,    23,   439,    25,
-      43,    37,     0,     0,     0,     0,     0,     0,   357,   249,
-     284,     0,     0,    45,     0,    44,     0,     0,    38,    63,
-     490,   486,   488,     0,    62,     0,    56,    58,    60,    61,
-      59,    96,   102,   104,     0,     0,     0,     0,     0,   198,
-     239,   274,   144,   161,   152,   388,   163,   182,   405,     0,
-     427,   437,    90,     0,    67,    69,    70,    71,    72,    73,
-      75,    76,    77,    78,    80,    79,    84,    85,    74,    82,
-      83,    81,    86,    87,    88,    89,   100,     0,   392,   300,
-     320,   227,   229,   231,     0,     0,   235,   233,   347,   384,
-     226,   210,   211,   212,   213,     0,   208,   217,   218,   219,
-     222,   224,   220,   221,   214,   215,   216,   223,   225,   316,
-     318,   315,   313,     0,   310,   312,   314,   340,     0,   343,
-       0,     0,   339,   335,   338,     0,   330,   332,   333,   336,
-     337,   334,   382,   370,   372,   374,   376,   378,   380,   369,
-     368,     0,   358,   359,   363,   364,   361,   365,   366,   367,
-     362,   264,   134,     0,   268,   266,   271,     0,   260,   261,
-       0,   250,   251,   253,   263,   254,   255,   256,   270,   257,
-     258,   259,   295,     0,   293,   294,   297,   298,     0,   285,
-     286,   288,   289,   290,   291,   292,   178,   180,   175,     0,
-     173,   176,   177,     0,   459,   461,     0,   464,     0,     0,
-     468,   472,     0,     0,     0,   477,   484,   457,     0,   441,
-     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
-     453,   454,   455,   456,    42,     0,     0,    35,     0,     0,
-       0,     0,     0,    53,     0,    55,     0,     0,     0,     0,
+      65,     7,   106,     9,   218,    11,   322,    13,   342,    15,
+     369,    17,   261,    19,   296,    21,   183,    23,   455,    25,
+      43,    37,     0,     0,     0,     0,     0,     0,   371,   263,
+     298,     0,     0,    45,     0,    44,     0,     0,    38,    63,
+     506,   502,   504,     0,    62,     0,    56,    58,    60,    61,
+      59,   104,   110,   112,     0,     0,     0,     0,     0,     0,
+     100,   102,   210,   253,   288,   156,   173,   164,   402,   175,
+     194,   419,     0,   441,   453,    93,     0,    67,    69,    70,
+      71,    72,    73,    74,    75,    76,    78,    79,    80,    81,
+      83,    82,    87,    88,    77,    85,    86,    84,    89,    90,
+      91,    92,   108,     0,   406,   314,   334,   240,   242,   244,
+       0,     0,   248,     0,   246,   361,   398,   239,   222,   223,
+     224,   225,     0,   220,   229,   230,   231,   234,   236,   238,
+     232,   233,   226,   227,   228,   235,   237,   330,   332,   329,
+     327,     0,   324,   326,   328,   354,     0,   357,     0,     0,
+     353,   349,   352,     0,   344,   346,   347,   350,   351,   348,
+     396,   384,   386,   388,   390,   392,   394,   383,   382,     0,
+     372,   373,   377,   378,   375,   379,   380,   381,   376,   278,
+     144,     0,   282,   280,   285,     0,   274,   275,     0,   264,
+     265,   267,   277,   268,   269,   270,   284,   271,   272,   273,
+     309,     0,   307,   308,   311,   312,     0,   299,   300,   302,
+     303,   304,   305,   306,   190,   192,   187,     0,   185,   188,
+     189,     0,   475,   477,     0,   480,     0,     0,   484,   488,
+       0,     0,     0,   493,   500,   473,     0,   457,   459,   460,
+     461,   462,   463,   464,   465,   466,   467,   468,   469,   470,
+     471,   472,    42,     0,     0,    35,     0,     0,     0,     0,
+       0,    53,     0,    55,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    66,     0,
-      99,   394,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   207,     0,     0,     0,   309,     0,
-       0,     0,     0,     0,     0,   329,     0,     0,     0,     0,
-       0,     0,     0,   356,     0,     0,     0,     0,     0,     0,
-       0,     0,   248,     0,     0,     0,   283,     0,     0,     0,
-       0,   172,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   440,    46,    39,
-       0,     0,     0,     0,     0,    57,     0,     0,     0,    91,
-      92,    93,    94,    95,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   426,     0,     0,    68,     0,   403,
-     401,   402,   400,     0,   395,   396,   398,   399,     0,     0,
-       0,     0,     0,   237,   238,     0,     0,     0,     0,   209,
-       0,     0,   311,     0,   342,     0,   345,   346,   331,     0,
-       0,     0,     0,     0,     0,     0,   360,     0,     0,   262,
-       0,     0,     0,   273,   252,     0,   299,   287,     0,     0,
-     174,   458,     0,     0,   463,     0,   466,   467,     0,     0,
-     474,   475,   476,     0,     0,   442,     0,     0,     0,   487,
-     489,     0,     0,     0,   200,   241,   276,     0,    43,     0,
-       0,   165,     0,     0,     0,     0,    47,   101,     0,   393,
-       0,   302,   322,   228,   230,   232,   236,   234,   349,     0,
-     317,    36,   319,   341,   344,   383,   371,   373,   375,   377,
-     379,   381,   265,   135,   269,   267,   272,   296,   179,   181,
-     460,   462,   465,   470,   471,   469,   473,   479,   480,   481,
-     482,   483,   478,   485,    40,     0,   495,     0,   492,   494,
-       0,   121,   127,   129,   131,     0,     0,     0,     0,     0,
-     140,   142,   120,     0,   106,   108,   109,   110,   111,   112,
-     113,   114,   115,   116,   117,   118,   119,     0,   204,     0,
-     201,   202,   245,     0,   242,   243,   280,     0,   277,   278,
-     150,   151,     0,   146,   148,   149,     0,   159,   160,   156,
-       0,   154,   157,   158,   390,     0,   169,     0,   166,   167,
-       0,     0,     0,     0,     0,     0,     0,   184,   186,   187,
-     188,   189,   190,   191,   416,   422,     0,     0,     0,   415,
-     414,     0,   407,   409,   412,   410,   411,   413,   433,   435,
-       0,   429,   431,   432,     0,    49,     0,   397,   306,     0,
-     303,   304,   326,     0,   323,   324,   353,     0,   350,   351,
-     386,     0,    64,     0,     0,   491,    97,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   103,
-     105,     0,   199,     0,   249,   240,     0,   284,   275,     0,
-       0,   145,   162,     0,   153,     0,   389,     0,   164,     0,
-       0,     0,     0,     0,     0,     0,     0,   183,     0,     0,
-       0,     0,     0,     0,   406,     0,     0,     0,   428,   438,
-      51,     0,    50,   404,     0,   301,     0,     0,   321,     0,
-     357,   348,     0,     0,   385,     0,   493,     0,     0,     0,
-       0,   133,   136,   137,   138,   139,     0,     0,   107,     0,
-     203,     0,   244,     0,   279,   147,   155,   391,     0,   168,
-     192,   193,   194,   195,   196,   197,   185,     0,     0,   421,
-     424,   425,   408,     0,     0,   430,    48,     0,     0,   305,
-       0,   325,     0,   352,     0,     0,   123,   124,   125,   126,
-     122,   128,   130,   132,   141,   143,   205,   246,   281,   170,
-     418,   419,   420,   417,   423,   434,   436,    52,   307,   327,
-     354,   387,   499,     0,   497,     0,     0,   496,   511,     0,
-     509,   507,   503,     0,   501,   505,   506,   504,   498,     0,
-       0,     0,     0,   500,     0,   508,     0,   502,     0,   510,
-     515,     0,   513,     0,     0,   512,   523,     0,     0,     0,
-       0,   517,   519,   520,   521,   522,   514,     0,     0,     0,
-       0,     0,   516,     0,   525,   526,   527,   518,   524
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    66,
+       0,   107,   408,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   219,     0,     0,     0,
+     323,     0,     0,     0,     0,     0,     0,   343,     0,     0,
+       0,     0,     0,     0,     0,   370,     0,     0,     0,     0,
+       0,     0,     0,     0,   262,     0,     0,     0,   297,     0,
+       0,     0,     0,   184,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   456,
+      46,    39,     0,     0,     0,     0,     0,    57,     0,     0,
+       0,    94,    95,    96,    97,    98,    99,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   440,
+       0,     0,    68,     0,   417,   415,   416,   414,     0,   409,
+     410,   412,   413,     0,     0,     0,     0,     0,   251,   252,
+       0,   250,     0,     0,     0,   221,     0,     0,   325,     0,
+     356,     0,   359,   360,   345,     0,     0,     0,     0,     0,
+       0,     0,   374,     0,     0,   276,     0,     0,     0,   287,
+     266,     0,   313,   301,     0,     0,   186,   474,     0,     0,
+     479,     0,   482,   483,     0,     0,   490,   491,   492,     0,
+       0,   458,     0,     0,     0,   503,   505,     0,     0,     0,
+      36,   101,   103,   212,   255,   290,     0,    43,     0,     0,
+     177,     0,     0,     0,     0,    47,   109,     0,   407,     0,
+     316,   336,   241,   243,   245,   249,   247,   363,     0,   331,
+     333,   355,   358,   397,   385,   387,   389,   391,   393,   395,
+     279,   145,   283,   281,   286,   310,   191,   193,   476,   478,
+     481,   486,   487,   485,   489,   495,   496,   497,   498,   499,
+     494,   501,    40,     0,   511,     0,   508,   510,     0,   131,
+     137,   139,   141,     0,     0,     0,     0,     0,     0,     0,
+     152,   154,   130,     0,   114,   116,   117,   118,   119,   120,
+     121,   122,   123,   124,   125,   126,   127,   128,   129,     0,
+     216,     0,   213,   214,   259,     0,   256,   257,   294,     0,
+     291,   292,   162,   163,     0,   158,   160,   161,     0,   171,
+     172,   168,     0,   166,   169,   170,   404,     0,   181,     0,
+     178,   179,     0,     0,     0,     0,     0,     0,     0,   196,
+     198,   199,   200,   201,   202,   203,   430,   436,     0,     0,
+       0,   429,   428,     0,   421,   423,   426,   424,   425,   427,
+     448,   450,     0,     0,   443,   445,   446,   447,     0,    49,
+       0,   411,   320,     0,   317,   318,   340,     0,   337,   338,
+     367,     0,   364,   365,   400,     0,    64,     0,     0,   507,
+     105,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   111,   113,     0,   211,     0,
+     263,   254,     0,   298,   289,     0,     0,   157,   174,     0,
+     165,     0,   403,     0,   176,     0,     0,     0,     0,     0,
+       0,     0,     0,   195,     0,     0,     0,     0,     0,     0,
+     420,     0,     0,     0,     0,   442,   454,    51,     0,    50,
+     418,     0,   315,     0,     0,   335,     0,   371,   362,     0,
+       0,   399,     0,   509,     0,     0,     0,     0,   143,   146,
+     147,   148,   149,   150,   151,     0,     0,   115,     0,   215,
+       0,   258,     0,   293,   159,   167,   405,     0,   180,   204,
+     205,   206,   207,   208,   209,   197,     0,     0,   435,   438,
+     439,   422,     0,     0,   452,   444,    48,     0,     0,   319,
+       0,   339,     0,   366,     0,     0,   133,   134,   135,   136,
+     132,   138,   140,   142,   153,   155,   217,   260,   295,   182,
+     432,   433,   434,   431,   437,   449,   451,    52,   321,   341,
+     368,   401,   515,     0,   513,     0,     0,   512,   527,     0,
+     525,   523,   519,     0,   517,   521,   522,   520,   514,     0,
+       0,     0,     0,   516,     0,   524,     0,   518,     0,   526,
+     531,     0,   529,     0,     0,   528,   539,     0,     0,     0,
+       0,   533,   535,   536,   537,   538,   530,     0,     0,     0,
+       0,     0,   532,     0,   541,   542,   543,   534,   540
   };
 
-  const short int
+  const short
   Dhcp6Parser::yypgoto_[] =
   {
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,     9,  -490,    74,  -490,  -490,  -490,
-    -490,  -490,  -490,    50,  -490,  -163,  -490,  -490,  -490,   -62,
-    -490,  -490,  -490,   276,  -490,  -490,  -490,  -490,    69,   245,
-     -63,   -50,   -49,   -43,  -490,  -490,  -490,  -490,  -490,    67,
-    -490,  -490,  -490,  -490,  -490,    64,  -129,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,   -58,  -490,  -489,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -137,  -475,  -490,  -490,  -490,  -490,  -139,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -144,  -490,  -490,  -490,  -141,
-     197,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -148,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -122,
-    -490,  -490,  -490,  -118,   243,  -490,  -490,  -490,  -490,  -490,
-    -490,  -479,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -121,  -490,  -490,  -490,  -120,  -490,   215,  -490,   -59,
-    -490,  -490,  -490,  -490,  -490,   -57,  -490,  -490,  -490,  -490,
-    -490,   -48,  -490,  -490,  -490,  -110,  -490,  -490,  -490,  -116,
-    -490,   229,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -146,  -490,  -490,  -490,  -143,   275,  -490,  -490,
-     -66,  -490,  -490,  -490,  -490,  -490,  -140,  -490,  -490,  -490,
-    -136,   256,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -135,  -490,  -490,  -490,  -138,  -490,   257,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,    98,  -490,  -490,  -490,  -490,  -490,
-    -490,  -114,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -117,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,   110,   227,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,  -490,
-    -490,  -490,  -490,  -490,  -490,   -60,  -490,  -490,  -490,  -210,
-    -490,  -490,  -225,  -490,  -490,  -490,  -490,  -490,  -490,  -236,
-    -490,  -490,  -252,  -490,  -490,  -490,  -490,  -490
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,    14,  -521,  -356,  -521,  -365,  -521,
+    -521,  -521,  -521,    36,  -521,  -139,  -521,  -521,  -521,   -62,
+    -521,  -521,  -521,   252,  -521,  -521,  -521,  -521,    53,   244,
+     -45,   -44,   -43,   -42,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,    67,  -521,  -521,  -521,  -521,  -521,
+      66,  -136,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,   -58,  -521,  -520,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -147,  -499,  -521,
+    -521,  -521,  -521,  -149,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -154,  -521,  -521,  -521,  -151,   202,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -159,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -132,  -521,  -521,  -521,
+    -129,   246,  -521,  -521,  -521,  -521,  -521,  -521,  -505,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -133,
+    -521,  -521,  -521,  -130,  -521,   217,  -521,   -59,  -521,  -521,
+    -521,  -521,  -521,   -57,  -521,  -521,  -521,  -521,  -521,   -50,
+    -521,  -521,  -521,  -128,  -521,  -521,  -521,  -125,  -521,   216,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -164,  -521,  -521,  -521,  -161,   253,  -521,  -521,   -66,  -521,
+    -521,  -521,  -521,  -521,  -165,  -521,  -521,  -521,  -160,   254,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -158,  -521,  -521,  -521,  -152,  -521,   250,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,    90,  -521,  -521,  -521,  -521,  -521,  -521,  -140,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -134,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,   100,   223,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,  -521,
+    -521,  -521,  -521,  -521,   -73,  -521,  -521,  -521,  -230,  -521,
+    -521,  -245,  -521,  -521,  -521,  -521,  -521,  -521,  -256,  -521,
+    -521,  -272,  -521,  -521,  -521,  -521,  -521
   };
 
-  const short int
+  const short
   Dhcp6Parser::yydefgoto_[] =
   {
-      -1,    13,    14,    15,    16,    17,    18,    19,    20,    21,
-      22,    23,    24,    25,    73,    35,    36,    61,   522,    77,
-      78,    37,    60,    74,    75,   507,   655,   731,   732,   112,
-      39,    62,    85,    86,    87,   289,    41,    63,   113,   114,
-     115,   116,   117,   118,   119,   120,   296,    43,    64,   137,
-     319,   121,   297,   122,   298,   573,   574,   575,   677,   800,
-     576,   678,   577,   679,   578,   680,   579,   219,   356,   581,
-     582,   583,   584,   585,   686,   586,   687,   123,   307,   602,
-     603,   604,   605,   124,   309,   610,   611,   612,   613,   125,
-     308,   126,   311,   617,   618,   619,   707,    57,    71,   249,
-     250,   251,   368,   252,   369,   127,   312,   626,   627,   628,
-     629,   630,   631,   632,   633,   128,   304,   589,   590,   591,
-     691,    45,    65,   155,   156,   157,   324,   158,   325,   159,
-     326,   160,   330,   161,   329,   162,   163,   129,   305,   593,
-     594,   595,   694,    53,    69,   220,   221,   222,   223,   224,
-     225,   226,   355,   227,   359,   228,   358,   229,   230,   360,
-     231,   130,   306,   597,   598,   599,   697,    55,    70,   238,
-     239,   240,   241,   242,   364,   243,   244,   245,   165,   322,
-     659,   660,   661,   734,    47,    66,   173,   174,   175,   335,
-     176,   336,   166,   323,   663,   664,   665,   737,    49,    67,
-     185,   186,   187,   339,   188,   189,   341,   190,   191,   167,
-     331,   667,   668,   669,   740,    51,    68,   201,   202,   203,
-     204,   347,   205,   348,   206,   349,   207,   350,   208,   351,
-     209,   352,   210,   346,   168,   332,   671,   743,   131,   310,
-     615,   321,   423,   424,   425,   426,   427,   508,   132,   313,
-     641,   642,   643,   718,   813,   644,   645,   719,   646,   647,
-     133,   134,   315,   650,   651,   652,   725,   653,   726,   135,
-     316,    59,    72,   268,   269,   270,   271,   373,   272,   374,
-     273,   274,   376,   275,   276,   277,   379,   545,   278,   380,
-     279,   280,   281,   282,   384,   552,   283,   385,    88,   291,
-      89,   292,    90,   290,   557,   558,   559,   673,   823,   824,
-     825,   833,   834,   835,   836,   841,   837,   839,   851,   852,
-     853,   860,   861,   862,   867,   863,   864,   865
+       0,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    73,    35,    36,    61,   511,    77,
+      78,    37,    60,    74,    75,   526,   679,   758,   759,   115,
+      39,    62,    85,    86,    87,   297,    41,    63,   116,   117,
+     118,   119,   120,   121,   122,   123,   124,   313,   125,   314,
+     126,   304,    43,    64,   143,   330,   127,   305,   128,   306,
+     593,   594,   595,   701,   830,   596,   702,   597,   703,   598,
+     704,   599,   227,   368,   601,   602,   603,   604,   605,   606,
+     607,   712,   608,   713,   129,   318,   624,   625,   626,   627,
+     130,   320,   632,   633,   634,   635,   131,   319,   132,   322,
+     639,   640,   641,   733,    57,    71,   257,   258,   259,   380,
+     260,   381,   133,   323,   648,   649,   650,   651,   652,   653,
+     654,   655,   134,   315,   611,   612,   613,   717,    45,    65,
+     162,   163,   164,   335,   165,   336,   166,   337,   167,   342,
+     168,   340,   169,   170,   171,   135,   316,   615,   616,   617,
+     720,    53,    69,   228,   229,   230,   231,   232,   233,   234,
+     367,   235,   371,   236,   370,   237,   238,   372,   239,   136,
+     317,   619,   620,   621,   723,    55,    70,   246,   247,   248,
+     249,   250,   376,   251,   252,   253,   173,   333,   683,   684,
+     685,   761,    47,    66,   181,   182,   183,   347,   184,   348,
+     174,   334,   687,   688,   689,   764,    49,    67,   193,   194,
+     195,   351,   196,   197,   353,   198,   199,   175,   343,   691,
+     692,   693,   767,    51,    68,   209,   210,   211,   212,   359,
+     213,   360,   214,   361,   215,   362,   216,   363,   217,   364,
+     218,   358,   176,   344,   695,   770,   137,   321,   637,   332,
+     438,   439,   440,   441,   442,   527,   138,   324,   663,   664,
+     665,   744,   843,   666,   667,   745,   668,   669,   139,   140,
+     326,   673,   674,   675,   751,   676,   752,   677,   141,   327,
+      59,    72,   276,   277,   278,   279,   385,   280,   386,   281,
+     282,   388,   283,   284,   285,   391,   563,   286,   392,   287,
+     288,   289,   290,   396,   570,   291,   397,    88,   299,    89,
+     300,    90,   298,   575,   576,   577,   697,   853,   854,   855,
+     863,   864,   865,   866,   871,   867,   869,   881,   882,   883,
+     890,   891,   892,   897,   893,   894,   895
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yytable_[] =
   {
-      84,   184,   151,   150,   171,   182,   199,   218,   234,   248,
-     267,   236,   235,   237,   640,   152,   153,   164,   172,   183,
-     200,   614,   154,    34,   609,    27,   138,    28,    79,    29,
-     856,   600,   294,   857,   858,   859,   101,   295,    91,   634,
-      92,    93,   138,   211,   246,   247,   169,    26,   566,    94,
-      95,    96,    97,   170,   246,   247,   101,    94,    95,    96,
-      97,    98,    99,   100,   101,   139,   212,   140,   213,   214,
-      38,   215,   216,   217,   141,   142,   143,   144,   145,   146,
-     101,   212,   101,   543,   544,   147,   148,    40,   102,   103,
-     104,   105,   212,   149,   177,   178,   179,   180,   181,   170,
-     317,   147,    42,   106,   601,   318,   107,   333,   419,    44,
-      83,    76,   334,   108,   635,   636,   637,   638,   101,   337,
-      46,   109,   110,   561,   338,   111,   648,   649,   562,   563,
-     564,   565,   566,   567,   568,   569,   570,   571,    80,   344,
-     600,   607,    83,   608,   345,   192,   212,    81,    82,   193,
-     194,   195,   196,   197,   198,   212,   232,   213,   214,   233,
-      48,    83,    83,    30,    31,    32,    33,    83,   370,   386,
-      83,    83,   317,   371,   387,   674,   828,   672,   829,   830,
-     675,    50,   547,   548,   549,   550,    83,   136,    83,   620,
-     621,   622,   623,   624,   625,    52,    54,    83,   253,   254,
-     255,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   551,   688,   688,   716,   723,   727,   689,   690,
-     717,   724,   728,    56,    83,   386,   767,    58,   609,   284,
-     729,   333,    84,   370,   640,   337,   806,   285,   809,   344,
-     818,   842,    83,   871,   819,   286,   843,   700,   872,   703,
-     701,    83,   704,   796,   797,   798,   799,   287,   705,   420,
-      83,   706,   826,   421,   854,   827,   288,   855,   293,   299,
-     151,   150,   300,   422,   301,   171,   302,   303,   184,   810,
-     811,   812,   182,   152,   153,   164,   525,   526,   527,   172,
-     154,   314,   199,   320,   388,   389,   183,   327,   328,   340,
-     342,   218,   343,   354,   363,   234,   200,   353,   236,   235,
-     237,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-      10,    11,    12,   357,   267,   361,   362,   365,   366,   367,
-     390,   372,   375,   377,   378,   381,   382,   383,   391,   392,
-     393,   394,   396,   397,   398,   399,   400,   401,   402,   403,
-     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
-     415,   414,   416,   418,   428,   429,   430,   431,   432,   433,
-     434,   435,   436,   437,   438,   440,   441,   443,   445,   444,
-     449,   450,   451,   446,   452,   453,   447,   454,   455,   457,
-     458,   459,   460,   461,   462,   465,   463,   466,   468,   469,
-     471,   472,   489,   490,   473,   475,   474,   478,   479,   483,
-     476,   477,   484,   486,   487,   480,   510,   481,   488,   491,
-     482,   492,   493,   494,   495,   496,   497,   498,   499,   500,
-     572,   572,   501,   502,   580,   580,   503,   504,   505,   506,
-     509,   639,   511,   267,   512,   513,   514,   515,   420,   516,
-     517,   518,   421,   520,   519,    28,   523,   524,   528,   529,
-     530,   588,   422,   592,   596,   531,   616,   532,   533,   656,
-     658,   662,   681,   666,   670,   676,   682,   683,   539,   684,
-     685,   693,   696,   692,   534,   535,   536,   537,   538,   695,
-     546,   698,   699,   702,   708,   554,   709,   735,   710,   711,
-     540,   712,   713,   556,   714,   715,   720,   721,   541,   542,
-     722,   736,   739,   738,   742,   521,   741,   745,   747,   748,
-     744,   749,   553,   750,   756,   757,   777,   778,   783,   784,
-     730,   787,   786,   794,   822,   733,   795,   751,   807,   840,
-     808,   820,   752,   844,   754,   846,   753,   848,   606,   868,
-     755,   850,   869,   870,   770,   873,   555,   587,   560,   758,
-     771,   772,   417,   765,   766,   769,   768,   470,   776,   773,
-     395,   760,   774,   759,   761,   762,   439,   775,   464,   779,
-     780,   763,   781,   801,   802,   803,   804,   805,   814,   764,
-     789,   788,   815,   816,   817,   821,   467,   845,   849,   791,
-     448,   790,   792,   878,   874,   875,   876,   793,   657,   782,
-     785,   456,   442,   485,   746,   654,   838,   847,   866,   877,
-       0,     0,     0,     0,     0,     0,   572,     0,   151,   150,
-     580,     0,   218,     0,     0,   234,     0,     0,   236,   235,
-     237,   152,   153,   164,     0,   248,     0,     0,   154,     0,
+      84,   192,   662,   157,   179,   190,   207,   226,   242,   256,
+     275,   244,   243,   245,   636,   172,   180,   191,   208,   631,
+     158,   159,   160,   161,   144,    27,    79,    28,    34,    29,
+     579,   104,   220,   561,   562,   580,   581,   582,   583,   584,
+     585,   586,   587,   588,   589,   590,   591,   104,   144,    94,
+      95,    96,    97,   512,   656,    26,   220,   177,   220,   104,
+     434,   510,   510,   584,   178,   219,   622,    38,   145,    40,
+     146,   220,   240,   221,   222,   241,    42,   147,   148,   149,
+     150,   151,   152,   153,   254,   255,   104,    44,   726,   154,
+     155,   727,   540,   220,    46,   221,   222,   156,   223,   224,
+     225,   510,    48,    91,    50,    92,    93,   642,   643,   644,
+     645,   646,   647,   154,   200,   840,   841,   842,   201,   202,
+     203,   204,   205,   206,    94,    95,    96,    97,    98,    99,
+     100,   101,   102,   103,   104,   657,   658,   659,   660,    83,
+     623,    52,   858,    80,   859,   860,   565,   566,   567,   568,
+      54,    83,    81,    82,   729,    83,    56,   730,    76,   105,
+     106,   107,   108,    83,   302,    83,    83,    83,   142,   303,
+      30,    31,    32,    33,   109,   328,   569,   110,    83,   292,
+     329,    58,   886,   345,   111,   887,   888,   889,   346,    83,
+     104,   349,   112,   113,    83,   293,   350,   114,   622,   629,
+      83,   630,   185,   186,   187,   188,   189,   178,   261,   262,
+     263,   264,   265,   266,   267,   268,   269,   270,   271,   272,
+     273,   274,   356,   382,   254,   255,   796,   357,   383,   662,
+     631,   398,   328,   698,   714,   295,   399,   696,   699,   715,
+      84,   714,    83,   742,   749,   754,   716,   294,   743,   750,
+     755,   296,    83,     1,     2,     3,     4,     5,     6,     7,
+       8,     9,    10,    11,    12,   301,   398,   345,   382,   366,
+     435,   756,   836,   839,   436,   349,   356,   331,   307,   872,
+     848,   849,   437,   157,   873,   731,   901,   179,   732,   856,
+     192,   902,   857,   884,   190,   172,   885,   365,    83,   180,
+     158,   159,   160,   161,   207,   308,   191,   400,   401,   826,
+     827,   828,   829,   226,   309,   310,   208,   242,   311,   312,
+     244,   243,   245,   670,   671,   672,   543,   544,   545,   325,
+     338,   339,   341,   352,   354,   355,   275,   369,   373,   375,
+     374,   377,   379,   378,   384,   387,   389,   390,   393,   394,
+     395,   402,   403,   404,   405,   406,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   423,   424,   425,   426,   427,   428,   429,   430,   431,
+     433,   443,   444,   445,   446,   447,   448,   449,   450,   451,
+     452,   453,   454,   456,   457,   459,   460,   461,   462,   465,
+     463,   466,   467,   468,   469,   470,   471,   473,   474,   475,
+     476,   477,   478,   479,   481,   482,   484,   485,   488,   505,
+     506,   487,   489,   491,   494,   495,   490,   499,   492,   493,
+     500,   502,   496,   497,   498,   503,   504,   507,   508,   509,
+      28,   513,   514,   515,   516,   517,   592,   592,   518,   519,
+     600,   600,   520,   521,   532,   522,   523,   524,   525,   528,
+     661,   529,   275,   533,   530,   531,   534,   435,   535,   536,
+     537,   436,   539,   538,   541,   610,   614,   618,   638,   437,
+     680,   682,   686,   705,   690,   706,   700,   707,   542,   708,
+     709,   710,   711,   719,   722,   718,   694,   546,   721,   557,
+     724,   725,   728,   734,   735,   547,   548,   549,   550,   551,
+     552,   736,   737,   738,   739,   740,   572,   741,   746,   747,
+     748,   753,   763,   553,   762,   766,   765,   564,   769,   768,
+     816,   772,   554,   555,   771,   556,   774,   775,   776,   574,
+     777,   785,   558,   786,   559,   806,   560,   807,   812,   813,
+     817,   825,   824,   628,   407,   870,   573,   837,   838,   571,
+     850,   852,   874,   876,   880,   878,   757,   760,   898,   899,
+     900,   903,   432,   778,   578,   609,   780,   779,   787,   794,
+     795,   798,   797,   805,   486,   781,   782,   789,   788,   791,
+     790,   455,   480,   784,   783,   483,   799,   793,   792,   819,
+     818,   821,   458,   800,   820,   801,   802,   803,   804,   811,
+     464,   823,   808,   809,   810,   822,   472,   814,   875,   681,
+     815,   501,   831,   832,   678,   773,   868,   877,   896,   907,
+     833,     0,   834,     0,   835,     0,     0,     0,     0,     0,
+       0,     0,     0,   844,     0,   845,     0,     0,     0,   846,
+     847,     0,   592,   851,   879,   157,   600,     0,   226,   904,
+       0,   242,     0,   905,   244,   243,   245,   172,     0,     0,
+       0,   256,   158,   159,   160,   161,     0,     0,     0,   906,
+     908,     0,     0,     0,     0,     0,     0,   661,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   192,   179,
+       0,     0,   190,     0,     0,   207,     0,     0,     0,     0,
+       0,   180,     0,     0,   191,     0,     0,   208,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   639,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   184,   171,     0,     0,   182,     0,     0,   199,     0,
-       0,     0,     0,     0,     0,     0,   172,     0,     0,   183,
-       0,     0,   200,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   831,     0,     0,     0,   832,     0,     0,
+       0,     0,     0,   861,     0,     0,     0,   862,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-     831,     0,     0,     0,   832
+     861,     0,     0,     0,   862
   };
 
-  const short int
+  const short
   Dhcp6Parser::yycheck_[] =
   {
-      62,    67,    65,    65,    66,    67,    68,    69,    70,    71,
-      72,    70,    70,    70,   503,    65,    65,    65,    66,    67,
-      68,   500,    65,    14,   499,     5,     7,     7,    10,     9,
-     123,    70,     3,   126,   127,   128,    37,     8,    11,    15,
-      13,    14,     7,    15,    77,    78,    47,     0,    24,    30,
-      31,    32,    33,    54,    77,    78,    37,    30,    31,    32,
-      33,    34,    35,    36,    37,    46,    38,    48,    40,    41,
-       7,    43,    44,    45,    55,    56,    57,    58,    59,    60,
-      37,    38,    37,   113,   114,    66,    67,     7,    61,    62,
-      63,    64,    38,    74,    49,    50,    51,    52,    53,    54,
-       3,    66,     7,    76,   143,     8,    79,     3,    65,     7,
-     143,   143,     8,    86,    90,    91,    92,    93,    37,     3,
-       7,    94,    95,    15,     8,    98,    96,    97,    20,    21,
-      22,    23,    24,    25,    26,    27,    28,    29,   120,     3,
-      70,    71,   143,    73,     8,    64,    38,   129,   130,    68,
-      69,    70,    71,    72,    73,    38,    39,    40,    41,    42,
-       7,   143,   143,   143,   144,   145,   146,   143,     3,     3,
-     143,   143,     3,     8,     8,     3,   122,     8,   124,   125,
-       8,     7,   116,   117,   118,   119,   143,    12,   143,    80,
-      81,    82,    83,    84,    85,     7,     7,   143,    99,   100,
-     101,   102,   103,   104,   105,   106,   107,   108,   109,   110,
-     111,   112,   146,     3,     3,     3,     3,     3,     8,     8,
-       8,     8,     8,     7,   143,     3,   705,     7,   703,     6,
-       8,     3,   294,     3,   723,     3,     8,     3,     8,     3,
-       8,     3,   143,     3,     8,     4,     8,     3,     8,     3,
-       6,   143,     6,    16,    17,    18,    19,     8,     3,   321,
-     143,     6,     3,   321,     3,     6,     3,     6,     4,     4,
-     333,   333,     4,   321,     4,   337,     4,     4,   344,    87,
-      88,    89,   344,   333,   333,   333,   449,   450,   451,   337,
-     333,     4,   354,     8,   285,   286,   344,     4,     4,     4,
-       4,   363,     4,     3,     3,   367,   354,     8,   367,   367,
-     367,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,     4,   386,     4,     8,     4,     8,     3,
-     143,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   144,   144,   144,   144,   144,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   144,     4,     4,     4,     4,     4,     4,     4,   144,
-     146,     4,     4,     4,     4,     4,     4,     4,     4,   144,
-       4,     4,     4,   144,     4,     4,   144,     4,     4,     4,
-       4,   144,     4,     4,     4,     4,   146,   146,     4,     4,
-     146,     4,   393,   394,     4,     4,   144,     4,     4,     4,
-     144,   144,     4,     4,     7,   146,     3,   146,     7,     7,
-     146,     7,     7,     5,     5,     5,     5,     5,     5,     5,
-     492,   493,     5,     7,   492,   493,     7,     7,     7,     5,
-       8,   503,     5,   505,     5,   143,   143,   143,   510,   143,
-     143,     5,   510,   143,     7,     7,   143,   143,   143,   143,
-     143,     7,   510,     7,     7,   143,     7,   143,   143,     4,
-       7,     7,     4,     7,    75,     8,     4,     4,   469,     4,
-       4,     3,     3,     6,   143,   143,   143,   143,   143,     6,
-     115,     6,     3,     6,     6,   486,     3,     6,     4,     4,
-     143,     4,     4,   121,     4,     4,     4,     4,   143,   143,
-       4,     3,     3,     6,     3,   441,     6,     4,     4,     4,
-       8,     4,   143,     4,     4,     4,     4,     4,     4,     4,
-     143,     3,     6,     4,     7,   143,     5,   144,     8,     4,
-       8,     8,   146,     4,   146,     4,   144,     5,   498,     4,
-     144,     7,     4,     4,   144,     4,   487,   493,   491,   688,
-     144,   144,   317,   700,   703,   709,   707,   370,   716,   144,
-     294,   693,   144,   691,   694,   696,   333,   144,   363,   144,
-     144,   697,   144,   143,   143,   143,   143,   143,   143,   699,
-     736,   734,   143,   143,   143,   143,   367,   144,   143,   739,
-     344,   737,   740,   143,   146,   144,   144,   742,   510,   723,
-     727,   354,   337,   386,   674,   505,   826,   842,   854,   871,
-      -1,    -1,    -1,    -1,    -1,    -1,   688,    -1,   691,   691,
-     688,    -1,   694,    -1,    -1,   697,    -1,    -1,   697,   697,
-     697,   691,   691,   691,    -1,   707,    -1,    -1,   691,    -1,
+      62,    67,   522,    65,    66,    67,    68,    69,    70,    71,
+      72,    70,    70,    70,   519,    65,    66,    67,    68,   518,
+      65,    65,    65,    65,     7,     5,    10,     7,    14,     9,
+      15,    42,    43,   120,   121,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    42,     7,    32,
+      33,    34,    35,   418,    15,     0,    43,    52,    43,    42,
+      71,   417,   418,    24,    59,    15,    76,     7,    51,     7,
+      53,    43,    44,    45,    46,    47,     7,    60,    61,    62,
+      63,    64,    65,    66,    83,    84,    42,     7,     3,    72,
+      73,     6,   457,    43,     7,    45,    46,    80,    48,    49,
+      50,   457,     7,    11,     7,    13,    14,    86,    87,    88,
+      89,    90,    91,    72,    70,    93,    94,    95,    74,    75,
+      76,    77,    78,    79,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    96,    97,    98,    99,   150,
+     150,     7,   129,   127,   131,   132,   123,   124,   125,   126,
+       7,   150,   136,   137,     3,   150,     7,     6,   150,    67,
+      68,    69,    70,   150,     3,   150,   150,   150,    12,     8,
+     150,   151,   152,   153,    82,     3,   153,    85,   150,     6,
+       8,     7,   130,     3,    92,   133,   134,   135,     8,   150,
+      42,     3,   100,   101,   150,     3,     8,   105,    76,    77,
+     150,    79,    54,    55,    56,    57,    58,    59,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
+     118,   119,     3,     3,    83,    84,   731,     8,     8,   749,
+     729,     3,     3,     3,     3,     8,     8,     8,     8,     8,
+     302,     3,   150,     3,     3,     3,     8,     4,     8,     8,
+       8,     3,   150,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,     4,     3,     3,     3,     3,
+     332,     8,     8,     8,   332,     3,     3,     8,     4,     3,
+       8,     8,   332,   345,     8,     3,     3,   349,     6,     3,
+     356,     8,     6,     3,   356,   345,     6,     8,   150,   349,
+     345,   345,   345,   345,   366,     4,   356,   293,   294,    16,
+      17,    18,    19,   375,     4,     4,   366,   379,     4,     4,
+     379,   379,   379,   102,   103,   104,   465,   466,   467,     4,
+       4,     4,     4,     4,     4,     4,   398,     4,     4,     3,
+       8,     4,     3,     8,     4,     4,     4,     4,     4,     4,
+       4,   150,     4,     4,     4,     4,     4,     4,     4,   151,
+     151,   151,   151,   151,   151,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,   151,     4,     4,
+       4,     4,     4,     4,     4,     4,   151,   153,     4,   152,
+       4,     4,     4,     4,     4,     4,   151,     4,   151,     4,
+     151,     4,     4,     4,     4,     4,     4,     4,     4,   151,
+       4,     4,     4,   153,     4,   153,     4,     4,     4,   405,
+     406,   153,     4,     4,     4,     4,   151,     4,   151,   151,
+       4,     4,   153,   153,   153,     7,     7,     7,     7,     7,
+       7,     5,     5,     5,     5,     5,   508,   509,     5,     5,
+     508,   509,     5,     7,   150,     7,     7,     7,     5,     8,
+     522,     3,   524,   150,     5,     5,   150,   529,   150,   150,
+       5,   529,   150,     7,   150,     7,     7,     7,     7,   529,
+       4,     7,     7,     4,     7,     4,     8,     4,   150,     4,
+       4,     4,     4,     3,     3,     6,    81,   150,     6,   485,
+       6,     3,     6,     6,     3,   150,   150,   150,   150,   150,
+     150,     4,     4,     4,     4,     4,   502,     4,     4,     4,
+       4,     4,     3,   150,     6,     3,     6,   122,     3,     6,
+       6,     4,   150,   150,     8,   150,     4,     4,     4,   128,
+       4,     4,   150,     4,   150,     4,   150,     4,     4,     4,
+       3,     5,     4,   517,   302,     4,   503,     8,     8,   150,
+       8,     7,     4,     4,     7,     5,   150,   150,     4,     4,
+       4,     4,   328,   151,   507,   509,   151,   153,   714,   726,
+     729,   735,   733,   742,   382,   151,   151,   719,   717,   722,
+     720,   345,   375,   151,   153,   379,   151,   725,   723,   763,
+     761,   766,   349,   151,   764,   151,   151,   151,   151,   749,
+     356,   769,   151,   151,   151,   767,   366,   153,   151,   529,
+     754,   398,   150,   150,   524,   698,   856,   872,   884,   901,
+     150,    -1,   150,    -1,   150,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   150,    -1,   150,    -1,    -1,    -1,   150,
+     150,    -1,   714,   150,   150,   717,   714,    -1,   720,   153,
+      -1,   723,    -1,   151,   723,   723,   723,   717,    -1,    -1,
+      -1,   733,   717,   717,   717,   717,    -1,    -1,    -1,   151,
+     150,    -1,    -1,    -1,    -1,    -1,    -1,   749,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   764,   761,
+      -1,    -1,   764,    -1,    -1,   767,    -1,    -1,    -1,    -1,
+      -1,   761,    -1,    -1,   764,    -1,    -1,   767,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   723,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   737,   734,    -1,    -1,   737,    -1,    -1,   740,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   734,    -1,    -1,   737,
-      -1,    -1,   740,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   825,    -1,    -1,    -1,   825,    -1,    -1,
+      -1,    -1,    -1,   855,    -1,    -1,    -1,   855,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-     842,    -1,    -1,    -1,   842
+     872,    -1,    -1,    -1,   872
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yystos_[] =
   {
-       0,   131,   132,   133,   134,   135,   136,   137,   138,   139,
-     140,   141,   142,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,     0,     5,     7,     9,
-     143,   144,   145,   146,   161,   162,   163,   168,     7,   177,
-       7,   183,     7,   194,     7,   268,     7,   331,     7,   345,
-       7,   362,     7,   290,     7,   314,     7,   244,     7,   418,
-     169,   164,   178,   184,   195,   269,   332,   346,   363,   291,
-     315,   245,   419,   161,   170,   171,   143,   166,   167,    10,
-     120,   129,   130,   143,   176,   179,   180,   181,   445,   447,
-     449,    11,    13,    14,    30,    31,    32,    33,    34,    35,
-      36,    37,    61,    62,    63,    64,    76,    79,    86,    94,
-      95,    98,   176,   185,   186,   187,   188,   189,   190,   191,
-     192,   198,   200,   224,   230,   236,   238,   252,   262,   284,
-     308,   385,   395,   407,   408,   416,    12,   196,     7,    46,
-      48,    55,    56,    57,    58,    59,    60,    66,    67,    74,
-     176,   187,   188,   189,   190,   270,   271,   272,   274,   276,
-     278,   280,   282,   283,   308,   325,   339,   356,   381,    47,
-      54,   176,   308,   333,   334,   335,   337,    49,    50,    51,
-      52,    53,   176,   308,   337,   347,   348,   349,   351,   352,
-     354,   355,    64,    68,    69,    70,    71,    72,    73,   176,
-     308,   364,   365,   366,   367,   369,   371,   373,   375,   377,
-     379,    15,    38,    40,    41,    43,    44,    45,   176,   214,
-     292,   293,   294,   295,   296,   297,   298,   300,   302,   304,
-     305,   307,    39,    42,   176,   214,   296,   302,   316,   317,
-     318,   319,   320,   322,   323,   324,    77,    78,   176,   246,
-     247,   248,   250,    99,   100,   101,   102,   103,   104,   105,
-     106,   107,   108,   109,   110,   111,   112,   176,   420,   421,
-     422,   423,   425,   427,   428,   430,   431,   432,   435,   437,
-     438,   439,   440,   443,     6,     3,     4,     8,     3,   182,
-     450,   446,   448,     4,     3,     8,   193,   199,   201,     4,
-       4,     4,     4,     4,   263,   285,   309,   225,   237,   231,
-     386,   239,   253,   396,     4,   409,   417,     3,     8,   197,
-       8,   388,   326,   340,   273,   275,   277,     4,     4,   281,
-     279,   357,   382,     3,     8,   336,   338,     3,     8,   350,
-       4,   353,     4,     4,     3,     8,   380,   368,   370,   372,
-     374,   376,   378,     8,     3,   299,   215,     4,   303,   301,
-     306,     4,     8,     3,   321,     4,     8,     3,   249,   251,
-       3,     8,     4,   424,   426,     4,   429,     4,     4,   433,
-     436,     4,     4,     4,   441,   444,     3,     8,   161,   161,
-     143,     4,     4,     4,     4,   180,     4,     4,     4,   144,
-     144,   144,   144,   144,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   144,     4,     4,   186,     4,    65,
-     176,   214,   308,   389,   390,   391,   392,   393,     4,     4,
-       4,     4,     4,   144,   146,     4,     4,     4,     4,   271,
-       4,     4,   334,     4,   144,     4,   144,   144,   348,     4,
-       4,     4,     4,     4,     4,     4,   366,     4,     4,   144,
-       4,     4,     4,   146,   294,     4,   146,   318,     4,     4,
-     247,   146,     4,     4,   144,     4,   144,   144,     4,     4,
-     146,   146,   146,     4,     4,   421,     4,     7,     7,   161,
-     161,     7,     7,     7,     5,     5,     5,     5,     5,     5,
-       5,     5,     7,     7,     7,     7,     5,   172,   394,     8,
-       3,     5,     5,   143,   143,   143,   143,   143,     5,     7,
-     143,   163,   165,   143,   143,   172,   172,   172,   143,   143,
-     143,   143,   143,   143,   143,   143,   143,   143,   143,   161,
-     143,   143,   143,   113,   114,   434,   115,   116,   117,   118,
-     119,   146,   442,   143,   161,   185,   121,   451,   452,   453,
-     196,    15,    20,    21,    22,    23,    24,    25,    26,    27,
-      28,    29,   176,   202,   203,   204,   207,   209,   211,   213,
-     214,   216,   217,   218,   219,   220,   222,   202,     7,   264,
-     265,   266,     7,   286,   287,   288,     7,   310,   311,   312,
-      70,   143,   226,   227,   228,   229,   170,    71,    73,   228,
-     232,   233,   234,   235,   278,   387,     7,   240,   241,   242,
-      80,    81,    82,    83,    84,    85,   254,   255,   256,   257,
-     258,   259,   260,   261,    15,    90,    91,    92,    93,   176,
-     216,   397,   398,   399,   402,   403,   405,   406,    96,    97,
-     410,   411,   412,   414,   420,   173,     4,   391,     7,   327,
-     328,   329,     7,   341,   342,   343,     7,   358,   359,   360,
-      75,   383,     8,   454,     3,     8,     8,   205,   208,   210,
-     212,     4,     4,     4,     4,     4,   221,   223,     3,     8,
-       8,   267,     6,     3,   289,     6,     3,   313,     6,     3,
-       3,     6,     6,     3,     6,     3,     6,   243,     6,     3,
-       4,     4,     4,     4,     4,     4,     3,     8,   400,   404,
-       4,     4,     4,     3,     8,   413,   415,     3,     8,     8,
-     143,   174,   175,   143,   330,     6,     3,   344,     6,     3,
-     361,     6,     3,   384,     8,     4,   452,     4,     4,     4,
-       4,   144,   146,   144,   146,   144,     4,     4,   203,   270,
-     266,   292,   288,   316,   312,   227,   233,   278,   246,   242,
-     144,   144,   144,   144,   144,   144,   255,     4,     4,   144,
-     144,   144,   398,     4,     4,   411,     6,     3,   333,   329,
-     347,   343,   364,   360,     4,     5,    16,    17,    18,    19,
-     206,   143,   143,   143,   143,   143,     8,     8,     8,     8,
-      87,    88,    89,   401,   143,   143,   143,   143,     8,     8,
-       8,   143,     7,   455,   456,   457,     3,     6,   122,   124,
-     125,   176,   214,   458,   459,   460,   461,   463,   456,   464,
-       4,   462,     3,     8,     4,   144,     4,   459,     5,   143,
-       7,   465,   466,   467,     3,     6,   123,   126,   127,   128,
-     468,   469,   470,   472,   473,   474,   466,   471,     4,     4,
-       4,     3,     8,     4,   146,   144,   144,   469,   143
+       0,   138,   139,   140,   141,   142,   143,   144,   145,   146,
+     147,   148,   149,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,     0,     5,     7,     9,
+     150,   151,   152,   153,   168,   169,   170,   175,     7,   184,
+       7,   190,     7,   206,     7,   282,     7,   346,     7,   360,
+       7,   377,     7,   305,     7,   329,     7,   258,     7,   434,
+     176,   171,   185,   191,   207,   283,   347,   361,   378,   306,
+     330,   259,   435,   168,   177,   178,   150,   173,   174,    10,
+     127,   136,   137,   150,   183,   186,   187,   188,   461,   463,
+     465,    11,    13,    14,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    67,    68,    69,    70,    82,
+      85,    92,   100,   101,   105,   183,   192,   193,   194,   195,
+     196,   197,   198,   199,   200,   202,   204,   210,   212,   238,
+     244,   250,   252,   266,   276,   299,   323,   400,   410,   422,
+     423,   432,    12,   208,     7,    51,    53,    60,    61,    62,
+      63,    64,    65,    66,    72,    73,    80,   183,   194,   195,
+     196,   197,   284,   285,   286,   288,   290,   292,   294,   296,
+     297,   298,   323,   340,   354,   371,   396,    52,    59,   183,
+     323,   348,   349,   350,   352,    54,    55,    56,    57,    58,
+     183,   323,   352,   362,   363,   364,   366,   367,   369,   370,
+      70,    74,    75,    76,    77,    78,    79,   183,   323,   379,
+     380,   381,   382,   384,   386,   388,   390,   392,   394,    15,
+      43,    45,    46,    48,    49,    50,   183,   226,   307,   308,
+     309,   310,   311,   312,   313,   315,   317,   319,   320,   322,
+      44,    47,   183,   226,   311,   317,   331,   332,   333,   334,
+     335,   337,   338,   339,    83,    84,   183,   260,   261,   262,
+     264,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   183,   436,   437,   438,   439,
+     441,   443,   444,   446,   447,   448,   451,   453,   454,   455,
+     456,   459,     6,     3,     4,     8,     3,   189,   466,   462,
+     464,     4,     3,     8,   205,   211,   213,     4,     4,     4,
+       4,     4,     4,   201,   203,   277,   300,   324,   239,   251,
+     245,   401,   253,   267,   411,     4,   424,   433,     3,     8,
+     209,     8,   403,   341,   355,   287,   289,   291,     4,     4,
+     295,     4,   293,   372,   397,     3,     8,   351,   353,     3,
+       8,   365,     4,   368,     4,     4,     3,     8,   395,   383,
+     385,   387,   389,   391,   393,     8,     3,   314,   227,     4,
+     318,   316,   321,     4,     8,     3,   336,     4,     8,     3,
+     263,   265,     3,     8,     4,   440,   442,     4,   445,     4,
+       4,   449,   452,     4,     4,     4,   457,   460,     3,     8,
+     168,   168,   150,     4,     4,     4,     4,   187,     4,     4,
+       4,   151,   151,   151,   151,   151,   151,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,   151,
+       4,     4,   193,     4,    71,   183,   226,   323,   404,   405,
+     406,   407,   408,     4,     4,     4,     4,     4,   151,   153,
+       4,   152,     4,     4,     4,   285,     4,     4,   349,     4,
+     151,     4,   151,   151,   363,     4,     4,     4,     4,     4,
+       4,     4,   381,     4,     4,   151,     4,     4,     4,   153,
+     309,     4,   153,   333,     4,     4,   261,   153,     4,     4,
+     151,     4,   151,   151,     4,     4,   153,   153,   153,     4,
+       4,   437,     4,     7,     7,   168,   168,     7,     7,     7,
+     170,   172,   172,     5,     5,     5,     5,     5,     5,     5,
+       5,     7,     7,     7,     7,     5,   179,   409,     8,     3,
+       5,     5,   150,   150,   150,   150,   150,     5,     7,   150,
+     172,   150,   150,   179,   179,   179,   150,   150,   150,   150,
+     150,   150,   150,   150,   150,   150,   150,   168,   150,   150,
+     150,   120,   121,   450,   122,   123,   124,   125,   126,   153,
+     458,   150,   168,   192,   128,   467,   468,   469,   208,    15,
+      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,    31,   183,   214,   215,   216,   219,   221,   223,   225,
+     226,   228,   229,   230,   231,   232,   233,   234,   236,   214,
+       7,   278,   279,   280,     7,   301,   302,   303,     7,   325,
+     326,   327,    76,   150,   240,   241,   242,   243,   177,    77,
+      79,   242,   246,   247,   248,   249,   292,   402,     7,   254,
+     255,   256,    86,    87,    88,    89,    90,    91,   268,   269,
+     270,   271,   272,   273,   274,   275,    15,    96,    97,    98,
+      99,   183,   228,   412,   413,   414,   417,   418,   420,   421,
+     102,   103,   104,   425,   426,   427,   429,   431,   436,   180,
+       4,   406,     7,   342,   343,   344,     7,   356,   357,   358,
+       7,   373,   374,   375,    81,   398,     8,   470,     3,     8,
+       8,   217,   220,   222,   224,     4,     4,     4,     4,     4,
+       4,     4,   235,   237,     3,     8,     8,   281,     6,     3,
+     304,     6,     3,   328,     6,     3,     3,     6,     6,     3,
+       6,     3,     6,   257,     6,     3,     4,     4,     4,     4,
+       4,     4,     3,     8,   415,   419,     4,     4,     4,     3,
+       8,   428,   430,     4,     3,     8,     8,   150,   181,   182,
+     150,   345,     6,     3,   359,     6,     3,   376,     6,     3,
+     399,     8,     4,   468,     4,     4,     4,     4,   151,   153,
+     151,   151,   151,   153,   151,     4,     4,   215,   284,   280,
+     307,   303,   331,   327,   241,   247,   292,   260,   256,   151,
+     151,   151,   151,   151,   151,   269,     4,     4,   151,   151,
+     151,   413,     4,     4,   153,   426,     6,     3,   348,   344,
+     362,   358,   379,   375,     4,     5,    16,    17,    18,    19,
+     218,   150,   150,   150,   150,   150,     8,     8,     8,     8,
+      93,    94,    95,   416,   150,   150,   150,   150,     8,     8,
+       8,   150,     7,   471,   472,   473,     3,     6,   129,   131,
+     132,   183,   226,   474,   475,   476,   477,   479,   472,   480,
+       4,   478,     3,     8,     4,   151,     4,   475,     5,   150,
+       7,   481,   482,   483,     3,     6,   130,   133,   134,   135,
+     484,   485,   486,   488,   489,   490,   482,   487,     4,     4,
+       4,     3,     8,     4,   153,   151,   151,   485,   150
   };
 
-  const unsigned short int
+  const short
   Dhcp6Parser::yyr1_[] =
   {
-       0,   147,   149,   148,   150,   148,   151,   148,   152,   148,
-     153,   148,   154,   148,   155,   148,   156,   148,   157,   148,
-     158,   148,   159,   148,   160,   148,   161,   161,   161,   161,
-     161,   161,   161,   162,   164,   163,   165,   166,   166,   167,
-     167,   169,   168,   170,   170,   171,   171,   173,   172,   174,
-     174,   175,   175,   176,   178,   177,   179,   179,   180,   180,
-     180,   180,   180,   182,   181,   184,   183,   185,   185,   186,
-     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
-     186,   186,   186,   186,   186,   186,   186,   186,   186,   186,
-     186,   187,   188,   189,   190,   191,   193,   192,   195,   194,
-     197,   196,   199,   198,   201,   200,   202,   202,   203,   203,
-     203,   203,   203,   203,   203,   203,   203,   203,   203,   203,
-     203,   205,   204,   206,   206,   206,   206,   208,   207,   210,
-     209,   212,   211,   213,   215,   214,   216,   217,   218,   219,
-     221,   220,   223,   222,   225,   224,   226,   226,   227,   227,
-     228,   229,   231,   230,   232,   232,   233,   233,   233,   234,
-     235,   237,   236,   239,   238,   240,   240,   241,   241,   243,
-     242,   245,   244,   246,   246,   246,   247,   247,   249,   248,
-     251,   250,   253,   252,   254,   254,   255,   255,   255,   255,
-     255,   255,   256,   257,   258,   259,   260,   261,   263,   262,
-     264,   264,   265,   265,   267,   266,   269,   268,   270,   270,
-     271,   271,   271,   271,   271,   271,   271,   271,   271,   271,
-     271,   271,   271,   271,   271,   271,   271,   273,   272,   275,
-     274,   277,   276,   279,   278,   281,   280,   282,   283,   285,
-     284,   286,   286,   287,   287,   289,   288,   291,   290,   292,
-     292,   293,   293,   294,   294,   294,   294,   294,   294,   294,
-     294,   295,   296,   297,   299,   298,   301,   300,   303,   302,
-     304,   306,   305,   307,   309,   308,   310,   310,   311,   311,
-     313,   312,   315,   314,   316,   316,   317,   317,   318,   318,
-     318,   318,   318,   318,   319,   321,   320,   322,   323,   324,
-     326,   325,   327,   327,   328,   328,   330,   329,   332,   331,
-     333,   333,   334,   334,   334,   334,   336,   335,   338,   337,
-     340,   339,   341,   341,   342,   342,   344,   343,   346,   345,
-     347,   347,   348,   348,   348,   348,   348,   348,   348,   348,
-     350,   349,   351,   353,   352,   354,   355,   357,   356,   358,
-     358,   359,   359,   361,   360,   363,   362,   364,   364,   365,
-     365,   366,   366,   366,   366,   366,   366,   366,   366,   366,
-     368,   367,   370,   369,   372,   371,   374,   373,   376,   375,
-     378,   377,   380,   379,   382,   381,   384,   383,   386,   385,
-     387,   387,   388,   278,   389,   389,   390,   390,   391,   391,
-     391,   391,   392,   394,   393,   396,   395,   397,   397,   398,
-     398,   398,   398,   398,   398,   398,   400,   399,   401,   401,
-     401,   402,   404,   403,   405,   406,   407,   409,   408,   410,
-     410,   411,   411,   413,   412,   415,   414,   417,   416,   419,
-     418,   420,   420,   421,   421,   421,   421,   421,   421,   421,
-     421,   421,   421,   421,   421,   421,   421,   421,   422,   424,
-     423,   426,   425,   427,   429,   428,   430,   431,   433,   432,
-     434,   434,   436,   435,   437,   438,   439,   441,   440,   442,
-     442,   442,   442,   442,   444,   443,   446,   445,   448,   447,
-     450,   449,   451,   451,   452,   454,   453,   455,   455,   457,
-     456,   458,   458,   459,   459,   459,   459,   459,   460,   462,
-     461,   464,   463,   465,   465,   467,   466,   468,   468,   469,
-     469,   469,   469,   471,   470,   472,   473,   474
+       0,   154,   156,   155,   157,   155,   158,   155,   159,   155,
+     160,   155,   161,   155,   162,   155,   163,   155,   164,   155,
+     165,   155,   166,   155,   167,   155,   168,   168,   168,   168,
+     168,   168,   168,   169,   171,   170,   172,   173,   173,   174,
+     174,   176,   175,   177,   177,   178,   178,   180,   179,   181,
+     181,   182,   182,   183,   185,   184,   186,   186,   187,   187,
+     187,   187,   187,   189,   188,   191,   190,   192,   192,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   193,   193,   193,   193,   193,   193,
+     193,   193,   193,   193,   194,   195,   196,   197,   198,   199,
+     201,   200,   203,   202,   205,   204,   207,   206,   209,   208,
+     211,   210,   213,   212,   214,   214,   215,   215,   215,   215,
+     215,   215,   215,   215,   215,   215,   215,   215,   215,   215,
+     215,   217,   216,   218,   218,   218,   218,   220,   219,   222,
+     221,   224,   223,   225,   227,   226,   228,   229,   230,   231,
+     232,   233,   235,   234,   237,   236,   239,   238,   240,   240,
+     241,   241,   242,   243,   245,   244,   246,   246,   247,   247,
+     247,   248,   249,   251,   250,   253,   252,   254,   254,   255,
+     255,   257,   256,   259,   258,   260,   260,   260,   261,   261,
+     263,   262,   265,   264,   267,   266,   268,   268,   269,   269,
+     269,   269,   269,   269,   270,   271,   272,   273,   274,   275,
+     277,   276,   278,   278,   279,   279,   281,   280,   283,   282,
+     284,   284,   285,   285,   285,   285,   285,   285,   285,   285,
+     285,   285,   285,   285,   285,   285,   285,   285,   285,   285,
+     287,   286,   289,   288,   291,   290,   293,   292,   295,   294,
+     296,   297,   298,   300,   299,   301,   301,   302,   302,   304,
+     303,   306,   305,   307,   307,   308,   308,   309,   309,   309,
+     309,   309,   309,   309,   309,   310,   311,   312,   314,   313,
+     316,   315,   318,   317,   319,   321,   320,   322,   324,   323,
+     325,   325,   326,   326,   328,   327,   330,   329,   331,   331,
+     332,   332,   333,   333,   333,   333,   333,   333,   334,   336,
+     335,   337,   338,   339,   341,   340,   342,   342,   343,   343,
+     345,   344,   347,   346,   348,   348,   349,   349,   349,   349,
+     351,   350,   353,   352,   355,   354,   356,   356,   357,   357,
+     359,   358,   361,   360,   362,   362,   363,   363,   363,   363,
+     363,   363,   363,   363,   365,   364,   366,   368,   367,   369,
+     370,   372,   371,   373,   373,   374,   374,   376,   375,   378,
+     377,   379,   379,   380,   380,   381,   381,   381,   381,   381,
+     381,   381,   381,   381,   383,   382,   385,   384,   387,   386,
+     389,   388,   391,   390,   393,   392,   395,   394,   397,   396,
+     399,   398,   401,   400,   402,   402,   403,   292,   404,   404,
+     405,   405,   406,   406,   406,   406,   407,   409,   408,   411,
+     410,   412,   412,   413,   413,   413,   413,   413,   413,   413,
+     415,   414,   416,   416,   416,   417,   419,   418,   420,   421,
+     422,   424,   423,   425,   425,   426,   426,   426,   428,   427,
+     430,   429,   431,   433,   432,   435,   434,   436,   436,   437,
+     437,   437,   437,   437,   437,   437,   437,   437,   437,   437,
+     437,   437,   437,   437,   438,   440,   439,   442,   441,   443,
+     445,   444,   446,   447,   449,   448,   450,   450,   452,   451,
+     453,   454,   455,   457,   456,   458,   458,   458,   458,   458,
+     460,   459,   462,   461,   464,   463,   466,   465,   467,   467,
+     468,   470,   469,   471,   471,   473,   472,   474,   474,   475,
+     475,   475,   475,   475,   476,   478,   477,   480,   479,   481,
+     481,   483,   482,   484,   484,   485,   485,   485,   485,   487,
+     486,   488,   489,   490
   };
 
-  const unsigned char
+  const signed char
   Dhcp6Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -3973,75 +4226,79 @@ namespace isc { namespace dhcp {
        1,     1,     1,     0,     6,     0,     4,     1,     3,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     3,     3,     3,     3,     0,     6,     0,     4,
-       0,     4,     0,     6,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
+       0,     4,     0,     4,     0,     6,     0,     4,     0,     4,
+       0,     6,     0,     6,     1,     3,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     0,     4,     1,     1,     1,     1,     0,     4,     0,
        4,     0,     4,     3,     0,     4,     3,     3,     3,     3,
+       3,     3,     0,     4,     0,     4,     0,     6,     1,     3,
+       1,     1,     1,     1,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     0,     6,     0,     6,     0,     1,     1,
+       3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
        0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
-       1,     1,     0,     6,     1,     3,     1,     1,     1,     1,
-       1,     0,     6,     0,     6,     0,     1,     1,     3,     0,
-       4,     0,     4,     1,     3,     1,     1,     1,     0,     4,
-       0,     4,     0,     6,     1,     3,     1,     1,     1,     1,
-       1,     1,     3,     3,     3,     3,     3,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     3,     3,     0,
-       6,     0,     1,     1,     3,     0,     4,     0,     4,     0,
-       1,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     3,     1,     0,     4,     0,     4,     0,     4,
-       1,     0,     4,     3,     0,     6,     0,     1,     1,     3,
-       0,     4,     0,     4,     0,     1,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     0,     4,     1,     1,     3,
-       0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     0,     4,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
        0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
        1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     3,     0,     4,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     6,     0,     4,     0,     6,
-       1,     3,     0,     4,     0,     1,     1,     3,     1,     1,
-       1,     1,     1,     0,     4,     0,     6,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     0,     4,     1,     1,
-       1,     3,     0,     4,     3,     3,     3,     0,     6,     1,
-       3,     1,     1,     0,     4,     0,     4,     0,     6,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     3,     0,
-       4,     0,     4,     3,     0,     4,     3,     3,     0,     4,
-       1,     1,     0,     4,     3,     3,     3,     0,     4,     1,
+       3,     3,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     0,     4,
+       0,     4,     0,     4,     1,     0,     4,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     1,     1,     3,     0,     6,     0,     1,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     6,     0,     1,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     4,     3,     0,     4,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
-       0,     6,     1,     3,     1,     0,     6,     1,     3,     0,
-       4,     1,     3,     1,     1,     1,     1,     1,     3,     0,
-       4,     0,     6,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     3,     3,     3
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     6,
+       0,     4,     0,     6,     1,     3,     0,     4,     0,     1,
+       1,     3,     1,     1,     1,     1,     1,     0,     4,     0,
+       6,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     1,     1,     1,     3,     0,     4,     3,     3,
+       3,     0,     6,     1,     3,     1,     1,     1,     0,     4,
+       0,     4,     3,     0,     6,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     0,     4,     0,     4,     3,
+       0,     4,     3,     3,     0,     4,     1,     1,     0,     4,
+       3,     3,     3,     0,     4,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     0,     6,     1,     3,
+       1,     0,     6,     1,     3,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     3,     0,     4,     0,     6,     1,
+       3,     0,     4,     1,     3,     1,     1,     1,     1,     0,
+       4,     3,     3,     3
   };
 
 
-
+#if PARSER6_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp6Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"",
   "\"interfaces-config\"", "\"interfaces\"", "\"lease-database\"",
   "\"hosts-database\"", "\"type\"", "\"memfile\"", "\"mysql\"",
   "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
-  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"keyspace\"",
-  "\"preferred-lifetime\"", "\"valid-lifetime\"", "\"renew-timer\"",
-  "\"rebind-timer\"", "\"decline-probation-period\"", "\"subnet6\"",
-  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
-  "\"space\"", "\"csv-format\"", "\"record-types\"", "\"encapsulate\"",
-  "\"array\"", "\"pools\"", "\"pool\"", "\"pd-pools\"", "\"prefix\"",
-  "\"prefix-len\"", "\"excluded-prefix\"", "\"excluded-prefix-len\"",
-  "\"delegated-len\"", "\"user-context\"", "\"subnet\"", "\"interface\"",
-  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
-  "\"mac-sources\"", "\"relay-supplied-options\"",
+  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"load-threads\"",
+  "\"lfc-max-leases\"", "\"readonly\"", "\"connect-timeout\"",
+  "\"contact-points\"", "\"keyspace\"", "\"preferred-lifetime\"",
+  "\"valid-lifetime\"", "\"renew-timer\"", "\"rebind-timer\"",
+  "\"decline-probation-period\"", "\"response-cache-ttl\"",
+  "\"receive-queue\"", "\"rate-limit\"", "\"subnet6\"", "\"option-def\"",
+  "\"option-data\"", "\"name\"", "\"data\"", "\"code\"", "\"space\"",
+  "\"csv-format\"", "\"record-types\"", "\"encapsulate\"", "\"array\"",
+  "\"pools\"", "\"pool\"", "\"pd-pools\"", "\"prefix\"", "\"prefix-len\"",
+  "\"excluded-prefix\"", "\"excluded-prefix-len\"", "\"delegated-len\"",
+  "\"user-context\"", "\"subnet\"", "\"interface\"", "\"interface-id\"",
+  "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
+  "\"cache-threshold\"", "\"mac-sources\"", "\"relay-supplied-options\"",
   "\"host-reservation-identifiers\"", "\"client-classes\"", "\"test\"",
   "\"client-class\"", "\"reservations\"", "\"ip-addresses\"",
   "\"prefixes\"", "\"duid\"", "\"hw-address\"", "\"hostname\"",
@@ -4052,9 +4309,9 @@ namespace isc { namespace dhcp {
   "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"", "\"server-id\"",
   "\"LLT\"", "\"EN\"", "\"LL\"", "\"identifier\"", "\"htype\"", "\"time\"",
   "\"enterprise-id\"", "\"dhcp4o6-port\"", "\"control-socket\"",
-  "\"socket-type\"", "\"socket-name\"", "\"dhcp-ddns\"",
-  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
-  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
+  "\"socket-type\"", "\"socket-name\"", "\"background-commands\"",
+  "\"dhcp-ddns\"", "\"enable-updates\"", "\"qualifying-suffix\"",
+  "\"server-ip\"", "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
   "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
   "\"always-include-fqdn\"", "\"override-no-update\"",
   "\"override-client-update\"", "\"replace-client-name\"",
@@ -4076,158 +4333,162 @@ namespace isc { namespace dhcp {
   "global_object", "dhcp6_object", "$@17", "sub_dhcp6", "$@18",
   "global_params", "global_param", "preferred_lifetime", "valid_lifetime",
   "renew_timer", "rebind_timer", "decline_probation_period",
-  "interfaces_config", "$@19", "sub_interfaces6", "$@20",
-  "interface_config_map", "$@21", "lease_database", "$@22",
-  "hosts_database", "$@23", "database_map_params", "database_map_param",
-  "database_type", "$@24", "db_type", "user", "$@25", "password", "$@26",
-  "host", "$@27", "port", "name", "$@28", "persist", "lfc_interval",
-  "readonly", "connect_timeout", "contact_points", "$@29", "keyspace",
-  "$@30", "mac_sources", "$@31", "mac_sources_list", "mac_sources_value",
-  "duid_id", "string_id", "host_reservation_identifiers", "$@32",
+  "response_cache_ttl", "receive_queue", "$@19", "rate_limit", "$@20",
+  "interfaces_config", "$@21", "sub_interfaces6", "$@22",
+  "interface_config_map", "$@23", "lease_database", "$@24",
+  "hosts_database", "$@25", "database_map_params", "database_map_param",
+  "database_type", "$@26", "db_type", "user", "$@27", "password", "$@28",
+  "host", "$@29", "port", "name", "$@30", "persist", "lfc_interval",
+  "load_threads", "lfc_max_leases", "readonly", "connect_timeout",
+  "contact_points", "$@31", "keyspace", "$@32", "mac_sources", "$@33",
+  "mac_sources_list", "mac_sources_value", "duid_id", "string_id",
+  "host_reservation_identifiers", "$@34",
   "host_reservation_identifiers_list", "host_reservation_identifier",
-  "hw_address_id", "flex_id", "relay_supplied_options", "$@33",
-  "hooks_libraries", "$@34", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@35",
-  "sub_hooks_library", "$@36", "hooks_params", "hooks_param", "library",
-  "$@37", "parameters", "$@38", "expired_leases_processing", "$@39",
+  "hw_address_id", "flex_id", "relay_supplied_options", "$@35",
+  "hooks_libraries", "$@36", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@37",
+  "sub_hooks_library", "$@38", "hooks_params", "hooks_param", "library",
+  "$@39", "parameters", "$@40", "expired_leases_processing", "$@41",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet6_list", "$@40",
-  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@41",
-  "sub_subnet6", "$@42", "subnet6_params", "subnet6_param", "subnet",
-  "$@43", "interface", "$@44", "interface_id", "$@45", "client_class",
-  "$@46", "reservation_mode", "$@47", "id", "rapid_commit",
-  "option_def_list", "$@48", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@49",
-  "sub_option_def", "$@50", "option_def_params",
+  "unwarned_reclaim_cycles", "subnet6_list", "$@42",
+  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@43",
+  "sub_subnet6", "$@44", "subnet6_params", "subnet6_param", "subnet",
+  "$@45", "interface", "$@46", "interface_id", "$@47", "client_class",
+  "$@48", "reservation_mode", "$@49", "cache_threshold", "id",
+  "rapid_commit", "option_def_list", "$@50", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@51",
+  "sub_option_def", "$@52", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@51",
-  "option_def_record_types", "$@52", "space", "$@53", "option_def_space",
-  "option_def_encapsulate", "$@54", "option_def_array", "option_data_list",
-  "$@55", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@56", "sub_option_data", "$@57",
+  "code", "option_def_code", "option_def_type", "$@53",
+  "option_def_record_types", "$@54", "space", "$@55", "option_def_space",
+  "option_def_encapsulate", "$@56", "option_def_array", "option_data_list",
+  "$@57", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@58", "sub_option_data", "$@59",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@58",
+  "option_data_param", "option_data_name", "option_data_data", "$@60",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "pools_list", "$@59", "pools_list_content", "not_empty_pools_list",
-  "pool_list_entry", "$@60", "sub_pool6", "$@61", "pool_params",
-  "pool_param", "pool_entry", "$@62", "user_context", "$@63",
-  "pd_pools_list", "$@64", "pd_pools_list_content",
-  "not_empty_pd_pools_list", "pd_pool_entry", "$@65", "sub_pd_pool",
-  "$@66", "pd_pool_params", "pd_pool_param", "pd_prefix", "$@67",
-  "pd_prefix_len", "excluded_prefix", "$@68", "excluded_prefix_len",
-  "pd_delegated_len", "reservations", "$@69", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@70", "sub_reservation",
-  "$@71", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "ip_addresses", "$@72", "prefixes", "$@73", "duid",
-  "$@74", "hw_address", "$@75", "hostname", "$@76", "flex_id_value",
-  "$@77", "reservation_client_classes", "$@78", "relay", "$@79",
-  "relay_map", "$@80", "client_classes", "$@81", "client_classes_list",
-  "$@82", "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@83",
-  "server_id", "$@84", "server_id_params", "server_id_param",
-  "server_id_type", "$@85", "duid_type", "htype", "identifier", "$@86",
-  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@87",
-  "control_socket_params", "control_socket_param", "socket_type", "$@88",
-  "socket_name", "$@89", "dhcp_ddns", "$@90", "sub_dhcp_ddns", "$@91",
-  "dhcp_ddns_params", "dhcp_ddns_param", "enable_updates",
-  "qualifying_suffix", "$@92", "server_ip", "$@93", "server_port",
-  "sender_ip", "$@94", "sender_port", "max_queue_size", "ncr_protocol",
-  "$@95", "ncr_protocol_value", "ncr_format", "$@96",
+  "pools_list", "$@61", "pools_list_content", "not_empty_pools_list",
+  "pool_list_entry", "$@62", "sub_pool6", "$@63", "pool_params",
+  "pool_param", "pool_entry", "$@64", "user_context", "$@65",
+  "pd_pools_list", "$@66", "pd_pools_list_content",
+  "not_empty_pd_pools_list", "pd_pool_entry", "$@67", "sub_pd_pool",
+  "$@68", "pd_pool_params", "pd_pool_param", "pd_prefix", "$@69",
+  "pd_prefix_len", "excluded_prefix", "$@70", "excluded_prefix_len",
+  "pd_delegated_len", "reservations", "$@71", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@72", "sub_reservation",
+  "$@73", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "ip_addresses", "$@74", "prefixes", "$@75", "duid",
+  "$@76", "hw_address", "$@77", "hostname", "$@78", "flex_id_value",
+  "$@79", "reservation_client_classes", "$@80", "relay", "$@81",
+  "relay_map", "$@82", "client_classes", "$@83", "client_classes_list",
+  "$@84", "client_class_params", "not_empty_client_class_params",
+  "client_class_param", "client_class_name", "client_class_test", "$@85",
+  "server_id", "$@86", "server_id_params", "server_id_param",
+  "server_id_type", "$@87", "duid_type", "htype", "identifier", "$@88",
+  "time", "enterprise_id", "dhcp4o6_port", "control_socket", "$@89",
+  "control_socket_params", "control_socket_param", "socket_type", "$@90",
+  "socket_name", "$@91", "background_commands", "dhcp_ddns", "$@92",
+  "sub_dhcp_ddns", "$@93", "dhcp_ddns_params", "dhcp_ddns_param",
+  "enable_updates", "qualifying_suffix", "$@94", "server_ip", "$@95",
+  "server_port", "sender_ip", "$@96", "sender_port", "max_queue_size",
+  "ncr_protocol", "$@97", "ncr_protocol_value", "ncr_format", "$@98",
   "always_include_fqdn", "override_no_update", "override_client_update",
-  "replace_client_name", "$@97", "replace_client_name_value",
-  "generated_prefix", "$@98", "dhcp4_json_object", "$@99",
-  "dhcpddns_json_object", "$@100", "logging_object", "$@101",
-  "logging_params", "logging_param", "loggers", "$@102", "loggers_entries",
-  "logger_entry", "$@103", "logger_params", "logger_param", "debuglevel",
-  "severity", "$@104", "output_options_list", "$@105",
-  "output_options_list_content", "output_entry", "$@106",
-  "output_params_list", "output_params", "output", "$@107", "flush",
+  "replace_client_name", "$@99", "replace_client_name_value",
+  "generated_prefix", "$@100", "dhcp4_json_object", "$@101",
+  "dhcpddns_json_object", "$@102", "logging_object", "$@103",
+  "logging_params", "logging_param", "loggers", "$@104", "loggers_entries",
+  "logger_entry", "$@105", "logger_params", "logger_param", "debuglevel",
+  "severity", "$@106", "output_options_list", "$@107",
+  "output_options_list_content", "output_entry", "$@108",
+  "output_params_list", "output_params", "output", "$@109", "flush",
   "maxsize", "maxver", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER6_DEBUG
-  const unsigned short int
+  const short
   Dhcp6Parser::yyrline_[] =
   {
-       0,   227,   227,   227,   228,   228,   229,   229,   230,   230,
-     231,   231,   232,   232,   233,   233,   234,   234,   235,   235,
-     236,   236,   237,   237,   238,   238,   246,   247,   248,   249,
-     250,   251,   252,   255,   260,   260,   271,   274,   275,   278,
-     282,   289,   289,   296,   297,   300,   304,   311,   311,   318,
-     319,   322,   326,   337,   347,   347,   359,   360,   364,   365,
-     366,   367,   368,   371,   371,   388,   388,   396,   397,   402,
-     403,   404,   405,   406,   407,   408,   409,   410,   411,   412,
-     413,   414,   415,   416,   417,   418,   419,   420,   421,   422,
-     423,   426,   431,   436,   441,   446,   451,   451,   461,   461,
-     469,   469,   479,   479,   489,   489,   499,   500,   503,   504,
-     505,   506,   507,   508,   509,   510,   511,   512,   513,   514,
-     515,   518,   518,   525,   526,   527,   528,   531,   531,   539,
-     539,   547,   547,   555,   560,   560,   568,   573,   578,   583,
-     588,   588,   596,   596,   605,   605,   615,   616,   619,   620,
-     623,   628,   633,   633,   643,   644,   647,   648,   649,   652,
-     657,   664,   664,   674,   674,   684,   685,   688,   689,   692,
-     692,   700,   700,   708,   709,   710,   713,   714,   717,   717,
-     725,   725,   733,   733,   743,   744,   747,   748,   749,   750,
-     751,   752,   755,   760,   765,   770,   775,   780,   788,   788,
-     801,   802,   805,   806,   813,   813,   836,   836,   845,   846,
-     850,   851,   852,   853,   854,   855,   856,   857,   858,   859,
-     860,   861,   862,   863,   864,   865,   866,   869,   869,   877,
-     877,   885,   885,   893,   893,   901,   901,   909,   914,   923,
-     923,   935,   936,   939,   940,   945,   945,   956,   956,   966,
-     967,   970,   971,   974,   975,   976,   977,   978,   979,   980,
-     981,   984,   986,   991,   993,   993,  1001,  1001,  1009,  1009,
-    1017,  1019,  1019,  1027,  1036,  1036,  1048,  1049,  1054,  1055,
-    1060,  1060,  1071,  1071,  1082,  1083,  1088,  1089,  1094,  1095,
-    1096,  1097,  1098,  1099,  1102,  1104,  1104,  1112,  1114,  1116,
-    1124,  1124,  1136,  1137,  1140,  1141,  1144,  1144,  1152,  1152,
-    1160,  1161,  1164,  1165,  1166,  1167,  1170,  1170,  1178,  1178,
-    1188,  1188,  1200,  1201,  1204,  1205,  1208,  1208,  1216,  1216,
-    1224,  1225,  1228,  1229,  1230,  1231,  1232,  1233,  1234,  1235,
-    1238,  1238,  1246,  1251,  1251,  1259,  1264,  1272,  1272,  1282,
-    1283,  1286,  1287,  1290,  1290,  1298,  1298,  1306,  1307,  1310,
-    1311,  1315,  1316,  1317,  1318,  1319,  1320,  1321,  1322,  1323,
-    1326,  1326,  1336,  1336,  1346,  1346,  1354,  1354,  1362,  1362,
-    1370,  1370,  1378,  1378,  1391,  1391,  1401,  1401,  1412,  1412,
-    1422,  1423,  1426,  1426,  1434,  1435,  1438,  1439,  1442,  1443,
-    1444,  1445,  1448,  1450,  1450,  1461,  1461,  1471,  1472,  1475,
-    1476,  1477,  1478,  1479,  1480,  1481,  1484,  1484,  1491,  1492,
-    1493,  1496,  1501,  1501,  1509,  1514,  1521,  1528,  1528,  1538,
-    1539,  1542,  1543,  1546,  1546,  1554,  1554,  1564,  1564,  1574,
-    1574,  1582,  1583,  1586,  1587,  1588,  1589,  1590,  1591,  1592,
-    1593,  1594,  1595,  1596,  1597,  1598,  1599,  1600,  1603,  1608,
-    1608,  1616,  1616,  1624,  1629,  1629,  1637,  1642,  1647,  1647,
-    1655,  1656,  1659,  1659,  1667,  1672,  1677,  1682,  1682,  1690,
-    1693,  1696,  1699,  1702,  1708,  1708,  1718,  1718,  1725,  1725,
-    1737,  1737,  1750,  1751,  1755,  1759,  1759,  1771,  1772,  1776,
-    1776,  1784,  1785,  1788,  1789,  1790,  1791,  1792,  1795,  1800,
-    1800,  1808,  1808,  1818,  1819,  1822,  1822,  1830,  1831,  1834,
-    1835,  1836,  1837,  1840,  1840,  1848,  1853,  1858
+       0,   234,   234,   234,   235,   235,   236,   236,   237,   237,
+     238,   238,   239,   239,   240,   240,   241,   241,   242,   242,
+     243,   243,   244,   244,   245,   245,   253,   254,   255,   256,
+     257,   258,   259,   262,   267,   267,   278,   281,   282,   285,
+     289,   296,   296,   303,   304,   307,   311,   318,   318,   325,
+     326,   329,   333,   344,   354,   354,   366,   367,   371,   372,
+     373,   374,   375,   378,   378,   395,   395,   403,   404,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   436,   441,   446,   451,   456,   461,
+     468,   468,   476,   476,   483,   483,   493,   493,   501,   501,
+     511,   511,   521,   521,   531,   532,   535,   536,   537,   538,
+     539,   540,   541,   542,   543,   544,   545,   546,   547,   548,
+     549,   552,   552,   559,   560,   561,   562,   565,   565,   573,
+     573,   581,   581,   589,   594,   594,   602,   607,   612,   617,
+     622,   627,   632,   632,   640,   640,   649,   649,   659,   660,
+     663,   664,   667,   672,   677,   677,   687,   688,   691,   692,
+     693,   696,   701,   708,   708,   718,   718,   728,   729,   732,
+     733,   736,   736,   744,   744,   752,   753,   754,   757,   758,
+     761,   761,   769,   769,   777,   777,   787,   788,   791,   792,
+     793,   794,   795,   796,   799,   804,   809,   814,   819,   824,
+     832,   832,   845,   846,   849,   850,   857,   857,   880,   880,
+     889,   890,   894,   895,   896,   897,   898,   899,   900,   901,
+     902,   903,   904,   905,   906,   907,   908,   909,   910,   911,
+     914,   914,   922,   922,   930,   930,   938,   938,   946,   946,
+     954,   959,   964,   973,   973,   985,   986,   989,   990,   995,
+     995,  1006,  1006,  1016,  1017,  1020,  1021,  1024,  1025,  1026,
+    1027,  1028,  1029,  1030,  1031,  1034,  1036,  1041,  1043,  1043,
+    1051,  1051,  1059,  1059,  1067,  1069,  1069,  1077,  1086,  1086,
+    1098,  1099,  1104,  1105,  1110,  1110,  1121,  1121,  1132,  1133,
+    1138,  1139,  1144,  1145,  1146,  1147,  1148,  1149,  1152,  1154,
+    1154,  1162,  1164,  1166,  1174,  1174,  1186,  1187,  1190,  1191,
+    1194,  1194,  1202,  1202,  1210,  1211,  1214,  1215,  1216,  1217,
+    1220,  1220,  1228,  1228,  1238,  1238,  1250,  1251,  1254,  1255,
+    1258,  1258,  1266,  1266,  1274,  1275,  1278,  1279,  1280,  1281,
+    1282,  1283,  1284,  1285,  1288,  1288,  1296,  1301,  1301,  1309,
+    1314,  1322,  1322,  1332,  1333,  1336,  1337,  1340,  1340,  1348,
+    1348,  1356,  1357,  1360,  1361,  1365,  1366,  1367,  1368,  1369,
+    1370,  1371,  1372,  1373,  1376,  1376,  1386,  1386,  1396,  1396,
+    1404,  1404,  1412,  1412,  1420,  1420,  1428,  1428,  1441,  1441,
+    1451,  1451,  1462,  1462,  1472,  1473,  1476,  1476,  1484,  1485,
+    1488,  1489,  1492,  1493,  1494,  1495,  1498,  1500,  1500,  1511,
+    1511,  1521,  1522,  1525,  1526,  1527,  1528,  1529,  1530,  1531,
+    1534,  1534,  1541,  1542,  1543,  1546,  1551,  1551,  1559,  1564,
+    1571,  1578,  1578,  1588,  1589,  1592,  1593,  1594,  1597,  1597,
+    1605,  1605,  1613,  1620,  1620,  1630,  1630,  1638,  1639,  1642,
+    1643,  1644,  1645,  1646,  1647,  1648,  1649,  1650,  1651,  1652,
+    1653,  1654,  1655,  1656,  1659,  1664,  1664,  1672,  1672,  1680,
+    1685,  1685,  1693,  1698,  1703,  1703,  1711,  1712,  1715,  1715,
+    1723,  1728,  1733,  1738,  1738,  1746,  1749,  1752,  1755,  1758,
+    1764,  1764,  1774,  1774,  1781,  1781,  1793,  1793,  1806,  1807,
+    1811,  1815,  1815,  1827,  1828,  1832,  1832,  1840,  1841,  1844,
+    1845,  1846,  1847,  1848,  1851,  1856,  1856,  1864,  1864,  1874,
+    1875,  1878,  1878,  1886,  1887,  1890,  1891,  1892,  1893,  1896,
+    1896,  1904,  1909,  1914
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp6Parser::yystack_print_ ()
+  Dhcp6Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
-    *yycdebug_ << std::endl;
+      *yycdebug_ << ' ' << int (i->state);
+    *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp6Parser::yy_reduce_print_ (int yyrule)
+  Dhcp6Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned int yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
-               << " (line " << yylno << "):" << std::endl;
+               << " (line " << yylno << "):\n";
     // The symbols being reduced.
     for (int yyi = 0; yyi < yynrhs; yyi++)
       YY_SYMBOL_PRINT ("   $" << yyi + 1 << " =",
@@ -4236,10 +4497,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER6_DEBUG
 
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:1167
+#line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 4242 "dhcp6_parser.cc" // lalr1.cc:1167
-#line 1863 "dhcp6_parser.yy" // lalr1.cc:1168
+#line 4503 "dhcp6_parser.cc"
+
+#line 1919 "dhcp6_parser.yy"
 
 
 void
@@ -66,6 +66,8 @@ using namespace std;
   PORT "port"
   PERSIST "persist"
   LFC_INTERVAL "lfc-interval"
+  LOAD_THREADS "load-threads"
+  LFC_MAX_LEASES "lfc-max-leases"
   READONLY "readonly"
   CONNECT_TIMEOUT "connect-timeout"
   CONTACT_POINTS "contact-points"
@@ -76,6 +78,9 @@ using namespace std;
   RENEW_TIMER "renew-timer"
   REBIND_TIMER "rebind-timer"
   DECLINE_PROBATION_PERIOD "decline-probation-period"
+  RESPONSE_CACHE_TTL "response-cache-ttl"
+  RECEIVE_QUEUE "receive-queue"
+  RATE_LIMIT "rate-limit"
   SUBNET6 "subnet6"
   OPTION_DEF "option-def"
   OPTION_DATA "option-data"
@@ -104,6 +109,7 @@ using namespace std;
   ID "id"
   RAPID_COMMIT "rapid-commit"
   RESERVATION_MODE "reservation-mode"
+  CACHE_THRESHOLD "cache-threshold"
 
   MAC_SOURCES "mac-sources"
   RELAY_SUPPLIED_OPTIONS "relay-supplied-options"
@@ -150,6 +156,7 @@ using namespace std;
   CONTROL_SOCKET "control-socket"
   SOCKET_TYPE "socket-type"
   SOCKET_NAME "socket-name"
+  BACKGROUND_COMMANDS "background-commands"
 
   DHCP_DDNS "dhcp-ddns"
   ENABLE_UPDATES "enable-updates"
@@ -404,6 +411,9 @@ global_param: preferred_lifetime
             | renew_timer
             | rebind_timer
             | decline_probation_period
+            | response_cache_ttl
+            | receive_queue
+            | rate_limit
             | subnet6_list
             | interfaces_config
             | lease_database
@@ -448,6 +458,28 @@ decline_probation_period: DECLINE_PROBATION_PERIOD COLON INTEGER {
     ctx.stack_.back()->set("decline-probation-period", dpp);
 };
 
+response_cache_ttl: RESPONSE_CACHE_TTL COLON INTEGER {
+    ElementPtr ttl(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("response-cache-ttl", ttl);
+};
+
+// The contents of the receive-queue map are checked by the
+// ReceiveQueueParser.
+receive_queue: RECEIVE_QUEUE {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON map_value {
+    ctx.stack_.back()->set("receive-queue", $4);
+    ctx.leave();
+};
+
+// The contents of the rate-limit map are checked by the RateLimitParser.
+rate_limit: RATE_LIMIT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON map_value {
+    ctx.stack_.back()->set("rate-limit", $4);
+    ctx.leave();
+};
+
 interfaces_config: INTERFACES_CONFIG {
     ElementPtr i(new MapElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -508,6 +540,8 @@ database_map_param: database_type
                   | name
                   | persist
                   | lfc_interval
+                  | load_threads
+                  | lfc_max_leases
                   | readonly
                   | connect_timeout
                   | contact_points
@@ -575,6 +609,16 @@ lfc_interval: LFC_INTERVAL COLON INTEGER {
     ctx.stack_.back()->set("lfc-interval", n);
 };
 
+load_threads: LOAD_THREADS COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("load-threads", n);
+};
+
+lfc_max_leases: LFC_MAX_LEASES COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("lfc-max-leases", n);
+};
+
 readonly: READONLY COLON BOOLEAN {
     ElementPtr n(new BoolElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("readonly", n);
@@ -863,6 +907,7 @@ subnet6_param: preferred_lifetime
              | reservations
              | reservation_mode
              | relay
+             | cache_threshold
              | unknown_map_entry
              ;
 
@@ -906,6 +951,11 @@ reservation_mode: RESERVATION_MODE {
     ctx.leave();
 };
 
+cache_threshold: CACHE_THRESHOLD COLON FLOAT {
+    ElementPtr ct(new DoubleElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-threshold", ct);
+};
+
 id: ID COLON INTEGER {
     ElementPtr id(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("id", id);
@@ -1541,6 +1591,7 @@ control_socket_params: control_socket_param
 
 control_socket_param: socket_type
                     | socket_name
+                    | background_commands
                     ;
 
 socket_type: SOCKET_TYPE {
@@ -1559,6 +1610,11 @@ socket_name: SOCKET_NAME {
     ctx.leave();
 };
 
+background_commands: BACKGROUND_COMMANDS COLON BOOLEAN {
+    ElementPtr bg(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("background-commands", bg);
+};
+
 // --- dhcp ddns ---------------------------------------------
 
 dhcp_ddns: DHCP_DDNS {
@@ -66,6 +66,7 @@
 
 #include <boost/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <boost/tokenizer.hpp>
 #include <boost/algorithm/string/erase.hpp>
 #include <boost/algorithm/string/join.hpp>
@@ -169,6 +170,62 @@ createStatusCode(const Pkt6& pkt, const Option6IA& ia, const uint16_t status_cod
     return (option_status);
 }
 
+/// @brief Returns valid lifetime to be sent to the client for a lease.
+///
+/// If the allocation engine has reused the existing lease, the client
+/// gets the remaining lifetime of the lease.
+///
+/// @param lease Reference to the lease.
+///
+/// @return Valid lifetime in seconds.
+uint32_t
+getValidLifetime(const Lease6& lease) {
+    return (lease.reuseable_valid_lft_ > 0 ? lease.reuseable_valid_lft_ :
+            lease.valid_lft_);
+}
+
+/// @brief Returns preferred lifetime to be sent to the client for a lease.
+///
+/// If the allocation engine has reused the existing lease, the preferred
+/// lifetime is reduced by the time which has elapsed since the lease
+/// was last extended.
+///
+/// @param lease Reference to the lease.
+///
+/// @return Preferred lifetime in seconds.
+uint32_t
+getPreferredLifetime(const Lease6& lease) {
+    if (lease.reuseable_valid_lft_ == 0) {
+        return (lease.preferred_lft_);
+    }
+    uint32_t elapsed = lease.valid_lft_ - lease.reuseable_valid_lft_;
+    return (lease.preferred_lft_ > elapsed ? lease.preferred_lft_ - elapsed : 0);
+}
+
+/// @brief Limits the T1 and T2 timers of an IA to the lifetimes of a
+/// reused lease.
+///
+/// If the allocation engine has reused the existing lease, its remaining
+/// preferred lifetime may be shorter than the configured timers. The
+/// timers are then reduced to this lifetime so as the client renews
+/// before the lease it was handed out stops being preferred.
+///
+/// @param ia Reference to the IA sent to the client.
+/// @param lease Reference to the lease sent within the IA.
+void
+clampTimers(Option6IA& ia, const Lease6& lease) {
+    if (lease.reuseable_valid_lft_ == 0) {
+        return;
+    }
+    const uint32_t preferred_lft = getPreferredLifetime(lease);
+    if (ia.getT1() > preferred_lft) {
+        ia.setT1(preferred_lft);
+    }
+    if (ia.getT2() > preferred_lft) {
+        ia.setT2(preferred_lft);
+    }
+}
+
 }; // anonymous namespace
 
 namespace isc {
@@ -177,7 +234,8 @@ namespace dhcp {
 const std::string Dhcpv6Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 
 Dhcpv6Srv::Dhcpv6Srv(uint16_t port)
-    : port_(port), serverid_(), shutdown_(true), alloc_engine_()
+    : port_(port), serverid_(), shutdown_(true), alloc_engine_(),
+      receive_queue_(), receive_queue_drops_(0), rate_limiter_()
 {
 
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_START, DHCP6_OPEN_SOCKET).arg(port);
@@ -245,6 +303,53 @@ Pkt6Ptr Dhcpv6Srv::receivePacket(int timeout) {
     return (IfaceMgr::instance().receive6(timeout));
 }
 
+Pkt6Ptr
+Dhcpv6Srv::receiveQueuedPacket(int timeout) {
+    receive_queue_.configure(CfgMgr::instance().getCurrentCfg()->
+                             getReceiveQueueConfig());
+    if (!receive_queue_.enabled()) {
+        return (receivePacket(timeout));
+    }
+
+    // Don't wait for new packets when there are queued packets to process.
+    if (!receive_queue_.empty()) {
+        timeout = 0;
+    }
+
+    // Move the packets waiting in the socket buffers to the queue, so as
+    // the drop policy is applied to them rather than to the packets which
+    // the kernel would drop when its buffers get full. The number of reads
+    // is limited to let the server process packets under constant load.
+    const size_t capacity = receive_queue_.getConfig().capacity_;
+    for (size_t reads = 0; reads < capacity; ++reads) {
+        Pkt6Ptr pkt = receivePacket(timeout);
+        if (!pkt) {
+            break;
+        }
+        receive_queue_.push(pkt);
+        timeout = 0;
+    }
+
+    Pkt6Ptr query = receive_queue_.pop();
+    updateReceiveQueueStats();
+    return (query);
+}
+
+void
+Dhcpv6Srv::updateReceiveQueueStats() {
+    const uint64_t drops = receive_queue_.getDropped();
+    if (drops > receive_queue_drops_) {
+        const int64_t dropped = drops - receive_queue_drops_;
+        receive_queue_drops_ = drops;
+        LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_PACKET_QUEUE_DROP)
+            .arg(dropped)
+            .arg(receive_queue_.size());
+        StatsMgr::instance().addValue("pkt6-queue-drop", dropped);
+    }
+    StatsMgr::instance().setValue("pkt6-queue-size",
+        static_cast<int64_t>(receive_queue_.size()));
+}
+
 void Dhcpv6Srv::sendPacket(const Pkt6Ptr& packet) {
     IfaceMgr::instance().send(packet);
 }
@@ -397,7 +502,7 @@ void Dhcpv6Srv::run_one() {
     try {
         uint32_t timeout = 1000;
         LOG_DEBUG(packet6_logger, DBG_DHCP6_DETAIL, DHCP6_BUFFER_WAIT).arg(timeout);
-        query = receivePacket(timeout);
+        query = receiveQueuedPacket(timeout);
 
         // Log if packet has arrived. We can't log the detailed information
         // about the DHCP message because it hasn't been unpacked/parsed
@@ -582,6 +687,23 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
+    // Drop the packets from the clients and relays exceeding their rates
+    // before spending any time on classification and lease lookups.
+    rate_limiter_.configure(CfgMgr::instance().getCurrentCfg()->
+                            getRateLimitConfig());
+    RateLimiter::Source source = rate_limiter_.check(query);
+    if (source != RateLimiter::NONE) {
+        LOG_DEBUG(bad_packet6_logger, DBG_DHCP6_DETAIL,
+                  DHCP6_PACKET_DROP_RATE_LIMIT)
+            .arg(query->getLabel())
+            .arg(RateLimiter::sourceToText(source));
+        StatsMgr::instance().addValue("pkt6-rate-limit-drop",
+                                      static_cast<int64_t>(1));
+        StatsMgr::instance().addValue("pkt6-receive-drop",
+                                      static_cast<int64_t>(1));
+        return;
+    }
+
     // Check if received query carries server identifier matching
     // server identifier being used by the server.
     if (!testServerID(query)) {
@@ -644,6 +766,30 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         callout_handle->getArgument("query6", query);
     }
 
+    // The client retransmits its query when the response is late. If the
+    // response to the previous copy of this query has been sent recently,
+    // send a copy of it again rather than going through the allocation
+    // once more. The pkt6_receive callouts have been called, but the
+    // subnet6_select, lease6_* and pkt6_send callouts are skipped. The
+    // buffer6_send callouts are called with the copy of the response.
+    response_cache_.setTTL(CfgMgr::instance().getCurrentCfg()->
+                           getResponseCacheTTL());
+    const uint8_t type = query->getType();
+    const bool cacheable = ((type == DHCPV6_SOLICIT) ||
+                            (type == DHCPV6_REQUEST) ||
+                            (type == DHCPV6_RENEW) ||
+                            (type == DHCPV6_REBIND));
+    if (cacheable) {
+        rsp = response_cache_.get(query);
+        if (rsp) {
+            LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC,
+                      DHCP6_PACKET_RETRANSMITTED)
+                .arg(query->getLabel())
+                .arg(query->getName());
+            return;
+        }
+    }
+
     // Assign this packet to a class, if possible
     classifyPacket(query);
 
@@ -803,6 +949,10 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             return;
         }
 
+        if (cacheable) {
+            response_cache_.add(query, rsp);
+        }
+
     }
 }
 
@@ -1300,16 +1450,8 @@ Dhcpv6Srv::createNameChangeRequests(const Pkt6Ptr& answer,
     }
     DuidPtr duid = DuidPtr(new DUID(opt_duid->getData()));
 
-    // Get the FQDN in the on-wire format. It will be needed to compute
-    // DHCID.
-    OutputBuffer name_buf(1);
-    opt_fqdn->packDomainName(name_buf);
-    const uint8_t* name_data = static_cast<const uint8_t*>(name_buf.getData());
-    // @todo currently D2Dhcid accepts a vector holding FQDN.
-    // However, it will be faster if we used a pointer name_data.
-    std::vector<uint8_t> buf_vec(name_data, name_data + name_buf.getLength());
-    // Compute DHCID from Client Identifier and FQDN.
-    isc::dhcp_ddns::D2Dhcid dhcid(*duid, buf_vec);
+    // DHCID of the requests, computed on first use.
+    boost::scoped_ptr<isc::dhcp_ddns::D2Dhcid> dhcid;
 
     // Get all IAs from the answer. For each IA, holding an address we will
     // create a corresponding NameChangeRequest.
@@ -1346,6 +1488,24 @@ Dhcpv6Srv::createNameChangeRequests(const Pkt6Ptr& answer,
             continue;
         }
 
+        // The DHCID is computed when the first request is created, so
+        // that the digest is computed at most once per packet and not at
+        // all for renewals leaving the FQDN unchanged.
+        if (!dhcid) {
+            // Get the FQDN in the on-wire format. It will be needed to
+            // compute DHCID.
+            OutputBuffer name_buf(1);
+            opt_fqdn->packDomainName(name_buf);
+            const uint8_t* name_data =
+                static_cast<const uint8_t*>(name_buf.getData());
+            // @todo currently D2Dhcid accepts a vector holding FQDN.
+            // However, it will be faster if we used a pointer name_data.
+            std::vector<uint8_t> buf_vec(name_data,
+                                         name_data + name_buf.getLength());
+            // Compute DHCID from Client Identifier and FQDN.
+            dhcid.reset(new isc::dhcp_ddns::D2Dhcid(*duid, buf_vec));
+        }
+
         // Create new NameChangeRequest. Use the domain name from the FQDN.
         // This is an FQDN included in the response to the client, so it
         // holds a fully qualified domain-name already (not partial).
@@ -1355,7 +1515,7 @@ Dhcpv6Srv::createNameChangeRequests(const Pkt6Ptr& answer,
                                         do_fwd, do_rev,
                                         opt_fqdn->getDomainName(),
                                         iaaddr->getAddress().toText(),
-                                        dhcid, 0, iaaddr->getValid()));
+                                        *dhcid, 0, iaaddr->getValid()));
 
         LOG_DEBUG(ddns6_logger, DBG_DHCP6_DETAIL,
                   DHCP6_DDNS_CREATE_ADD_NAME_CHANGE_REQUEST).arg(ncr->toText());
@@ -1495,9 +1655,10 @@ Dhcpv6Srv::assignIA_NA(const Pkt6Ptr& query, const Pkt6Ptr& answer,
         ia_rsp->setT2(subnet->getT2());
 
         Option6IAAddrPtr addr(new Option6IAAddr(D6O_IAADDR, lease->addr_,
-                                                lease->preferred_lft_,
-                                                lease->valid_lft_));
+                                                getPreferredLifetime(*lease),
+                                                getValidLifetime(*lease)));
         ia_rsp->addOption(addr);
+        clampTimers(*ia_rsp, *lease);
 
         // It would be possible to insert status code=0(success) as well,
         // but this is considered waste of bandwidth as absence of status
@@ -1608,9 +1769,11 @@ Dhcpv6Srv::assignIA_PD(const Pkt6Ptr& query, const Pkt6Ptr& answer,
 
             boost::shared_ptr<Option6IAPrefix>
                 addr(new Option6IAPrefix(D6O_IAPREFIX, (*l)->addr_,
-                                         (*l)->prefixlen_, (*l)->preferred_lft_,
-                                         (*l)->valid_lft_));
+                                         (*l)->prefixlen_,
+                                         getPreferredLifetime(**l),
+                                         getValidLifetime(**l)));
             ia_rsp->addOption(addr);
+            clampTimers(*ia_rsp, **l);
 
             if (pd_exclude_requested) {
                 // PD exclude option has been requested via ORO, thus we need to
@@ -1737,8 +1900,10 @@ Dhcpv6Srv::extendIA_NA(const Pkt6Ptr& query, const Pkt6Ptr& answer,
     // For all leases we have now, add the IAADDR with non-zero lifetimes.
     for (Lease6Collection::const_iterator l = leases.begin(); l != leases.end(); ++l) {
         Option6IAAddrPtr iaaddr(new Option6IAAddr(D6O_IAADDR,
-                                (*l)->addr_, (*l)->preferred_lft_, (*l)->valid_lft_));
+                                (*l)->addr_, getPreferredLifetime(**l),
+                                getValidLifetime(**l)));
         ia_rsp->addOption(iaaddr);
+        clampTimers(*ia_rsp, **l);
         LOG_INFO(lease6_logger, DHCP6_LEASE_RENEW)
             .arg(query->getLabel())
             .arg((*l)->addr_.toText())
@@ -1899,8 +2064,10 @@ Dhcpv6Srv::extendIA_PD(const Pkt6Ptr& query,
 
         Option6IAPrefixPtr prf(new Option6IAPrefix(D6O_IAPREFIX,
                                (*l)->addr_, (*l)->prefixlen_,
-                               (*l)->preferred_lft_, (*l)->valid_lft_));
+                               getPreferredLifetime(**l),
+                               getValidLifetime(**l)));
         ia_rsp->addOption(prf);
+        clampTimers(*ia_rsp, **l);
 
 
         if (pd_exclude_requested) {
@@ -14,10 +14,13 @@
 #include <dhcp/option6_client_fqdn.h>
 #include <dhcp/option6_ia.h>
 #include <dhcp/option_definition.h>
+#include <dhcp/packet_queue.h>
 #include <dhcp/pkt6.h>
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/d2_client_mgr.h>
+#include <dhcpsrv/rate_limiter.h>
+#include <dhcpsrv/response_cache.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
@@ -614,6 +617,23 @@ protected:
     /// simulates reception of a packet. For that purpose it is protected.
     virtual Pkt6Ptr receivePacket(int timeout);
 
+    /// @brief Receives the next packet to be processed.
+    ///
+    /// If the receive queue is enabled, all packets waiting in the socket
+    /// buffers are read into the queue and the packet from the front of
+    /// the queue is returned. The packets which don't fit into the queue
+    /// or have been waiting there for too long are dropped. Otherwise,
+    /// this method simply calls @ref receivePacket.
+    ///
+    /// @param timeout Timeout for the first read, used when the queue is
+    /// empty.
+    ///
+    /// @return Packet to be processed or null pointer if there is none.
+    Pkt6Ptr receiveQueuedPacket(int timeout);
+
+    /// @brief Updates the receive queue statistics.
+    void updateReceiveQueueStats();
+
     /// @brief dummy wrapper around IfaceMgr::send()
     ///
     /// This method is useful for testing purposes, where its replacement
@@ -842,6 +862,25 @@ protected:
     /// Holds a list of @c isc::dhcp_ddns::NameChangeRequest objects, which
     /// are waiting for sending to kea-dhcp-ddns module.
     std::queue<isc::dhcp_ddns::NameChangeRequest> name_change_reqs_;
+
+    /// @brief Responses sent to the recent Solicit, Request, Renew and
+    /// Rebind messages.
+    ///
+    /// Retransmitted messages are answered with the cached responses
+    /// rather than being processed again. The cache is cleared when a new
+    /// configuration is committed.
+    ResponseCache response_cache_;
+
+    /// @brief Queue holding the received packets until they are processed.
+    PacketQueue<Pkt6Ptr> receive_queue_;
+
+    /// @brief Number of packets dropped from the receive queue, which has
+    /// been accounted for in the statistics.
+    uint64_t receive_queue_drops_;
+
+    /// @brief Limits the rate of packets accepted from each client and
+    /// relay.
+    RateLimiter rate_limiter_;
 };
 
 }; // namespace isc::dhcp
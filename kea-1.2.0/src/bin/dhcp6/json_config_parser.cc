@@ -528,6 +528,7 @@ public:
     ///
     /// - decline-probation-period
     /// - dhcp4o6-port
+    /// - response-cache-ttl (optional)
     ///
     /// @throw DhcpConfigError if parameters are missing or
     /// or having incorrect values.
@@ -541,6 +542,12 @@ public:
         // Set the DHCPv4-over-DHCPv6 interserver port.
         uint16_t dhcp4o6_port = getUint16(global, "dhcp4o6-port");
         srv_config->setDhcp4o6Port(dhcp4o6_port);
+
+        // Set the lifetime of the cached responses, if specified.
+        if (global->contains("response-cache-ttl")) {
+            srv_config->setResponseCacheTTL(getUint32(global,
+                                                      "response-cache-ttl"));
+        }
     }
 };
 
@@ -686,6 +693,18 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
                 continue;
             }
 
+            if (config_pair.first == "receive-queue") {
+                ReceiveQueueParser parser;
+                parser.parse(*srv_config, config_pair.second);
+                continue;
+            }
+
+            if (config_pair.first == "rate-limit") {
+                RateLimitParser parser;
+                parser.parse(*srv_config, config_pair.second);
+                continue;
+            }
+
             if (config_pair.first == "host-reservation-identifiers") {
                 HostReservationIdsParser6 parser;
                 parser.parse(config_pair.second);
@@ -762,14 +781,16 @@ configureDhcp6Server(Dhcpv6Srv&, isc::data::ConstElementPtr config_set,
 
             // Timers are not used in the global scope. Their values are derived
             // to specific subnets (see SimpleParser6::deriveParameters).
-            // decline-probation-period and dhcp4o6-port are handled in the
-            // global_parser.parse() which sets global parameters.
+            // decline-probation-period, dhcp4o6-port and response-cache-ttl
+            // are handled in the global_parser.parse() which sets global
+            // parameters.
             if ( (config_pair.first == "renew-timer") ||
                  (config_pair.first == "rebind-timer") ||
                  (config_pair.first == "preferred-lifetime") ||
                  (config_pair.first == "valid-lifetime") ||
                  (config_pair.first == "decline-probation-period") ||
-                 (config_pair.first == "dhcp4o6-port")) {
+                 (config_pair.first == "dhcp4o6-port") ||
+                 (config_pair.first == "response-cache-ttl")) {
                 continue;
             }
 
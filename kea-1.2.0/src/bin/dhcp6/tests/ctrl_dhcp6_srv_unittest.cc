@@ -53,6 +53,7 @@ public:
 
     /// Expose internal methods for the sake of testing
     using Dhcpv6Srv::receivePacket;
+    using Dhcpv6Srv::response_cache_;
 };
 
 class CtrlDhcpv6SrvTest : public BaseServerTest {
@@ -443,6 +444,17 @@ TEST_F(CtrlChannelDhcpv6SrvTest, configSet) {
         << logger_txt
         << "}}";
 
+    // Cache a response. It must be dropped when the new configuration
+    // is committed.
+    server_->response_cache_.setTTL(10000);
+    Pkt6Ptr query(new Pkt6(DHCPV6_SOLICIT, 1234));
+    query->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID,
+                                          OptionBuffer(8, 1))));
+    Pkt6Ptr advertise(new Pkt6(DHCPV6_ADVERTISE, 1234));
+    ASSERT_NO_THROW(advertise->pack());
+    server_->response_cache_.add(query, advertise);
+    ASSERT_EQ(1, server_->response_cache_.size());
+
     // Send the config-set command
     std::string response;
     sendUnixCommand(os.str(), response);
@@ -456,6 +468,9 @@ TEST_F(CtrlChannelDhcpv6SrvTest, configSet) {
         CfgMgr::instance().getCurrentCfg()->getCfgSubnets6()->getAll();
     EXPECT_EQ(1, subnets->size());
 
+    // The cached response has been removed.
+    EXPECT_EQ(0, server_->response_cache_.size());
+
     // Create a config with malformed subnet that should fail to parse.
     os.str("");
     os << set_config_txt << ","
@@ -693,6 +708,7 @@ TEST_F(CtrlDhcpv6SrvTest, commandsRegistration) {
     EXPECT_TRUE(command_list.find("\"build-report\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-write\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"lease6-get-page\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"leases-reclaim\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"libreload\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-set\"") != string::npos);
@@ -864,6 +880,100 @@ TEST_F(CtrlChannelDhcpv6SrvTest, controlLeasesReclaimRemove) {
     ASSERT_FALSE(lease1);
 }
 
+// This test verifies that the leases of a subnet are returned in pages
+// on lease6-get-page command.
+TEST_F(CtrlChannelDhcpv6SrvTest, controlLease6GetPage) {
+    createUnixChannelServer();
+
+    // Create leases in two subnets.
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    const char* addresses[] = { "3000::3", "3000::1", "3001::1", "3000::2" };
+    for (int i = 0; i < 4; ++i) {
+        DuidPtr duid(new DUID(std::vector<uint8_t>(8, i)));
+        Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress(addresses[i]),
+                                   duid, 1, 50, 60, 10, 20,
+                                   SubnetID(i == 2 ? 2 : 1)));
+        ASSERT_NO_THROW(lease_mgr.addLease(lease));
+    }
+
+    // Missing or bogus arguments.
+    std::string response;
+    sendUnixCommand("{ \"command\": \"lease6-get-page\" }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"Missing mandatory 'subnet-id' parameter.\" }", response);
+
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1 } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"Missing mandatory 'limit' parameter.\" }", response);
+
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 0 } }",
+                    response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"'limit' parameter expected to be a positive integer.\" }",
+              response);
+
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"10.0.0.1\" } }", response);
+    EXPECT_EQ("{ \"result\": 1, \"text\": "
+              "\"'from' parameter expected to be 'start' or an IPv6 address.\" }",
+              response);
+
+    // The first page holds two lowest addresses of the subnet 1.
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"start\" } }", response);
+    ConstElementPtr rsp;
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    int status;
+    ConstElementPtr args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(2, args->get("count")->intValue());
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("3000::1", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("3000::2", leases->get(1)->get("ip-address")->stringValue());
+
+    // The next page starts after the last returned address.
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"3000::2\" } }", response);
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    EXPECT_EQ("3000::3", leases->get(0)->get("ip-address")->stringValue());
+
+    // There are no more leases in this subnet.
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 1, \"limit\": 2, "
+                    "\"from\": \"3000::3\" } }", response);
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(0, args->get("count")->intValue());
+
+    // The other subnet holds one lease.
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"subnet-id\": 2, \"limit\": 10 } }",
+                    response);
+    ASSERT_NO_THROW(rsp = Element::fromJSON(response));
+    args = parseAnswer(status, rsp);
+    ASSERT_EQ(0, status) << response;
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(1, leases->size());
+    EXPECT_EQ("3001::1", leases->get(0)->get("ip-address")->stringValue());
+}
+
 // Tests that the server properly responds to statistics commands.  Note this
 // is really only intended to verify that the appropriate Statistics handler
 // is called based on the command.  It is not intended to be an exhaustive
@@ -928,6 +1038,7 @@ TEST_F(CtrlChannelDhcpv6SrvTest, commandsList) {
     checkListCommands(rsp, "config-test");
     checkListCommands(rsp, "config-write");
     checkListCommands(rsp, "list-commands");
+    checkListCommands(rsp, "lease6-get-page");
     checkListCommands(rsp, "leases-reclaim");
     checkListCommands(rsp, "libreload");
     checkListCommands(rsp, "version-get");
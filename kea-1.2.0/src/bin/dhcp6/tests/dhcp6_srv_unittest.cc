@@ -918,6 +918,54 @@ TEST_F(Dhcpv6SrvTest, pdRenewBasic) {
                    "2001:db8:1:2::", pd_pool_->getLength());
 }
 
+// This test verifies that when the existing lease is reused on renewal,
+// the T1 and T2 timers sent to the client don't exceed the remaining
+// preferred lifetime of the lease.
+TEST_F(Dhcpv6SrvTest, renewReuseLeaseTimers) {
+    NakedDhcpv6Srv srv(0);
+
+    const IOAddress addr("2001:db8:1:1::cafe:babe");
+    const uint32_t iaid = 234;
+    OptionPtr clientid = generateClientId();
+
+    Pkt6Ptr req = createMessage(DHCPV6_RENEW, Lease::TYPE_NA, addr, 128, iaid);
+    req->addOption(clientid);
+    req->addOption(srv.getServerID());
+
+    // The first renewal stores the lease with the subnet's lifetimes.
+    ASSERT_TRUE(srv.processRenew(req));
+    Lease6Ptr lease = LeaseMgrFactory::instance().getLease6(Lease::TYPE_NA,
+                                                            addr);
+    ASSERT_TRUE(lease);
+
+    // Pretend the lease was extended 2500 seconds ago: 1500 seconds of the
+    // valid and 500 seconds of the preferred lifetime remain, which is
+    // less than the T1 and T2 configured for the subnet.
+    lease->cltt_ = time(NULL) - 2500;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease6(lease));
+    subnet_->setCacheThreshold(0.25);
+
+    Pkt6Ptr reply = srv.processRenew(req);
+    checkResponse(reply, DHCPV6_REPLY, 1234);
+
+    Option6IAPtr ia = boost::dynamic_pointer_cast<
+        Option6IA>(reply->getOption(D6O_IA_NA));
+    ASSERT_TRUE(ia);
+    Option6IAAddrPtr iaaddr = boost::dynamic_pointer_cast<
+        Option6IAAddr>(ia->getOption(D6O_IAADDR));
+    ASSERT_TRUE(iaaddr);
+
+    // The lease should have been reused.
+    EXPECT_GE(1500, iaaddr->getValid());
+    EXPECT_LE(1490, iaaddr->getValid());
+    EXPECT_GE(500, iaaddr->getPreferred());
+    EXPECT_LE(490, iaaddr->getPreferred());
+
+    // The timers must fire before the address stops being preferred.
+    EXPECT_EQ(iaaddr->getPreferred(), ia->getT1());
+    EXPECT_EQ(iaaddr->getPreferred(), ia->getT2());
+}
+
 // This test verifies that incoming (invalid) RENEW with an address
 // can be handled properly. This has changed with #3565. The server
 // is now able to allocate a lease in Renew if it's available.
@@ -1477,6 +1525,129 @@ TEST_F(Dhcpv6SrvTest, portsDirectTraffic) {
     EXPECT_EQ(DHCP6_CLIENT_PORT, adv->getRemotePort());
 }
 
+// Checks that the retransmitted SOLICIT is answered with the cached
+// response when the response cache is enabled.
+TEST_F(Dhcpv6SrvTest, responseCache) {
+
+    NakedDhcpv6Srv srv(0);
+
+    // Enable the response cache.
+    CfgMgr::instance().clear();
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets6()->add(subnet_);
+    CfgMgr::instance().getStagingCfg()->setResponseCacheTTL(10000);
+    CfgMgr::instance().commit();
+
+    // Simulate that the client has sent the same SOLICIT twice and then
+    // the same one has been received from another address.
+    srv.fakeReceive(PktCaptures::captureSimpleSolicit());
+    srv.fakeReceive(PktCaptures::captureSimpleSolicit());
+    Pkt6Ptr sol = PktCaptures::captureSimpleSolicit();
+    sol->setRemoteAddr(IOAddress("fe80::2"));
+    srv.fakeReceive(sol);
+
+    srv.run();
+
+    // All queries should have been answered.
+    ASSERT_EQ(3, srv.fake_sent_.size());
+    Pkt6Ptr adv1 = srv.fake_sent_.front();
+    srv.fake_sent_.pop_front();
+    Pkt6Ptr adv2 = srv.fake_sent_.front();
+    srv.fake_sent_.pop_front();
+    Pkt6Ptr adv3 = srv.fake_sent_.front();
+
+    // The retransmission is answered with a copy of the response to the
+    // first query, so the sent packets don't share a buffer.
+    EXPECT_FALSE(adv1 == adv2);
+    ASSERT_EQ(adv1->getBuffer().getLength(), adv2->getBuffer().getLength());
+    EXPECT_EQ(0, memcmp(adv1->getBuffer().getData(),
+                        adv2->getBuffer().getData(),
+                        adv1->getBuffer().getLength()));
+    EXPECT_EQ(adv1->getTransid(), adv2->getTransid());
+    // The query received from another address has been processed and
+    // cached separately.
+    EXPECT_EQ(2, srv.response_cache_.size());
+}
+
+// This test verifies that the packets which don't fit into the receive
+// queue are dropped and the remaining ones are processed.
+TEST_F(Dhcpv6SrvTest, receiveQueue) {
+
+    NakedDhcpv6Srv srv(0);
+
+    // Enable the receive queue holding at most two packets.
+    CfgMgr::instance().clear();
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets6()->add(subnet_);
+    CfgMgr::instance().getStagingCfg()->
+        setReceiveQueueConfig(PacketQueueConfig(2));
+    CfgMgr::instance().commit();
+
+    // Simulate that four packets are waiting in the socket buffers.
+    for (int i = 0; i < 4; ++i) {
+        srv.fakeReceive(PktCaptures::captureSimpleSolicit());
+    }
+
+    // The first call reads as many packets as fit into the queue and
+    // processes the first one.
+    srv.run_one();
+    ASSERT_EQ(1, srv.fake_sent_.size());
+
+    // The next call reads the remaining packets. The oldest packet is
+    // dropped to make room for the last one.
+    srv.run_one();
+    ASSERT_EQ(2, srv.fake_sent_.size());
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    ObservationPtr drop_stat = mgr.getObservation("pkt6-queue-drop");
+    ASSERT_TRUE(drop_stat);
+    EXPECT_EQ(1, drop_stat->getInteger().first);
+    ObservationPtr size_stat = mgr.getObservation("pkt6-queue-size");
+    ASSERT_TRUE(size_stat);
+    EXPECT_EQ(1, size_stat->getInteger().first);
+
+    // The next call processes the queued packet.
+    srv.run_one();
+    EXPECT_EQ(3, srv.fake_sent_.size());
+    EXPECT_EQ(0, size_stat->getInteger().first);
+
+    // There is nothing more to process.
+    srv.run_one();
+    EXPECT_EQ(3, srv.fake_sent_.size());
+}
+
+// This test verifies that the packets from the client exceeding its rate
+// are dropped.
+TEST_F(Dhcpv6SrvTest, rateLimit) {
+
+    NakedDhcpv6Srv srv(0);
+
+    // Allow the client to send two packets at once.
+    CfgMgr::instance().clear();
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets6()->add(subnet_);
+    CfgMgr::instance().getStagingCfg()->
+        setRateLimitConfig(RateLimitConfig(1, 2));
+    CfgMgr::instance().commit();
+
+    // Simulate that the client has sent the same SOLICIT three times.
+    for (int i = 0; i < 3; ++i) {
+        srv.fakeReceive(PktCaptures::captureSimpleSolicit());
+    }
+
+    srv.run();
+
+    // The third query should have been dropped.
+    EXPECT_EQ(2, srv.fake_sent_.size());
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    ObservationPtr rate_stat = mgr.getObservation("pkt6-rate-limit-drop");
+    ASSERT_TRUE(rate_stat);
+    EXPECT_EQ(1, rate_stat->getInteger().first);
+    ObservationPtr drop_stat = mgr.getObservation("pkt6-receive-drop");
+    ASSERT_TRUE(drop_stat);
+    EXPECT_EQ(1, drop_stat->getInteger().first);
+}
+
 // Checks if server responses are sent to the proper port.
 TEST_F(Dhcpv6SrvTest, portsRelayedTraffic) {
 
@@ -788,6 +788,55 @@ TEST_F(FqdnDhcpv6SrvTest, createNameChangeRequests) {
                             0, 500);
 }
 
+// Test that no NameChangeRequest is created for the addresses whose lease
+// was renewed with an unchanged FQDN, and that one is created for the first
+// address whose FQDN changed.
+TEST_F(FqdnDhcpv6SrvTest, createNameChangeRequestsUnchangedFqdn) {
+    // Create Reply message with Client Id and Server id.
+    Pkt6Ptr answer = generateMessageWithIds(DHCPV6_REPLY);
+
+    // Create three IAs, each having different address.
+    addIA(1234, IOAddress("2001:db8:1::1"), answer);
+    addIA(2345, IOAddress("2001:db8:1::2"), answer);
+    addIA(3456, IOAddress("2001:db8:1::3"), answer);
+
+    Option6ClientFqdnPtr fqdn = createClientFqdn(Option6ClientFqdn::FLAG_S,
+                                                 "myhost.example.com",
+                                                 Option6ClientFqdn::FULL);
+    answer->addOption(fqdn);
+
+    // The leases of the first two addresses were renewed with the same
+    // FQDN and flags.
+    AllocEngine::ClientContext6 ctx;
+    ctx.fwd_dns_update_ = ctx.rev_dns_update_ = true;
+    for (int i = 1; i <= 2; ++i) {
+        Lease6Ptr lease(new Lease6(*lease_));
+        lease->addr_ = IOAddress(i == 1 ? "2001:db8:1::1" : "2001:db8:1::2");
+        lease->hostname_ = "myhost.example.com.";
+        lease->fqdn_fwd_ = lease->fqdn_rev_ = true;
+        ctx.currentIA().changed_leases_.push_back(lease);
+    }
+
+    // Only the third address needs a DNS update.
+    ASSERT_NO_THROW(srv_->createNameChangeRequests(answer, ctx));
+    ASSERT_EQ(1, d2_mgr_.getQueueSize());
+    verifyNameChangeRequest(isc::dhcp_ddns::CHG_ADD, true, true,
+                            "2001:db8:1::3",
+                            "000201415AA33D1187D148275136FA30300478"
+                            "FAAAA3EBD29826B5C907B2C9268A6F52",
+                            0, 500);
+
+    // When all the leases were renewed with the same FQDN, no request is
+    // created.
+    Lease6Ptr lease(new Lease6(*lease_));
+    lease->addr_ = IOAddress("2001:db8:1::3");
+    lease->hostname_ = "myhost.example.com.";
+    lease->fqdn_fwd_ = lease->fqdn_rev_ = true;
+    ctx.currentIA().changed_leases_.push_back(lease);
+    ASSERT_NO_THROW(srv_->createNameChangeRequests(answer, ctx));
+    EXPECT_EQ(0, d2_mgr_.getQueueSize());
+}
+
 // Checks that NameChangeRequests to add entries are not
 // created when ddns updates are disabled.
 TEST_F(FqdnDhcpv6SrvTest, noAddRequestsWhenDisabled) {
@@ -1058,6 +1058,38 @@ TEST_F(HooksDhcpv6SrvTest, skipPkt6Receive) {
     ASSERT_EQ(0, srv_->fake_sent_.size());
 }
 
+// Checks that the pkt6_receive callouts are called for a retransmitted
+// query which has a cached response and that they can drop it.
+TEST_F(HooksDhcpv6SrvTest, skipPkt6ReceiveCachedResponse) {
+
+    // Enable the response cache.
+    CfgMgr::instance().clear();
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets6()->add(subnet_);
+    CfgMgr::instance().getStagingCfg()->setResponseCacheTTL(10000);
+    CfgMgr::instance().commit();
+
+    // The first SOLICIT is processed and its response is cached.
+    srv_->fakeReceive(PktCaptures::captureSimpleSolicit());
+    srv_->run();
+    ASSERT_EQ(1, srv_->fake_sent_.size());
+    ASSERT_EQ(1, srv_->response_cache_.size());
+    srv_->fake_sent_.clear();
+
+    // Install pkt6_receive_callout
+    EXPECT_NO_THROW(HooksManager::preCalloutsLibraryHandle().registerCallout(
+                        "pkt6_receive", pkt6_receive_skip));
+
+    // Simulate that the client has retransmitted the SOLICIT.
+    srv_->shutdown_ = false;
+    srv_->fakeReceive(PktCaptures::captureSimpleSolicit());
+    srv_->run();
+
+    // The callout has been called and the retransmission has been dropped
+    // rather than answered from the cache.
+    EXPECT_EQ("pkt6_receive", callback_name_);
+    EXPECT_EQ(0, srv_->fake_sent_.size());
+}
+
 
 // Checks if callouts installed on pkt6_send are indeed called and the
 // all necessary parameters are passed.
@@ -508,6 +508,99 @@ TEST(ParserTest, errors) {
               "\"preferred_lifetime\" in Dhcp6 map.");
 }
 
+// Check that background-commands is a keyword of the control-socket map
+// only.
+TEST(ParserTest, backgroundCommands) {
+    string txt = "{ \"Dhcp6\": { \"control-socket\": {"
+                 " \"socket-type\": \"unix\","
+                 " \"socket-name\": \"/tmp/kea6-ctrl-socket\","
+                 " \"background-commands\": true } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"background-commands\": true } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.14-34: got unexpected keyword "
+              "\"background-commands\" in Dhcp6 map.");
+}
+
+// Check that cache-threshold is a keyword of the subnet map only.
+TEST(ParserTest, cacheThreshold) {
+    string txt = "{ \"Dhcp6\": { \"subnet6\": [ {"
+                 " \"subnet\": \"2001:db8:1::/64\","
+                 " \"cache-threshold\": 0.25 } ] } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"cache-threshold\": 0.25 } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.14-30: got unexpected keyword "
+              "\"cache-threshold\" in Dhcp6 map.");
+}
+
+// Check that response-cache-ttl is a global keyword only.
+TEST(ParserTest, responseCacheTTL) {
+    string txt = "{ \"Dhcp6\": { \"response-cache-ttl\": 500 } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"subnet6\": [ {"
+              " \"response-cache-ttl\": 500 } ] } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.29-48: got unexpected keyword "
+              "\"response-cache-ttl\" in subnet6 map.");
+}
+
+// Check that receive-queue is a global map.
+TEST(ParserTest, receiveQueue) {
+    string txt = "{ \"Dhcp6\": { \"receive-queue\": {"
+                 " \"capacity\": 100, \"drop-policy\": \"drop-oldest\","
+                 " \"max-age\": 2 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"receive-queue\": 100 } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.31-33: syntax error, unexpected integer, "
+              "expecting {");
+}
+
+// Check that rate-limit is a global map.
+TEST(ParserTest, rateLimit) {
+    string txt = "{ \"Dhcp6\": { \"rate-limit\": {"
+                 " \"client-rate\": 10, \"client-burst\": 20,"
+                 " \"relay-rate\": 1000, \"relay-burst\": 2000,"
+                 " \"max-sources\": 1024 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"rate-limit\": 10 } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.28-29: syntax error, unexpected integer, "
+              "expecting {");
+}
+
+// Check that load-threads is a keyword of the lease-database map only.
+TEST(ParserTest, loadThreads) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+                 " \"type\": \"memfile\", \"load-threads\": 4 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"load-threads\": 4 } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.34-47: got unexpected keyword "
+              "\"load-threads\" in hosts-database map.");
+}
+
+// Check that lfc-max-leases is a keyword of the lease-database map only.
+TEST(ParserTest, lfcMaxLeases) {
+    string txt = "{ \"Dhcp6\": { \"lease-database\": {"
+                 " \"type\": \"memfile\", \"lfc-max-leases\": 1000 } } }";
+    testParser(txt, Parser6Context::PARSER_DHCP6);
+
+    testError("{ \"Dhcp6\": { \"hosts-database\": {"
+              " \"lfc-max-leases\": 1000 } } }",
+              Parser6Context::PARSER_DHCP6,
+              "<string>:1.34-49: got unexpected keyword "
+              "\"lfc-max-leases\" in hosts-database map.");
+}
+
 // Check unicode escapes
 TEST(ParserTest, unicodeEscapes) {
     ConstElementPtr result;
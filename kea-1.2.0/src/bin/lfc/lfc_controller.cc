@@ -20,8 +20,11 @@
 #include <log/logger_name.h>
 #include <cfgrpt/config_report.h>
 
+#include <boost/lexical_cast.hpp>
+
 #include <iostream>
 #include <sstream>
+#include <vector>
 #include <unistd.h>
 #include <stdlib.h>
 #include <cerrno>
@@ -51,7 +54,8 @@ const char* LFCController::lfc_bin_name_ = "kea-lfc";
 
 LFCController::LFCController()
     : protocol_version_(0), verbose_(false), config_file_(""), previous_file_(""),
-      copy_file_(""), output_file_(""), finish_file_(""), pid_file_("") {
+      copy_file_(""), output_file_(""), finish_file_(""), pid_file_(""),
+      max_leases_(0) {
 }
 
 LFCController::~LFCController() {
@@ -150,7 +154,7 @@ LFCController::parseArgs(int argc, char* argv[]) {
 
     opterr = 0;
     optind = 1;
-    while ((ch = getopt(argc, argv, ":46dhvVWp:x:i:o:c:f:")) != -1) {
+    while ((ch = getopt(argc, argv, ":46dhvVWp:x:i:o:c:f:m:")) != -1) {
         switch (ch) {
         case '4':
             // Process DHCPv4 lease files.
@@ -230,6 +234,19 @@ LFCController::parseArgs(int argc, char* argv[]) {
             config_file_ = optarg;
             break;
 
+        case 'm':
+            // Maximum number of leases held in memory
+            if (optarg == NULL) {
+                isc_throw(InvalidUsage, "Maximum number of leases missing");
+            }
+            try {
+                max_leases_ = boost::lexical_cast<uint32_t>(optarg);
+            } catch (const boost::bad_lexical_cast&) {
+                isc_throw(InvalidUsage, "Maximum number of leases must be"
+                          " a number: " << optarg);
+            }
+            break;
+
         case 'h':
             usage("");
             exit(EXIT_SUCCESS);
@@ -292,6 +309,7 @@ LFCController::parseArgs(int argc, char* argv[]) {
                   << "Finish file:               " << finish_file_ << std::endl
                   << "Config file:               " << config_file_ << std::endl
                   << "PID file:                  " << pid_file_ << std::endl
+                  << "Maximum leases in memory:  " << max_leases_ << std::endl
                   << std::endl;
     }
 }
@@ -311,6 +329,8 @@ LFCController::usage(const std::string& text) {
               << "   -o <file>: output lease file" << std::endl
               << "   -f <file>: finish file" << std::endl
               << "   -c <file>: configuration file" << std::endl
+              << "   -m <leases>: optional, maximum number of leases held in"
+              << " memory, 0 for no limit" << std::endl
               << "   -v: print version number and exit" << std::endl
               << "   -V: print extended version information and exit" << std::endl
               << "   -d: optional, verbose output " << std::endl
@@ -335,24 +355,57 @@ template<typename LeaseObjectType, typename LeaseFileType, typename StorageType>
 void
 LFCController::processLeases() const {
     StorageType storage;
-
-    // If a previous file exists read the entries into storage
     LeaseFileType lf_prev(getPreviousFile());
-    if (lf_prev.exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(lf_prev, storage,
-                                               MAX_LEASE_ERRORS);
-    }
-
-    // Follow that with the copy of the current lease file
     LeaseFileType lf_copy(getCopyFile());
-    if (lf_copy.exists()) {
-        LeaseFileLoader::load<LeaseObjectType>(lf_copy, storage,
-                                               MAX_LEASE_ERRORS);
-    }
-
-    // Write the result out to the output file
     LeaseFileType lf_output(getOutputFile());
-    LeaseFileLoader::write<LeaseObjectType>(lf_output, storage);
+
+    if (max_leases_ == 0) {
+        // If a previous file exists read the entries into storage
+        if (lf_prev.exists()) {
+            LeaseFileLoader::load<LeaseObjectType>(lf_prev, storage,
+                                                   MAX_LEASE_ERRORS);
+        }
+
+        // Follow that with the copy of the current lease file
+        if (lf_copy.exists()) {
+            LeaseFileLoader::load<LeaseObjectType>(lf_copy, storage,
+                                                   MAX_LEASE_ERRORS);
+        }
+
+        // Write the result out to the output file
+        LeaseFileLoader::write<LeaseObjectType>(lf_output, storage);
+
+    } else {
+        // The same as above, but the leases which don't fit in memory
+        // are written to the sorted runs next to the output file and
+        // merged into it.
+        std::vector<std::string> runs;
+        try {
+            if (lf_prev.exists()) {
+                LeaseFileLoader::loadRuns<LeaseObjectType>(lf_prev, storage,
+                                                           runs,
+                                                           getOutputFile(),
+                                                           max_leases_,
+                                                           MAX_LEASE_ERRORS);
+            }
+
+            if (lf_copy.exists()) {
+                LeaseFileLoader::loadRuns<LeaseObjectType>(lf_copy, storage,
+                                                           runs,
+                                                           getOutputFile(),
+                                                           max_leases_,
+                                                           MAX_LEASE_ERRORS);
+            }
+
+            LeaseFileLoader::writeRuns<LeaseObjectType>(lf_output, storage,
+                                                        runs);
+
+        } catch (...) {
+            LeaseFileLoader::removeRuns(runs);
+            throw;
+        }
+        LeaseFileLoader::removeRuns(runs);
+    }
 
     // If desired log the stats
     LOG_INFO(lfc_logger, LFC_READ_STATS)
@@ -8,6 +8,7 @@
 #define LFC_CONTROLLER_H
 
 #include <exceptions/exceptions.h>
+#include <stdint.h>
 #include <string>
 
 namespace isc {
@@ -149,6 +150,13 @@ public:
     std::string getPidFile() const {
         return (pid_file_);
     }
+
+    /// @brief Gets the maximum number of leases held in memory
+    ///
+    /// @return Returns the maximum number of leases, 0 if not limited
+    uint32_t getMaxLeases() const {
+        return (max_leases_);
+    }
     //@}
 
 private:
@@ -162,6 +170,7 @@ private:
     std::string output_file_;   ///< The path to the output file
     std::string finish_file_;   ///< The path to the finished output file
     std::string pid_file_;      ///< The path to the pid file
+    uint32_t max_leases_;       ///< The maximum number of leases in memory
 
     /// @brief Prints the program usage text to std error.
     ///
@@ -181,6 +190,11 @@ private:
     /// write the results out to the output file.  Upon completion of
     /// the write move the file to the finish file.
     ///
+    /// When the maximum number of leases held in memory is set, the
+    /// leases exceeding it are written to the temporary files next to
+    /// the output file, which are merged into the output file and
+    /// removed.
+    ///
     /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
     /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
     /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
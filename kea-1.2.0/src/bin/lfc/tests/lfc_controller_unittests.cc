@@ -143,6 +143,7 @@ TEST_F(LFCControllerTest, initialValues) {
     EXPECT_TRUE(lfc_controller.getOutputFile().empty());
     EXPECT_TRUE(lfc_controller.getFinishFile().empty());
     EXPECT_TRUE(lfc_controller.getPidFile().empty());
+    EXPECT_EQ(lfc_controller.getMaxLeases(), 0);
 }
 
 /// @todo verify that parsing -v/V/W/h works well without ASSERT_EXIT
@@ -182,6 +183,36 @@ TEST_F(LFCControllerTest, fullCommandLine) {
     EXPECT_EQ(lfc_controller.getPidFile(), "pid");
 }
 
+/// @brief Verify that the maximum number of leases held in memory
+/// can be specified and that it must be a number.
+TEST_F(LFCControllerTest, maxLeasesCommandLine) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>("previous"),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>("copy"),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>("output"),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>("config"),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>("finish"),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>("pid"),
+                     const_cast<char*>("-m"),
+                     const_cast<char*>("1000") };
+    int argc = 16;
+
+    ASSERT_NO_THROW(lfc_controller.parseArgs(argc, argv));
+    EXPECT_EQ(lfc_controller.getMaxLeases(), 1000);
+
+    argv[15] = const_cast<char*>("many");
+    EXPECT_THROW(lfc_controller.parseArgs(argc, argv), InvalidUsage);
+}
+
 /// @brief Verify that parsing a correct but incomplete line fails.
 /// Parse a command line that is correctly formatted but isn't complete
 /// (doesn't include some options or an some option arguments).  We
@@ -512,6 +543,94 @@ TEST_F(LFCControllerTest, launch4) {
     EXPECT_TRUE(noExistIOFP());
 }
 
+/// @brief Verify that the files are combined the same way when the
+/// leases don't fit in memory.
+///
+/// The leases are written to the temporary files which are merged
+/// into the output file. This is checked with one and two leases
+/// held in memory, so as the most recent entries and the expired
+/// leases are found across the temporary files.
+TEST_F(LFCControllerTest, launch4MaxLeases) {
+    LFCController lfc_controller;
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-4"),
+                     const_cast<char*>("-x"),
+                     const_cast<char*>(xstr_.c_str()),
+                     const_cast<char*>("-i"),
+                     const_cast<char*>(istr_.c_str()),
+                     const_cast<char*>("-o"),
+                     const_cast<char*>(ostr_.c_str()),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(cstr_.c_str()),
+                     const_cast<char*>("-f"),
+                     const_cast<char*>(fstr_.c_str()),
+                     const_cast<char*>("-p"),
+                     const_cast<char*>(pstr_.c_str()),
+                     const_cast<char*>("-m"),
+                     const_cast<char*>("1"),
+                     const_cast<char*>("-d")
+    };
+    int argc = 16;
+    string test_str;
+
+    // The same leases as in the launch4 test.
+    string a_1 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,200,8,1,1,host.example.com,1\n";
+    string a_2 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,500,8,1,1,host.example.com,1\n";
+    string a_3 = "192.0.2.1,06:07:08:09:0a:bc,,"
+                 "200,800,8,1,1,host.example.com,1\n";
+
+    string b_1 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,100,7,0,0,,1\n";
+    string b_2 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,135,7,0,0,,1\n";
+    string b_3 = "192.0.3.15,dd:de:ba:0d:1b:2e:3e:4f,0a:00:01:04,"
+                 "100,150,7,0,0,,1\n";
+
+    string c_1 = "192.0.2.3,,a:11:01:04,"
+                 "200,200,8,1,1,host.example.com,0\n";
+
+    string d_1 = "192.0.2.5,16:17:18:19:1a:bc,,"
+                 "200,200,8,1,1,host.example.com,1\n";
+    string d_2 = "192.0.2.5,16:17:18:19:1a:bc,,"
+                 "0,200,8,1,1,host.example.com,1\n";
+
+    const char* max_leases[] = { "1", "2" };
+    for (int i = 0; i < 2; ++i) {
+        SCOPED_TRACE(max_leases[i]);
+        argv[15] = const_cast<char*>(max_leases[i]);
+
+        // Both previous and copy available, the lease D expired in
+        // the copy file is removed from the temporary file.
+        test_str = v4_hdr_ + a_1 + b_1 + c_1 + b_2 + a_2 + d_1;
+        writeFile(xstr_, test_str);
+        test_str = v4_hdr_ + a_3 + b_3 + d_2;
+        writeFile(istr_, test_str);
+
+        launch(lfc_controller, argc, argv);
+
+        test_str = v4_hdr_ + a_3 + b_3;
+        EXPECT_EQ(readFile(xstr_), test_str);
+        EXPECT_TRUE(noExistIOFP());
+        EXPECT_TRUE(noExist(ostr_ + ".run1"));
+        removeTestFile();
+
+        // Only previous available.
+        test_str = v4_hdr_ + a_1 + b_1 + c_1 + b_2 + a_2 + d_1;
+        writeFile(xstr_, test_str);
+
+        launch(lfc_controller, argc, argv);
+
+        test_str = v4_hdr_ + a_2 + d_1 + b_2;
+        EXPECT_EQ(readFile(xstr_), test_str);
+        EXPECT_TRUE(noExistIOFP());
+        EXPECT_TRUE(noExist(ostr_ + ".run1"));
+        removeTestFile();
+    }
+}
+
 /// @brief Verify that we properly combine and clean up files
 ///
 /// This is mostly a retest as we already test that the loader and
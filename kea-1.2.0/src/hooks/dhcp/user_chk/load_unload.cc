@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,6 +26,12 @@ UserRegistryPtr user_registry;
 /// @brief Output filestream for recording user check outcomes.
 std::fstream user_chk_output;
 
+/// @brief Size of the buffer of the user check outcome file.
+const size_t USER_CHK_OUTPUT_BUFFER_SIZE = 65536;
+
+/// @brief Buffer of the user check outcome file.
+char user_chk_output_buffer[USER_CHK_OUTPUT_BUFFER_SIZE];
+
 /// @brief User registry input file name.
 /// @todo Hard-coded for now, this should be configurable.
 const char* registry_fname = "/tmp/user_chk_registry.txt";
@@ -34,12 +40,6 @@ const char* registry_fname = "/tmp/user_chk_registry.txt";
 /// @todo Hard-coded for now, this should be configurable.
 const char* user_chk_output_fname = "/tmp/user_chk_outcome.txt";
 
-/// @brief Text label of user id in the inbound query in callout context
-const char* query_user_id_label = "query_user_id";
-
-/// @brief Text label of registered user pointer in callout context
-const char* registered_user_label = "registered_user";
-
 /// @brief Text id used to identify the default IPv4 user in the registry
 /// The format is a string containing an even number of hex digits.  This
 /// value is to look up the default IPv4 user in the user registry for the
@@ -83,7 +83,10 @@ int load(LibraryHandle&) {
         // zero out the errno to be safe
         errno = 0;
 
-        // Open up the output file for user_chk results.
+        // Open up the output file for user_chk results.  The records are
+        // written through a large buffer, which must be set before opening.
+        user_chk_output.rdbuf()->pubsetbuf(user_chk_output_buffer,
+                                           sizeof(user_chk_output_buffer));
         user_chk_output.open(user_chk_output_fname,
                      std::fstream::out | std::fstream::app);
 
@@ -107,7 +110,8 @@ int load(LibraryHandle&) {
 
 /// @brief Called by the Hooks library manager when the library is unloaded.
 ///
-/// Destroys the UserRegistry and closes the outcome file.
+/// Destroys the UserRegistry and closes the outcome file, which writes
+/// the buffered outcome records.
 ///
 /// @return Always returns 0.
 int unload() {
@@ -28,11 +28,11 @@ extern "C" {
 /// This function determines if the DHCP client identified by the inbound
 /// DHCP query packet is in the user registry.
 /// Upon entry, the registry is refreshed. Next the hardware address is
-/// extracted from query and saved to the context as the "query_user_id".
+/// extracted from query and saved to the context slot QUERY_USER_ID_SLOT.
 /// This id is then used to search the user registry.  The resultant UserPtr
-/// whether the user is found or not, is saved to the callout context as
-/// "registered_user".   This makes the registered user, if not null, available
-/// to subsequent callouts.
+/// whether the user is found or not, is saved to the callout context slot
+/// REGISTERED_USER_SLOT.   This makes the registered user, if not null,
+/// available to subsequent callouts.
 ///
 /// @param handle CalloutHandle which provides access to context.
 ///
@@ -54,14 +54,14 @@ int pkt4_receive(CalloutHandle& handle) {
         HWAddrPtr hwaddr = query->getHWAddr();
 
         // Store the id we search with so it is available down the road.
-        handle.setContext(query_user_id_label, hwaddr);
+        handle.setContextSlot(QUERY_USER_ID_SLOT, hwaddr);
 
         // Look for the user in the registry.
         UserPtr registered_user = user_registry->findUser(*hwaddr);
 
         // Store user regardless. Empty user pointer means non-found. It is
         // cheaper to fetch it and test it, than to use an exception throw.
-        handle.setContext(registered_user_label, registered_user);
+        handle.setContextSlot(REGISTERED_USER_SLOT, registered_user);
         std::cout << "DHCP UserCheckHook : pkt4_receive user : "
                   << hwaddr->toText() << " is "
                   << (registered_user ? " registered" : " not registered")
@@ -80,9 +80,9 @@ int pkt4_receive(CalloutHandle& handle) {
 /// This function determines if the DHCP client identified by the inbound
 /// DHCP query packet is in the user registry.
 /// Upon entry, the registry is refreshed. Next the DUID is extracted from
-/// query and saved to the context as the "query_user_id". This id is then
+/// query and saved to the context slot QUERY_USER_ID_SLOT. This id is then
 /// used to search the user registry.  The resultant UserPtr whether the user
-/// is found or not, is saved to the callout context as "registered_user".
+/// is found or not, is saved to the callout context slot REGISTERED_USER_SLOT.
 /// This makes the registered user, if not null, available to subsequent
 /// callouts.
 ///
@@ -113,14 +113,14 @@ int pkt6_receive(CalloutHandle& handle) {
         DuidPtr duid = DuidPtr(new DUID(opt_duid->getData()));
 
         // Store the id we search with so it is available down the road.
-        handle.setContext(query_user_id_label, duid);
+        handle.setContextSlot(QUERY_USER_ID_SLOT, duid);
 
         // Look for the user in the registry.
         UserPtr registered_user = user_registry->findUser(*duid);
 
         // Store user regardless. Empty user pointer means non-found. It is
         // cheaper to fetch it and test it, than to use an exception throw.
-        handle.setContext(registered_user_label, registered_user);
+        handle.setContextSlot(REGISTERED_USER_SLOT, registered_user);
         std::cout << "DHCP UserCheckHook : pkt6_receive user : "
                   << duid->toText() << " is "
                   << (registered_user ? " registered" : " not registered")
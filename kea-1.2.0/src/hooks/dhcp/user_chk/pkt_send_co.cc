@@ -40,8 +40,8 @@ void add4Options(Pkt4Ptr& response, const UserPtr& user);
 void add4Option(Pkt4Ptr& response, uint8_t opt_code, std::string& opt_value);
 void add6Options(Pkt6Ptr& response, const UserPtr& user);
 void add6Option(OptionPtr& vendor, uint8_t opt_code, std::string& opt_value);
-const UserPtr& getDefaultUser4();
-const UserPtr& getDefaultUser6();
+UserPtr getDefaultUser4();
+UserPtr getDefaultUser6();
 
 // Functions accessed by the hooks framework use C linkage to avoid the name
 // mangling that accompanies use of the C++ compiler as well as to avoid
@@ -81,11 +81,11 @@ int pkt4_send(CalloutHandle& handle) {
 
         // Get the user id saved from the query packet.
         HWAddrPtr hwaddr;
-        handle.getContext(query_user_id_label, hwaddr);
+        handle.getContextSlot(QUERY_USER_ID_SLOT, hwaddr);
 
         // Get registered_user pointer.
         UserPtr registered_user;
-        handle.getContext(registered_user_label, registered_user);
+        handle.getContextSlot(REGISTERED_USER_SLOT, registered_user);
 
         // Fetch the lease address.
         isc::asiolink::IOAddress addr = response->getYiaddr();
@@ -153,11 +153,11 @@ int pkt6_send(CalloutHandle& handle) {
 
         // Get the user id saved from the query packet.
         DuidPtr duid;
-        handle.getContext(query_user_id_label, duid);
+        handle.getContextSlot(QUERY_USER_ID_SLOT, duid);
 
         // Get registered_user pointer.
         UserPtr registered_user;
-        handle.getContext(registered_user_label, registered_user);
+        handle.getContextSlot(REGISTERED_USER_SLOT, registered_user);
 
         if (registered_user) {
             // add options based on user
@@ -357,16 +357,13 @@ void generate_output_record(const std::string& id_type_str,
                             const std::string& addr_str,
                             const bool& registered)
 {
-    user_chk_output << "id_type=" << id_type_str << std::endl
-                    << "client=" << id_val_str << std::endl
-                    << "addr=" << addr_str << std::endl
-                    << "registered=" << (registered ? "yes" : "no")
-                    << std::endl
-                    << std::endl;   // extra line in between
-
-    // @todo Flush is here to ensure output is immediate for demo purposes.
-    // Performance would generally dictate not using it.
-    flush(user_chk_output);
+    // The stream is not flushed for each record: the output is buffered
+    // and written when the buffer is full or the file is closed on unload.
+    user_chk_output << "id_type=" << id_type_str << "\n"
+                    << "client=" << id_val_str << "\n"
+                    << "addr=" << addr_str << "\n"
+                    << "registered=" << (registered ? "yes" : "no") << "\n"
+                    << "\n";   // extra line in between
 }
 
 /// @brief Stringify the lease address or prefix IPv6 response packet
@@ -517,7 +514,7 @@ bool checkIAStatus(boost::shared_ptr<Option6IA>& ia) {
 /// The default user may be used to provide default property values.
 ///
 /// @return A pointer to the IPv4 user or null if not defined.
-const UserPtr& getDefaultUser4() {
+UserPtr getDefaultUser4() {
    return (user_registry->findUser(UserId(UserId::HW_ADDRESS,
                                           default_user4_id_str)));
 }
@@ -527,7 +524,7 @@ const UserPtr& getDefaultUser4() {
 /// The default user may be used to provide default property values.
 ///
 /// @return A pointer to the IPv6 user or null if not defined.
-const UserPtr& getDefaultUser6() {
+UserPtr getDefaultUser6() {
    return (user_registry->findUser(UserId(UserId::DUID,
                                           default_user6_id_str)));
 }
@@ -57,7 +57,7 @@ int subnet4_select(CalloutHandle& handle) {
 
         // Get registered_user pointer.
         UserPtr registered_user;
-        handle.getContext(registered_user_label, registered_user);
+        handle.getContextSlot(REGISTERED_USER_SLOT, registered_user);
 
         if (registered_user) {
             // User is in the registry, so leave the pre-selected subnet alone.
@@ -111,7 +111,7 @@ int subnet6_select(CalloutHandle& handle) {
 
         // Get registered_user pointer.
         UserPtr registered_user;
-        handle.getContext(registered_user_label, registered_user);
+        handle.getContextSlot(REGISTERED_USER_SLOT, registered_user);
 
         if (registered_user) {
             // User is in the registry, so leave the pre-selected subnet alone.
@@ -13,6 +13,9 @@
 #include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <stdio.h>
+
 using namespace std;
 using namespace user_chk;
 
@@ -160,4 +163,70 @@ TEST(UserFile, readFile) {
     ASSERT_NO_THROW(user_file->close());
 }
 
+/// @brief Writes a line to a test file.
+///
+/// @param name path of the file
+/// @param line text of the line, without the newline
+/// @param mode open mode of the file, truncate or append
+void writeLine(const std::string& name, const std::string& line,
+               std::ios_base::openmode mode) {
+    std::ofstream file(name.c_str(), std::ofstream::out | mode);
+    file << line << "\n";
+}
+
+/// @brief Tests reporting and reading the changes of the file.
+TEST(UserFile, fileChanges) {
+    std::string name = testFilePath("test_users_tmp.txt");
+    writeLine(name, "{ \"type\" : \"HW_ADDR\", \"id\" : \"01AC00F03344\" }",
+              std::ofstream::trunc);
+
+    UserFilePtr user_file;
+    ASSERT_NO_THROW(user_file.reset(new UserFile(name)));
+
+    // The file was not read, so it must be read from the beginning.
+    EXPECT_EQ(UserDataSource::MODIFIED, user_file->getChange());
+    EXPECT_THROW(user_file->openAppended(), UserFileError);
+
+    // Read the file to the end.
+    ASSERT_NO_THROW(user_file->open());
+    UserPtr user;
+    ASSERT_NO_THROW(user = user_file->readNextUser());
+    ASSERT_TRUE(user);
+    ASSERT_NO_THROW(user = user_file->readNextUser());
+    EXPECT_FALSE(user);
+    user_file->close();
+    EXPECT_EQ(UserDataSource::UNCHANGED, user_file->getChange());
+
+    // Append a user.
+    writeLine(name, "{ \"type\" : \"DUID\", \"id\" : \"225060de0a0b\" }",
+              std::ofstream::app);
+    EXPECT_EQ(UserDataSource::APPENDED, user_file->getChange());
+
+    // Verify only the appended user is read.
+    ASSERT_NO_THROW(user_file->openAppended());
+    ASSERT_NO_THROW(user = user_file->readNextUser());
+    ASSERT_TRUE(user);
+    EXPECT_EQ(UserId::DUID, user->getUserId().getType());
+    ASSERT_NO_THROW(user = user_file->readNextUser());
+    EXPECT_FALSE(user);
+    user_file->close();
+    EXPECT_EQ(UserDataSource::UNCHANGED, user_file->getChange());
+
+    // Rewrite the file with a different first line: it is not an append.
+    writeLine(name, "{ \"type\" : \"HW_ADDR\", \"id\" : \"01AC00F03345\" }\n"
+              "{ \"type\" : \"DUID\", \"id\" : \"225060de0a0c\" }\n"
+              "{ \"type\" : \"DUID\", \"id\" : \"225060de0a0d\" }",
+              std::ofstream::trunc);
+    EXPECT_EQ(UserDataSource::MODIFIED, user_file->getChange());
+
+    // Shrink the file.
+    writeLine(name, "{ \"type\" : \"DUID\", \"id\" : \"225060de0a0b\" }",
+              std::ofstream::trunc);
+    EXPECT_EQ(UserDataSource::MODIFIED, user_file->getChange());
+
+    // Remove the file.
+    remove(name.c_str());
+    EXPECT_EQ(UserDataSource::MODIFIED, user_file->getChange());
+}
+
 } // end of anonymous namespace
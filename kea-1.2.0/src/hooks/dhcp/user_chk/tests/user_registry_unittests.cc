@@ -15,6 +15,9 @@
 #include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 
+#include <fstream>
+#include <stdio.h>
+
 using namespace std;
 using namespace user_chk;
 
@@ -206,4 +209,77 @@ TEST(UserRegistry, refreshFail) {
     EXPECT_TRUE(reg->findUser(*id2));
 }
 
+/// @brief Tests refreshing the registry from a changing file.
+TEST(UserRegistry, refreshChanges) {
+    std::string name = testFilePath("test_users_tmp.txt");
+    {
+        std::ofstream file(name.c_str(), std::ofstream::trunc);
+        file << "{ \"type\" : \"HW_ADDR\", \"id\" : \"01AC00F03344\" }\n"
+             << "{ \"type\" : \"DUID\", \"id\" : \"225060de0a0b\" }\n";
+    }
+
+    // Load the registry from the file.
+    UserRegistryPtr reg(new UserRegistry());
+    UserDataSourcePtr user_file(new UserFile(name));
+    ASSERT_NO_THROW(reg->setSource(user_file));
+    ASSERT_NO_THROW(reg->refresh());
+    EXPECT_EQ(2, reg->size());
+
+    // Refreshing with the file unchanged keeps the registry.
+    ASSERT_NO_THROW(reg->refresh());
+    EXPECT_EQ(2, reg->size());
+
+    // Append a user and verify it is added.
+    {
+        std::ofstream file(name.c_str(), std::ofstream::app);
+        file << "{ \"type\" : \"DUID\", \"id\" : \"225060de0a0c\" }\n";
+    }
+    ASSERT_NO_THROW(reg->refresh());
+    EXPECT_EQ(3, reg->size());
+    EXPECT_TRUE(reg->findUser(UserId(UserId::HW_ADDRESS, "01ac00f03344")));
+    EXPECT_TRUE(reg->findUser(UserId(UserId::DUID, "225060de0a0c")));
+
+    // Users added to the registry are dropped by the next refresh.
+    UserPtr user(new User(UserId::DUID, "225060de0a0d"));
+    ASSERT_NO_THROW(reg->addUser(user));
+    EXPECT_EQ(4, reg->size());
+    ASSERT_NO_THROW(reg->refresh());
+    EXPECT_EQ(3, reg->size());
+    EXPECT_FALSE(reg->findUser(user->getUserId()));
+
+    // Append a duplicate user, the registry must be preserved.
+    {
+        std::ofstream file(name.c_str(), std::ofstream::app);
+        file << "{ \"type\" : \"DUID\", \"id\" : \"225060de0a0c\" }\n";
+    }
+    EXPECT_THROW(reg->refresh(), UserRegistryError);
+    EXPECT_EQ(3, reg->size());
+    EXPECT_TRUE(reg->findUser(UserId(UserId::DUID, "225060de0a0c")));
+
+    // Rewrite the file and verify the registry is reloaded.
+    {
+        std::ofstream file(name.c_str(), std::ofstream::trunc);
+        file << "{ \"type\" : \"HW_ADDR\", \"id\" : \"01AC00F03345\" }\n";
+    }
+    ASSERT_NO_THROW(reg->refresh());
+    EXPECT_EQ(1, reg->size());
+    EXPECT_TRUE(reg->findUser(UserId(UserId::HW_ADDRESS, "01ac00f03345")));
+
+    remove(name.c_str());
+}
+
+/// @brief Tests that a lookup result outlives the registry update.
+TEST(UserRegistry, findUserAfterUpdate) {
+    UserRegistryPtr reg(new UserRegistry());
+    UserPtr user(new User(UserId::HW_ADDRESS, "01010101"));
+    ASSERT_NO_THROW(reg->addUser(user));
+
+    UserPtr found_user = reg->findUser(user->getUserId());
+    ASSERT_TRUE(found_user);
+    ASSERT_NO_THROW(reg->clearall());
+    EXPECT_EQ(0, reg->size());
+    EXPECT_FALSE(reg->findUser(user->getUserId()));
+    EXPECT_EQ(user->getUserId(), found_user->getUserId());
+}
+
 } // end of anonymous namespace
@@ -9,6 +9,8 @@
 #include <exceptions/exceptions.h>
 #include <util/encode/hex.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <user.h>
 
 #include <iomanip>
@@ -149,6 +151,14 @@ operator<<(std::ostream& os, const UserId& user_id) {
     return (os);
 }
 
+std::size_t
+hash_value(const UserId& user_id) {
+    const std::vector<uint8_t>& id = user_id.getId();
+    std::size_t seed = boost::hash_range(id.begin(), id.end());
+    boost::hash_combine(seed, static_cast<int>(user_id.getType()));
+    return (seed);
+}
+
 //********************************* User ******************************
 
 User::User(const UserId& user_id) : user_id_(user_id) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <cstddef>
 #include <map>
 #include <stdint.h>
 #include <vector>
@@ -138,6 +139,17 @@ private:
 std::ostream&
 operator<<(std::ostream& os, const UserId& user_id);
 
+/// @brief Computes the hash of a UserId.
+///
+/// It allows UserIds to be used as keys of the hashed containers such as
+/// boost::unordered_map.
+///
+/// @param user_id UserId to hash
+///
+/// @return Hash of the id type and of the id value.
+std::size_t
+hash_value(const UserId& user_id);
+
 /// @brief Defines a smart pointer to UserId
 typedef boost::shared_ptr<UserId> UserIdPtr;
 
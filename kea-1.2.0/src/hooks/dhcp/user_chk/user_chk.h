@@ -25,11 +25,13 @@ extern const char* registry_fname;
 /// @brief User check outcome file name.
 extern const char* user_chk_output_fname;
 
-/// @brief Text label of user id in the inbound query in callout context
-extern const char* query_user_id_label;
-
-/// @brief Text label of registered user pointer in callout context
-extern const char* registered_user_label;
+/// @brief Slots of the callout context used by the library.
+enum UserChkContextSlot {
+    /// @brief User id in the inbound query
+    QUERY_USER_ID_SLOT,
+    /// @brief Registered user pointer, null if the user is not registered
+    REGISTERED_USER_SLOT
+};
 
 /// @brief Text id used to identify the default IPv4 user in the registry
 extern const char* default_user4_id_str;
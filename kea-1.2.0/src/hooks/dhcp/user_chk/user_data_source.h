@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -25,6 +25,16 @@ public:
 /// from an IO source such as a file.
 class UserDataSource {
 public:
+    /// @brief Defines the changes of the content since it was last read.
+    enum Change {
+        /// @brief The content is the same, there is nothing to read.
+        UNCHANGED,
+        /// @brief Users were added after the content last read.
+        APPENDED,
+        /// @brief The content must be read again from the beginning.
+        MODIFIED
+    };
+
     /// @brief Constructor.
     UserDataSource() {};
 
@@ -61,6 +71,30 @@ public:
     ///
     /// It is assumed to be exception safe.
     virtual bool isOpen() const = 0;
+
+    /// @brief Returns the changes of the content since it was last read.
+    ///
+    /// The content was last read when @c readNextUser returned an empty
+    /// user.  This allows the registry to skip reading a source which did
+    /// not change, or to read only the users added since.  Data sources
+    /// which cannot tell always return MODIFIED, which is the default.
+    ///
+    /// This method must not throw exceptions.
+    virtual Change getChange() const {
+        return (MODIFIED);
+    }
+
+    /// @brief Opens the data source after the content last read.
+    ///
+    /// Prepares the data source for reading the users added since the
+    /// content was last read, i.e. when @c getChange returns APPENDED.
+    ///
+    /// @throw UserDataSourceError if the source fails to open or it cannot
+    /// be read incrementally, which is the default.
+    virtual void openAppended() {
+        isc_throw(UserDataSourceError,
+                  "data source cannot be read incrementally");
+    }
 };
 
 /// @brief Defines a smart pointer to a UserDataSource.
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,12 +9,16 @@
 #include <user_file.h>
 
 #include <boost/foreach.hpp>
+#include <sys/stat.h>
 #include <errno.h>
+#include <cstring>
 #include <iostream>
 
 namespace user_chk {
 
-UserFile::UserFile(const std::string& fname) : fname_(fname), file_() {
+UserFile::UserFile(const std::string& fname)
+    : fname_(fname), file_(), position_(0), last_line_(), read_(false),
+      read_size_(0), read_inode_(0), read_mtime_(0), read_last_line_() {
     if (fname_.empty()) {
         isc_throw(UserFileError, "file name cannot be blank");
     }
@@ -36,6 +40,59 @@ UserFile::open() {
         isc_throw(UserFileError, "cannot open file:" << fname_
                                  << " reason: " << strerror(sav_error));
     }
+
+    position_ = 0;
+    last_line_.clear();
+}
+
+void
+UserFile::openAppended() {
+    if (!read_) {
+        isc_throw(UserFileError, "cannot read appended lines, file: "
+                  << fname_ << " was not read");
+    }
+
+    open();
+    file_.seekg(read_size_);
+    if (!file_.good()) {
+        close();
+        isc_throw(UserFileError, "cannot seek to the appended lines of file:"
+                  << fname_);
+    }
+
+    position_ = read_size_;
+    last_line_ = read_last_line_;
+}
+
+UserDataSource::Change
+UserFile::getChange() const {
+    struct stat st;
+    if (!read_ || (stat(fname_.c_str(), &st) != 0) ||
+        (st.st_ino != read_inode_) || (st.st_size < read_size_)) {
+        return (MODIFIED);
+    }
+
+    if (st.st_size == read_size_) {
+        return (st.st_mtime == read_mtime_ ? UNCHANGED : MODIFIED);
+    }
+
+    // The file grew. The new lines can be read alone only if the content
+    // last read is still in place and ended with a complete line.
+    if (!read_last_line_.empty()) {
+        if (read_last_line_[read_last_line_.size() - 1] != '\n') {
+            return (MODIFIED);
+        }
+
+        std::ifstream file(fname_.c_str(), std::ifstream::in);
+        std::string line(read_last_line_.size(), '\0');
+        file.seekg(read_size_ - read_last_line_.size());
+        file.read(&line[0], line.size());
+        if (!file || (line != read_last_line_)) {
+            return (MODIFIED);
+        }
+    }
+
+    return (APPENDED);
 }
 
 UserPtr
@@ -51,11 +108,32 @@ UserFile::readNextUser() {
         file_.getline(buf, sizeof(buf));
 
         // We got something, try to make a user out of it.
-        if (file_.gcount() > 0) {
+        size_t count = file_.gcount();
+        if (count > 0) {
+            // The count includes the newline when it was extracted.
+            position_ += count;
+            last_line_.assign(buf);
+            if (count > last_line_.size()) {
+                last_line_.push_back('\n');
+            }
+
             return(makeUser(buf));
         }
     }
 
+    // The whole file was read: remember what it looked like so that it is
+    // not read again until it changes.
+    struct stat st;
+    if (stat(fname_.c_str(), &st) == 0) {
+        read_ = true;
+        read_size_ = position_;
+        read_inode_ = st.st_ino;
+        read_mtime_ = st.st_mtime;
+        read_last_line_ = last_line_;
+    } else {
+        read_ = false;
+    }
+
     // Returns an empty user on EOF.
     return (UserPtr());
 }
@@ -12,6 +12,7 @@
 #include <user.h>
 
 #include <boost/shared_ptr.hpp>
+#include <sys/types.h>
 #include <fstream>
 #include <string>
 
@@ -55,6 +56,14 @@ public:
 /// { "type" : "DUID", "id" : "225060de0a0b", "opt1" : "false" }
 ///
 /// @endcode
+///
+/// The file is usually updated by appending entries.  The size, inode and
+/// modification time of the file are recorded when it has been read to the
+/// end, so that an unchanged file is not read again and only the lines
+/// appended since are read when the file grew.  As the modification time
+/// has a resolution of one second, a file rewritten in place with the same
+/// size within the second it was read is not seen as changed: the file
+/// should rather be replaced, e.g. renamed over.
 class UserFile : public UserDataSource {
 public:
     /// @brief Maximum length of a single user entry.
@@ -104,6 +113,23 @@ public:
     /// @return True if the underlying file is open, false otherwise.
     virtual bool isOpen() const;
 
+    /// @brief Returns the changes of the file since it was last read.
+    ///
+    /// The file is seen as APPENDED when it grew and the last line read is
+    /// still in place, and as MODIFIED when it was replaced, shrank or its
+    /// modification time changed.
+    ///
+    /// @return The changes of the file since it was last read.
+    virtual Change getChange() const;
+
+    /// @brief Opens the input file for reading the appended lines.
+    ///
+    /// Upon successful completion, the file is opened and positioned after
+    /// the content last read.
+    ///
+    /// @throw UserFileError if the file cannot be opened.
+    virtual void openAppended();
+
     /// @brief Creates a new User instance from JSON text.
     ///
     /// @param user_string string the JSON text for a user entry.
@@ -120,6 +146,26 @@ private:
     /// @brief Input file stream.
     std::ifstream file_;
 
+    /// @brief Position in the file of the next line to read.
+    off_t position_;
+
+    /// @brief Last line read from the file, including its newline.
+    std::string last_line_;
+
+    /// @brief True if the file was read to the end.
+    bool read_;
+
+    /// @brief Size of the file content last read.
+    off_t read_size_;
+
+    /// @brief Inode of the file last read.
+    ino_t read_inode_;
+
+    /// @brief Modification time of the file last read.
+    time_t read_mtime_;
+
+    /// @brief Last line of the file content last read.
+    std::string read_last_line_;
 };
 
 /// @brief Defines a smart pointer to a UserFile.
@@ -9,7 +9,8 @@
 
 namespace user_chk {
 
-UserRegistry::UserRegistry() {
+UserRegistry::UserRegistry()
+    : users_(UserMapPtr(new UserMap())), source_(), synced_(false) {
 }
 
 UserRegistry::~UserRegistry(){
@@ -17,47 +18,56 @@ UserRegistry::~UserRegistry(){
 
 void
 UserRegistry::addUser(UserPtr& user) {
+    // Add the user to a copy of the list so that lookups in progress
+    // are not affected.
+    boost::shared_ptr<UserMap> users(new UserMap(*users_.get()));
+    addUser(*users, user);
+    users_.set(users);
+    synced_ = false;
+}
+
+void
+UserRegistry::addUser(UserMap& users, const UserPtr& user) {
     if (!user) {
         isc_throw (UserRegistryError, "UserRegistry cannot add blank user");
     }
 
-    UserPtr found_user;
-    if ((found_user = findUser(user->getUserId()))) {
+    if (!users.insert(std::make_pair(user->getUserId(), user)).second) {
         isc_throw (UserRegistryError, "UserRegistry duplicate user: "
                    << user->getUserId());
     }
-
-    users_[user->getUserId()] = user;
 }
 
-const UserPtr&
+UserPtr
 UserRegistry::findUser(const UserId& id) const {
-    static UserPtr empty;
-    UserMap::const_iterator it = users_.find(id);
-    if (it != users_.end()) {
-        const UserPtr tmp = (*it).second;
+    // Hold the list while searching it, it may be replaced meanwhile.
+    UserMapPtr users = users_.get();
+    UserMap::const_iterator it = users->find(id);
+    if (it != users->end()) {
         return ((*it).second);
     }
 
-    return empty;
+    return (UserPtr());
 }
 
 void
 UserRegistry::removeUser(const UserId& id) {
-    static UserPtr empty;
-    UserMap::iterator it = users_.find(id);
-    if (it != users_.end()) {
-        users_.erase(it);
+    UserMapPtr current = users_.get();
+    if (current->find(id) != current->end()) {
+        boost::shared_ptr<UserMap> users(new UserMap(*current));
+        users->erase(id);
+        users_.set(users);
+        synced_ = false;
     }
 }
 
-const UserPtr&
+UserPtr
 UserRegistry::findUser(const isc::dhcp::HWAddr& hwaddr) const {
     UserId id(UserId::HW_ADDRESS, hwaddr.hwaddr_);
     return (findUser(id));
 }
 
-const UserPtr&
+UserPtr
 UserRegistry::findUser(const isc::dhcp::DUID& duid) const {
     UserId id(UserId::DUID, duid.getDuid());
     return (findUser(id));
@@ -69,24 +79,35 @@ void UserRegistry::refresh() {
                   "UserRegistry: cannot refresh, no data source");
     }
 
+    // Content changed since read by the registry must be read again.
+    UserDataSource::Change change = (synced_ ? source_->getChange()
+                                     : UserDataSource::MODIFIED);
+    if (change == UserDataSource::UNCHANGED) {
+        return;
+    }
+
     // If the source isn't open, open it.
     if (!source_->isOpen()) {
-        source_->open();
+        if (change == UserDataSource::APPENDED) {
+            source_->openAppended();
+        } else {
+            source_->open();
+        }
     }
 
-    // Make a copy in case something goes wrong midstream.
-    UserMap backup(users_);
-
-    // Empty the registry then read users from source until source is empty.
-    clearall();
+    // The new list is built aside, the current one is kept in case
+    // something goes wrong midstream.
+    boost::shared_ptr<UserMap> users(change == UserDataSource::APPENDED ?
+                                     new UserMap(*users_.get()) :
+                                     new UserMap());
     try {
+        // Read users from source until source is empty.
         UserPtr user;
         while ((user = source_->readNextUser())) {
-            addUser(user);
+            addUser(*users, user);
         }
     } catch (const std::exception& ex) {
-        // Source was compromised so restore registry from backup.
-        users_ = backup;
+        // Source was compromised so keep the current registry.
         // Close the source.
         source_->close();
         isc_throw (UserRegistryError, "UserRegistry: refresh failed during read"
@@ -95,10 +116,18 @@ void UserRegistry::refresh() {
 
     // Close the source.
     source_->close();
+
+    users_.set(users);
+    synced_ = true;
 }
 
 void UserRegistry::clearall() {
-    users_.clear();
+    users_.set(UserMapPtr(new UserMap()));
+    synced_ = false;
+}
+
+size_t UserRegistry::size() const {
+    return (users_.get()->size());
 }
 
 void UserRegistry::setSource(UserDataSourcePtr& source) {
@@ -108,6 +137,7 @@ void UserRegistry::setSource(UserDataSourcePtr& source) {
     }
 
     source_ = source;
+    synced_ = false;
 }
 
 const UserDataSourcePtr& UserRegistry::getSource() {
@@ -1,4 +1,4 @@
-// Copyright (C) 2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,9 +11,13 @@
 #include <dhcp/hwaddr.h>
 #include <dhcp/duid.h>
 #include <exceptions/exceptions.h>
+#include <hooks/shared_state.h>
 #include <user.h>
 #include <user_data_source.h>
 
+#include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+
 #include <string>
 
 namespace user_chk {
@@ -26,8 +30,11 @@ public:
     {}
 };
 
-/// @brief Defines a map of unique Users keyed by UserId.
-typedef std::map<UserId,UserPtr> UserMap;
+/// @brief Defines a hashed map of unique Users keyed by UserId.
+typedef boost::unordered_map<UserId,UserPtr> UserMap;
+
+/// @brief Defines a smart pointer to a constant UserMap.
+typedef boost::shared_ptr<const UserMap> UserMapPtr;
 
 /// @brief Embodies an update-able, searchable list of unique users
 /// This class provides the means to create and maintain a searchable list
@@ -35,6 +42,11 @@ typedef std::map<UserId,UserPtr> UserMap;
 /// by their UserIds.
 /// Users may be added and removed from the list individually or the list
 /// may be updated by loading it from a data source, such as a file.
+///
+/// The list is held as a @c isc::hooks::SharedState: lookups use the
+/// current list while the updates build a new list and replace the current
+/// one with it.  Adding or removing a user thus copies the list, so bulk
+/// updates should be done through the data source.
 class UserRegistry {
 public:
     /// @brief Constructor
@@ -58,7 +70,7 @@ public:
     /// @param id The user id for which to search
     ///
     /// @return A pointer to the user if found or an null pointer if not.
-    const UserPtr& findUser(const UserId& id) const;
+    UserPtr findUser(const UserId& id) const;
 
     /// @brief Removes a user from the registry by user id
     ///
@@ -72,14 +84,14 @@ public:
     /// @param hwaddr The hardware address for which to search
     ///
     /// @return A pointer to the user if found or an null pointer if not.
-    const UserPtr& findUser(const isc::dhcp::HWAddr& hwaddr) const;
+    UserPtr findUser(const isc::dhcp::HWAddr& hwaddr) const;
 
     /// @brief Finds a user in the registry by DUID
     ///
     /// @param duid The DUID for which to search
     ///
     /// @return A pointer to the user if found or an null pointer if not.
-    const UserPtr& findUser(const isc::dhcp::DUID& duid) const;
+    UserPtr findUser(const isc::dhcp::DUID& duid) const;
 
     /// @brief Updates the registry from its data source.
     ///
@@ -89,6 +101,10 @@ public:
     /// exhausted.  If an error occurs accessing the source the registry
     /// contents will be restored to that of before the call to refresh.
     ///
+    /// When the registry holds the content last read from the source, it is
+    /// left as is if the source did not change, and only the users appended
+    /// to the source are added if the source supports it.
+    ///
     /// @throw UserRegistryError if the data source has not been set (is null)
     /// or if an error occurs accessing the data source.
     void refresh();
@@ -96,6 +112,9 @@ public:
     /// @brief Removes all entries from the registry.
     void clearall();
 
+    /// @brief Returns the number of users in the registry.
+    size_t size() const;
+
     /// @brief Returns a reference to the data source.
     const UserDataSourcePtr& getSource();
 
@@ -107,11 +126,24 @@ public:
     void setSource(UserDataSourcePtr& source);
 
 private:
+    /// @brief Adds a given user to a list of users.
+    ///
+    /// @param users The list to which the user is added
+    /// @param user A pointer to the user to add
+    ///
+    /// @throw UserRegistryError if the user is null or if the user already
+    /// exists in the list.
+    static void addUser(UserMap& users, const UserPtr& user);
+
     /// @brief The registry of users.
-    UserMap users_;
+    isc::hooks::SharedState<UserMap> users_;
 
     /// @brief The current data source of users.
     UserDataSourcePtr source_;
+
+    /// @brief True if the registry holds the content last read from the
+    /// data source.
+    bool synced_;
 };
 
 /// @brief Define a smart pointer to a UserRegistry.
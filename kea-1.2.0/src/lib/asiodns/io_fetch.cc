@@ -12,6 +12,7 @@
 #include <asiolink/io_service.h>
 #include <asiolink/tcp_endpoint.h>
 #include <asiolink/tcp_socket.h>
+#include <asiolink/timing_wheel.h>
 #include <asiolink/udp_endpoint.h>
 #include <asiolink/udp_socket.h>
 #include <asiodns/io_fetch.h>
@@ -21,9 +22,11 @@
 #include <dns/rcode.h>
 #include <util/buffer.h>
 #include <util/random/qid_gen.h>
+#include <util/threads/sync.h>
 
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/weak_ptr.hpp>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
 
 #include <unistd.h>             // for some IPC/network system calls
@@ -48,6 +51,23 @@ const int DBG_IMPORTANT = DBGLVL_TRACE_BASIC;
 const int DBG_COMMON = DBGLVL_TRACE_DETAIL;
 const int DBG_ALL = DBGLVL_TRACE_DETAIL + 20;
 
+namespace {
+
+/// \brief Mutex protecting the query identifier generator.
+isc::util::thread::Mutex qid_mutex;
+
+/// \brief Generates the query identifier.
+///
+/// The fetches may be created by several threads (e.g. the D2 worker
+/// threads), so the shared generator is protected by the mutex.
+uint16_t
+generateQid() {
+    isc::util::thread::Mutex::Locker locker(qid_mutex);
+    return (QidGenerator::getInstance().generateQid());
+}
+
+}
+
 /// \brief IOFetch Data
 ///
 /// The data for IOFetch is held in a separate struct pointed to by a shared_ptr
@@ -69,6 +89,8 @@ struct IOFetchData {
     OutputBufferPtr   received;    ///< Received data put here
     IOFetch::Callback*          callback;    ///< Called on I/O Completion
     boost::asio::deadline_timer timer;       ///< Timer to measure timeouts
+    boost::weak_ptr<TimingWheel> wheel;      ///< Wheel to measure timeouts
+    TimingWheel::TimerId        timer_id;    ///< Timeout armed on the wheel
     IOFetch::Protocol           protocol;    ///< Protocol being used
     size_t                      cumulative;  ///< Cumulative received amount
     size_t                      expected;    ///< Expected amount of data
@@ -126,6 +148,8 @@ struct IOFetchData {
         received(buff),
         callback(cb),
         timer(service.get_io_service()),
+        wheel(),
+        timer_id(0),
         protocol(proto),
         cumulative(0),
         expected(0),
@@ -135,7 +159,7 @@ struct IOFetchData {
         packet(false),
         origin(ASIODNS_UNKNOWN_ORIGIN),
         staging(),
-        qid(QidGenerator::getInstance().generateQid())
+        qid(generateQid())
     {}
 
     // Checks if the response we received was ok;
@@ -164,13 +188,15 @@ IOFetch::IOFetch(Protocol protocol, IOService& service,
 
 IOFetch::IOFetch(Protocol protocol, IOService& service,
     OutputBufferPtr& outpkt, const IOAddress& address, uint16_t port,
-    OutputBufferPtr& buff, Callback* cb, int wait)
+    OutputBufferPtr& buff, Callback* cb, int wait,
+    const TimingWheelPtr& wheel)
     :
     data_(new IOFetchData(protocol, service,
           address, port, buff, cb, wait))
 {
     data_->msgbuf = outpkt;
     data_->packet = true;
+    data_->wheel = wheel;
 }
 
 IOFetch::IOFetch(Protocol protocol, IOService& service,
@@ -258,10 +284,16 @@ IOFetch::operator()(boost::system::error_code ec, size_t length) {
         // If we timeout, we stop, which will can cancel outstanding I/Os and
         // shutdown everything.
         if (data_->timeout != -1) {
-            data_->timer.expires_from_now(boost::posix_time::milliseconds(
-                data_->timeout));
-            data_->timer.async_wait(boost::bind(&IOFetch::stop, *this,
-                TIME_OUT));
+            TimingWheelPtr wheel = data_->wheel.lock();
+            if (wheel) {
+                data_->timer_id = wheel->arm(boost::bind(&IOFetch::stop,
+                    *this, TIME_OUT), data_->timeout);
+            } else {
+                data_->timer.expires_from_now(boost::posix_time::milliseconds(
+                    data_->timeout));
+                data_->timer.async_wait(boost::bind(&IOFetch::stop, *this,
+                    TIME_OUT));
+            }
         }
 
         // Open a connection to the target system.  For speed, if the operation
@@ -381,6 +413,13 @@ IOFetch::stop(Result result) {
         data_->socket->close();
 
         data_->timer.cancel();
+        if (data_->timer_id != 0) {
+            TimingWheelPtr wheel = data_->wheel.lock();
+            if (wheel) {
+                wheel->cancel(data_->timer_id);
+            }
+            data_->timer_id = 0;
+        }
 
         // Execute the I/O completion callback (if present).
         if (data_->callback) {
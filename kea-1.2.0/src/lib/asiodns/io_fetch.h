@@ -16,6 +16,7 @@
 #include <boost/system/error_code.hpp>
 #include <asiolink/io_address.h>
 #include <asiolink/io_service.h>
+#include <asiolink/timing_wheel.h>
 
 #include <util/buffer.h>
 #include <dns/question.h>
@@ -175,11 +176,16 @@ public:
     /// (default = 53)
     /// \param wait Timeout for the fetch (in ms).  The default value of
     ///     -1 indicates no timeout.
+    /// \param wheel Timing wheel used to measure the timeout.  If null (the
+    ///     default), the fetch uses its own deadline timer.  The wheel is
+    ///     cheaper when many fetches are in progress at the same time.
     IOFetch(Protocol protocol, isc::asiolink::IOService& service,
         isc::util::OutputBufferPtr& outpkt,
         const isc::asiolink::IOAddress& address,
         uint16_t port, isc::util::OutputBufferPtr& buff, Callback* cb,
-        int wait = -1);
+        int wait = -1,
+        const isc::asiolink::TimingWheelPtr& wheel =
+        isc::asiolink::TimingWheelPtr());
 
     /// \brief Return Current Protocol
     ///
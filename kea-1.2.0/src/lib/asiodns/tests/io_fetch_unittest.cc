@@ -9,6 +9,7 @@
 #include <asiolink/io_address.h>
 #include <asiolink/io_endpoint.h>
 #include <asiolink/io_service.h>
+#include <asiolink/timing_wheel.h>
 #include <asiodns/io_fetch.h>
 #include <dns/question.h>
 #include <dns/message.h>
@@ -620,6 +621,24 @@ TEST_F(IOFetchTest, UdpTimeout) {
     timeoutTest(IOFetch::UDP, udp_fetch_);
 }
 
+// UDP timeout test with the timeout measured on the timing wheel.
+TEST_F(IOFetchTest, UdpTimeoutWheel) {
+    TimingWheelPtr wheel(new TimingWheel(service_));
+    IOFetch fetch(IOFetch::UDP, service_, msgbuf_, IOAddress(TEST_HOST),
+                  TEST_PORT, result_buff_, this, 100, wheel);
+    timeoutTest(IOFetch::UDP, fetch);
+    EXPECT_EQ(0, wheel->size());
+}
+
+// UDP stop test with the timing wheel.  The timeout must be canceled.
+TEST_F(IOFetchTest, UdpStopWheel) {
+    TimingWheelPtr wheel(new TimingWheel(service_));
+    IOFetch fetch(IOFetch::UDP, service_, msgbuf_, IOAddress(TEST_HOST),
+                  TEST_PORT, result_buff_, this, 100, wheel);
+    stopTest(IOFetch::UDP, fetch);
+    EXPECT_EQ(0, wheel->size());
+}
+
 // UDP SendReceive test.  Set up a UDP server then ports a UDP fetch object.
 // This will send question_ to the server and receive the answer back from it.
 TEST_F(IOFetchTest, UdpSendReceive) {
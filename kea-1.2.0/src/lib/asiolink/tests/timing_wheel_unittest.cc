@@ -0,0 +1,196 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
+#include <asiolink/timing_wheel.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/bind.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace boost::posix_time;
+
+namespace {
+
+/// @brief Test fixture class for @c TimingWheel.
+class TimingWheelTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    TimingWheelTest()
+        : io_service_(), fired_() {
+    }
+
+    /// @brief Records the expired timeout.
+    ///
+    /// @param id Identifier chosen by the test.
+    void expired(const int id) {
+        fired_.push_back(id);
+    }
+
+    /// @brief Stops the IO service.
+    void stop() {
+        io_service_.stop();
+    }
+
+    /// @brief IO service used by the tests.
+    IOService io_service_;
+
+    /// @brief Identifiers of the expired timeouts in the expiration order.
+    std::vector<int> fired_;
+};
+
+// This test verifies that the invalid parameters are rejected.
+TEST_F(TimingWheelTest, invalidParameters) {
+    EXPECT_THROW(TimingWheel(io_service_, 0), BadValue);
+    EXPECT_THROW(TimingWheel(io_service_, 10, 0), BadValue);
+
+    TimingWheel wheel(io_service_);
+    EXPECT_THROW(wheel.arm(TimingWheel::Callback(), 10), InvalidParameter);
+}
+
+// This test verifies that the number of slots is rounded up to the
+// power of two.
+TEST_F(TimingWheelTest, slots) {
+    TimingWheel wheel(io_service_, 5, 100);
+    EXPECT_EQ(5, wheel.getResolution());
+    EXPECT_EQ(128, wheel.getSlots());
+}
+
+// This test verifies that the timeouts expire in order when the wheel
+// is advanced and that they never expire early.
+TEST_F(TimingWheelTest, advance) {
+    TimingWheel wheel(io_service_, 10, 8);
+
+    wheel.arm(boost::bind(&TimingWheelTest::expired, this, 3), 25);
+    wheel.arm(boost::bind(&TimingWheelTest::expired, this, 1), 0);
+    wheel.arm(boost::bind(&TimingWheelTest::expired, this, 2), 15);
+    // This one needs more than one rotation of the wheel.
+    wheel.arm(boost::bind(&TimingWheelTest::expired, this, 4), 195);
+    EXPECT_EQ(4, wheel.size());
+
+    wheel.advance();
+    ASSERT_EQ(1, fired_.size());
+    EXPECT_EQ(1, fired_[0]);
+
+    wheel.advance(2);
+    ASSERT_EQ(3, fired_.size());
+    EXPECT_EQ(2, fired_[1]);
+    EXPECT_EQ(3, fired_[2]);
+    EXPECT_EQ(1, wheel.size());
+
+    // The slot of the long timeout is visited, but it isn't due yet.
+    wheel.advance();
+    EXPECT_EQ(3, fired_.size());
+
+    wheel.advance(15);
+    EXPECT_EQ(3, fired_.size());
+    wheel.advance();
+    ASSERT_EQ(4, fired_.size());
+    EXPECT_EQ(4, fired_[3]);
+    EXPECT_EQ(0, wheel.size());
+}
+
+// This test verifies that advancing the wheel by many rotations at once
+// expires all due timeouts.
+TEST_F(TimingWheelTest, advanceManyRotations) {
+    TimingWheel wheel(io_service_, 10, 4);
+
+    for (int i = 0; i < 10; ++i) {
+        wheel.arm(boost::bind(&TimingWheelTest::expired, this, i), i * 10);
+    }
+    wheel.arm(boost::bind(&TimingWheelTest::expired, this, 100), 995);
+
+    wheel.advance(50);
+    EXPECT_EQ(10, fired_.size());
+    EXPECT_EQ(1, wheel.size());
+
+    wheel.advance(50);
+    EXPECT_EQ(11, fired_.size());
+}
+
+// This test verifies that the canceled timeouts don't expire.
+TEST_F(TimingWheelTest, cancel) {
+    TimingWheel wheel(io_service_, 10, 8);
+
+    TimingWheel::TimerId id1 =
+        wheel.arm(boost::bind(&TimingWheelTest::expired, this, 1), 5);
+    TimingWheel::TimerId id2 =
+        wheel.arm(boost::bind(&TimingWheelTest::expired, this, 2), 5);
+    ASSERT_NE(id1, id2);
+    EXPECT_NE(0, id1);
+
+    EXPECT_TRUE(wheel.cancel(id1));
+    EXPECT_FALSE(wheel.cancel(id1));
+    EXPECT_EQ(1, wheel.size());
+
+    wheel.advance();
+    ASSERT_EQ(1, fired_.size());
+    EXPECT_EQ(2, fired_[0]);
+
+    // The expired timeout can't be canceled.
+    EXPECT_FALSE(wheel.cancel(id2));
+}
+
+// This test verifies that the callback may cancel another timeout
+// expiring in the same tick and arm a new one.
+TEST_F(TimingWheelTest, cancelFromCallback) {
+    TimingWheel wheel(io_service_, 10, 8);
+
+    TimingWheel::TimerId id2 = 0;
+    wheel.arm(boost::bind(&TimingWheel::cancel, &wheel, boost::ref(id2)), 5);
+    id2 = wheel.arm(boost::bind(&TimingWheelTest::expired, this, 2), 5);
+    wheel.arm(boost::bind(&TimingWheel::arm, &wheel,
+                          TimingWheel::Callback(
+                              boost::bind(&TimingWheelTest::expired, this, 3)),
+                          0), 5);
+
+    wheel.advance();
+    EXPECT_TRUE(fired_.empty());
+    EXPECT_EQ(1, wheel.size());
+
+    wheel.advance();
+    ASSERT_EQ(1, fired_.size());
+    EXPECT_EQ(3, fired_[0]);
+}
+
+// This test verifies that the wheel is driven by the IO service and that
+// the timeouts expire after the requested time.
+TEST_F(TimingWheelTest, run) {
+    TimingWheel wheel(io_service_, 5);
+
+    // Safety timer in case the wheel doesn't work.
+    IntervalTimer test_timer(io_service_);
+    test_timer.setup(boost::bind(&TimingWheelTest::stop, this), 2000,
+                     IntervalTimer::ONE_SHOT);
+
+    const ptime start = microsec_clock::universal_time();
+    wheel.arm(boost::bind(&TimingWheelTest::expired, this, 1), 20);
+    wheel.arm(boost::bind(&TimingWheelTest::expired, this, 2), 50);
+    wheel.arm(boost::bind(&TimingWheelTest::stop, this), 60);
+    TimingWheel::TimerId id =
+        wheel.arm(boost::bind(&TimingWheelTest::expired, this, 3), 30);
+    EXPECT_TRUE(wheel.cancel(id));
+
+    io_service_.run();
+
+    EXPECT_GE((microsec_clock::universal_time() - start).total_milliseconds(),
+              60);
+    ASSERT_EQ(2, fired_.size());
+    EXPECT_EQ(1, fired_[0]);
+    EXPECT_EQ(2, fired_[1]);
+    EXPECT_EQ(0, wheel.size());
+}
+
+}
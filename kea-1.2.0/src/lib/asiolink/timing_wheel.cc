@@ -0,0 +1,161 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/timing_wheel.h>
+
+#include <boost/bind.hpp>
+
+#include <exceptions/exceptions.h>
+
+#include <algorithm>
+
+using namespace boost::posix_time;
+
+namespace isc {
+namespace asiolink {
+
+const long TimingWheel::DEFAULT_RESOLUTION;
+const size_t TimingWheel::DEFAULT_SLOTS;
+
+TimingWheel::TimingWheel(IOService& io_service, const long resolution,
+                         const size_t slots)
+    : timer_(io_service), resolution_(resolution), slots_(), mask_(0),
+      tick_(0), tick_time_(), next_id_(1), timers_() {
+    if (resolution <= 0) {
+        isc_throw(isc::BadValue, "timing wheel resolution must be greater"
+                  " than 0");
+    }
+    if (slots == 0) {
+        isc_throw(isc::BadValue, "timing wheel must have at least one slot");
+    }
+
+    // Round the number of slots up to the power of two, so as the slot
+    // index is obtained by masking the tick.
+    size_t size = 1;
+    while (size < slots) {
+        size <<= 1;
+    }
+    slots_.resize(size);
+    mask_ = size - 1;
+}
+
+TimingWheel::TimerId
+TimingWheel::arm(const Callback& callback, const long timeout) {
+    if (callback.empty()) {
+        isc_throw(isc::InvalidParameter, "timing wheel callback is empty");
+    }
+
+    // Start the timer when the first timeout is armed. The current tick
+    // is aligned with the current time.
+    const ptime now = microsec_clock::universal_time();
+    if (timer_.getInterval() == 0) {
+        tick_time_ = now;
+        timer_.setup(boost::bind(&TimingWheel::tickHandler, this),
+                     resolution_, IntervalTimer::REPEATING);
+    }
+
+    // The current tick may have started some time ago, so the timeout is
+    // counted from the start of the tick and rounded up. This guarantees
+    // the callback is never invoked too early.
+    int64_t delay = (timeout > 0 ? static_cast<int64_t>(timeout) * 1000 : 0);
+    if (now > tick_time_) {
+        delay += (now - tick_time_).total_microseconds();
+    }
+    const int64_t tick_length = static_cast<int64_t>(resolution_) * 1000;
+    uint64_t ticks = static_cast<uint64_t>((delay + tick_length - 1) /
+                                           tick_length);
+    if (ticks == 0) {
+        ticks = 1;
+    }
+
+    Entry entry;
+    entry.id_ = next_id_++;
+    entry.expires_ = tick_ + ticks;
+    entry.callback_ = callback;
+
+    Slot& slot = slots_[entry.expires_ & mask_];
+    timers_[entry.id_] = slot.insert(slot.end(), entry);
+    return (entry.id_);
+}
+
+bool
+TimingWheel::cancel(const TimerId& id) {
+    TimerMap::iterator timer = timers_.find(id);
+    if (timer == timers_.end()) {
+        return (false);
+    }
+
+    Slot::iterator entry = timer->second;
+    slots_[entry->expires_ & mask_].erase(entry);
+    timers_.erase(timer);
+
+    if (timers_.empty()) {
+        timer_.cancel();
+    }
+    return (true);
+}
+
+void
+TimingWheel::advance(const uint64_t ticks) {
+    // There is no need to visit the same slot twice when the wheel is
+    // advanced by more than one rotation.
+    if (ticks > slots_.size()) {
+        tick_ += ticks - slots_.size();
+    }
+    const uint64_t last = tick_ + std::min(ticks,
+                                           static_cast<uint64_t>(slots_.size()));
+
+    while (tick_ < last) {
+        ++tick_;
+        Slot& slot = slots_[tick_ & mask_];
+
+        // The callbacks may arm and cancel timeouts in this slot, so the
+        // identifiers of the expired timeouts are collected first and each
+        // of them is looked up again before invoking its callback.
+        std::vector<TimerId> expired;
+        for (Slot::const_iterator entry = slot.begin(); entry != slot.end();
+             ++entry) {
+            if (entry->expires_ <= tick_) {
+                expired.push_back(entry->id_);
+            }
+        }
+
+        for (std::vector<TimerId>::const_iterator id = expired.begin();
+             id != expired.end(); ++id) {
+            TimerMap::iterator timer = timers_.find(*id);
+            if (timer == timers_.end()) {
+                continue;
+            }
+            Callback callback = timer->second->callback_;
+            slot.erase(timer->second);
+            timers_.erase(timer);
+            callback();
+        }
+    }
+
+    if (timers_.empty()) {
+        timer_.cancel();
+    }
+}
+
+void
+TimingWheel::tickHandler() {
+    const ptime now = microsec_clock::universal_time();
+    uint64_t ticks = 1;
+    if (now > tick_time_) {
+        const int64_t elapsed = (now - tick_time_).total_milliseconds();
+        if (elapsed > resolution_) {
+            ticks = static_cast<uint64_t>(elapsed / resolution_);
+        }
+    }
+    tick_time_ += milliseconds(static_cast<long>(ticks) * resolution_);
+    advance(ticks);
+}
+
+} // namespace asiolink
+} // namespace isc
@@ -0,0 +1,174 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASIOLINK_TIMING_WHEEL_H
+#define ASIOLINK_TIMING_WHEEL_H 1
+
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_service.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/unordered_map.hpp>
+
+#include <list>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace asiolink {
+
+/// \brief Hashed timing wheel for large numbers of one shot timeouts.
+///
+/// Each \c IntervalTimer owns an ASIO deadline timer, and ASIO keeps all
+/// pending deadline timers in a heap, so arming and canceling a timer
+/// costs O(log n). This becomes noticeable when thousands of I/O
+/// operations, e.g. DNS updates sent by D2, each arm a timeout which is
+/// almost always canceled before it expires.
+///
+/// The \c TimingWheel keeps the timeouts in a circular array of slots,
+/// each slot covering one tick of the configured resolution. Arming a
+/// timeout appends it to the slot in which it expires and canceling it
+/// removes it from that slot, both in constant time. A single
+/// \c IntervalTimer advances the wheel by one tick at a time and invokes
+/// the callbacks of the expired timeouts. The timeouts longer than one
+/// rotation of the wheel stay in their slot until the wheel comes around
+/// enough times. The interval timer only runs while there are armed
+/// timeouts, so an idle wheel doesn't wake the process up.
+///
+/// The timeouts are rounded up to the resolution of the wheel, thus the
+/// callback is never invoked earlier than requested, but may be invoked
+/// up to one tick later.
+///
+/// The callbacks may arm and cancel timeouts, including the ones which
+/// expire in the same tick.
+class TimingWheel : public boost::noncopyable {
+public:
+
+    /// \brief The type of the timeout callback function.
+    typedef boost::function<void()> Callback;
+
+    /// \brief Identifier of the armed timeout.
+    ///
+    /// The value of 0 is never assigned to a timeout.
+    typedef uint64_t TimerId;
+
+    /// \brief Default resolution in milliseconds.
+    static const long DEFAULT_RESOLUTION = 10;
+
+    /// \brief Default number of slots.
+    static const size_t DEFAULT_SLOTS = 512;
+
+    /// \brief Constructor.
+    ///
+    /// \param io_service IO service used to run the interval timer.
+    /// \param resolution Duration of a single tick in milliseconds.
+    /// \param slots Number of slots. It is rounded up to the power of two.
+    ///
+    /// \throw isc::BadValue if the resolution or the number of slots is 0.
+    TimingWheel(IOService& io_service,
+                const long resolution = DEFAULT_RESOLUTION,
+                const size_t slots = DEFAULT_SLOTS);
+
+    /// \brief Arms a one shot timeout.
+    ///
+    /// \param callback Function invoked when the timeout expires.
+    /// \param timeout Timeout in milliseconds. The negative value is
+    /// treated as 0, i.e. the callback is invoked at the next tick.
+    ///
+    /// \return Identifier of the timeout which can be used to cancel it.
+    /// \throw isc::InvalidParameter if the callback is empty.
+    TimerId arm(const Callback& callback, const long timeout);
+
+    /// \brief Cancels the timeout.
+    ///
+    /// \param id Identifier returned by \c arm.
+    ///
+    /// \return true if the timeout has been canceled, false if it has
+    /// already expired, has been canceled before or doesn't exist.
+    bool cancel(const TimerId& id);
+
+    /// \brief Advances the wheel and invokes the expired callbacks.
+    ///
+    /// This function is called by the interval timer. It is public for
+    /// the use by the unit tests which can't afford waiting.
+    ///
+    /// \param ticks Number of ticks to advance.
+    void advance(const uint64_t ticks = 1);
+
+    /// \brief Returns the number of armed timeouts.
+    size_t size() const {
+        return (timers_.size());
+    }
+
+    /// \brief Returns the resolution in milliseconds.
+    long getResolution() const {
+        return (resolution_);
+    }
+
+    /// \brief Returns the number of slots.
+    size_t getSlots() const {
+        return (slots_.size());
+    }
+
+private:
+
+    /// \brief Armed timeout.
+    struct Entry {
+        /// \brief Identifier of the timeout.
+        TimerId id_;
+        /// \brief Tick at which the timeout expires.
+        uint64_t expires_;
+        /// \brief Function invoked when the timeout expires.
+        Callback callback_;
+    };
+
+    /// \brief Timeouts expiring in the same slot.
+    typedef std::list<Entry> Slot;
+
+    /// \brief Locations of the armed timeouts, indexed by identifier.
+    typedef boost::unordered_map<TimerId, Slot::iterator> TimerMap;
+
+    /// \brief Interval timer callback.
+    ///
+    /// Advances the wheel by the number of ticks elapsed since the last
+    /// call, so as the processing delays don't accumulate.
+    void tickHandler();
+
+    /// \brief Timer driving the wheel.
+    IntervalTimer timer_;
+
+    /// \brief Resolution in milliseconds.
+    long resolution_;
+
+    /// \brief Slots of the wheel.
+    std::vector<Slot> slots_;
+
+    /// \brief Mask applied to the tick to get the slot index.
+    uint64_t mask_;
+
+    /// \brief Current tick.
+    uint64_t tick_;
+
+    /// \brief Time of the current tick.
+    boost::posix_time::ptime tick_time_;
+
+    /// \brief Identifier of the next armed timeout.
+    TimerId next_id_;
+
+    /// \brief Locations of the armed timeouts.
+    TimerMap timers_;
+};
+
+/// \brief Pointer to the \c TimingWheel.
+typedef boost::shared_ptr<TimingWheel> TimingWheelPtr;
+
+} // namespace asiolink
+} // namespace isc
+
+#endif // ASIOLINK_TIMING_WHEEL_H
@@ -11,15 +11,162 @@
 #include <dhcp/iface_mgr.h>
 #include <config/config_log.h>
 #include <boost/bind.hpp>
+#include <boost/pointer_cast.hpp>
+#include <sys/socket.h>
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
 #include <unistd.h>
 
+// Not all systems can disable SIGPIPE for a single send.
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+using namespace isc::asiolink;
 using namespace isc::data;
+using namespace isc::util;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Time a response write waits for the client to read the response
+/// (in milliseconds) before giving up.
+const int RESPONSE_SEND_TIMEOUT = 10000;
+
+/// @brief Sends the whole response over a non-blocking socket.
+///
+/// When the socket doesn't accept more data, waits for the client to read
+/// what has been sent so far, giving up after RESPONSE_SEND_TIMEOUT.
+///
+/// @param fd socket descriptor the response is sent over
+/// @param txt text of the response
+void
+sendResponseText(const int fd, const std::string& txt) {
+    using namespace isc::config;
+
+    size_t sent = 0;
+    while (sent < txt.length()) {
+        ssize_t len = send(fd, txt.c_str() + sent, txt.length() - sent,
+                           MSG_NOSIGNAL);
+        if (len >= 0) {
+            sent += len;
+            continue;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            struct pollfd pfd;
+            pfd.fd = fd;
+            pfd.events = POLLOUT;
+            pfd.revents = 0;
+            int ready = poll(&pfd, 1, RESPONSE_SEND_TIMEOUT);
+            if (ready > 0) {
+                continue;
+            }
+            if ((ready < 0) && (errno == EINTR)) {
+                continue;
+            }
+            if (ready == 0) {
+                errno = ETIMEDOUT;
+            }
+        }
+
+        const char* errmsg = strerror(errno);
+        LOG_ERROR(command_logger, COMMAND_SOCKET_WRITE_FAIL)
+            .arg(txt.length() - sent).arg(fd).arg(errmsg);
+        break;
+    }
+
+    LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE)
+        .arg(sent).arg(fd);
+}
+
+/// @brief Returns the response it is called with.
+///
+/// @param response response to be returned
+ConstElementPtr
+returnResponse(const ConstElementPtr& response) {
+    return (response);
+}
+
+}
 
 namespace isc {
 namespace config {
 
+const size_t CommandMgr::DEFAULT_MAX_CONNECTIONS;
+const size_t CommandMgr::MAX_COMMAND_SIZE;
+
+/// @brief Command whose response is generated in background.
+struct CommandMgr::BackgroundCommand {
+
+    /// @brief Constructor
+    ///
+    /// @param conn connection the command was received over
+    /// @param fd duplicate of the connection's socket, owned by the object
+    /// @param name name of the command
+    /// @param generator function generating the response
+    BackgroundCommand(const ConnectionSocketPtr& conn, const int fd,
+                      const std::string& name,
+                      const ResponseGenerator& generator)
+        : conn_(conn), fd_(fd), name_(name), generator_(generator),
+          wake_(false), done_(false) {
+    }
+
+    /// @brief Destructor
+    ///
+    /// Closes the duplicated socket if it is still open.
+    ~BackgroundCommand() {
+        closeFD();
+    }
+
+    /// @brief Closes the duplicated socket.
+    void closeFD() {
+        if (fd_ >= 0) {
+            close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    /// @brief Connection the command was received over.
+    ///
+    /// It is only used in the main thread.
+    ConnectionSocketPtr conn_;
+
+    /// @brief Socket the response is sent over.
+    int fd_;
+
+    /// @brief Name of the command.
+    std::string name_;
+
+    /// @brief Function generating the response.
+    ResponseGenerator generator_;
+
+    /// @brief Indicates if the main thread must be signalled when the
+    /// response is sent.
+    bool wake_;
+
+    /// @brief Indicates if the response has been sent.
+    bool done_;
+};
+
 CommandMgr::CommandMgr()
-    : HookedCommandMgr() {
+    : HookedCommandMgr(), max_connections_(DEFAULT_MAX_CONNECTIONS),
+      background_enabled_(false), defer_(false), deferred_(),
+      worker_io_service_(), worker_thread_(), running_(), running_mutex_(),
+      done_watch_() {
+}
+
+CommandMgr::~CommandMgr() {
+    // IfaceMgr may already be gone, so only the thread is stopped here.
+    if (worker_thread_) {
+        worker_io_service_->stop();
+        worker_thread_->wait();
+    }
 }
 
 CommandSocketPtr
@@ -28,13 +175,32 @@ CommandMgr::openCommandSocket(const isc::data::ConstElementPtr& socket_info) {
         isc_throw(SocketError, "There is already a control socket open");
     }
 
+    // The commands are processed in background only if explicitly
+    // enabled for the socket.
+    bool background = false;
+    if (socket_info) {
+        ConstElementPtr param = socket_info->get("background-commands");
+        if (param) {
+            if (param->getType() != Element::boolean) {
+                isc_throw(BadSocketInfo, "'background-commands' parameter"
+                          " expected to be a boolean");
+            }
+            background = param->boolValue();
+        }
+    }
+
     socket_ = CommandSocketFactory::create(socket_info);
+    background_enabled_ = background;
 
     return (socket_);
 }
 
 void CommandMgr::closeCommandSocket() {
-    // First, let's close the socket for incoming new connections.
+    // Stop generating the responses in background, as the connections
+    // they would be sent over are about to be closed.
+    stopWorker();
+
+    // Let's close the socket for incoming new connections.
     if (socket_) {
         socket_->close();
         socket_.reset();
@@ -48,6 +214,42 @@ void CommandMgr::closeCommandSocket() {
     connections_.clear();
 }
 
+void
+CommandMgr::registerBackgroundCommand(const std::string& cmd,
+                                      BackgroundCommandHandler handler) {
+    if (!handler) {
+        isc_throw(InvalidCommandHandler, "Specified command handler is NULL");
+    }
+
+    registerCommand(cmd, boost::bind(&CommandMgr::backgroundCommandHandler,
+                                     handler, _1, _2));
+}
+
+CommandMgr::ResponseGenerator
+CommandMgr::respondWith(const ConstElementPtr& response) {
+    return (boost::bind(&returnResponse, response));
+}
+
+ConstElementPtr
+CommandMgr::backgroundCommandHandler(const BackgroundCommandHandler& handler,
+                                     const std::string& name,
+                                     const ConstElementPtr& params) {
+    ResponseGenerator generator = handler(name, params);
+    if (!generator) {
+        return (ConstElementPtr());
+    }
+
+    // Only the command received over a connection is deferred.
+    CommandMgr& mgr = instance();
+    if (mgr.defer_) {
+        mgr.defer_ = false;
+        mgr.deferred_ = generator;
+        return (createAnswer(CONTROL_RESULT_SUCCESS,
+                             "response is generated in background"));
+    }
+
+    return (generator());
+}
 
 void CommandMgr::addConnection(const CommandSocketPtr& conn) {
     connections_.push_back(conn);
@@ -70,6 +272,28 @@ bool CommandMgr::closeConnection(int fd) {
     return (false);
 }
 
+ConnectionSocketPtr
+CommandMgr::getConnection(int fd) const {
+    for (std::list<CommandSocketPtr>::const_iterator conn = connections_.begin();
+         conn != connections_.end(); ++conn) {
+        if ((*conn)->getFD() == fd) {
+            return (boost::dynamic_pointer_cast<ConnectionSocket>(*conn));
+        }
+    }
+    return (ConnectionSocketPtr());
+}
+
+bool
+CommandMgr::hasConnection(const ConnectionSocketPtr& conn) const {
+    for (std::list<CommandSocketPtr>::const_iterator c = connections_.begin();
+         c != connections_.end(); ++c) {
+        if (*c == conn) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
 CommandMgr&
 CommandMgr::instance() {
     static CommandMgr cmd_mgr;
@@ -79,16 +303,17 @@ CommandMgr::instance() {
 void
 CommandMgr::commandReader(int sockfd) {
 
-    /// @todo: We do not handle commands that are larger than 64K.
-
-    // We should not expect commands bigger than 64K.
+    // Commands larger than the buffer are assembled from several reads.
     char buf[65536];
-    memset(buf, 0, sizeof(buf));
-    ConstElementPtr cmd, rsp;
 
     // Read incoming data.
     int rval = read(sockfd, buf, sizeof(buf));
     if (rval < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+            // Nothing to read after all. Try again next time.
+            return;
+        }
+
         // Read failed
         LOG_ERROR(command_logger, COMMAND_SOCKET_READ_FAIL).arg(rval).arg(sockfd);
 
@@ -103,6 +328,61 @@ CommandMgr::commandReader(int sockfd) {
         return;
     }
 
+    LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_READ).arg(rval).arg(sockfd);
+
+    // Holding the connection keeps it alive even if a command closes it.
+    ConnectionSocketPtr conn = instance().getConnection(sockfd);
+    if (!conn) {
+        // Should not happen: only the open connections read commands.
+        return;
+    }
+
+    conn->appendInput(buf, static_cast<size_t>(rval));
+    if (conn->getInputSize() > MAX_COMMAND_SIZE) {
+        LOG_ERROR(command_logger, COMMAND_SOCKET_COMMAND_TOOLARGE)
+            .arg(sockfd).arg(MAX_COMMAND_SIZE);
+        instance().closeConnection(sockfd);
+        return;
+    }
+
+    // Collect the responses sent in background in the meantime. If this
+    // connection is still busy, its commands are processed when its
+    // response is sent.
+    std::list<ConnectionSocketPtr> ready;
+    instance().collectBackgroundCommands(conn, ready);
+    for (std::list<ConnectionSocketPtr>::const_iterator c = ready.begin();
+         c != ready.end(); ++c) {
+        if ((*c != conn) && instance().hasConnection(*c)) {
+            processCommands(*c);
+        }
+    }
+
+    // Process all the complete commands received so far. The rest of the
+    // data is kept until more arrives.
+    processCommands(conn);
+}
+
+void
+CommandMgr::processCommands(const ConnectionSocketPtr& conn) {
+    // The commands received while the response to the previous one is
+    // generated in background are processed when it is sent.
+    std::string command;
+    while (!conn->isBusy() && conn->getCommand(command)) {
+        processConnectionCommand(conn, command);
+
+        // The command may have closed the connection (e.g. a reconfig).
+        if (!instance().hasConnection(conn)) {
+            break;
+        }
+    }
+}
+
+void
+CommandMgr::processConnectionCommand(const ConnectionSocketPtr& conn,
+                                     const std::string& command) {
+    ConstElementPtr cmd, rsp;
+    int sockfd = conn->getFD();
+
     // Duplicate the connection's socket in the event, the command causes the
     // channel to close (like a reconfig).  This permits us to always have
     // a socket on which to respond. If for some reason  we can't fall back
@@ -116,62 +396,234 @@ CommandMgr::commandReader(int sockfd) {
         rsp_fd = sockfd;
     }
 
-    LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_READ).arg(rval).arg(sockfd);
+    // The handler of a background command leaves the response generator
+    // here rather than generating the response.
+    CommandMgr& mgr = instance();
+    mgr.defer_ = mgr.background_enabled_;
+    mgr.deferred_ = ResponseGenerator();
 
     // Ok, we received something. Let's see if we can make any sense of it.
     try {
 
         // Try to interpret it as JSON.
-        std::string sbuf(buf, static_cast<size_t>(rval));
-        cmd = Element::fromJSON(sbuf, true);
+        cmd = Element::fromJSON(command, true);
 
         // If successful, then process it as a command.
-        rsp = CommandMgr::instance().processCommand(cmd);
+        rsp = mgr.processCommand(cmd);
     } catch (const Exception& ex) {
         LOG_WARN(command_logger, COMMAND_PROCESS_ERROR1).arg(ex.what());
         rsp = createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what()));
     }
 
+    mgr.defer_ = false;
+    ResponseGenerator generator;
+    generator.swap(mgr.deferred_);
+
+    if (generator) {
+        // The worker thread sends the response over the duplicated socket,
+        // which requires the previous responses to have been sent.
+        const std::string name = cmd->get(CONTROL_COMMAND)->stringValue();
+        if ((rsp_fd != sockfd) && mgr.hasConnection(conn) &&
+            (conn->getOutputSize() == 0)) {
+            BackgroundCommandPtr background(new BackgroundCommand(conn,
+                                                                  rsp_fd,
+                                                                  name,
+                                                                  generator));
+            try {
+                mgr.startWorker();
+                conn->setBusy(true);
+                // The commands received along with this one are processed
+                // when the response is sent.
+                background->wake_ = (conn->getInputSize() > 0);
+                mgr.running_.push_back(background);
+                mgr.worker_io_service_->post(
+                    boost::bind(&CommandMgr::runBackgroundCommand,
+                                background));
+                LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_BACKGROUND_START)
+                    .arg(name).arg(sockfd);
+                return;
+            } catch (const std::exception& ex) {
+                // The response is generated right here instead, so the
+                // duplicated socket is still needed.
+                background->fd_ = -1;
+                conn->setBusy(false);
+                mgr.running_.remove(background);
+                LOG_WARN(command_logger, COMMAND_BACKGROUND_ERROR)
+                    .arg(name).arg(ex.what());
+            }
+        }
+
+        // Generate the response right here.
+        try {
+            rsp = generator();
+        } catch (const std::exception& ex) {
+            LOG_WARN(command_logger, COMMAND_PROCESS_ERROR1).arg(ex.what());
+            rsp = createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what()));
+        }
+    }
+
+    if (!rsp) {
+        LOG_WARN(command_logger, COMMAND_RESPONSE_ERROR);
+
+    } else if (instance().hasConnection(conn)) {
+        // Let's convert JSON response to text and send it. Whatever can't
+        // be sent right away will be sent when the peer is ready for it.
+        conn->sendResponse(rsp->str());
+
+    } else if (rsp_fd != sockfd) {
+        // The connection has been closed by the command, so the response
+        // is sent over the duplicated socket. It shares the non-blocking
+        // mode with the closed one, so wait for the client to read it.
+        sendResponseText(rsp_fd, rsp->str());
+    }
+
+    // Only close the duped socket if it's different (should be)
+    if (rsp_fd != sockfd) {
+        close(rsp_fd);
+    }
+}
+
+void
+CommandMgr::runBackgroundCommand(const BackgroundCommandPtr& command) {
+    ConstElementPtr rsp;
+    try {
+        rsp = command->generator_();
+    } catch (const std::exception& ex) {
+        LOG_WARN(command_logger, COMMAND_BACKGROUND_ERROR)
+            .arg(command->name_).arg(ex.what());
+        rsp = createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what()));
+    } catch (...) {
+        LOG_WARN(command_logger, COMMAND_BACKGROUND_ERROR)
+            .arg(command->name_).arg("unknown error");
+        rsp = createAnswer(CONTROL_RESULT_ERROR, "unknown error");
+    }
+
+    // The snapshot the response was generated from isn't needed anymore.
+    command->generator_ = ResponseGenerator();
+
     if (!rsp) {
         LOG_WARN(command_logger, COMMAND_RESPONSE_ERROR);
-        // Only close the duped socket if it's different (should be)
-        if (rsp_fd != sockfd) {
-            close(rsp_fd);
+
+    } else {
+        // The socket is non-blocking, so the worker waits for the client
+        // to read the response when it is large.
+        std::string txt = rsp->str();
+        rsp.reset();
+        sendResponseText(command->fd_, txt);
+    }
+    command->closeFD();
+
+    // The main thread collects the command when it reads more data from
+    // the connection, or right away if it has commands waiting.
+    CommandMgr& mgr = instance();
+    bool wake = false;
+    {
+        Mutex::Locker lock(mgr.running_mutex_);
+        command->done_ = true;
+        wake = command->wake_;
+    }
+    if (wake) {
+        try {
+            mgr.done_watch_->markReady();
+        } catch (const std::exception& ex) {
+            LOG_ERROR(command_logger, COMMAND_BACKGROUND_SIGNAL_FAIL)
+                .arg(ex.what());
+        }
+    }
+}
+
+void
+CommandMgr::backgroundCommandsDone() {
+    // The watch socket is cleared before the commands are collected, so as
+    // it signals the commands completed in the meantime.
+    try {
+        done_watch_->clearReady();
+    } catch (const std::exception& ex) {
+        LOG_ERROR(command_logger, COMMAND_BACKGROUND_SIGNAL_FAIL)
+            .arg(ex.what());
+    }
+
+    std::list<ConnectionSocketPtr> ready;
+    collectBackgroundCommands(ConnectionSocketPtr(), ready);
+    for (std::list<ConnectionSocketPtr>::const_iterator conn = ready.begin();
+         conn != ready.end(); ++conn) {
+        if (hasConnection(*conn)) {
+            processCommands(*conn);
         }
+    }
+}
 
+void
+CommandMgr::collectBackgroundCommands(const ConnectionSocketPtr& waiting,
+                                      std::list<ConnectionSocketPtr>& ready) {
+    if (running_.empty()) {
         return;
     }
 
-    // Let's convert JSON response to text. Note that at this stage
-    // the rsp pointer is always set.
-    std::string txt = rsp->str();
-    size_t len = txt.length();
-    if (len > 65535) {
-        // Hmm, our response is too large. Let's send the first
-        // 64KB and hope for the best.
-        LOG_ERROR(command_logger, COMMAND_SOCKET_RESPONSE_TOOLARGE).arg(len);
+    // The worker thread checks whether to signal the main thread when it
+    // marks the command done, so both happen under the same lock.
+    Mutex::Locker lock(running_mutex_);
+    std::list<BackgroundCommandPtr>::iterator command = running_.begin();
+    while (command != running_.end()) {
+        if ((*command)->done_) {
+            (*command)->conn_->setBusy(false);
+            ready.push_back((*command)->conn_);
+            command = running_.erase(command);
+
+        } else {
+            if ((*command)->conn_ == waiting) {
+                (*command)->wake_ = true;
+            }
+            ++command;
+        }
+    }
+}
 
-        len = 65535;
+void
+CommandMgr::startWorker() {
+    if (worker_thread_) {
+        return;
     }
 
-    // Send the data back over socket.
-    rval = write(rsp_fd, txt.c_str(), len);
-    int saverr = errno;
+    try {
+        // The worker thread wakes the main thread up through this socket,
+        // which is watched by IfaceMgr along with the DHCP sockets.
+        done_watch_.reset(new WatchSocket());
+        isc::dhcp::IfaceMgr::instance().addExternalSocket(
+            done_watch_->getSelectFd(),
+            boost::bind(&CommandMgr::backgroundCommandsDone, this));
+
+        worker_io_service_.reset(new IOService());
+        worker_thread_.reset(new Thread(boost::bind(&IOService::run,
+                                                    worker_io_service_.get())));
+    } catch (...) {
+        stopWorker();
+        throw;
+    }
+}
 
-    LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE).arg(len).arg(sockfd);
+void
+CommandMgr::stopWorker() {
+    if (worker_thread_) {
+        worker_io_service_->stop();
+        worker_thread_->wait();
+        worker_thread_.reset();
+    }
 
-    if (rval < 0) {
-        // Response transmission failed. Since the response failed, it doesn't
-        // make sense to send any status codes. Let's log it and be done with
-        // it.
-        LOG_ERROR(command_logger, COMMAND_SOCKET_WRITE_FAIL)
-                  .arg(len).arg(sockfd).arg(strerror(saverr));
+    // Destroying the IOService discards the commands not processed yet.
+    worker_io_service_.reset();
+
+    if (done_watch_) {
+        isc::dhcp::IfaceMgr::instance().deleteExternalSocket(
+            done_watch_->getSelectFd());
+        done_watch_.reset();
     }
 
-    // Only close the duped socket if it's different (should be)
-    if (rsp_fd != sockfd) {
-        close(rsp_fd);
+    for (std::list<BackgroundCommandPtr>::const_iterator command =
+             running_.begin(); command != running_.end(); ++command) {
+        (*command)->conn_->setBusy(false);
     }
+    running_.clear();
 }
 
 }; // end of isc::config
@@ -7,10 +7,17 @@
 #ifndef COMMAND_MGR_H
 #define COMMAND_MGR_H
 
+#include <asiolink/io_service.h>
 #include <cc/data.h>
 #include <config/hooked_command_mgr.h>
 #include <config/command_socket.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
+#include <boost/function.hpp>
 #include <boost/noncopyable.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <list>
 
 namespace isc {
@@ -20,9 +27,38 @@ namespace config {
 ///
 /// This class extends @ref BaseCommandMgr with the ability to receive and
 /// respond to commands over unix domain sockets.
+///
+/// The commands received over the sockets are processed in the main thread,
+/// along with the DHCP packets. The commands registered with
+/// @ref registerBackgroundCommand only take a snapshot of the data they
+/// return there, e.g. the current configuration: the response is generated
+/// from the snapshot, serialized and sent by a worker thread, so a large
+/// response doesn't hold up packet processing. The connection doesn't
+/// process further commands until the response is sent.
 class CommandMgr : public HookedCommandMgr, public boost::noncopyable {
 public:
 
+    /// @brief Function generating the response to a command.
+    typedef boost::function<isc::data::ConstElementPtr ()> ResponseGenerator;
+
+    /// @brief Handler of a command which can be processed in background.
+    ///
+    /// The handler is called in the main thread. It checks the parameters
+    /// and takes a snapshot of the data the response is generated from,
+    /// and returns the function generating the response. That function
+    /// may be called in the worker thread, so it must not use any data the
+    /// main thread may modify in the meantime.
+    typedef boost::function<ResponseGenerator (const std::string& name,
+        const isc::data::ConstElementPtr& params)> BackgroundCommandHandler;
+
+    /// @brief Default maximum number of concurrent control connections.
+    static const size_t DEFAULT_MAX_CONNECTIONS = 16;
+
+    /// @brief Maximum size of a command received over a connection.
+    ///
+    /// A connection sending a larger command is closed.
+    static const size_t MAX_COMMAND_SIZE = 64 * 1024 * 1024;
+
     /// @brief CommandMgr is a singleton class. This method returns reference
     /// to its sole instance.
     ///
@@ -34,8 +70,13 @@ public:
     /// Currently supported types are:
     /// - unix (required parameters: socket-type: unix, socket-name:/unix/path)
     ///
+    /// The optional boolean background-commands parameter enables the
+    /// processing of commands in background (see
+    /// @ref setBackgroundCommands).
+    ///
     /// This method will close previously open command socket (if exists).
     ///
+    /// @throw BadSocketInfo if background-commands is not a boolean.
     /// @throw CommandSocketError if socket creation fails.
     /// @throw SocketError if command socket is already open.
     ///
@@ -45,8 +86,56 @@ public:
     openCommandSocket(const isc::data::ConstElementPtr& socket_info);
 
     /// @brief Shuts down any open control sockets
+    ///
+    /// This also stops the worker thread. The responses it was generating
+    /// are not sent.
     void closeCommandSocket();
 
+    /// @brief Registers a command whose response may be generated in
+    /// background
+    ///
+    /// The command is registered as any other command, so it may also be
+    /// processed with @ref processCommand, in which case the response is
+    /// generated right away. It is generated in the worker thread only
+    /// when the command is received over a control connection.
+    ///
+    /// @param cmd Command to be registered.
+    /// @param handler Handler taking the snapshot the response is generated
+    /// from.
+    ///
+    /// @throw InvalidCommandHandler if the handler is empty.
+    /// @throw InvalidCommandName if the command name is invalid or it is
+    /// already registered.
+    void registerBackgroundCommand(const std::string& cmd,
+                                   BackgroundCommandHandler handler);
+
+    /// @brief Returns a function generating a given response.
+    ///
+    /// This is convenient for background command handlers which build the
+    /// response in the main thread, leaving only its serialization and
+    /// sending to the worker thread.
+    ///
+    /// @param response Response to be returned by the function.
+    /// @return Function returning the response.
+    static ResponseGenerator
+    respondWith(const isc::data::ConstElementPtr& response);
+
+    /// @brief Enables or disables processing of commands in background.
+    ///
+    /// When disabled, the responses to all commands are generated in the
+    /// main thread. It is disabled by default and set by
+    /// @ref openCommandSocket from the "background-commands" parameter.
+    ///
+    /// @param enabled true to enable processing in background
+    void setBackgroundCommands(const bool enabled) {
+        background_enabled_ = enabled;
+    }
+
+    /// @brief Checks if processing of commands in background is enabled.
+    bool getBackgroundCommands() const {
+        return (background_enabled_);
+    }
+
     /// @brief Reads data from a socket, parses as JSON command and processes it
     ///
     /// This method is used to handle traffic on connected socket. This callback
@@ -56,6 +145,11 @@ public:
     /// method will close the socket and will uninstall itself from
     /// @ref isc::dhcp::IfaceMgr.
     ///
+    /// The method reads what is available without blocking. A command larger
+    /// than a single read is assembled from several reads, and is processed
+    /// once it is complete. The response is handed to the connection, which
+    /// sends it without blocking.
+    ///
     /// @param sockfd socket descriptor of a connected socket
     static void commandReader(int sockfd);
 
@@ -70,6 +164,26 @@ public:
     /// @return true if closed successfully, false if not found
     bool closeConnection(int fd);
 
+    /// @brief Returns the number of open connections.
+    size_t getConnectionCount() const {
+        return (connections_.size());
+    }
+
+    /// @brief Sets the maximum number of concurrent connections.
+    ///
+    /// The connections accepted above this number are closed right away.
+    /// The connections already open aren't affected.
+    ///
+    /// @param max_connections maximum number of connections
+    void setMaxConnections(size_t max_connections) {
+        max_connections_ = max_connections;
+    }
+
+    /// @brief Returns the maximum number of concurrent connections.
+    size_t getMaxConnections() const {
+        return (max_connections_);
+    }
+
     /// @brief Returns control socket descriptor
     ///
     /// This method should be used only in tests.
@@ -84,6 +198,92 @@ private:
     /// Registers internal 'list-commands' command.
     CommandMgr();
 
+    /// @brief Destructor
+    ///
+    /// Waits for the worker thread to terminate, if it is running.
+    virtual ~CommandMgr();
+
+    /// @brief Returns the connection with a specific socket descriptor
+    ///
+    /// @param fd socket descriptor
+    /// @return pointer to the connection or null pointer if not found
+    ConnectionSocketPtr getConnection(int fd) const;
+
+    /// @brief Checks if a connection is still open
+    ///
+    /// @param conn pointer to the connection
+    /// @return true if the connection is one of the open connections
+    bool hasConnection(const ConnectionSocketPtr& conn) const;
+
+    /// @brief Processes a command received over a connection and responds
+    ///
+    /// @param conn connection the command was received over
+    /// @param command text of the command
+    static void processConnectionCommand(const ConnectionSocketPtr& conn,
+                                         const std::string& command);
+
+    /// @brief Processes the commands received over a connection
+    ///
+    /// The commands are processed until the data received doesn't contain
+    /// a complete command, or until the response to a command is being
+    /// generated in background.
+    ///
+    /// @param conn connection the commands were received over
+    static void processCommands(const ConnectionSocketPtr& conn);
+
+    /// @brief Command handler registered for background commands.
+    ///
+    /// It calls the background command handler. If the command was
+    /// received over a connection, the response generator is kept so as
+    /// it's called in the worker thread. Otherwise it's called right away.
+    ///
+    /// @param handler Background command handler.
+    /// @param name Command name.
+    /// @param params Command parameters.
+    /// @return Response to the command.
+    static isc::data::ConstElementPtr
+    backgroundCommandHandler(const BackgroundCommandHandler& handler,
+                             const std::string& name,
+                             const isc::data::ConstElementPtr& params);
+
+    /// @brief Command being processed in background.
+    struct BackgroundCommand;
+
+    /// @brief Pointer to a command being processed in background.
+    typedef boost::shared_ptr<BackgroundCommand> BackgroundCommandPtr;
+
+    /// @brief Generates and sends the response to a command in the worker
+    /// thread.
+    ///
+    /// @param command Command being processed.
+    static void runBackgroundCommand(const BackgroundCommandPtr& command);
+
+    /// @brief Resumes processing of the connections whose responses have
+    /// been sent by the worker thread.
+    ///
+    /// This is called in the main thread when the worker thread signals
+    /// that it sent the response over a connection with more commands
+    /// waiting.
+    void backgroundCommandsDone();
+
+    /// @brief Collects the commands whose responses have been sent.
+    ///
+    /// The connections they were received over are no longer busy. If the
+    /// response over the specified connection isn't sent yet, the worker
+    /// is asked to signal the main thread when it is, so as the commands
+    /// waiting are processed.
+    ///
+    /// @param waiting connection with commands waiting, may be null
+    /// @param [out] ready connections no longer busy
+    void collectBackgroundCommands(const ConnectionSocketPtr& waiting,
+                                   std::list<ConnectionSocketPtr>& ready);
+
+    /// @brief Starts the worker thread if it isn't running yet.
+    void startWorker();
+
+    /// @brief Stops the worker thread.
+    void stopWorker();
+
     /// @brief Control socket structure
     ///
     /// This is the socket that accepts incoming connections. There can be at
@@ -95,6 +295,38 @@ private:
     /// These are the sockets that are dedicated to handle a specific connection.
     /// Their number is equal to number of current control connections.
     std::list<CommandSocketPtr> connections_;
+
+    /// @brief Maximum number of concurrent connections
+    size_t max_connections_;
+
+    /// @brief Indicates if commands are processed in background.
+    bool background_enabled_;
+
+    /// @brief Indicates if the command being processed was received over
+    /// a connection and may be processed in background.
+    bool defer_;
+
+    /// @brief Response generator returned by a background command handler.
+    ResponseGenerator deferred_;
+
+    /// @brief IOService run by the worker thread.
+    asiolink::IOServicePtr worker_io_service_;
+
+    /// @brief Worker thread.
+    boost::scoped_ptr<util::thread::Thread> worker_thread_;
+
+    /// @brief Commands passed to the worker thread and not collected yet.
+    ///
+    /// The list itself is only used by the main thread.
+    std::list<BackgroundCommandPtr> running_;
+
+    /// @brief Protects the completion state of the commands in
+    /// @c running_.
+    util::thread::Mutex running_mutex_;
+
+    /// @brief Watch socket signalling the main thread that the commands
+    /// waiting over a connection may be processed.
+    util::WatchSocketPtr done_watch_;
 };
 
 }; // end of isc::config namespace
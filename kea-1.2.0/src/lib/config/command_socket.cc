@@ -1,4 +1,4 @@
-// Copyright (C) 2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,12 +9,23 @@
 #include <config/config_log.h>
 #include <dhcp/iface_mgr.h>
 #include <boost/bind.hpp>
+#include <sys/socket.h>
+#include <cctype>
+#include <errno.h>
+#include <string.h>
 #include <unistd.h>
 
+// Not all systems can disable SIGPIPE for a single send.
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
 namespace isc {
 namespace config {
 
-ConnectionSocket::ConnectionSocket(int sockfd) {
+ConnectionSocket::ConnectionSocket(int sockfd)
+    : input_(), scanned_(0), depth_(0), in_string_(false), escaped_(false),
+      output_(), output_sent_(0), sending_(false), busy_(false) {
     sockfd_ = sockfd;
 
     // Install commandReader callback. When there's any data incoming on this
@@ -27,17 +38,150 @@ ConnectionSocket::ConnectionSocket(int sockfd) {
 void ConnectionSocket::close() {
     LOG_INFO(command_logger, COMMAND_SOCKET_CONNECTION_CLOSED).arg(sockfd_);
 
-    // Unregister this callback
+    // Unregister the callbacks
     isc::dhcp::IfaceMgr::instance().deleteExternalSocket(sockfd_);
+    if (sending_) {
+        isc::dhcp::IfaceMgr::instance().deleteExternalWriteSocket(sockfd_);
+        sending_ = false;
+    }
+    output_.clear();
+    output_sent_ = 0;
 
     // We're closing a connection, not the whole socket. It's ok to just
-    // close the connection and don't delete anything.
+    // close the connection and don't delete anything. The descriptor is
+    // forgotten, as it may be reused before this object is destroyed.
     ::close(sockfd_);
+    sockfd_ = -1;
 }
 
 void ConnectionSocket::receiveHandler() {
     CommandMgr::instance().commandReader(sockfd_);
 }
 
+void ConnectionSocket::appendInput(const char* data, size_t length) {
+    input_.append(data, length);
+}
+
+bool ConnectionSocket::getCommand(std::string& command) {
+    // The input is scanned from where the previous call stopped, so as a
+    // command received in many pieces is scanned only once.
+    for (; scanned_ < input_.size(); ++scanned_) {
+        const char c = input_[scanned_];
+
+        if (in_string_) {
+            if (escaped_) {
+                escaped_ = false;
+            } else if (c == '\\') {
+                escaped_ = true;
+            } else if (c == '"') {
+                in_string_ = false;
+            }
+            continue;
+        }
+
+        if (depth_ == 0) {
+            // Whitespace preceding the command is skipped. Anything else
+            // than a map or a list there isn't a command we could wait for
+            // the end of, so it is returned as it is.
+            if ((c == '{') || (c == '[')) {
+                depth_ = 1;
+            } else if (!isspace(static_cast<unsigned char>(c))) {
+                command.swap(input_);
+                input_.clear();
+                scanned_ = 0;
+                return (true);
+            }
+            continue;
+        }
+
+        switch (c) {
+        case '"':
+            in_string_ = true;
+            break;
+
+        case '{':
+        case '[':
+            ++depth_;
+            break;
+
+        case '}':
+        case ']':
+            if (--depth_ == 0) {
+                // The map or list the command begins with is closed.
+                command = input_.substr(0, scanned_ + 1);
+                input_.erase(0, scanned_ + 1);
+                scanned_ = 0;
+                return (true);
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return (false);
+}
+
+void ConnectionSocket::sendResponse(const std::string& response) {
+    output_.append(response);
+    send();
+}
+
+void ConnectionSocket::sendHandler() {
+    send();
+}
+
+void ConnectionSocket::send() {
+    while (output_sent_ < output_.size()) {
+        ssize_t rval = ::send(sockfd_, output_.data() + output_sent_,
+                              output_.size() - output_sent_, MSG_NOSIGNAL);
+        if (rval >= 0) {
+            output_sent_ += rval;
+            continue;
+        }
+
+        if (errno == EINTR) {
+            continue;
+        }
+
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            // The peer hasn't read enough yet. Send the rest when the
+            // socket becomes writable.
+            LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE_PENDING)
+                .arg(output_sent_).arg(sockfd_)
+                .arg(output_.size() - output_sent_);
+            if (!sending_) {
+                isc::dhcp::IfaceMgr::instance().addExternalWriteSocket(sockfd_,
+                    boost::bind(&ConnectionSocket::sendHandler, this));
+                sending_ = true;
+            }
+            return;
+        }
+
+        // Response transmission failed. Since the response failed, it doesn't
+        // make sense to send any status codes. Let's log it and be done with
+        // it.
+        const char* errmsg = strerror(errno);
+        LOG_ERROR(command_logger, COMMAND_SOCKET_WRITE_FAIL)
+            .arg(output_.size() - output_sent_).arg(sockfd_).arg(errmsg);
+        output_sent_ = 0;
+        output_.clear();
+        break;
+    }
+
+    if (!output_.empty()) {
+        LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE)
+            .arg(output_.size()).arg(sockfd_);
+        output_sent_ = 0;
+        output_.clear();
+    }
+
+    if (sending_) {
+        isc::dhcp::IfaceMgr::instance().deleteExternalWriteSocket(sockfd_);
+        sending_ = false;
+    }
+}
+
 };
 };
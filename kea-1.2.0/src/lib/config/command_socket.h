@@ -8,6 +8,8 @@
 #define COMMAND_SOCKET_H
 
 #include <cc/data.h>
+#include <boost/shared_ptr.hpp>
+#include <string>
 #include <unistd.h>
 
 namespace isc {
@@ -76,6 +78,12 @@ typedef boost::shared_ptr<CommandSocket> CommandSocketPtr;
 /// @ref UnixCommandSocket). Once incoming connection is detected, that class
 /// calls accept(), which returns a new socket dedicated to handling that
 /// specific connection. That socket is represented by this class.
+///
+/// The socket is non-blocking. The commands may arrive in several pieces,
+/// which are assembled until a complete JSON text is received. The
+/// responses are sent without blocking too: what can't be sent right away
+/// is sent when the socket becomes writable, so a peer slowly reading a
+/// large response doesn't hold up the server.
 class ConnectionSocket : public CommandSocket {
 public:
     /// @brief Default constructor
@@ -92,13 +100,108 @@ public:
     /// This method calls isc::config::CommandMgr::commandReader method.
     virtual void receiveHandler();
 
+    /// @brief Appends received data to the command being assembled.
+    ///
+    /// @param data pointer to the received data
+    /// @param length number of bytes received
+    void appendInput(const char* data, size_t length);
+
+    /// @brief Returns the next complete command received, if any.
+    ///
+    /// A command is complete when the JSON map or list it begins with is
+    /// closed. Anything else is returned as a whole, leaving the error
+    /// to the JSON parser.
+    ///
+    /// @param [out] command text of the command
+    /// @return true if a command was returned, false if more data is needed
+    bool getCommand(std::string& command);
+
+    /// @brief Returns the number of bytes received but not yet returned
+    /// as a command.
+    size_t getInputSize() const {
+        return (input_.size());
+    }
+
+    /// @brief Sends a response without blocking.
+    ///
+    /// As much of the response as the socket accepts is sent right away.
+    /// The rest is sent by @ref sendHandler, which is installed in
+    /// @ref isc::dhcp::IfaceMgr until the whole response is sent.
+    ///
+    /// @param response text of the response
+    void sendResponse(const std::string& response);
+
+    /// @brief Method used to send the pending response data
+    ///
+    /// This is called by @ref isc::dhcp::IfaceMgr when the socket is
+    /// writable.
+    void sendHandler();
+
+    /// @brief Returns the number of bytes of responses not sent yet.
+    size_t getOutputSize() const {
+        return (output_.size() - output_sent_);
+    }
+
+    /// @brief Marks the connection as waiting for a response generated
+    /// in background.
+    ///
+    /// The commands received over a busy connection are kept until the
+    /// response is sent, so as the responses are sent in order.
+    ///
+    /// @param busy true when the response is being generated
+    void setBusy(const bool busy) {
+        busy_ = busy;
+    }
+
+    /// @brief Checks if the connection waits for a response generated in
+    /// background.
+    bool isBusy() const {
+        return (busy_);
+    }
+
     /// @brief Closes socket.
     ///
     /// This method closes the socket, prints appropriate log message and
-    /// unregisters callback from @ref isc::dhcp::IfaceMgr.
+    /// unregisters callbacks from @ref isc::dhcp::IfaceMgr. Pending
+    /// responses are discarded.
     virtual void close();
+
+private:
+    /// @brief Sends as much of the pending response data as possible.
+    void send();
+
+    /// @brief Data received but not yet returned as a command.
+    std::string input_;
+
+    /// @brief Position in the input up to which it has been scanned.
+    size_t scanned_;
+
+    /// @brief Nesting depth of JSON maps and lists at the scanned position.
+    int depth_;
+
+    /// @brief Indicates if the scanned position is within a JSON string.
+    bool in_string_;
+
+    /// @brief Indicates if the previous scanned character is a backslash
+    /// within a string.
+    bool escaped_;
+
+    /// @brief Responses being sent.
+    std::string output_;
+
+    /// @brief Number of bytes of the output already sent.
+    size_t output_sent_;
+
+    /// @brief Indicates if the write callback is installed in IfaceMgr.
+    bool sending_;
+
+    /// @brief Indicates if a response is generated in background.
+    bool busy_;
 };
 
+/// Pointer to a connection socket object
+typedef boost::shared_ptr<ConnectionSocket> ConnectionSocketPtr;
+
 };
 };
 
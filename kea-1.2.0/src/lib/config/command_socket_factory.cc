@@ -108,9 +108,8 @@ private:
 
         // One means that we allow at most 1 awaiting connections.
         // Any additional attempts will get ECONNREFUSED error.
-        // That means that at any given time, there may be at most one controlling
-        // connection.
-        /// @todo: Make the number of parallel connections configurable.
+        // The number of connections accepted and open at the same time is
+        // limited by CommandMgr::getMaxConnections().
         int status = listen(fd, 1);
         if (status < 0) {
             const char* errmsg = strerror(errno);
@@ -152,6 +151,16 @@ private:
             return;
         }
 
+        // Each connection takes a socket and a buffer for the response being
+        // sent, so their number is limited.
+        if (CommandMgr::instance().getConnectionCount() >=
+            CommandMgr::instance().getMaxConnections()) {
+            LOG_WARN(command_logger, COMMAND_SOCKET_CONNECTION_LIMIT)
+                .arg(sockfd_).arg(CommandMgr::instance().getConnectionCount());
+            ::close(fd2);
+            return;
+        }
+
         // And now create an object that represents that new connection.
         CommandSocketPtr conn(new ConnectionSocket(fd2));
 
@@ -13,11 +13,24 @@
 #include <hooks/hooks_manager.h>
 #include <hooks/callout_handle.h>
 #include <hooks/library_handle.h>
+#include <dhcp/iface_mgr.h>
+#include <boost/bind.hpp>
+#include <cstdio>
+#include <cstdlib>
 #include <string>
 #include <vector>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
 
 using namespace isc::config;
 using namespace isc::data;
+using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace std;
 
@@ -490,3 +503,374 @@ TEST_F(CommandMgrTest, modifyCommandArgsInHook) {
     EXPECT_EQ("response", callout_argument_names[1]);
 
 }
+
+/// @brief Test class for commands received over the command socket.
+class CommandMgrSocketTest : public CommandMgrTest {
+public:
+
+    /// @brief Constructor
+    ///
+    /// Opens the command socket.
+    CommandMgrSocketTest()
+        : CommandMgrTest(), socket_path_(getSocketPath()),
+          main_thread_(pthread_self()), generated_in_main_(false) {
+        static_cast<void>(remove(socket_path_.c_str()));
+        release_[0] = release_[1] = -1;
+
+        ElementPtr socket_info = Element::createMap();
+        socket_info->set("socket-type", Element::create("unix"));
+        socket_info->set("socket-name", Element::create(socket_path_));
+        CommandMgr::instance().openCommandSocket(socket_info);
+    }
+
+    /// @brief Destructor
+    ///
+    /// Closes the clients and the command socket.
+    virtual ~CommandMgrSocketTest() {
+        for (std::vector<int>::const_iterator fd = clients_.begin();
+             fd != clients_.end(); ++fd) {
+            close(*fd);
+        }
+        // Closing the pipe releases the response generator if it waits.
+        if (release_[1] >= 0) {
+            close(release_[1]);
+        }
+        CommandMgr::instance().closeCommandSocket();
+        if (release_[0] >= 0) {
+            close(release_[0]);
+        }
+        CommandMgr::instance().setMaxConnections(
+            CommandMgr::DEFAULT_MAX_CONNECTIONS);
+        CommandMgr::instance().setBackgroundCommands(false);
+        static_cast<void>(remove(socket_path_.c_str()));
+    }
+
+    /// @brief Returns socket path (using either hardcoded path or env variable)
+    /// @return path to the unix socket
+    std::string getSocketPath() {
+        std::string socket_path;
+        const char* env = getenv("KEA_SOCKET_TEST_DIR");
+        if (env) {
+            socket_path = std::string(env) + "/test-socket";
+        } else {
+            socket_path = std::string(TEST_DATA_BUILDDIR) + "/test-socket";
+        }
+        return (socket_path);
+    }
+
+    /// @brief Connects a non-blocking client to the command socket.
+    ///
+    /// The connection is accepted by the server.
+    ///
+    /// @return client socket descriptor or -1 on failure
+    int connectClient() {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0) {
+            ADD_FAILURE() << "socket failed: " << strerror(errno);
+            return (-1);
+        }
+        clients_.push_back(fd);
+
+        struct sockaddr_un addr;
+        memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        strncpy(addr.sun_path, socket_path_.c_str(), sizeof(addr.sun_path) - 1);
+        if (connect(fd, reinterpret_cast<struct sockaddr*>(&addr),
+                    sizeof(addr)) < 0) {
+            ADD_FAILURE() << "connect failed: " << strerror(errno);
+            return (-1);
+        }
+        if (fcntl(fd, F_SETFL, O_NONBLOCK) < 0) {
+            ADD_FAILURE() << "fcntl failed: " << strerror(errno);
+            return (-1);
+        }
+
+        // Let the server accept the connection.
+        IfaceMgr::instance().receive4(0, 100000);
+        return (fd);
+    }
+
+    /// @brief Sends a command and receives the response.
+    ///
+    /// The client sends and receives without blocking and the server is
+    /// run in between, so as the command and the response may be larger
+    /// than the socket buffers.
+    ///
+    /// @param fd client socket descriptor
+    /// @param command text of the command
+    /// @param [out] response text of the response
+    void exchange(int fd, const std::string& command, std::string& response) {
+        size_t sent = 0;
+        response.clear();
+        for (int i = 0; i < 100000; ++i) {
+            if (sent < command.size()) {
+                ssize_t len = send(fd, command.data() + sent,
+                                   command.size() - sent, 0);
+                if (len > 0) {
+                    sent += len;
+                }
+            }
+
+            IfaceMgr::instance().receive4(0, 10000);
+
+            char buf[65536];
+            ssize_t len = recv(fd, buf, sizeof(buf), 0);
+            if (len > 0) {
+                response.append(buf, len);
+                if (response[response.size() - 1] != '}') {
+                    continue;
+                }
+                try {
+                    Element::fromJSON(response);
+                    return;
+                } catch (const std::exception&) {
+                    // Incomplete response.
+                }
+            }
+        }
+        ADD_FAILURE() << "incomplete response of " << response.size()
+                      << " bytes";
+    }
+
+    /// @brief Receives a response without running the server.
+    ///
+    /// @param fd client socket descriptor
+    /// @param [out] response text of the response
+    void receiveResponse(int fd, std::string& response) {
+        response.clear();
+        for (int i = 0; i < 100; ++i) {
+            struct pollfd pfd;
+            pfd.fd = fd;
+            pfd.events = POLLIN;
+            pfd.revents = 0;
+            if (poll(&pfd, 1, 100) <= 0) {
+                continue;
+            }
+
+            char buf[65536];
+            ssize_t len = recv(fd, buf, sizeof(buf), 0);
+            if (len > 0) {
+                response.append(buf, len);
+                try {
+                    Element::fromJSON(response);
+                    return;
+                } catch (const std::exception&) {
+                    // Incomplete response.
+                }
+            }
+        }
+        ADD_FAILURE() << "incomplete response of " << response.size()
+                      << " bytes";
+    }
+
+    /// @brief A command handler returning its arguments.
+    static ConstElementPtr echo_handler(const std::string& /*name*/,
+                                        const ConstElementPtr& params) {
+        return (createAnswer(0, params));
+    }
+
+    /// @brief A background command handler.
+    ///
+    /// @return function generating the response
+    CommandMgr::ResponseGenerator
+    background_handler(const std::string& /*name*/,
+                       const ConstElementPtr& /*params*/) {
+        return (boost::bind(&CommandMgrSocketTest::generate, this));
+    }
+
+    /// @brief Generates the response to the background command.
+    ///
+    /// It records the thread it is called in and waits for the test
+    /// to release it, if the test asked for it.
+    ConstElementPtr generate() {
+        generated_in_main_ = pthread_equal(pthread_self(), main_thread_);
+        if (release_[0] >= 0) {
+            char c;
+            static_cast<void>(read(release_[0], &c, 1));
+        }
+        return (createAnswer(0, "generated"));
+    }
+
+    /// @brief Path of the command socket.
+    std::string socket_path_;
+
+    /// @brief Descriptors of the client sockets.
+    std::vector<int> clients_;
+
+    /// @brief Main thread of the test.
+    pthread_t main_thread_;
+
+    /// @brief Indicates if the response was generated in the main thread.
+    bool generated_in_main_;
+
+    /// @brief Pipe releasing the response generator.
+    int release_[2];
+};
+
+// This test verifies that a command and a response larger than a single
+// read and than the socket buffers are received and sent in full.
+TEST_F(CommandMgrSocketTest, largeCommandAndResponse) {
+    CommandMgr::instance().registerCommand("echo", echo_handler);
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+
+    ElementPtr params = Element::createList();
+    params->add(Element::create(std::string(2 * 1024 * 1024, 'x')));
+    ConstElementPtr command = createCommand("echo", params);
+
+    std::string response;
+    ASSERT_NO_FATAL_FAILURE(exchange(fd, command->str(), response));
+
+    ConstElementPtr answer;
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    int status_code;
+    ConstElementPtr answer_arg = parseAnswer(status_code, answer);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status_code);
+    ASSERT_TRUE(answer_arg);
+    EXPECT_TRUE(answer_arg->equals(*params));
+}
+
+// This test verifies that a command received in several pieces is only
+// processed once complete and that the commands sent together are all
+// processed.
+TEST_F(CommandMgrSocketTest, partialCommands) {
+    CommandMgr::instance().registerCommand("my-command", my_handler);
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+
+    // The first half of the command isn't processed.
+    std::string part = "{ \"command\": \"my-com";
+    ASSERT_EQ(part.size(), send(fd, part.data(), part.size(), 0));
+    IfaceMgr::instance().receive4(0, 100000);
+    EXPECT_FALSE(handler_called);
+
+    // The end of the command comes with another command.
+    part = "mand\", \"arguments\": { \"a\": \"}\" } }"
+        " { \"command\": \"list-commands\" }";
+    ASSERT_EQ(part.size(), send(fd, part.data(), part.size(), 0));
+    IfaceMgr::instance().receive4(0, 100000);
+    EXPECT_TRUE(handler_called);
+    ASSERT_TRUE(handler_params);
+    EXPECT_EQ("{ \"a\": \"}\" }", handler_params->str());
+
+    // Both responses have been sent.
+    char buf[65536];
+    ssize_t len = recv(fd, buf, sizeof(buf), 0);
+    ASSERT_GT(len, 0);
+    std::string response(buf, len);
+    EXPECT_NE(std::string::npos, response.find("test error message"));
+    EXPECT_NE(std::string::npos, response.find("my-command\" ]"));
+}
+
+// This test verifies that the connections above the limit are closed.
+TEST_F(CommandMgrSocketTest, maxConnections) {
+    CommandMgr::instance().setMaxConnections(1);
+    EXPECT_EQ(1, CommandMgr::instance().getMaxConnections());
+
+    int fd1 = connectClient();
+    ASSERT_GE(fd1, 0);
+    EXPECT_EQ(1, CommandMgr::instance().getConnectionCount());
+
+    // The second connection is closed by the server.
+    int fd2 = connectClient();
+    ASSERT_GE(fd2, 0);
+    EXPECT_EQ(1, CommandMgr::instance().getConnectionCount());
+    char c;
+    EXPECT_EQ(0, recv(fd2, &c, 1, 0));
+
+    // The first one still works.
+    std::string response;
+    ASSERT_NO_FATAL_FAILURE(exchange(fd1, "{ \"command\": \"list-commands\" }",
+                                     response));
+    EXPECT_NE(std::string::npos, response.find("list-commands"));
+}
+
+// This test verifies that the response to a background command is
+// generated and sent by the worker thread and that the commands received
+// in the meantime are processed once it is sent.
+TEST_F(CommandMgrSocketTest, backgroundCommand) {
+    CommandMgr::instance().registerBackgroundCommand("background",
+        boost::bind(&CommandMgrSocketTest::background_handler, this, _1, _2));
+    CommandMgr::instance().setBackgroundCommands(true);
+    ASSERT_EQ(0, pipe(release_));
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+
+    std::string commands = "{ \"command\": \"background\" }"
+        " { \"command\": \"list-commands\" }";
+    ASSERT_EQ(commands.size(), send(fd, commands.data(), commands.size(), 0));
+    IfaceMgr::instance().receive4(0, 100000);
+
+    // The response is being generated, so nothing has been sent yet. The
+    // second command waits for the response to be sent.
+    char buf[1024];
+    EXPECT_GT(0, recv(fd, buf, sizeof(buf), 0));
+    IfaceMgr::instance().receive4(0, 10000);
+    EXPECT_GT(0, recv(fd, buf, sizeof(buf), 0));
+
+    // The response is sent by the worker thread without the main thread
+    // running.
+    ASSERT_EQ(1, write(release_[1], "x", 1));
+    std::string response;
+    ASSERT_NO_FATAL_FAILURE(receiveResponse(fd, response));
+    EXPECT_FALSE(generated_in_main_);
+    EXPECT_NE(std::string::npos, response.find("generated"));
+    EXPECT_EQ(std::string::npos, response.find("list-commands"));
+
+    // The main thread is woken up and processes the second command.
+    ASSERT_NO_FATAL_FAILURE(exchange(fd, "", response));
+    EXPECT_NE(std::string::npos, response.find("background"));
+}
+
+// This test verifies that the response to a background command is
+// generated right away when the background processing is disabled or the
+// command is not received over a connection.
+TEST_F(CommandMgrSocketTest, backgroundCommandDisabled) {
+    CommandMgr::instance().registerBackgroundCommand("background",
+        boost::bind(&CommandMgrSocketTest::background_handler, this, _1, _2));
+
+    ConstElementPtr answer = CommandMgr::instance().processCommand(
+        createCommand("background"));
+    ASSERT_TRUE(answer);
+    EXPECT_TRUE(generated_in_main_);
+    EXPECT_NE(std::string::npos, answer->str().find("generated"));
+
+    // The background processing is disabled by default.
+    EXPECT_FALSE(CommandMgr::instance().getBackgroundCommands());
+    generated_in_main_ = false;
+
+    int fd = connectClient();
+    ASSERT_GE(fd, 0);
+
+    std::string response;
+    ASSERT_NO_FATAL_FAILURE(exchange(fd, "{ \"command\": \"background\" }",
+                                     response));
+    EXPECT_TRUE(generated_in_main_);
+    EXPECT_NE(std::string::npos, response.find("generated"));
+}
+
+// This test verifies that the background processing is enabled by the
+// background-commands parameter of the control socket.
+TEST_F(CommandMgrSocketTest, backgroundCommandsParameter) {
+    CommandMgr::instance().closeCommandSocket();
+
+    ElementPtr socket_info = Element::createMap();
+    socket_info->set("socket-type", Element::create("unix"));
+    socket_info->set("socket-name", Element::create(socket_path_));
+    socket_info->set("background-commands", Element::create("true"));
+    EXPECT_THROW(CommandMgr::instance().openCommandSocket(socket_info),
+                 BadSocketInfo);
+
+    socket_info->set("background-commands", Element::create(true));
+    ASSERT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+    EXPECT_TRUE(CommandMgr::instance().getBackgroundCommands());
+
+    // The parameter is not inherited by the next socket.
+    CommandMgr::instance().closeCommandSocket();
+    socket_info->remove("background-commands");
+    ASSERT_NO_THROW(CommandMgr::instance().openCommandSocket(socket_info));
+    EXPECT_FALSE(CommandMgr::instance().getBackgroundCommands());
+}
@@ -17,6 +17,8 @@
 
 #include <cryptolink/botan_common.h>
 
+#include <algorithm>
+
 #if BOTAN_VERSION_CODE < BOTAN_VERSION_CODE_FOR(1,11,0)
 #define secure_vector SecureVector
 #endif
@@ -37,7 +39,7 @@ public:
     /// @param hash_algorithm The hash algorithm
     explicit HMACImpl(const void* secret, size_t secret_len,
                       const HashAlgorithm hash_algorithm)
-    : hash_algorithm_(hash_algorithm), hmac_() {
+    : hash_algorithm_(hash_algorithm), hmac_(), key_() {
         Botan::HashFunction* hash;
         try {
             const std::string& name =
@@ -78,19 +80,20 @@ public:
             size_t block_length = 0;
 #endif
             if (secret_len > block_length) {
-                Botan::secure_vector<Botan::byte> hashed_key =
-                    hash->process(static_cast<const Botan::byte*>(secret),
-                                  secret_len);
-                hmac_->set_key(&hashed_key[0], hashed_key.size());
+                key_ = hash->process(static_cast<const Botan::byte*>(secret),
+                                     secret_len);
             } else {
                 // Botan 1.8 considers len 0 a bad key. 1.9 does not,
                 // but we won't accept it anyway, and fail early
                 if (secret_len == 0) {
                     isc_throw(BadKey, "Bad HMAC secret length: 0");
                 }
-                hmac_->set_key(static_cast<const Botan::byte*>(secret),
-                               secret_len);
+                const Botan::byte* secret_ptr =
+                    static_cast<const Botan::byte*>(secret);
+                key_.resize(secret_len);
+                std::copy(secret_ptr, secret_ptr + secret_len, key_.begin());
             }
+            hmac_->set_key(&key_[0], key_.size());
         } catch (const Botan::Invalid_Key_Length& ikl) {
             isc_throw(BadKey, ikl.what());
         } catch (const Botan::Exception& exc) {
@@ -98,6 +101,22 @@ public:
         }
     }
 
+    /// @brief Copy constructor
+    ///
+    /// See @ref isc::cryptolink::HMAC::clone() for details.
+    ///
+    /// @param other The implementation to copy the key from
+    HMACImpl(const HMACImpl& other)
+    : hash_algorithm_(other.hash_algorithm_), hmac_(), key_(other.key_) {
+        try {
+            // The clone has the same hash function but no key.
+            hmac_.reset(static_cast<Botan::HMAC*>(other.hmac_->clone()));
+            hmac_->set_key(&key_[0], key_.size());
+        } catch (const Botan::Exception& exc) {
+            isc_throw(LibraryError, "Botan error: " << exc.what());
+        }
+    }
+
     /// @brief Destructor
     ~HMACImpl() {
     }
@@ -216,6 +235,9 @@ private:
 
     /// @brief The digest cache for multiple verify
     Botan::secure_vector<Botan::byte> digest_;
+
+    /// @brief The key used by the HMAC object, kept for copies
+    Botan::secure_vector<Botan::byte> key_;
 };
 
 HMAC::HMAC(const void* secret, size_t secret_length,
@@ -224,6 +246,14 @@ HMAC::HMAC(const void* secret, size_t secret_length,
     impl_ = new HMACImpl(secret, secret_length, hash_algorithm);
 }
 
+HMAC::HMAC(HMACImpl* impl) : impl_(impl) {
+}
+
+HMAC*
+HMAC::clone() const {
+    return (new HMAC(new HMACImpl(*impl_)));
+}
+
 HMAC::~HMAC() {
     delete impl_;
 }
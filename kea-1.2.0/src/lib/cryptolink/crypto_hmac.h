@@ -48,10 +48,39 @@ private:
     friend HMAC* CryptoLink::createHMAC(const void*, size_t,
                                         const HashAlgorithm);
 
+    /// \brief Constructor from an implementation
+    ///
+    /// Used by clone()
+    ///
+    /// \param impl The implementation, the object takes its ownership
+    explicit HMAC(HMACImpl* impl);
+
 public:
     /// \brief Destructor
     ~HMAC();
 
+    /// \brief Create a new HMAC object with the same secret
+    ///
+    /// The returned object has the same secret and hash algorithm as
+    /// this one but none of the data added to it so far, i.e. it is in
+    /// the same state as a newly created object. This is cheaper than
+    /// CryptoLink::createHMAC() as the secret is not processed again,
+    /// so an object created once for a long lived secret can be used
+    /// as a template for the HMAC computed for each message.
+    ///
+    /// This method doesn't modify this object, so it may be called
+    /// concurrently from several threads as long as no data is added
+    /// to this object.
+    ///
+    /// The caller is responsible for deleting the returned object,
+    /// e.g. with deleteHMAC().
+    ///
+    /// \exception LibraryError if there was any unexpected exception
+    ///                         in the underlying library
+    ///
+    /// \return a pointer to the new HMAC object
+    HMAC* clone() const;
+
     /// \brief Returns the HashAlgorithm of the object
     ///
     /// \return hash algorithm
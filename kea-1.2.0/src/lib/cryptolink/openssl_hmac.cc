@@ -56,6 +56,27 @@ public:
         }
     }
 
+    /// @brief Copy constructor
+    ///
+    /// See @ref isc::cryptolink::HMAC::clone() for details.
+    ///
+    /// @param other The implementation to copy the keyed context from
+    HMACImpl(const HMACImpl& other)
+    : hash_algorithm_(other.hash_algorithm_), md_() {
+        md_ = HMAC_CTX_new();
+        if (md_ == 0) {
+            isc_throw(LibraryError, "OpenSSL HMAC_CTX_new() failed");
+        }
+
+        // Copy the context and reset it to the initial state with the
+        // same key, discarding the data digested by the other context.
+        if (!HMAC_CTX_copy(md_, other.md_) ||
+            !HMAC_Init_ex(md_, NULL, 0, NULL, NULL)) {
+            HMAC_CTX_free(md_);
+            isc_throw(LibraryError, "OpenSSL HMAC_CTX_copy() failed");
+        }
+    }
+
     /// @brief Destructor
     ~HMACImpl() {
         if (md_) {
@@ -180,6 +201,14 @@ HMAC::HMAC(const void* secret, size_t secret_length,
     impl_ = new HMACImpl(secret, secret_length, hash_algorithm);
 }
 
+HMAC::HMAC(HMACImpl* impl) : impl_(impl) {
+}
+
+HMAC*
+HMAC::clone() const {
+    return (new HMAC(new HMACImpl(*impl_)));
+}
+
 HMAC::~HMAC() {
     delete impl_;
 }
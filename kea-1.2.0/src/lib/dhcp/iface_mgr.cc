@@ -318,9 +318,58 @@ IfaceMgr::deleteExternalSocket(int socketfd) {
     }
 }
 
+void
+IfaceMgr::addExternalWriteSocket(int socketfd, SocketCallback callback) {
+    if (socketfd < 0) {
+        isc_throw(BadValue, "Attempted to install write callback for invalid"
+                  " socket " << socketfd);
+    }
+    for (SocketCallbackInfoContainer::iterator s = write_callbacks_.begin();
+         s != write_callbacks_.end(); ++s) {
+        if (s->socket_ == socketfd) {
+            s->callback_ = callback;
+            return;
+        }
+    }
+
+    SocketCallbackInfo x;
+    x.socket_ = socketfd;
+    x.callback_ = callback;
+    write_callbacks_.push_back(x);
+}
+
+void
+IfaceMgr::deleteExternalWriteSocket(int socketfd) {
+    for (SocketCallbackInfoContainer::iterator s = write_callbacks_.begin();
+         s != write_callbacks_.end(); ++s) {
+        if (s->socket_ == socketfd) {
+            write_callbacks_.erase(s);
+            return;
+        }
+    }
+}
+
 void
 IfaceMgr::deleteAllExternalSockets() {
     callbacks_.clear();
+    write_callbacks_.clear();
+}
+
+int
+IfaceMgr::callWriteCallbacks(const fd_set& sockets) {
+    // The callbacks are likely to remove themselves from the list once they
+    // have sent everything, so they are collected before being called.
+    std::vector<SocketCallback> writable;
+    BOOST_FOREACH(SocketCallbackInfo s, write_callbacks_) {
+        if (FD_ISSET(s.socket_, &sockets) && s.callback_) {
+            writable.push_back(s.callback_);
+        }
+    }
+
+    BOOST_FOREACH(SocketCallback callback, writable) {
+        callback();
+    }
+    return (static_cast<int>(writable.size()));
 }
 
 void
@@ -891,6 +940,16 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     fd_set sockets;
     int maxfd = 0;
 
+    // If the packet filter holds received packets (e.g. the rest of a
+    // receive ring block), return the next one without calling select().
+    BOOST_FOREACH(iface, ifaces_) {
+        BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
+            if (s.addr_.isV4() && packet_filter_->hasBufferedPackets(s)) {
+                return (packet_filter_->receive(*iface, s));
+            }
+        }
+    }
+
     FD_ZERO(&sockets);
 
     /// @todo: marginal performance optimization. We could create the set once
@@ -928,7 +987,19 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     // zero out the errno to be safe
     errno = 0;
 
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    // Sockets with some data waiting to be sent are watched for being
+    // writable.
+    fd_set write_sockets;
+    FD_ZERO(&write_sockets);
+    BOOST_FOREACH(SocketCallbackInfo s, write_callbacks_) {
+        FD_SET(s.socket_, &write_sockets);
+        if (maxfd < s.socket_) {
+            maxfd = s.socket_;
+        }
+    }
+
+    int result = select(maxfd + 1, &sockets, &write_sockets, NULL,
+                        &select_timeout);
 
     if (result == 0) {
         // nothing received and timeout has been reached
@@ -949,6 +1020,14 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         }
     }
 
+    // Continue sending the data waiting for the writable external sockets.
+    if (!write_callbacks_.empty()) {
+        result -= callWriteCallbacks(write_sockets);
+        if (result <= 0) {
+            return (Pkt4Ptr());
+        }
+    }
+
     // Let's find out which socket has the data
     BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
         if (!FD_ISSET(s.socket_, &sockets)) {
@@ -1038,7 +1117,19 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     // zero out the errno to be safe
     errno = 0;
 
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    // Sockets with some data waiting to be sent are watched for being
+    // writable.
+    fd_set write_sockets;
+    FD_ZERO(&write_sockets);
+    BOOST_FOREACH(SocketCallbackInfo s, write_callbacks_) {
+        FD_SET(s.socket_, &write_sockets);
+        if (maxfd < s.socket_) {
+            maxfd = s.socket_;
+        }
+    }
+
+    int result = select(maxfd + 1, &sockets, &write_sockets, NULL,
+                        &select_timeout);
 
     if (result == 0) {
         // nothing received and timeout has been reached
@@ -1059,6 +1150,14 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         }
     }
 
+    // Continue sending the data waiting for the writable external sockets.
+    if (!write_callbacks_.empty()) {
+        result -= callWriteCallbacks(write_sockets);
+        if (result <= 0) {
+            return (Pkt6Ptr());
+        }
+    }
+
     // Let's find out which socket has the data
     BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
         if (!FD_ISSET(s.socket_, &sockets)) {
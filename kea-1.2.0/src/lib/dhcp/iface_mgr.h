@@ -22,6 +22,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include <list>
+#include <sys/select.h>
 #include <vector>
 
 namespace isc {
@@ -123,6 +124,15 @@ struct SocketInfo {
     /// the fallback socket is closed (not open).
     int fallbackfd_;
 
+    /// @brief Packet filter specific state of the socket.
+    ///
+    /// The packet filter which opened the socket may attach the state it
+    /// needs to handle the socket, e.g. the memory mapped receive ring used
+    /// by the @c PktFilterLPF. The state is released when the last copy of
+    /// this structure is destroyed, i.e. when the socket is removed from
+    /// the interface.
+    boost::shared_ptr<void> filter_state_;
+
     /// @brief SocketInfo constructor.
     ///
     /// @param addr An address the socket is bound to.
@@ -132,7 +142,7 @@ struct SocketInfo {
     SocketInfo(const isc::asiolink::IOAddress& addr, const uint16_t port,
                const int sockfd, const int fallbackfd = -1)
         : addr_(addr), port_(port), family_(addr.getFamily()),
-          sockfd_(sockfd), fallbackfd_(fallbackfd) { }
+          sockfd_(sockfd), fallbackfd_(fallbackfd), filter_state_() { }
 
 };
 
@@ -990,6 +1000,24 @@ public:
     /// @brief Deletes external socket
     void deleteExternalSocket(int socketfd);
 
+    /// @brief Adds a callback called when an external socket is writable
+    ///
+    /// This allows the owner of an external non-blocking socket to send
+    /// data it couldn't send right away without blocking the server. The
+    /// callback is called by @c receive4 or @c receive6 whenever the
+    /// socket is writable, so it should be installed only as long as
+    /// there is some data to send and removed with
+    /// @c deleteExternalWriteSocket afterwards.
+    ///
+    /// @param socketfd socket descriptor
+    /// @param callback callback function
+    void addExternalWriteSocket(int socketfd, SocketCallback callback);
+
+    /// @brief Deletes the callback called when an external socket is writable
+    ///
+    /// @param socketfd socket descriptor
+    void deleteExternalWriteSocket(int socketfd);
+
     /// @brief Deletes all external sockets.
     void deleteAllExternalSockets();
 
@@ -1048,7 +1076,11 @@ public:
     /// @param direct_response_desired specifies whether the Packet Filter
     /// object being set should support direct traffic to the host
     /// not having address assigned.
-    void setMatchingPacketFilter(const bool direct_response_desired = false);
+    /// @param use_receive_ring specifies whether the Packet Filter should
+    /// receive packets through a memory mapped ring when it supports it.
+    /// This is currently only supported by the Linux Packet Filtering.
+    void setMatchingPacketFilter(const bool direct_response_desired = false,
+                                 const bool use_receive_ring = false);
 
     /// @brief Adds an interface to list of known interfaces.
     ///
@@ -1212,9 +1244,18 @@ private:
     /// setPacketFilter method.
     PktFilter6Ptr packet_filter6_;
 
+    /// @brief Calls the callbacks of the writable external sockets.
+    ///
+    /// @param sockets set of the writable sockets returned by select
+    /// @return number of the callbacks called
+    int callWriteCallbacks(const fd_set& sockets);
+
     /// @brief Contains list of callbacks for external sockets
     SocketCallbackInfoContainer callbacks_;
 
+    /// @brief Contains list of callbacks for writable external sockets
+    SocketCallbackInfoContainer write_callbacks_;
+
     /// @brief Indicates if the IfaceMgr is in the test mode.
     bool test_mode_;
 };
@@ -122,7 +122,8 @@ void Iface::setFlags(uint64_t flags) {
 }
 
 void
-IfaceMgr::setMatchingPacketFilter(const bool direct_response_desired) {
+IfaceMgr::setMatchingPacketFilter(const bool direct_response_desired,
+                                  const bool /* use_receive_ring */) {
     // If direct response is desired we have to use BPF. If the direct
     // response is not desired we use datagram socket supported by the
     // PktFilterInet class. Note however that on BSD systems binding the
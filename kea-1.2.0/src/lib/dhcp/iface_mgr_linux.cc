@@ -511,9 +511,10 @@ void Iface::setFlags(uint64_t flags) {
 }
 
 void
-IfaceMgr::setMatchingPacketFilter(const bool direct_response_desired) {
+IfaceMgr::setMatchingPacketFilter(const bool direct_response_desired,
+                                  const bool use_receive_ring) {
     if (direct_response_desired) {
-        setPacketFilter(PktFilterPtr(new PktFilterLPF()));
+        setPacketFilter(PktFilterPtr(new PktFilterLPF(use_receive_ring)));
 
     } else {
         setPacketFilter(PktFilterPtr(new PktFilterInet()));
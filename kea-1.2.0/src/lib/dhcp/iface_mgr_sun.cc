@@ -124,7 +124,8 @@ void Iface::setFlags(uint64_t flags) {
 }
 
 void
-IfaceMgr::setMatchingPacketFilter(const bool /* direct_response_desired */) {
+IfaceMgr::setMatchingPacketFilter(const bool /* direct_response_desired */,
+                                  const bool /* use_receive_ring */) {
     // @todo Currently we ignore the preference to use direct traffic
     // because it hasn't been implemented for Solaris.
     setPacketFilter(PktFilterPtr(new PktFilterInet()));
@@ -0,0 +1,98 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/packet_queue.h>
+#include <exceptions/exceptions.h>
+
+namespace isc {
+namespace dhcp {
+
+PacketQueueConfig::DropPolicy
+PacketQueueConfig::policyFromText(const std::string& policy) {
+    if (policy == "drop-oldest") {
+        return (DROP_OLDEST);
+
+    } else if (policy == "drop-discovery") {
+        return (DROP_DISCOVERY);
+    }
+
+    isc_throw(BadValue, "unsupported receive queue drop policy '"
+              << policy << "', expected drop-oldest or drop-discovery");
+}
+
+std::string
+PacketQueueConfig::policyToText(const DropPolicy& policy) {
+    return (policy == DROP_DISCOVERY ? "drop-discovery" : "drop-oldest");
+}
+
+bool
+isDiscovery(const Pkt4Ptr& pkt) {
+    const OptionBuffer& data = pkt->data_;
+    // Options start after the fixed header and the magic cookie.
+    size_t offset = Pkt4::DHCPV4_PKT_HDR_LEN + sizeof(DHCP_OPTIONS_COOKIE);
+    while (offset < data.size()) {
+        const uint8_t code = data[offset];
+        if (code == DHO_END) {
+            break;
+
+        } else if (code == DHO_PAD) {
+            ++offset;
+            continue;
+
+        } else if (offset + 1 >= data.size()) {
+            break;
+        }
+
+        const uint8_t len = data[offset + 1];
+        if (code == DHO_DHCP_MESSAGE_TYPE) {
+            return ((len == 1) && (offset + 2 < data.size()) &&
+                    (data[offset + 2] == DHCPDISCOVER));
+        }
+        offset += 2 + len;
+    }
+    return (false);
+}
+
+bool
+isDiscovery(const Pkt6Ptr& pkt) {
+    const OptionBuffer& data = pkt->data_;
+    size_t begin = 0;
+    size_t end = data.size();
+    // Descend into the relayed messages, with the same limit on the
+    // number of relays as for the packet parsing.
+    for (unsigned hops = 0; hops <= HOP_COUNT_LIMIT; ++hops) {
+        if (begin >= end) {
+            return (false);
+        }
+        if (data[begin] != DHCPV6_RELAY_FORW) {
+            return (data[begin] == DHCPV6_SOLICIT);
+        }
+
+        size_t offset = begin + Pkt6::DHCPV6_RELAY_HDR_LEN;
+        begin = end;
+        while (offset + 4 <= end) {
+            const uint16_t code = (data[offset] << 8) | data[offset + 1];
+            const uint16_t len = (data[offset + 2] << 8) | data[offset + 3];
+            offset += 4;
+            if (offset + len > end) {
+                break;
+            }
+            if (code == D6O_RELAY_MSG) {
+                begin = offset;
+                end = offset + len;
+                break;
+            }
+            offset += len;
+        }
+    }
+    return (false);
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
@@ -0,0 +1,295 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PACKET_QUEUE_H
+#define PACKET_QUEUE_H
+
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <deque>
+#include <stdint.h>
+#include <string>
+#include <utility>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Configuration of the queue holding the received packets.
+///
+/// The queue is disabled when its capacity is 0, which is the default.
+struct PacketQueueConfig {
+
+    /// @brief Policy used to make room for a packet when the queue is full.
+    enum DropPolicy {
+        /// The oldest packet in the queue is dropped.
+        DROP_OLDEST,
+        /// A DHCPDISCOVER or Solicit is dropped in the first place, so as
+        /// the clients which already have leases are served first. The
+        /// oldest packet is dropped when there is no such packet.
+        DROP_DISCOVERY
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param capacity Maximum number of packets in the queue.
+    /// @param policy Drop policy.
+    /// @param max_age Maximum number of milliseconds a packet may wait in
+    /// the queue. The value of 0 means no limit.
+    PacketQueueConfig(const size_t capacity = 0,
+                      const DropPolicy policy = DROP_OLDEST,
+                      const uint32_t max_age = 0)
+        : capacity_(capacity), policy_(policy), max_age_(max_age) {
+    }
+
+    /// @brief Converts the policy name to the enum value.
+    ///
+    /// @param policy Policy name: "drop-oldest" or "drop-discovery".
+    ///
+    /// @return Policy value.
+    /// @throw BadValue if the name is not recognized.
+    static DropPolicy policyFromText(const std::string& policy);
+
+    /// @brief Returns the name of the policy.
+    ///
+    /// @param policy Policy value.
+    static std::string policyToText(const DropPolicy& policy);
+
+    /// @brief Compares two configurations.
+    bool operator==(const PacketQueueConfig& other) const {
+        return ((capacity_ == other.capacity_) && (policy_ == other.policy_) &&
+                (max_age_ == other.max_age_));
+    }
+
+    /// @brief Compares two configurations.
+    bool operator!=(const PacketQueueConfig& other) const {
+        return (!(*this == other));
+    }
+
+    /// @brief Maximum number of packets in the queue.
+    size_t capacity_;
+
+    /// @brief Drop policy.
+    DropPolicy policy_;
+
+    /// @brief Maximum age of the queued packet in milliseconds.
+    uint32_t max_age_;
+};
+
+/// @brief Checks if the received DHCPv4 packet is a DHCPDISCOVER.
+///
+/// The packet hasn't been parsed yet when it is queued, so the message
+/// type option is looked up in the raw packet data. The lookup stops
+/// at the first occurrence of the option.
+///
+/// @param pkt Received packet.
+bool isDiscovery(const Pkt4Ptr& pkt);
+
+/// @brief Checks if the received DHCPv6 packet is a Solicit.
+///
+/// The packet hasn't been parsed yet when it is queued, so the message
+/// type is read from the raw packet data. For the relayed packets the
+/// relayed message is looked up.
+///
+/// @param pkt Received packet.
+bool isDiscovery(const Pkt6Ptr& pkt);
+
+/// @brief Bounded queue holding the received packets until the server
+/// processes them.
+///
+/// When the server is overloaded, the packets received by the kernel
+/// wait in the socket buffers until the server reads them. By the time
+/// they get processed, the clients may have already retransmitted them
+/// or given up. The server reads the pending packets from the sockets
+/// into this queue before processing the next packet. When the queue is
+/// full, the packets are dropped according to the configured policy,
+/// and the packets waiting longer than the configured time are discarded
+/// when they reach the front of the queue. The server spends its time on
+/// the packets which are still worth responding to.
+///
+/// @tparam PacketTypePtr Type of the pointer to the packet: @c Pkt4Ptr
+/// or @c Pkt6Ptr.
+template<typename PacketTypePtr>
+class PacketQueue {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the disabled queue.
+    PacketQueue()
+        : config_(), packets_(), discoveries_(0), dropped_(0) {
+    }
+
+    /// @brief Sets the configuration of the queue.
+    ///
+    /// Packets exceeding the new capacity are dropped, starting from the
+    /// oldest ones.
+    ///
+    /// @param config New configuration.
+    void configure(const PacketQueueConfig& config) {
+        if (config != config_) {
+            config_ = config;
+            while (packets_.size() > config_.capacity_) {
+                dropFront();
+            }
+        }
+    }
+
+    /// @brief Returns the configuration of the queue.
+    const PacketQueueConfig& getConfig() const {
+        return (config_);
+    }
+
+    /// @brief Checks if the queue is enabled.
+    bool enabled() const {
+        return (config_.capacity_ > 0);
+    }
+
+    /// @brief Adds the packet at the end of the queue.
+    ///
+    /// If the queue is full, a packet is dropped according to the drop
+    /// policy. This may be the packet being added.
+    ///
+    /// @param pkt Received packet.
+    void push(const PacketTypePtr& pkt) {
+        if (!enabled()) {
+            ++dropped_;
+            return;
+        }
+
+        const bool discovery = isDiscovery(pkt);
+        if (packets_.size() >= config_.capacity_) {
+            if (config_.policy_ == PacketQueueConfig::DROP_DISCOVERY) {
+                if (discovery) {
+                    ++dropped_;
+                    return;
+
+                } else if (discoveries_ > 0) {
+                    dropDiscovery();
+
+                } else {
+                    dropFront();
+                }
+
+            } else {
+                dropFront();
+            }
+        }
+
+        packets_.push_back(std::make_pair(pkt, discovery));
+        if (discovery) {
+            ++discoveries_;
+        }
+    }
+
+    /// @brief Removes the oldest packet from the queue and returns it.
+    ///
+    /// The packets which have been waiting for longer than the maximum
+    /// age are dropped.
+    ///
+    /// @return Pointer to the packet or null if the queue is empty.
+    PacketTypePtr pop() {
+        if (config_.max_age_ > 0) {
+            const boost::posix_time::ptime oldest =
+                boost::posix_time::microsec_clock::universal_time() -
+                boost::posix_time::milliseconds(config_.max_age_);
+            while (!packets_.empty() &&
+                   (packets_.front().first->getTimestamp() < oldest)) {
+                dropFront();
+            }
+        }
+
+        if (packets_.empty()) {
+            return (PacketTypePtr());
+        }
+
+        PacketTypePtr pkt = packets_.front().first;
+        if (packets_.front().second) {
+            --discoveries_;
+        }
+        packets_.pop_front();
+        return (pkt);
+    }
+
+    /// @brief Checks if the queue is empty.
+    bool empty() const {
+        return (packets_.empty());
+    }
+
+    /// @brief Checks if the queue is full.
+    bool full() const {
+        return (packets_.size() >= config_.capacity_);
+    }
+
+    /// @brief Returns the number of packets in the queue.
+    size_t size() const {
+        return (packets_.size());
+    }
+
+    /// @brief Returns the number of packets dropped since the queue was
+    /// created.
+    uint64_t getDropped() const {
+        return (dropped_);
+    }
+
+    /// @brief Removes all packets from the queue.
+    ///
+    /// The removed packets are not counted as dropped.
+    void clear() {
+        packets_.clear();
+        discoveries_ = 0;
+    }
+
+private:
+
+    /// @brief Drops the oldest packet.
+    void dropFront() {
+        if (packets_.front().second) {
+            --discoveries_;
+        }
+        packets_.pop_front();
+        ++dropped_;
+    }
+
+    /// @brief Drops the oldest DHCPDISCOVER or Solicit.
+    ///
+    /// This function must only be called when there is such packet in
+    /// the queue.
+    void dropDiscovery() {
+        for (typename PacketContainer::iterator it = packets_.begin();
+             it != packets_.end(); ++it) {
+            if (it->second) {
+                packets_.erase(it);
+                --discoveries_;
+                ++dropped_;
+                return;
+            }
+        }
+    }
+
+    /// @brief Type of the container holding the packets along with the
+    /// flag indicating if the packet is a DHCPDISCOVER or Solicit.
+    typedef std::deque<std::pair<PacketTypePtr, bool> > PacketContainer;
+
+    /// @brief Queue configuration.
+    PacketQueueConfig config_;
+
+    /// @brief Queued packets.
+    PacketContainer packets_;
+
+    /// @brief Number of DHCPDISCOVERs or Solicits in the queue.
+    size_t discoveries_;
+
+    /// @brief Number of the dropped packets.
+    uint64_t dropped_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // PACKET_QUEUE_H
@@ -757,6 +757,9 @@ private:
                                  HWAddrPtr& storage);
 };
 
+/// @brief A pointer to either Pkt4 or Pkt6 packet
+typedef boost::shared_ptr<isc::dhcp::Pkt> PktPtr;
+
 }; // namespace isc::dhcp
 }; // namespace isc
 
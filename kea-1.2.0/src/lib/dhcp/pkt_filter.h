@@ -93,6 +93,21 @@ public:
     virtual Pkt4Ptr receive(Iface& iface,
                             const SocketInfo& socket_info) = 0;
 
+    /// @brief Checks if packets can be received without checking the socket.
+    ///
+    /// Packet filters which hold received packets in user space, e.g. in a
+    /// memory mapped receive ring, return true when the next call to
+    /// @c receive returns a packet for the socket without reading it. The
+    /// @c IfaceMgr doesn't wait for the socket to become readable then.
+    ///
+    /// @param socket_info structure holding socket information
+    ///
+    /// @return true if there are packets held for the socket, false by
+    /// default.
+    virtual bool hasBufferedPackets(const SocketInfo&) const {
+        return (false);
+    }
+
     /// @brief Send packet over specified socket.
     ///
     /// @param iface interface to be used to send packet
@@ -16,11 +16,28 @@
 #include <linux/if_ether.h>
 #include <linux/if_packet.h>
 #include <net/ethernet.h>
+#include <sys/mman.h>
 
 namespace {
 
 using namespace isc::dhcp;
 
+/// Size of a single block of the receive ring. It must be a multiple of
+/// the page size and it should be able to hold a number of frames.
+const uint32_t RING_BLOCK_SIZE = 1 << 16;
+
+/// Number of blocks in the receive ring.
+const uint32_t RING_BLOCK_NR = 32;
+
+/// Nominal frame size used to compute the number of frames in the ring.
+/// With TPACKET_V3 the frames are packed into the blocks back to back.
+const uint32_t RING_FRAME_SIZE = 2048;
+
+/// Time in milliseconds after which the kernel hands over a partially
+/// filled block, so as the packets don't wait for the block to fill up
+/// when the traffic is low.
+const uint32_t RING_BLOCK_TIMEOUT = 10;
+
 /// The following structure defines a Berkeley Packet Filter program to perform
 /// packet filtering. The program operates on Ethernet packets.  To help with
 /// interpretation of the program, for the types of Ethernet packets we are
@@ -128,6 +145,136 @@ using namespace isc::util;
 namespace isc {
 namespace dhcp {
 
+/// @brief Memory mapped receive ring of a socket.
+///
+/// The ring consists of the blocks owned either by the kernel or by the
+/// user. The kernel hands over a block when it is full or when it times
+/// out. The packets in the block are then processed one by one and the
+/// block is returned to the kernel when all packets have been processed.
+struct PktFilterLPF::RxRing {
+
+    /// @brief Constructor.
+    RxRing()
+        : map_(NULL), map_len_(0), block_size_(0),
+          block_nr_(0), current_block_(0), pkts_left_(0), next_pkt_(NULL) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Unmaps the ring.
+    ~RxRing() {
+        if (map_) {
+            munmap(map_, map_len_);
+        }
+    }
+
+    /// @brief Returns descriptor of the current block.
+    struct tpacket_block_desc* currentBlock() const {
+        return (reinterpret_cast<struct tpacket_block_desc*>
+                (map_ + current_block_ * block_size_));
+    }
+
+    /// @brief Moves to the next packet and returns the current block to
+    /// the kernel when all its packets have been processed.
+    void nextPacket() {
+        struct tpacket3_hdr* hdr =
+            reinterpret_cast<struct tpacket3_hdr*>(next_pkt_);
+        if (--pkts_left_ > 0) {
+            next_pkt_ += hdr->tp_next_offset;
+        } else {
+            releaseBlock();
+        }
+    }
+
+    /// @brief Returns the current block to the kernel.
+    void releaseBlock() {
+        // Make sure that we're done with the frames before the kernel
+        // is allowed to overwrite them.
+        __sync_synchronize();
+        currentBlock()->hdr.bh1.block_status = TP_STATUS_KERNEL;
+        current_block_ = (current_block_ + 1) % block_nr_;
+        pkts_left_ = 0;
+        next_pkt_ = NULL;
+    }
+
+    /// @brief Pointer to the mapped ring.
+    uint8_t* map_;
+
+    /// @brief Length of the mapped ring.
+    size_t map_len_;
+
+    /// @brief Size of a block.
+    uint32_t block_size_;
+
+    /// @brief Number of blocks.
+    uint32_t block_nr_;
+
+    /// @brief Index of the block being processed.
+    uint32_t current_block_;
+
+    /// @brief Number of packets not yet processed in the current block.
+    uint32_t pkts_left_;
+
+    /// @brief Pointer to the next packet to be processed.
+    uint8_t* next_pkt_;
+};
+
+PktFilterLPF::PktFilterLPF(const bool use_ring)
+    : use_ring_(use_ring) {
+}
+
+bool
+PktFilterLPF::isRingUsed(const SocketInfo& socket_info) {
+    return (static_cast<bool>(socket_info.filter_state_));
+}
+
+bool
+PktFilterLPF::hasBufferedPackets(const SocketInfo& socket_info) const {
+    return (socket_info.filter_state_ &&
+            (boost::static_pointer_cast<RxRing>
+             (socket_info.filter_state_)->pkts_left_ > 0));
+}
+
+PktFilterLPF::RxRingPtr
+PktFilterLPF::openRing(const int sock) {
+#ifdef TPACKET3_HDRLEN
+    int version = TPACKET_V3;
+    if (setsockopt(sock, SOL_PACKET, PACKET_VERSION, &version,
+                   sizeof(version)) < 0) {
+        return (RxRingPtr());
+    }
+
+    struct tpacket_req3 req;
+    memset(&req, 0, sizeof(req));
+    req.tp_block_size = RING_BLOCK_SIZE;
+    req.tp_block_nr = RING_BLOCK_NR;
+    req.tp_frame_size = RING_FRAME_SIZE;
+    req.tp_frame_nr = (RING_BLOCK_SIZE / RING_FRAME_SIZE) * RING_BLOCK_NR;
+    req.tp_retire_blk_tov = RING_BLOCK_TIMEOUT;
+    if (setsockopt(sock, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req)) < 0) {
+        return (RxRingPtr());
+    }
+
+    RxRingPtr ring(new RxRing());
+    ring->map_len_ = static_cast<size_t>(RING_BLOCK_SIZE) * RING_BLOCK_NR;
+    void* map = mmap(NULL, ring->map_len_, PROT_READ | PROT_WRITE, MAP_SHARED,
+                     sock, 0);
+    if (map == MAP_FAILED) {
+        // Release the ring in the kernel, so as packets are queued to the
+        // socket again.
+        memset(&req, 0, sizeof(req));
+        setsockopt(sock, SOL_PACKET, PACKET_RX_RING, &req, sizeof(req));
+        return (RxRingPtr());
+    }
+    ring->map_ = static_cast<uint8_t*>(map);
+    ring->block_size_ = RING_BLOCK_SIZE;
+    ring->block_nr_ = RING_BLOCK_NR;
+    return (ring);
+#else
+    return (RxRingPtr());
+#endif
+}
+
 SocketInfo
 PktFilterLPF::openSocket(Iface& iface,
                          const isc::asiolink::IOAddress& addr,
@@ -180,6 +327,14 @@ PktFilterLPF::openSocket(Iface& iface,
                   << " on the socket " << sock);
     }
 
+    // Set up the receive ring if possible. If not, the packets will be
+    // received with read(). The ring is unmapped when the socket fails
+    // to open or when it is closed and the returned structure is released.
+    RxRingPtr ring;
+    if (use_ring_) {
+        ring = openRing(sock);
+    }
+
     struct sockaddr_ll sa;
     memset(&sa, 0, sizeof(sockaddr_ll));
     sa.sll_family = AF_PACKET;
@@ -197,12 +352,22 @@ PktFilterLPF::openSocket(Iface& iface,
                   << "' to interface '" << iface.getName() << "'");
     }
 
-    return (SocketInfo(addr, port, sock, fallback));
+    SocketInfo sock_info(addr, port, sock, fallback);
+    sock_info.filter_state_ = ring;
+    return (sock_info);
 
 }
 
 Pkt4Ptr
 PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
+    // Take the remaining frames of the current ring block without any
+    // system call. The fallback socket is drained when the next block
+    // is taken from the kernel.
+    if (hasBufferedPackets(socket_info)) {
+        return (receiveFromRing(iface, *boost::static_pointer_cast<RxRing>
+                                (socket_info.filter_state_)));
+    }
+
     uint8_t raw_buf[IfaceMgr::RCVBUFSIZE];
     // First let's get some data from the fallback socket. The data will be
     // discarded but we don't want the socket buffer to bloat. We get the
@@ -223,6 +388,12 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
         datalen = recv(socket_info.fallbackfd_, raw_buf, sizeof(raw_buf), 0);
     } while (datalen > 0);
 
+    // If the socket has the receive ring, take the next packet from it.
+    if (socket_info.filter_state_) {
+        return (receiveFromRing(iface, *boost::static_pointer_cast<RxRing>
+                                (socket_info.filter_state_)));
+    }
+
     // Now that we finished getting data from the fallback socket, we
     // have to get the data from the raw socket too.
     int data_len = read(socket_info.sockfd_, raw_buf, sizeof(raw_buf));
@@ -235,7 +406,57 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
         return Pkt4Ptr();
     }
 
-    InputBuffer buf(raw_buf, data_len);
+    return (decodeFrame(iface, raw_buf, data_len));
+}
+
+Pkt4Ptr
+PktFilterLPF::receiveFromRing(Iface& iface, RxRing& ring) {
+#ifdef TPACKET3_HDRLEN
+    // Take the next block from the kernel if we're done with the current one.
+    while (ring.pkts_left_ == 0) {
+        struct tpacket_block_desc* block = ring.currentBlock();
+        if ((block->hdr.bh1.block_status & TP_STATUS_USER) == 0) {
+            // The kernel hasn't handed over any packets yet. A partially
+            // filled block is handed over when the block timeout elapses
+            // and the socket becomes readable, so there is nothing to wait
+            // for here.
+            return (Pkt4Ptr());
+        }
+        // Make sure the block contents are read after its status.
+        __sync_synchronize();
+        ring.pkts_left_ = block->hdr.bh1.num_pkts;
+        if (ring.pkts_left_ == 0) {
+            ring.releaseBlock();
+            continue;
+        }
+        ring.next_pkt_ = reinterpret_cast<uint8_t*>(block) +
+            block->hdr.bh1.offset_to_first_pkt;
+    }
+
+    struct tpacket3_hdr* hdr =
+        reinterpret_cast<struct tpacket3_hdr*>(ring.next_pkt_);
+    Pkt4Ptr pkt;
+    try {
+        // The packet is decoded straight from the ring. The frame has to be
+        // decoded before it is returned to the kernel.
+        pkt = decodeFrame(iface, ring.next_pkt_ + hdr->tp_mac,
+                          hdr->tp_snaplen);
+    } catch (...) {
+        // Skip the malformed frame, so as we don't get stuck on it.
+        ring.nextPacket();
+        throw;
+    }
+    ring.nextPacket();
+    return (pkt);
+#else
+    return (Pkt4Ptr());
+#endif
+}
+
+Pkt4Ptr
+PktFilterLPF::decodeFrame(Iface& iface, const uint8_t* data,
+                          const size_t data_len) {
+    InputBuffer buf(data, data_len);
 
     // @todo: This is awkward way to solve the chicken and egg problem
     // whereby we don't know the offset where DHCP data start in the
@@ -255,12 +476,10 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
     decodeEthernetHeader(buf, dummy_pkt);
     decodeIpUdpHeader(buf, dummy_pkt);
 
-    // Read the DHCP data.
-    std::vector<uint8_t> dhcp_buf;
-    buf.readVector(dhcp_buf, buf.getLength() - buf.getPosition());
-
-    // Decode DHCP data into the Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(&dhcp_buf[0], dhcp_buf.size()));
+    // Decode DHCP data into the Pkt4 object. The data are copied into the
+    // packet directly from the received buffer.
+    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(data + buf.getPosition(),
+                                   buf.getLength() - buf.getPosition()));
 
     // Set the appropriate packet members using data collected from
     // the decoded headers.
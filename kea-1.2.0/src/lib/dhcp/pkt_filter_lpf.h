@@ -11,6 +11,8 @@
 
 #include <util/buffer.h>
 
+#include <boost/shared_ptr.hpp>
+
 namespace isc {
 namespace dhcp {
 
@@ -20,9 +22,25 @@ namespace dhcp {
 /// sockets and Linux Packet Filtering. It is used by @c isc::dhcp::IfaceMgr
 /// to send DHCPv4 messages to the hosts which don't have an IPv4 address
 /// assigned yet.
+///
+/// If enabled and supported by the kernel, the packets are received through
+/// the memory mapped receive ring (PACKET_MMAP with TPACKET_V3) rather than
+/// with one read() per frame. The kernel fills the ring with blocks of frames
+/// which are then processed without any further system calls, and the DHCP
+/// data are parsed directly from the ring. The @c IfaceMgr calls select()
+/// and the fallback socket is drained once per block rather than per frame. If the ring can't be set up for
+/// the socket, the packets are received with read(). The ring is held in the
+/// @c SocketInfo returned by @c openSocket, so it is unmapped when the socket
+/// is removed from its interface.
 class PktFilterLPF : public PktFilter {
 public:
 
+    /// @brief Constructor.
+    ///
+    /// @param use_ring Indicates if the sockets should use the memory mapped
+    /// receive ring when it is supported by the kernel.
+    PktFilterLPF(const bool use_ring = false);
+
     /// @brief Check if packet can be sent to the host without address directly.
     ///
     /// This class supports direct responses to the host without address.
@@ -56,6 +74,14 @@ public:
     /// @return Received packet
     virtual Pkt4Ptr receive(Iface& iface, const SocketInfo& socket_info);
 
+    /// @brief Checks if packets can be received without checking the socket.
+    ///
+    /// @param socket_info structure holding socket information
+    ///
+    /// @return true if the socket uses the receive ring and there are
+    /// frames left in the ring block being processed.
+    virtual bool hasBufferedPackets(const SocketInfo& socket_info) const;
+
     /// @brief Send packet over specified socket.
     ///
     /// @param iface interface to be used to send packet
@@ -67,6 +93,55 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt4Ptr& pkt);
 
+    /// @brief Checks if the socket receives packets through the ring.
+    ///
+    /// @param socket_info Structure describing the socket opened by this
+    /// object.
+    ///
+    /// @return true if the memory mapped receive ring is used for the
+    /// socket, false otherwise.
+    static bool isRingUsed(const SocketInfo& socket_info);
+
+private:
+
+    /// @brief Memory mapped receive ring of a socket.
+    struct RxRing;
+
+    /// @brief Pointer to the receive ring.
+    typedef boost::shared_ptr<RxRing> RxRingPtr;
+
+    /// @brief Sets up the memory mapped receive ring for a socket.
+    ///
+    /// @param sock Socket descriptor.
+    ///
+    /// @return Pointer to the ring or null pointer if the ring couldn't be
+    /// set up, in which case the socket is still usable with read().
+    static RxRingPtr openRing(const int sock);
+
+    /// @brief Receives packet from the memory mapped ring.
+    ///
+    /// This function doesn't wait for the kernel to hand over a block of
+    /// packets. The socket is reported readable by select() when a block
+    /// is available.
+    ///
+    /// @param iface Interface on which the packet is received.
+    /// @param ring Receive ring of the socket.
+    ///
+    /// @return Received packet or null pointer if the ring holds no packets.
+    static Pkt4Ptr receiveFromRing(Iface& iface, RxRing& ring);
+
+    /// @brief Decodes the received frame.
+    ///
+    /// @param iface Interface on which the packet is received.
+    /// @param data Pointer to the beginning of the Ethernet frame.
+    /// @param data_len Length of the frame.
+    ///
+    /// @return Decoded packet.
+    static Pkt4Ptr decodeFrame(Iface& iface, const uint8_t* data,
+                               const size_t data_len);
+
+    /// @brief Indicates if the receive ring should be used.
+    bool use_ring_;
 };
 
 } // namespace isc::dhcp
@@ -1345,6 +1345,10 @@ TEST_F(IfaceMgrTest, setMatchingPacketFilter) {
     EXPECT_NO_THROW(iface_mgr->setMatchingPacketFilter(true));
     // This object should report that direct responses are supported.
     EXPECT_TRUE(iface_mgr->isDirectResponseSupported());
+
+    // The receive ring doesn't change the capabilities of the filter.
+    EXPECT_NO_THROW(iface_mgr->setMatchingPacketFilter(true, true));
+    EXPECT_TRUE(iface_mgr->isDirectResponseSupported());
 }
 
 // This test checks that it is not possible to open two sockets: IP/UDP
@@ -2789,6 +2793,53 @@ TEST_F(IfaceMgrTest, DeleteExternalSockets6) {
     close(secondpipe[0]);
 }
 
+// Tests that the write callback of an external socket is called when the
+// socket is writable, until it is deleted, and that it doesn't prevent
+// the read callbacks from being called.
+TEST_F(IfaceMgrTest, ExternalWriteSockets) {
+
+    callback_ok = false;
+    callback2_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // Create a pipe, read from the first end and written to via the other.
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback));
+    EXPECT_THROW(ifacemgr->addExternalWriteSocket(-1, my_callback2),
+                 isc::BadValue);
+    EXPECT_NO_THROW(ifacemgr->addExternalWriteSocket(pipefd[1],
+                                                     my_callback2));
+
+    // The pipe is empty, so it is writable, but there is nothing to read.
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+    EXPECT_FALSE(callback_ok);
+    EXPECT_TRUE(callback2_ok);
+
+    // Both callbacks are called when the pipe is readable and writable.
+    callback2_ok = false;
+    EXPECT_EQ(38, write(pipefd[1], "Hi, this is a message sent over a pipe", 38));
+    Pkt6Ptr pkt6;
+    ASSERT_NO_THROW(pkt6 = ifacemgr->receive6(1));
+    EXPECT_FALSE(pkt6);
+    EXPECT_TRUE(callback_ok);
+    EXPECT_TRUE(callback2_ok);
+
+    // The write callback isn't called any longer once deleted.
+    callback_ok = false;
+    callback2_ok = false;
+    EXPECT_NO_THROW(ifacemgr->deleteExternalWriteSocket(pipefd[1]));
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_TRUE(callback_ok);
+    EXPECT_FALSE(callback2_ok);
+
+    close(pipefd[1]);
+    close(pipefd[0]);
+}
+
 
 // Test checks if the unicast sockets can be opened.
 // This test is now disabled, because there is no reliable way to test it. We
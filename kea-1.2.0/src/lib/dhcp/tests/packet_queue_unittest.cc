@@ -0,0 +1,215 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/packet_queue.h>
+#include <exceptions/exceptions.h>
+#include <util/buffer.h>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Creates received DHCPv4 packet of the specified type.
+///
+/// The packet is packed and then created from the wire data, so as it
+/// looks like it was read from the socket, including the timestamp.
+///
+/// @param type Message type.
+/// @param transid Transaction id.
+Pkt4Ptr
+createPacket4(const uint8_t type, const uint32_t transid) {
+    Pkt4 pkt(type, transid);
+    pkt.pack();
+    const OutputBuffer& buf = pkt.getBuffer();
+    Pkt4Ptr received(new Pkt4(static_cast<const uint8_t*>(buf.getData()),
+                              buf.getLength()));
+    received->updateTimestamp();
+    return (received);
+}
+
+/// @brief Creates received DHCPv6 packet of the specified type.
+///
+/// @param type Message type.
+/// @param transid Transaction id.
+/// @param relays Number of relays which forwarded the packet.
+Pkt6Ptr
+createPacket6(const uint8_t type, const uint32_t transid,
+              const unsigned relays = 0) {
+    Pkt6 pkt(type, transid);
+    for (unsigned i = 0; i < relays; ++i) {
+        Pkt6::RelayInfo relay;
+        relay.msg_type_ = DHCPV6_RELAY_FORW;
+        relay.hop_count_ = i;
+        relay.linkaddr_ = IOAddress("2001:db8:1::1");
+        relay.peeraddr_ = IOAddress("fe80::1");
+        pkt.addRelayInfo(relay);
+    }
+    pkt.pack();
+    const OutputBuffer& buf = pkt.getBuffer();
+    Pkt6Ptr received(new Pkt6(static_cast<const uint8_t*>(buf.getData()),
+                              buf.getLength()));
+    received->updateTimestamp();
+    return (received);
+}
+
+// This test verifies that the drop policy names are converted.
+TEST(PacketQueueConfigTest, policyText) {
+    EXPECT_EQ(PacketQueueConfig::DROP_OLDEST,
+              PacketQueueConfig::policyFromText("drop-oldest"));
+    EXPECT_EQ(PacketQueueConfig::DROP_DISCOVERY,
+              PacketQueueConfig::policyFromText("drop-discovery"));
+    EXPECT_THROW(PacketQueueConfig::policyFromText("drop-all"), BadValue);
+
+    EXPECT_EQ("drop-oldest",
+              PacketQueueConfig::policyToText(PacketQueueConfig::DROP_OLDEST));
+    EXPECT_EQ("drop-discovery",
+              PacketQueueConfig::policyToText(PacketQueueConfig::DROP_DISCOVERY));
+}
+
+// This test verifies that the DHCPDISCOVER and Solicit are recognized
+// in the raw packet data.
+TEST(PacketQueueTest, isDiscovery) {
+    EXPECT_TRUE(isDiscovery(createPacket4(DHCPDISCOVER, 1)));
+    EXPECT_FALSE(isDiscovery(createPacket4(DHCPREQUEST, 1)));
+
+    // BOOTP packet carries no message type.
+    Pkt4Ptr bootp(new Pkt4(std::vector<uint8_t>(240, 0).data(), 240));
+    EXPECT_FALSE(isDiscovery(bootp));
+
+    EXPECT_TRUE(isDiscovery(createPacket6(DHCPV6_SOLICIT, 1)));
+    EXPECT_FALSE(isDiscovery(createPacket6(DHCPV6_RENEW, 1)));
+    EXPECT_TRUE(isDiscovery(createPacket6(DHCPV6_SOLICIT, 1, 2)));
+    EXPECT_FALSE(isDiscovery(createPacket6(DHCPV6_REBIND, 1, 2)));
+}
+
+// This test verifies that the disabled queue doesn't hold packets.
+TEST(PacketQueueTest, disabled) {
+    PacketQueue<Pkt4Ptr> queue;
+    EXPECT_FALSE(queue.enabled());
+
+    queue.push(createPacket4(DHCPDISCOVER, 1));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_FALSE(queue.pop());
+}
+
+// This test verifies that the packets are returned in the order in
+// which they have been received and that the oldest packets are
+// dropped when the queue is full.
+TEST(PacketQueueTest, dropOldest) {
+    PacketQueue<Pkt4Ptr> queue;
+    queue.configure(PacketQueueConfig(3));
+    ASSERT_TRUE(queue.enabled());
+
+    for (uint32_t transid = 1; transid <= 5; ++transid) {
+        queue.push(createPacket4(transid % 2 ? DHCPDISCOVER : DHCPREQUEST,
+                                 transid));
+    }
+    EXPECT_EQ(3, queue.size());
+    EXPECT_TRUE(queue.full());
+    EXPECT_EQ(2, queue.getDropped());
+
+    for (uint32_t transid = 3; transid <= 5; ++transid) {
+        Pkt4Ptr pkt = queue.pop();
+        ASSERT_TRUE(pkt);
+        pkt->unpack();
+        EXPECT_EQ(transid, pkt->getTransid());
+    }
+    EXPECT_FALSE(queue.pop());
+
+    // Reducing the capacity drops the oldest packets.
+    for (uint32_t transid = 1; transid <= 3; ++transid) {
+        queue.push(createPacket4(DHCPREQUEST, transid));
+    }
+    queue.configure(PacketQueueConfig(1));
+    EXPECT_EQ(1, queue.size());
+    EXPECT_EQ(4, queue.getDropped());
+}
+
+// This test verifies that the DHCPv4 DHCPDISCOVERs are dropped first when
+// the queue is full.
+TEST(PacketQueueTest, dropDiscovery4) {
+    PacketQueue<Pkt4Ptr> queue;
+    queue.configure(PacketQueueConfig(3, PacketQueueConfig::DROP_DISCOVERY));
+
+    queue.push(createPacket4(DHCPREQUEST, 1));
+    queue.push(createPacket4(DHCPDISCOVER, 2));
+    queue.push(createPacket4(DHCPDISCOVER, 3));
+
+    // The incoming DHCPDISCOVER is dropped when the queue is full.
+    queue.push(createPacket4(DHCPDISCOVER, 4));
+    EXPECT_EQ(1, queue.getDropped());
+
+    // The DHCPREQUEST replaces the oldest DHCPDISCOVER.
+    queue.push(createPacket4(DHCPREQUEST, 5));
+    queue.push(createPacket4(DHCPREQUEST, 6));
+    EXPECT_EQ(3, queue.getDropped());
+
+    // The oldest packet is dropped when there is no DHCPDISCOVER.
+    queue.push(createPacket4(DHCPREQUEST, 7));
+    EXPECT_EQ(4, queue.getDropped());
+
+    for (uint32_t transid = 5; transid <= 7; ++transid) {
+        Pkt4Ptr pkt = queue.pop();
+        ASSERT_TRUE(pkt);
+        pkt->unpack();
+        EXPECT_EQ(transid, pkt->getTransid());
+    }
+    EXPECT_TRUE(queue.empty());
+}
+
+// This test verifies that the DHCPv6 Solicits are dropped first when
+// the queue is full.
+TEST(PacketQueueTest, dropDiscovery6) {
+    PacketQueue<Pkt6Ptr> queue;
+    queue.configure(PacketQueueConfig(2, PacketQueueConfig::DROP_DISCOVERY));
+
+    queue.push(createPacket6(DHCPV6_SOLICIT, 1, 1));
+    queue.push(createPacket6(DHCPV6_RENEW, 2));
+    queue.push(createPacket6(DHCPV6_SOLICIT, 3));
+    queue.push(createPacket6(DHCPV6_RENEW, 4, 1));
+    EXPECT_EQ(2, queue.getDropped());
+
+    Pkt6Ptr pkt = queue.pop();
+    ASSERT_TRUE(pkt);
+    pkt->unpack();
+    EXPECT_EQ(2, pkt->getTransid());
+
+    pkt = queue.pop();
+    ASSERT_TRUE(pkt);
+    pkt->unpack();
+    EXPECT_EQ(4, pkt->getTransid());
+}
+
+// This test verifies that the packets waiting too long in the queue
+// are dropped.
+TEST(PacketQueueTest, maxAge) {
+    PacketQueue<Pkt4Ptr> queue;
+    queue.configure(PacketQueueConfig(10, PacketQueueConfig::DROP_OLDEST, 5));
+
+    queue.push(createPacket4(DHCPDISCOVER, 1));
+    queue.push(createPacket4(DHCPREQUEST, 2));
+    usleep(10000);
+    queue.push(createPacket4(DHCPREQUEST, 3));
+
+    Pkt4Ptr pkt = queue.pop();
+    ASSERT_TRUE(pkt);
+    pkt->unpack();
+    EXPECT_EQ(3, pkt->getTransid());
+    EXPECT_EQ(2, queue.getDropped());
+}
+
+} // end of anonymous namespace
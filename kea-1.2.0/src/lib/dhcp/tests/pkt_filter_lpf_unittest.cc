@@ -13,6 +13,7 @@
 #include <dhcp/tests/pkt_filter_test_utils.h>
 #include <util/buffer.h>
 
+#include <boost/weak_ptr.hpp>
 #include <gtest/gtest.h>
 
 #include <linux/if_packet.h>
@@ -35,6 +36,25 @@ class PktFilterLPFTest : public isc::dhcp::test::PktFilterTest {
 public:
     PktFilterLPFTest() : PktFilterTest(PORT) {
     }
+
+    /// @brief Waits for the data to arrive on the primary socket.
+    ///
+    /// The receive ring is handed over by the kernel when the block
+    /// timeout elapses, so the socket has to be checked with select()
+    /// before the packet is received, like the @c IfaceMgr does.
+    ///
+    /// @return true if the socket is readable, false otherwise.
+    bool waitForPacket() {
+        fd_set readfds;
+        FD_ZERO(&readfds);
+        FD_SET(sock_info_.sockfd_, &readfds);
+
+        struct timeval timeout;
+        timeout.tv_sec = 5;
+        timeout.tv_usec = 0;
+        return (select(sock_info_.sockfd_ + 1, &readfds, NULL, NULL,
+                       &timeout) > 0);
+    }
 };
 
 // This test verifies that the PktFilterLPF class reports its capability
@@ -99,8 +119,9 @@ TEST_F(PktFilterLPFTest, DISABLED_send) {
     Iface iface(ifname_, ifindex_);
     IOAddress addr("127.0.0.1");
 
-    // Create an instance of the class which we are testing.
-    PktFilterLPF pkt_filter;
+    // Create an instance of the class which we are testing. The ring is
+    // disabled because the sent packet is read from the socket directly.
+    PktFilterLPF pkt_filter(false);
     // Open socket. We don't check that the socket has appropriate
     // options and family set because we have checked that in the
     // openSocket test already.
@@ -182,6 +203,100 @@ TEST_F(PktFilterLPFTest, DISABLED_receive) {
     testRcvdMessageAddressPort(rcvd_pkt);
 }
 
+// This test verifies that the packets are received over the memory
+// mapped ring when it has been enabled and that they are received with
+// plain reads from the socket by default.
+TEST_F(PktFilterLPFTest, DISABLED_receiveRing) {
+
+    // Packet will be received over loopback interface.
+    Iface iface(ifname_, ifindex_);
+    IOAddress addr("127.0.0.1");
+
+    // The ring should be set up when the socket is opened.
+    PktFilterLPF pkt_filter(true);
+    sock_info_ = pkt_filter.openSocket(iface, addr, PORT, false, false);
+    ASSERT_GE(sock_info_.sockfd_, 0);
+    EXPECT_TRUE(PktFilterLPF::isRingUsed(sock_info_));
+
+    // Nothing has been sent yet, so the receive should return at once.
+    EXPECT_FALSE(pkt_filter.hasBufferedPackets(sock_info_));
+    EXPECT_FALSE(pkt_filter.receive(iface, sock_info_));
+
+    // Send two messages and make sure that both are received from
+    // the same ring block: the second one is held by the filter once
+    // the first one has been received.
+    sendMessage();
+    sendMessage();
+    ASSERT_TRUE(waitForPacket());
+    for (int i = 0; i < 2; ++i) {
+        Pkt4Ptr rcvd_pkt = pkt_filter.receive(iface, sock_info_);
+        ASSERT_TRUE(rcvd_pkt);
+        if (i == 0) {
+            EXPECT_TRUE(pkt_filter.hasBufferedPackets(sock_info_));
+        }
+        ASSERT_NO_THROW(rcvd_pkt->unpack());
+        testRcvdMessage(rcvd_pkt);
+        testRcvdMessageAddressPort(rcvd_pkt);
+    }
+
+    // Close the socket and open it again with the default settings.
+    close(sock_info_.sockfd_);
+    close(sock_info_.fallbackfd_);
+    sock_info_ = SocketInfo(addr, PORT, -1, -1);
+
+    PktFilterLPF pkt_filter_no_ring;
+    sock_info_ = pkt_filter_no_ring.openSocket(iface, addr, PORT, false, false);
+    ASSERT_GE(sock_info_.sockfd_, 0);
+    EXPECT_FALSE(PktFilterLPF::isRingUsed(sock_info_));
+
+    sendMessage();
+    Pkt4Ptr rcvd_pkt = pkt_filter_no_ring.receive(iface, sock_info_);
+    ASSERT_TRUE(rcvd_pkt);
+    EXPECT_FALSE(pkt_filter_no_ring.hasBufferedPackets(sock_info_));
+    ASSERT_NO_THROW(rcvd_pkt->unpack());
+    testRcvdMessage(rcvd_pkt);
+    testRcvdMessageAddressPort(rcvd_pkt);
+}
+
+// This test verifies that the receive ring is released when the socket
+// is closed by the interface and that a new ring is set up when the
+// socket is opened again.
+TEST_F(PktFilterLPFTest, DISABLED_reopenRing) {
+
+    // Packet will be received over loopback interface.
+    Iface iface(ifname_, ifindex_);
+    IOAddress addr("127.0.0.1");
+
+    PktFilterLPF pkt_filter(true);
+    for (int i = 0; i < 2; ++i) {
+        // Open the socket and hand it over to the interface as the
+        // IfaceMgr does.
+        SocketInfo sock_info = pkt_filter.openSocket(iface, addr, PORT,
+                                                     false, false);
+        ASSERT_GE(sock_info.sockfd_, 0);
+        ASSERT_TRUE(PktFilterLPF::isRingUsed(sock_info));
+        iface.addSocket(sock_info);
+        boost::weak_ptr<void> ring = sock_info.filter_state_;
+        sock_info = SocketInfo(addr, PORT, -1, -1);
+
+        // The packets should be received over the ring.
+        sock_info_ = iface.getSockets().front();
+        sendMessage();
+        ASSERT_TRUE(waitForPacket());
+        Pkt4Ptr rcvd_pkt = pkt_filter.receive(iface, sock_info_);
+        ASSERT_TRUE(rcvd_pkt);
+        ASSERT_NO_THROW(rcvd_pkt->unpack());
+        testRcvdMessage(rcvd_pkt);
+        sock_info_ = SocketInfo(addr, PORT, -1, -1);
+
+        // Closing the socket should unmap the ring.
+        ASSERT_FALSE(ring.expired());
+        iface.closeSockets();
+        EXPECT_TRUE(iface.getSockets().empty());
+        EXPECT_TRUE(ring.expired());
+    }
+}
+
 // This test verifies that if the packet is received over the raw
 // socket and its destination address doesn't match the address
 // to which the socket is "bound", the packet is dropped.
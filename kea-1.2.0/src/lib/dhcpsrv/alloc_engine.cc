@@ -781,7 +781,9 @@ AllocEngine::allocateReservedLeases6(ClientContext6& ctx,
 
                 // If this is a real allocation, we may need to extend the lease
                 // lifetime.
-                if (!ctx.fake_allocation_ && conditionalExtendLifetime(*lease)) {
+                if (!ctx.fake_allocation_ &&
+                    conditionalExtendLifetime(*lease,
+                                              ctx.subnet_->getCacheThreshold())) {
                     LeaseMgrFactory::instance().updateLease6(lease);
                 }
                 return;
@@ -1341,8 +1343,10 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
     lease->hwaddr_ = ctx.hwaddr_;
     lease->state_ = Lease::STATE_DEFAULT;
 
-    // Extend lease lifetime if it is time to extend it.
-    conditionalExtendLifetime(*lease);
+    // Extend lease lifetime if it is time to extend it. The existing lease
+    // may only be handed out as is when nothing else has changed in it.
+    conditionalExtendLifetime(*lease, (*lease == *old_data) ?
+                              ctx.subnet_->getCacheThreshold() : 0.0);
 
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE_DETAIL_DATA,
               ALLOC_ENGINE_V6_EXTEND_NEW_LEASE_DATA)
@@ -1414,9 +1418,24 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
             }
         }
 
-        // Now that the lease has been reclaimed, we can go ahead and update it
-        // in the lease database.
-        LeaseMgrFactory::instance().updateLease6(lease);
+        // The callouts may have modified the lease we were going to reuse,
+        // in which case it has to be extended and stored after all.
+        if ((lease->reuseable_valid_lft_ > 0) && !(*lease == *old_data)) {
+            conditionalExtendLifetime(*lease);
+        }
+
+        if (lease->reuseable_valid_lft_ > 0) {
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                      ALLOC_ENGINE_V6_LEASE_REUSE)
+                .arg(ctx.query_->getLabel())
+                .arg(lease->addr_.toText())
+                .arg(lease->reuseable_valid_lft_);
+
+        } else {
+            // Now that the lease has been reclaimed, we can go ahead and
+            // update it in the lease database.
+            LeaseMgrFactory::instance().updateLease6(lease);
+        }
 
     } else {
         // Copy back the original date to the lease. For MySQL it doesn't make
@@ -1462,7 +1481,11 @@ AllocEngine::updateLeaseData(ClientContext6& ctx, const Lease6Collection& leases
             bool fqdn_changed = ((lease->type_ != Lease::TYPE_PD) &&
                                  !(lease->hasIdenticalFqdn(**lease_it)));
 
-            if (conditionalExtendLifetime(*lease) || fqdn_changed) {
+            // The lease is reused only if nothing but its lifetime would
+            // change.
+            double threshold = (*lease == **lease_it) ?
+                ctx.subnet_->getCacheThreshold() : 0.0;
+            if (conditionalExtendLifetime(*lease, threshold) || fqdn_changed) {
                 ctx.currentIA().changed_leases_.push_back(*lease_it);
                 LeaseMgrFactory::instance().updateLease6(lease);
 
@@ -2692,9 +2715,10 @@ AllocEngine::renewLease4(const Lease4Ptr& lease,
         if (ctx.old_lease_->expired()) {
             reclaimExpiredLease(ctx.old_lease_, ctx.callout_handle_);
 
-        } else if (!lease->hasIdenticalFqdn(*ctx.old_lease_)) {
-            // The lease is not expired but the FQDN information has
-            // changed. So, we have to remove the previous DNS entry.
+        } else if (!hasIdenticalDnsData(*lease, *ctx.old_lease_)) {
+            // The lease is not expired but the FQDN information or the
+            // client's identifier has changed. So, we have to remove the
+            // previous DNS entry.
             queueNCR(CHG_REMOVE, ctx.old_lease_);
         }
 
@@ -2744,14 +2768,31 @@ AllocEngine::renewLease4(const Lease4Ptr& lease,
     }
 
     if (!ctx.fake_allocation_ && !skip) {
-        // for REQUEST we do update the lease
-        LeaseMgrFactory::instance().updateLease4(lease);
+        // If nothing but the lifetime of the lease would change and most of
+        // the lifetime is still left, hand out the existing lease rather
+        // than updating it in the lease database.
+        Lease4 reused(*lease);
+        reused.cltt_ = old_values.cltt_;
+        if ((reused == old_values) &&
+            !conditionalExtendLifetime(reused,
+                                       ctx.subnet_->getCacheThreshold())) {
+            *lease = reused;
+            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                      ALLOC_ENGINE_V4_LEASE_REUSE)
+                .arg(ctx.query_->getLabel())
+                .arg(lease->addr_.toText())
+                .arg(lease->reuseable_valid_lft_);
 
-        // We need to account for the re-assignment of The lease.
-        if (ctx.old_lease_->expired() || ctx.old_lease_->state_ == Lease::STATE_EXPIRED_RECLAIMED) {
-            StatsMgr::instance().addValue(
-                StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
-                static_cast<int64_t>(1));
+        } else {
+            // for REQUEST we do update the lease
+            LeaseMgrFactory::instance().updateLease4(lease);
+
+            // We need to account for the re-assignment of The lease.
+            if (ctx.old_lease_->expired() || ctx.old_lease_->state_ == Lease::STATE_EXPIRED_RECLAIMED) {
+                StatsMgr::instance().addValue(
+                    StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
+                    static_cast<int64_t>(1));
+            }
         }
     }
     if (skip) {
@@ -2927,8 +2968,18 @@ AllocEngine::updateLease4Information(const Lease4Ptr& lease,
 }
 
 bool
-AllocEngine::conditionalExtendLifetime(Lease& lease) const {
-    lease.cltt_ = time(NULL);
+AllocEngine::conditionalExtendLifetime(Lease& lease,
+                                       const double threshold) const {
+    lease.reuseable_valid_lft_ = 0;
+    time_t now = time(NULL);
+    if ((threshold > 0.0) && (lease.valid_lft_ > 0) && (lease.cltt_ <= now)) {
+        int64_t remaining = lease.getExpirationTime() - now;
+        if (remaining > threshold * lease.valid_lft_) {
+            lease.reuseable_valid_lft_ = static_cast<uint32_t>(remaining);
+            return (false);
+        }
+    }
+    lease.cltt_ = now;
     return (true);
 }
 
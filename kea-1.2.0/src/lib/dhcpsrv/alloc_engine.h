@@ -1446,23 +1446,27 @@ private:
     /// @brief Extends the lease lifetime.
     ///
     /// This function is called to conditionally extend the lifetime of
-    /// the DHCPv4 or DHCPv6 lease. It is envisaged that this function will
-    /// make a decision if the lease lifetime should be extended, using
-    /// a preconfigured threshold, which would indicate how many percent
-    /// of the valid lifetime should have passed for the lease lifetime
-    /// to be extended. The lease lifetime would not be extended if
-    /// the threshold hasn't been reached.
+    /// the DHCPv4 or DHCPv6 lease. The lease lifetime is not extended if
+    /// the remaining lifetime of the lease is above the specified fraction
+    /// of its valid lifetime. In this case the remaining lifetime is stored
+    /// in @c Lease::reuseable_valid_lft_ and the caller should hand out the
+    /// existing lease without updating it in the lease database.
     ///
-    /// @todo Currently this function always extends the lease lifetime.
-    /// In the future, it will take the threshold value into account,
-    /// once the threshold is configurable.
+    /// The caller must only specify a non-zero threshold if nothing but the
+    /// client last transmission time would change in the lease. In
+    /// particular, @c Lease::valid_lft_ and @c Lease::cltt_ must still hold
+    /// the values stored in the lease database.
     ///
     /// @param [in,out] lease A lease for which the lifetime should be
     /// extended.
+    /// @param threshold Lease cache threshold, i.e. the fraction of the
+    /// valid lifetime which has to remain for the lease to be reused. The
+    /// value of 0 causes the lifetime to be always extended.
     ///
     /// @return true if the lease lifetime has been extended, false
     /// otherwise.
-    bool conditionalExtendLifetime(Lease& lease) const;
+    bool conditionalExtendLifetime(Lease& lease,
+                                   const double threshold = 0.0) const;
 
 private:
 
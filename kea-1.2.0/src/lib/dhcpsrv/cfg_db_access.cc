@@ -80,6 +80,8 @@ CfgDbAccess::toElementDbAccessString(const std::string& dbaccess) {
             std::string keyword = token.substr(0, pos);
             std::string value = token.substr(pos + 1);
             if ((keyword == "lfc-interval") ||
+                (keyword == "load-threads") ||
+                (keyword == "lfc-max-leases") ||
                 (keyword == "connect-timeout") ||
                 (keyword == "port")) {
                 // integer parameters
@@ -22,7 +22,7 @@ namespace dhcp {
 const char* CfgIface::ALL_IFACES_KEYWORD = "*";
 
 CfgIface::CfgIface()
-    : wildcard_used_(false), socket_type_(SOCKET_RAW) {
+    : wildcard_used_(false), socket_type_(SOCKET_RAW), receive_ring_(false) {
 }
 
 void
@@ -35,7 +35,8 @@ CfgIface::equals(const CfgIface& other) const {
     return (iface_set_ == other.iface_set_ &&
             address_map_ == other.address_map_ &&
             wildcard_used_ == other.wildcard_used_ &&
-            socket_type_ == other.socket_type_);
+            socket_type_ == other.socket_type_ &&
+            receive_ring_ == other.receive_ring_);
 }
 
 bool
@@ -71,7 +72,8 @@ CfgIface::openSockets(const uint16_t family, const uint16_t port,
     // sockets. However, this may be unsupported on some operating
     // systems, so there is no guarantee.
     if ((family == AF_INET) && (!IfaceMgr::instance().isTestMode())) {
-        iface_mgr.setMatchingPacketFilter(socket_type_ == SOCKET_RAW);
+        iface_mgr.setMatchingPacketFilter(socket_type_ == SOCKET_RAW,
+                                          receive_ring_);
         if ((socket_type_ == SOCKET_RAW) &&
             !iface_mgr.isDirectResponseSupported()) {
             LOG_WARN(dhcpsrv_logger, DHCPSRV_CFGMGR_SOCKET_RAW_UNSUPPORTED);
@@ -399,6 +401,15 @@ CfgIface::useSocketType(const uint16_t family,
     useSocketType(family, textToSocketType(socket_type_name));
 }
 
+void
+CfgIface::useReceiveRing(const uint16_t family, const bool use_ring) {
+    if (family != AF_INET) {
+        isc_throw(InvalidSocketType, "receive ring must not be specified for"
+                  " the DHCPv6 server");
+    }
+    receive_ring_ = use_ring;
+}
+
 ElementPtr
 CfgIface::toElement() const {
     ElementPtr result = Element::createMap();
@@ -425,6 +436,11 @@ CfgIface::toElement() const {
         result->set("dhcp-socket-type", Element::create(std::string("udp")));
     }
 
+    // Set receive-ring (DHCPv4 specific too)
+    if (receive_ring_) {
+        result->set("receive-ring", Element::create(true));
+    }
+
     return (result);
 }
 
@@ -84,7 +84,9 @@ public:
 /// in such case the use of UDP sockets is preferred. The type of the
 /// sockets to be opened is specified using one of the
 /// @c CfgIface::useSocketType method variants. The @c CfgIface::SocketType
-/// enumeration specifies the possible values.
+/// enumeration specifies the possible values. The raw sockets may
+/// additionally receive the packets through a memory mapped ring, which
+/// is enabled with @c CfgIface::useReceiveRing.
 ///
 /// @warning This class makes use of the AF_INET and AF_INET6 family literals,
 /// but it doesn't verify that the address family value passed as @c uint16_t
@@ -227,6 +229,22 @@ public:
     /// @brief Returns the socket type in the textual format.
     std::string socketTypeToText() const;
 
+    /// @brief Enables or disables the memory mapped receive ring.
+    ///
+    /// The ring is only used by the raw sockets on the systems which
+    /// support it. It is disabled by default.
+    ///
+    /// @param family Address family (AF_INET or AF_INET6).
+    /// @param use_ring Indicates if the ring should be used.
+    ///
+    /// @throw InvalidSocketType if the address family is AF_INET6.
+    void useReceiveRing(const uint16_t family, const bool use_ring);
+
+    /// @brief Checks if the memory mapped receive ring should be used.
+    bool getReceiveRing() const {
+        return (receive_ring_);
+    }
+
     /// @brief Converts the socket type in the textual format to the type
     /// represented by the @c SocketType.
     ///
@@ -330,6 +348,9 @@ private:
 
     /// @brief A type of the sockets used by the DHCP server.
     SocketType socket_type_;
+
+    /// @brief Indicates if the raw sockets should use the receive ring.
+    bool receive_ring_;
 };
 
 /// @brief A pointer to the @c CfgIface .
@@ -358,6 +358,11 @@ CfgSubnets4::toElement() const {
                       "invalid host reservation mode: " << hrmode);
         }
         map->set("reservation-mode", Element::create(mode));
+        // Set cache-threshold (only when leases are cached)
+        double cache_threshold = (*subnet)->getCacheThreshold();
+        if (cache_threshold > 0.0) {
+            map->set("cache-threshold", Element::create(cache_threshold));
+        }
         // Set match-client-id
         map->set("match-client-id",
                  Element::create((*subnet)->getMatchClientId()));
@@ -392,6 +392,11 @@ CfgSubnets6::toElement() const {
                       "invalid host reservation mode: " << hrmode);
         }
         map->set("reservation-mode", Element::create(mode));
+        // Set cache-threshold (only when leases are cached)
+        double cache_threshold = (*subnet)->getCacheThreshold();
+        if (cache_threshold > 0.0) {
+            map->set("cache-threshold", Element::create(cache_threshold));
+        }
         // Set client-class
         const ClientClasses& cclasses = (*subnet)->getClientClasses();
         if (cclasses.size() > 1) {
@@ -14,7 +14,7 @@ namespace isc {
 namespace dhcp {
 
 CSVLeaseFile4::CSVLeaseFile4(const std::string& filename)
-    : VersionedCSVFile(filename) {
+    : VersionedCSVFile(filename), row_() {
     initColumns();
 }
 
@@ -67,45 +67,79 @@ CSVLeaseFile4::append(const Lease4& lease) {
 
 bool
 CSVLeaseFile4::next(Lease4Ptr& lease) {
-    // Bump the number of read attempts
-    ++reads_;
-
     // Read the CSV row and try to create a lease from the values read.
     // This may easily result in exception. We don't want this function
     // to throw exceptions, so we catch them all and rather return the
     // false value.
+    lease.reset();
+
+    // Get the row of CSV values. The same row object is used for
+    // all rows, so as the memory holding the values is reused.
+    if (!nextRow(row_)) {
+        return (false);
+    }
+
+    // The empty row signals EOF.
+    if (row_.empty()) {
+        return (true);
+    }
+
+    try {
+        lease = parseRow(row_);
+
+    } catch (std::exception& ex) {
+        // The lease hasn't been parsed.
+        rowParsed(false, ex.what());
+        return (false);
+    }
+
+    rowParsed(true);
+    return (true);
+}
+
+bool
+CSVLeaseFile4::nextRow(CSVRow& row) {
+    // Bump the number of read attempts
+    ++reads_;
+
     try {
-        // Get the row of CSV values.
-        CSVRow row;
         VersionedCSVFile::next(row);
-        // The empty row signals EOF.
-        if (row == CSVFile::EMPTY_ROW()) {
-            lease.reset();
-            return (true);
-        }
-
-        // Get client id. It is possible that the client id is empty and the
-        // returned pointer is NULL. This is ok, but if the client id is NULL,
-        // we need to be careful to not use the NULL pointer.
-        ClientIdPtr client_id = readClientId(row);
-        std::vector<uint8_t> client_id_vec;
-        if (client_id) {
-            client_id_vec = client_id->getClientId();
-        }
-        size_t client_id_len = client_id_vec.size();
-
-        // Get the HW address. It should never be empty and the readHWAddr checks
-        // that.
-        HWAddr hwaddr = readHWAddr(row);
-        uint32_t state = readState(row);
-        if (hwaddr.hwaddr_.empty() && state != Lease::STATE_DECLINED) {
-            isc_throw(isc::BadValue, "A blank hardware address is only"
-                      " valid for declined leases");
-        }
-
-        lease.reset(new Lease4(readAddress(row),
+
+    } catch (std::exception& ex) {
+        // bump the read error count
+        ++read_errs_;
+        setReadMsg(ex.what());
+        return (false);
+    }
+
+    return (true);
+}
+
+Lease4Ptr
+CSVLeaseFile4::parseRow(const CSVRow& row) const {
+    // Get client id. It is possible that the client id is empty and the
+    // returned pointer is NULL. This is ok, but if the client id is NULL,
+    // we need to be careful to not use the NULL pointer.
+    ClientIdPtr client_id = readClientId(row);
+    std::vector<uint8_t> client_id_vec;
+    if (client_id) {
+        client_id_vec = client_id->getClientId();
+    }
+    size_t client_id_len = client_id_vec.size();
+
+    // Get the HW address. It should never be empty and the readHWAddr checks
+    // that.
+    HWAddr hwaddr = readHWAddr(row);
+    uint32_t state = readState(row);
+    if (hwaddr.hwaddr_.empty() && state != Lease::STATE_DECLINED) {
+        isc_throw(isc::BadValue, "A blank hardware address is only"
+                  " valid for declined leases");
+    }
+
+    Lease4Ptr lease(new Lease4(readAddress(row),
                                HWAddrPtr(new HWAddr(hwaddr)),
-                               client_id_vec.empty() ? NULL : &client_id_vec[0],
+                               client_id_vec.empty() ? NULL :
+                               &client_id_vec[0],
                                client_id_len,
                                readValid(row),
                                0, 0, // t1, t2 = 0
@@ -114,23 +148,22 @@ CSVLeaseFile4::next(Lease4Ptr& lease) {
                                readFqdnFwd(row),
                                readFqdnRev(row),
                                readHostname(row)));
-        lease->state_ = state;
+    lease->state_ = state;
 
-    } catch (std::exception& ex) {
+    return (lease);
+}
+
+void
+CSVLeaseFile4::rowParsed(const bool parsed, const std::string& error_msg) {
+    if (parsed) {
+        // bump the number of leases read
+        ++read_leases_;
+
+    } else {
         // bump the read error count
         ++read_errs_;
-
-        // The lease might have been created, so let's set it back to NULL to
-        // signal that lease hasn't been parsed.
-        lease.reset();
-        setReadMsg(ex.what());
-        return (false);
+        setReadMsg(error_msg);
     }
-
-    // bump the number of leases read
-    ++read_leases_;
-
-    return (true);
 }
 
 void
@@ -150,19 +183,19 @@ CSVLeaseFile4::initColumns() {
 }
 
 IOAddress
-CSVLeaseFile4::readAddress(const CSVRow& row) {
+CSVLeaseFile4::readAddress(const CSVRow& row) const {
     IOAddress address(row.readAt(getColumnIndex("address")));
     return (address);
 }
 
 HWAddr
-CSVLeaseFile4::readHWAddr(const CSVRow& row) {
+CSVLeaseFile4::readHWAddr(const CSVRow& row) const {
     HWAddr hwaddr = HWAddr::fromText(row.readAt(getColumnIndex("hwaddr")));
     return (hwaddr);
 }
 
 ClientIdPtr
-CSVLeaseFile4::readClientId(const CSVRow& row) {
+CSVLeaseFile4::readClientId(const CSVRow& row) const {
     std::string client_id = row.readAt(getColumnIndex("client_id"));
     // NULL client ids are allowed in DHCPv4.
     if (client_id.empty()) {
@@ -173,46 +206,46 @@ CSVLeaseFile4::readClientId(const CSVRow& row) {
 }
 
 uint32_t
-CSVLeaseFile4::readValid(const CSVRow& row) {
+CSVLeaseFile4::readValid(const CSVRow& row) const {
     uint32_t valid =
         row.readAndConvertAt<uint32_t>(getColumnIndex("valid_lifetime"));
     return (valid);
 }
 
 time_t
-CSVLeaseFile4::readCltt(const CSVRow& row) {
+CSVLeaseFile4::readCltt(const CSVRow& row) const {
     uint32_t cltt = row.readAndConvertAt<uint32_t>(getColumnIndex("expire"))
         - readValid(row);
     return (cltt);
 }
 
 SubnetID
-CSVLeaseFile4::readSubnetID(const CSVRow& row) {
+CSVLeaseFile4::readSubnetID(const CSVRow& row) const {
     SubnetID subnet_id =
         row.readAndConvertAt<SubnetID>(getColumnIndex("subnet_id"));
     return (subnet_id);
 }
 
 bool
-CSVLeaseFile4::readFqdnFwd(const CSVRow& row) {
+CSVLeaseFile4::readFqdnFwd(const CSVRow& row) const {
     bool fqdn_fwd = row.readAndConvertAt<bool>(getColumnIndex("fqdn_fwd"));
     return (fqdn_fwd);
 }
 
 bool
-CSVLeaseFile4::readFqdnRev(const CSVRow& row) {
+CSVLeaseFile4::readFqdnRev(const CSVRow& row) const {
     bool fqdn_rev = row.readAndConvertAt<bool>(getColumnIndex("fqdn_rev"));
     return (fqdn_rev);
 }
 
 std::string
-CSVLeaseFile4::readHostname(const CSVRow& row) {
+CSVLeaseFile4::readHostname(const CSVRow& row) const {
     std::string hostname = row.readAt(getColumnIndex("hostname"));
     return (hostname);
 }
 
 uint32_t
-CSVLeaseFile4::readState(const util::CSVRow& row) {
+CSVLeaseFile4::readState(const util::CSVRow& row) const {
     uint32_t state = row.readAndConvertAt<uint32_t>(getColumnIndex("state"));
     return (state);
 }
@@ -80,6 +80,48 @@ public:
     /// ticket http://kea.isc.org/ticket/2405 is implemented.
     bool next(Lease4Ptr& lease);
 
+    /// @name Methods which split the work of @c next.
+    ///
+    /// They allow for reading the rows of the file in order by one thread
+    /// while the leases are created from the rows by other threads. The
+    /// rows must be accounted for with @c rowParsed in the order in which
+    /// they were read to keep the statistics of the file the same as
+    /// if they were read with @c next.
+    //@{
+    ///
+    /// @brief Reads the next row of the CSV file without creating a lease.
+    ///
+    /// If this function hits an error during row read, it sets the error
+    /// message using @c CSVFile::setReadMsg and returns false. The row is
+    /// accounted for and no call to @c rowParsed is expected for it.
+    ///
+    /// This function is exception safe.
+    ///
+    /// @param [out] row Object receiving the values read. It is empty if
+    /// the end of file has been reached.
+    ///
+    /// @return true if the row has been read, false if an error occurred.
+    bool nextRow(util::CSVRow& row);
+
+    /// @brief Creates a lease from the row read with @c nextRow.
+    ///
+    /// This function doesn't modify the object, so it may be called by
+    /// several threads concurrently, for different rows.
+    ///
+    /// @param row Non-empty row read with @c nextRow.
+    ///
+    /// @return Pointer to the lease created.
+    /// @throw isc::Exception or std::exception if the values are invalid.
+    Lease4Ptr parseRow(const util::CSVRow& row) const;
+
+    /// @brief Accounts for the row read with @c nextRow.
+    ///
+    /// @param parsed true if the lease has been created from the row.
+    /// @param error_msg Error message if the lease hasn't been created.
+    /// It is set using @c CSVFile::setReadMsg.
+    void rowParsed(const bool parsed, const std::string& error_msg = "");
+    //@}
+
 private:
 
     /// @brief Initializes columns of the CSV file holding leases.
@@ -105,54 +147,57 @@ private:
     /// @brief Reads lease address from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    asiolink::IOAddress readAddress(const util::CSVRow& row);
+    asiolink::IOAddress readAddress(const util::CSVRow& row) const;
 
     /// @brief Reads HW address from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    HWAddr readHWAddr(const util::CSVRow& row);
+    HWAddr readHWAddr(const util::CSVRow& row) const;
 
     /// @brief Reads client identifier from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    ClientIdPtr readClientId(const util::CSVRow& row);
+    ClientIdPtr readClientId(const util::CSVRow& row) const;
 
     /// @brief Reads valid lifetime from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    uint32_t readValid(const util::CSVRow& row);
+    uint32_t readValid(const util::CSVRow& row) const;
 
     /// @brief Reads cltt value from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    time_t readCltt(const util::CSVRow& row);
+    time_t readCltt(const util::CSVRow& row) const;
 
     /// @brief Reads subnet id from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    SubnetID readSubnetID(const util::CSVRow& row);
+    SubnetID readSubnetID(const util::CSVRow& row) const;
 
     /// @brief Reads the FQDN forward flag from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    bool readFqdnFwd(const util::CSVRow& row);
+    bool readFqdnFwd(const util::CSVRow& row) const;
 
     /// @brief Reads the FQDN reverse flag from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    bool readFqdnRev(const util::CSVRow& row);
+    bool readFqdnRev(const util::CSVRow& row) const;
 
     /// @brief Reads hostname from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    std::string readHostname(const util::CSVRow& row);
+    std::string readHostname(const util::CSVRow& row) const;
 
     /// @brief Reads lease state from the CSV file row.
     ///
     /// @param row CSV file row holding lease information.
-    uint32_t readState(const util::CSVRow& row);
+    uint32_t readState(const util::CSVRow& row) const;
     //@}
 
+    /// @brief Row into which the lease file rows are read.
+    util::CSVRow row_;
+
 };
 
 } // namespace isc::dhcp
@@ -143,12 +143,20 @@ public:
     /// Daemon is merged with CPL architecture, it will be a better
     /// fit.
     ///
+    /// The configuration converted to JSON may be specified instead, e.g.
+    /// when it is written by a thread other than the main one, which can't
+    /// use CfgMgr.
+    ///
     /// @param config_file name of the file to write the configuration to
+    /// @param cfg configuration to be written; the current one is written
+    /// if it is null
     /// @return number of files written
     /// @throw Unexpected if CfgMgr can't retrieve configuation or file cannot
     ///                   be written
     virtual size_t
-    writeConfigFile(const std::string& config_file) const;
+    writeConfigFile(const std::string& config_file,
+                    isc::data::ConstElementPtr cfg =
+                    isc::data::ConstElementPtr()) const;
 
     /// @brief returns the process name
     /// This value is used as when forming the default PID file name
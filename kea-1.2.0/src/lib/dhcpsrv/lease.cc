@@ -9,6 +9,7 @@
 #include <sstream>
 #include <iostream>
 
+using namespace isc::data;
 using namespace isc::util;
 using namespace std;
 
@@ -25,7 +26,8 @@ Lease::Lease(const isc::asiolink::IOAddress& addr, uint32_t t1, uint32_t t2,
              const std::string& hostname, const HWAddrPtr& hwaddr)
     :addr_(addr), t1_(t1), t2_(t2), valid_lft_(valid_lft), cltt_(cltt),
      subnet_id_(subnet_id), hostname_(hostname), fqdn_fwd_(fqdn_fwd),
-    fqdn_rev_(fqdn_rev), hwaddr_(hwaddr), state_(STATE_DEFAULT) {
+    fqdn_rev_(fqdn_rev), hwaddr_(hwaddr), state_(STATE_DEFAULT),
+    reuseable_valid_lft_(0) {
 }
 
 
@@ -101,6 +103,7 @@ Lease4::Lease4(const Lease4& other)
 
     // Copy over fields derived from Lease.
     state_ = other.state_;
+    reuseable_valid_lft_ = other.reuseable_valid_lft_;
 
     // Copy the hardware address if it is defined.
     if (other.hwaddr_) {
@@ -203,6 +206,7 @@ Lease4::operator=(const Lease4& other) {
         fqdn_fwd_ = other.fqdn_fwd_;
         fqdn_rev_ = other.fqdn_rev_;
         state_ = other.state_;
+        reuseable_valid_lft_ = other.reuseable_valid_lft_;
 
         // Copy the hardware address if it is defined.
         if (other.hwaddr_) {
@@ -308,6 +312,31 @@ Lease6::toText() const {
     return (stream.str());
 }
 
+ElementPtr
+Lease6::toElement() const {
+    ElementPtr map = Element::createMap();
+    map->set("ip-address", Element::create(addr_.toText()));
+    map->set("type", Element::create(typeToText(type_)));
+    if (type_ == TYPE_PD) {
+        map->set("prefix-len", Element::create(static_cast<int>(prefixlen_)));
+    }
+    map->set("iaid", Element::create(static_cast<long int>(iaid_)));
+    map->set("duid", Element::create(duid_ ? duid_->toText() : ""));
+    map->set("subnet-id", Element::create(static_cast<long int>(subnet_id_)));
+    if (hwaddr_) {
+        map->set("hw-address", Element::create(hwaddr_->toText(false)));
+    }
+    map->set("cltt", Element::create(static_cast<long int>(cltt_)));
+    map->set("preferred-lft",
+             Element::create(static_cast<long int>(preferred_lft_)));
+    map->set("valid-lft", Element::create(static_cast<long int>(valid_lft_)));
+    map->set("fqdn-fwd", Element::create(fqdn_fwd_));
+    map->set("fqdn-rev", Element::create(fqdn_rev_));
+    map->set("hostname", Element::create(hostname_));
+    map->set("state", Element::create(statesToText(state_)));
+    return (map);
+}
+
 std::string
 Lease4::toText() const {
     ostringstream stream;
@@ -325,6 +354,26 @@ Lease4::toText() const {
     return (stream.str());
 }
 
+ElementPtr
+Lease4::toElement() const {
+    ElementPtr map = Element::createMap();
+    map->set("ip-address", Element::create(addr_.toText()));
+    map->set("subnet-id", Element::create(static_cast<long int>(subnet_id_)));
+    if (hwaddr_) {
+        map->set("hw-address", Element::create(hwaddr_->toText(false)));
+    }
+    if (client_id_) {
+        map->set("client-id", Element::create(client_id_->toText()));
+    }
+    map->set("cltt", Element::create(static_cast<long int>(cltt_)));
+    map->set("valid-lft", Element::create(static_cast<long int>(valid_lft_)));
+    map->set("fqdn-fwd", Element::create(fqdn_fwd_));
+    map->set("fqdn-rev", Element::create(fqdn_rev_));
+    map->set("hostname", Element::create(hostname_));
+    map->set("state", Element::create(statesToText(state_)));
+    return (map);
+}
+
 
 bool
 Lease4::operator==(const Lease4& other) const {
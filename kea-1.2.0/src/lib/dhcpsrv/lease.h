@@ -8,6 +8,7 @@
 #define LEASE_H
 
 #include <asiolink/io_address.h>
+#include <cc/cfg_to_element.h>
 #include <dhcp/duid.h>
 #include <dhcp/option.h>
 #include <dhcp/hwaddr.h>
@@ -25,7 +26,7 @@ typedef uint32_t SubnetID;
 ///
 /// This structure holds all information that is common between IPv4 and IPv6
 /// leases.
-struct Lease {
+struct Lease : public isc::data::CfgToElement {
 
     /// @brief Type of lease or pool
     typedef enum {
@@ -152,6 +153,16 @@ struct Lease {
     /// belonging to this class.
     uint32_t state_;
 
+    /// @brief Remaining valid lifetime of a reused lease.
+    ///
+    /// When the allocation engine hands out an existing lease without
+    /// extending it in the lease database (see
+    /// @ref Subnet::getCacheThreshold), this field holds the remaining
+    /// lifetime of the lease which should be sent to the client. The
+    /// value of 0 means that the lease has not been reused. This value
+    /// is not stored in the lease database.
+    uint32_t reuseable_valid_lft_;
+
     /// @brief Convert Lease to Printable Form
     ///
     /// @return String form of the lease
@@ -393,6 +404,13 @@ struct Lease4 : public Lease {
     /// @return Textual representation of lease data
     virtual std::string toText() const;
 
+    /// @brief Returns the lease as a map of its parameters.
+    ///
+    /// The map is used to report the lease over the control channel.
+    ///
+    /// @return Pointer to the map holding the lease parameters.
+    virtual isc::data::ElementPtr toElement() const;
+
     /// @brief Sets IPv4 lease to declined state.
     ///
     /// See @ref Lease::decline for detailed description.
@@ -532,6 +550,13 @@ struct Lease6 : public Lease {
     ///
     /// @return String form of the lease
     virtual std::string toText() const;
+
+    /// @brief Returns the lease as a map of its parameters.
+    ///
+    /// The map is used to report the lease over the control channel.
+    ///
+    /// @return Pointer to the map holding the lease parameters.
+    virtual isc::data::ElementPtr toElement() const;
 };
 
 /// @brief Pointer to a Lease6 structure.
@@ -10,9 +10,21 @@
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/memfile_lease_storage.h>
 #include <util/versioned_csv_file.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
 
+#include <boost/bind.hpp>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/ref.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+#include <string>
+#include <vector>
+
 namespace isc {
 namespace dhcp {
 
@@ -30,6 +42,10 @@ namespace dhcp {
 /// In the latter case, this class is used by the standalone application
 /// which reads the whole lease file into memory (storage) and then
 /// dumps the leases held in the storage to another file.
+/// If the memory used by the application must be bounded, the leases are
+/// loaded with @c loadRuns instead. It writes the leases to the temporary
+/// files (runs), sorted by address, whenever the storage holds too many
+/// leases. The @c writeRuns merges the runs into the output file.
 ///
 /// The methods in this class are templated so as they can be used both
 /// with the @c Lease4Storage and @c Lease6Storage to process the DHCPv4
@@ -51,6 +67,13 @@ public:
     /// means that the particular lease was released and the method
     /// removes an existing lease from the container.
     ///
+    /// When more than one thread is specified, the rows of the file are
+    /// read in batches. The leases are created from the rows of a batch
+    /// by several threads, each converting its share of the rows, and
+    /// then inserted into the storage in the file order. The result is
+    /// the same as when the file is loaded by a single thread. Small
+    /// files are loaded by the calling thread only.
+    ///
     /// @param lease_file A reference to the @c CSVLeaseFile4 or
     /// @c CSVLeaseFile6 object representing the lease file. The file
     /// doesn't need to be open because the method re-opens the file.
@@ -65,6 +88,8 @@ public:
     /// One case when the file is not opened is when the server starts
     /// up, reads the leases in the file and then leaves the file open
     /// for writing future lease updates.
+    /// @param threads Maximum number of threads creating the leases from
+    /// the rows of the file, including the calling thread.
     /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
     /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
     /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
@@ -75,95 +100,14 @@ public:
              typename StorageType>
     static void load(LeaseFileType& lease_file, StorageType& storage,
                      const uint32_t max_errors = 0xFFFFFFFF,
-                     const bool close_file_on_exit = true) {
-
-        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_FILE_LOAD)
-            .arg(lease_file.getFilename());
-
-        // Reopen the file, as we don't know whether the file is open
-        // and we also don't know its current state.
-        lease_file.close();
-        lease_file.open();
-
-        boost::shared_ptr<LeaseObjectType> lease;
-        // Track the number of corrupted leases.
-        uint32_t errcnt = 0;
-        while (true) {
-            // Unable to parse the lease.
-            if (!lease_file.next(lease)) {
-                LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR)
-                            .arg(lease_file.getReads())
-                            .arg(lease_file.getReadMsg());
-
-                // A value of 0xFFFFFFFF indicates that we don't return
-                // until the whole file is parsed, even if errors occur.
-                // Otherwise, check if we have exceeded the maximum number
-                // of errors and throw an exception if we have.
-                if (++errcnt > max_errors) {
-                    // If we break parsing the CSV file because of too many
-                    // errors, it doesn't make sense to keep the file open.
-                    // This is because the caller wouldn't know where we
-                    // stopped parsing and where the internal file pointer
-                    // is. So, there are probably no cases when the caller
-                    // would continue to use the open file.
-                    lease_file.close();
-                    isc_throw(util::CSVFileError, "exceeded maximum number of"
-                              " failures " << max_errors << " to read a lease"
-                              " from the lease file "
-                              << lease_file.getFilename());
-                }
-                // Skip the corrupted lease.
-                continue;
-            }
-
-            // Lease was found and we successfully parsed it.
-            if (lease) {
-                LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL_DATA,
-                          DHCPSRV_MEMFILE_LEASE_LOAD)
-                    .arg(lease->toText());
-
-                // Check if this lease exists.
-                typename StorageType::iterator lease_it =
-                    storage.find(lease->addr_);
-                // The lease doesn't exist yet. Insert the lease if
-                // it has a positive valid lifetime.
-                if (lease_it == storage.end()) {
-                    if (lease->valid_lft_ > 0) {
-                        storage.insert(lease);
-                    }
-                } else {
-                    // The lease exists. If the new entry has a valid
-                    // lifetime of 0 it is an indication to remove the
-                    // existing entry. Otherwise, we update the lease.
-                    if (lease->valid_lft_ == 0) {
-                        storage.erase(lease_it);
-
-                    } else {
-                        // Use replace to re-index leases on update.
-                        storage.replace(lease_it, lease);
-                    }
-                }
-
-            } else {
-                // Being here means that we hit the end of file.
-                break;
-
-            }
-        }
-
-        if (lease_file.needsConversion()) {
-            LOG_WARN(dhcpsrv_logger,
-                     (lease_file.getInputSchemaState()
-                      == util::VersionedCSVFile::NEEDS_UPGRADE
-                      ?  DHCPSRV_MEMFILE_NEEDS_UPGRADING
-                      : DHCPSRV_MEMFILE_NEEDS_DOWNGRADING))
-                     .arg(lease_file.getFilename())
-                     .arg(lease_file.getSchemaVersion());
-        }
-
-        if (close_file_on_exit) {
-            lease_file.close();
-        }
+                     const bool close_file_on_exit = true,
+                     const unsigned int threads = 1) {
+        typedef boost::shared_ptr<LeaseObjectType> LeasePtr;
+        loadFile<LeaseObjectType>(lease_file,
+                                  boost::bind(&LeaseFileLoader::storeLease<
+                                              StorageType, LeasePtr>,
+                                              boost::ref(storage), _1),
+                                  max_errors, close_file_on_exit, threads);
     }
 
     /// @brief Write leases from the storage into a lease file
@@ -216,6 +160,707 @@ public:
         // Close the file
         lease_file.close();
     }
+
+    /// @brief Load the most recent entries of the leases from the lease
+    /// file, holding a limited number of leases in memory.
+    ///
+    /// This method reads the lease file like @c load, but it keeps the
+    /// most recent entry of each lease in the storage, including the
+    /// entries with the valid lifetime of 0. Such entries remove the
+    /// lease which may have been written to a previous run.
+    ///
+    /// When the storage holds the maximum number of leases, they are
+    /// written to a new run file in the order of the addresses and the
+    /// storage is cleared. The names of the run files are made of the
+    /// specified prefix followed by ".run" and a sequence number. The
+    /// run files are appended to the list of runs, which may be passed to
+    /// the subsequent calls for the next lease files. The leases held in
+    /// the storage and the runs are written to the lease file with
+    /// @c writeRuns.
+    ///
+    /// @param lease_file A reference to the @c CSVLeaseFile4 or
+    /// @c CSVLeaseFile6 object representing the lease file.
+    /// @param storage A reference to the container holding the leases
+    /// not written to the runs yet.
+    /// @param [in,out] runs Names of the run files, from the oldest.
+    /// @param run_prefix Prefix of the names of the run files.
+    /// @param max_leases Maximum number of leases held in the storage.
+    /// @param max_errors Maximum number of corrupted leases in the
+    /// lease file.
+    /// @param threads Maximum number of threads creating the leases from
+    /// the rows of the file, including the calling thread.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded or a run file can't be written.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    static void loadRuns(LeaseFileType& lease_file, StorageType& storage,
+                         std::vector<std::string>& runs,
+                         const std::string& run_prefix,
+                         const size_t max_leases,
+                         const uint32_t max_errors = 0xFFFFFFFF,
+                         const unsigned int threads = 1) {
+        typedef boost::shared_ptr<LeaseObjectType> LeasePtr;
+        loadFile<LeaseObjectType>(lease_file,
+                                  boost::bind(&LeaseFileLoader::storeLatest<
+                                              LeaseFileType, StorageType,
+                                              LeasePtr>,
+                                              boost::ref(storage),
+                                              boost::ref(runs),
+                                              boost::cref(run_prefix),
+                                              max_leases, _1),
+                                  max_errors, true, threads);
+    }
+
+    /// @brief Write the leases loaded with @c loadRuns into a lease file.
+    ///
+    /// The leases held in the storage and the runs are merged by address.
+    /// For each address, the entry from the storage or the most recent
+    /// run wins, and it is written unless its valid lifetime is 0. The
+    /// output is the same as the one of @c write after loading the same
+    /// lease files with @c load. Only one lease per run is held in memory.
+    ///
+    /// @param lease_file A reference to the @c CSVLeaseFile4 or
+    /// @c CSVLeaseFile6 object representing the lease file. The file
+    /// doesn't need to be open because the method re-opens the file.
+    /// @param storage A reference to the container holding the leases
+    /// not written to the runs.
+    /// @param runs Names of the run files, from the oldest.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    ///
+    /// @throw isc::util::CSVFileError when a run file can't be read.
+    template<typename LeaseObjectType, typename LeaseFileType,
+             typename StorageType>
+    static void writeRuns(LeaseFileType& lease_file,
+                          const StorageType& storage,
+                          const std::vector<std::string>& runs) {
+        typedef boost::shared_ptr<LeaseObjectType> LeasePtr;
+        typedef boost::shared_ptr<LeaseFileType> LeaseFilePtr;
+
+        // Open the runs and read their first leases.
+        std::vector<LeaseFilePtr> run_files;
+        std::vector<LeasePtr> heads;
+        for (size_t i = 0; i < runs.size(); ++i) {
+            run_files.push_back(LeaseFilePtr(new LeaseFileType(runs[i])));
+            run_files.back()->open();
+            heads.push_back(LeasePtr());
+            nextRunLease(*run_files.back(), heads.back());
+        }
+        typename StorageType::const_iterator held = storage.begin();
+
+        lease_file.close();
+        lease_file.open();
+
+        try {
+            while (true) {
+                // Find the lowest address. The storage holds the most
+                // recent entries, followed by the runs from the last one.
+                LeasePtr lease;
+                if (held != storage.end()) {
+                    lease = *held;
+                }
+                for (size_t i = heads.size(); i > 0; --i) {
+                    if (heads[i - 1] &&
+                        (!lease || (heads[i - 1]->addr_ < lease->addr_))) {
+                        lease = heads[i - 1];
+                    }
+                }
+                if (!lease) {
+                    break;
+                }
+
+                // Skip the older entries for the same address.
+                if ((held != storage.end()) &&
+                    ((*held)->addr_ == lease->addr_)) {
+                    ++held;
+                }
+                for (size_t i = 0; i < heads.size(); ++i) {
+                    if (heads[i] && (heads[i]->addr_ == lease->addr_)) {
+                        nextRunLease(*run_files[i], heads[i]);
+                    }
+                }
+
+                if (lease->valid_lft_ > 0) {
+                    lease_file.append(*lease);
+                }
+            }
+
+        } catch (const isc::Exception&) {
+            // Close the file
+            lease_file.close();
+            throw;
+        }
+
+        // Close the file
+        lease_file.close();
+    }
+
+    /// @brief Removes the run files.
+    ///
+    /// @param runs Names of the run files.
+    static void removeRuns(const std::vector<std::string>& runs) {
+        for (size_t i = 0; i < runs.size(); ++i) {
+            static_cast<void>(remove(runs[i].c_str()));
+        }
+    }
+
+private:
+
+    /// @brief Type of the function storing a lease read from the file.
+    ///
+    /// @tparam LeasePtrType Pointer to a @c Lease4 or @c Lease6.
+    template<typename LeasePtrType>
+    struct StoreFunction {
+        typedef boost::function<void(const LeasePtrType&)> type;
+    };
+
+    /// @brief Threads creating the leases from the rows of a lease file.
+    ///
+    /// The threads are started as the batches of rows need them, up to
+    /// the maximum, and live until the whole file has been loaded. Each
+    /// batch is split in shares which the threads, including the calling
+    /// one, take in turn until none is left.
+    class Workers : public boost::noncopyable {
+    public:
+
+        /// @brief Function converting a range of rows of the batch.
+        typedef boost::function<void(const size_t, const size_t)> Work;
+
+        /// @brief Constructor.
+        ///
+        /// No thread is started until a batch needs it.
+        ///
+        /// @param work Function converting a range of rows.
+        /// @param share Number of rows converted by a thread at a time.
+        /// @param threads Maximum number of threads, including the
+        /// calling thread.
+        Workers(const Work& work, const size_t share,
+                const unsigned int threads)
+            : work_(work), share_(share), max_threads_(threads),
+              threads_(), mutex_(), work_cond_(), done_cond_(), next_(0),
+              count_(0), pending_(0), stopping_(false) {
+        }
+
+        /// @brief Destructor.
+        ///
+        /// Stops the threads and waits for them to terminate.
+        ~Workers() {
+            {
+                util::thread::Mutex::Locker lock(mutex_);
+                stopping_ = true;
+            }
+            // The condition variable wakes a single thread at a time.
+            for (size_t i = 0; i < threads_.size(); ++i) {
+                util::thread::Mutex::Locker lock(mutex_);
+                work_cond_.signal();
+            }
+            for (size_t i = 0; i < threads_.size(); ++i) {
+                try {
+                    threads_[i]->wait();
+                } catch (...) {
+                    // The work doesn't throw.
+                }
+            }
+        }
+
+        /// @brief Converts the rows of a batch.
+        ///
+        /// Returns when all rows have been converted. If a thread can't
+        /// be started, the shares are taken by the running threads.
+        ///
+        /// @param count Number of rows in the batch.
+        void run(const size_t count) {
+            const size_t shares = (count + share_ - 1) / share_;
+            while ((threads_.size() + 1 < shares) &&
+                   (threads_.size() + 1 < max_threads_)) {
+                try {
+                    threads_.push_back(ThreadPtr(new util::thread::Thread(
+                        boost::bind(&Workers::worker, this))));
+                } catch (const std::exception&) {
+                    break;
+                }
+            }
+
+            {
+                util::thread::Mutex::Locker lock(mutex_);
+                next_ = 0;
+                count_ = count;
+                pending_ = shares;
+                for (size_t i = 1; i < shares; ++i) {
+                    work_cond_.signal();
+                }
+            }
+
+            size_t begin = 0;
+            size_t end = 0;
+            while (take(begin, end)) {
+                work_(begin, end);
+                done();
+            }
+
+            util::thread::Mutex::Locker lock(mutex_);
+            while (pending_ > 0) {
+                done_cond_.wait(mutex_);
+            }
+        }
+
+    private:
+
+        /// @brief Pointer to a thread.
+        typedef boost::shared_ptr<util::thread::Thread> ThreadPtr;
+
+        /// @brief Body of the threads.
+        ///
+        /// Converts the shares of the batches until the threads are
+        /// stopped.
+        void worker() {
+            while (true) {
+                size_t begin = 0;
+                size_t end = 0;
+                {
+                    util::thread::Mutex::Locker lock(mutex_);
+                    while (!stopping_ && (next_ >= count_)) {
+                        work_cond_.wait(mutex_);
+                    }
+                    if (stopping_) {
+                        return;
+                    }
+                    begin = next_;
+                    end = std::min(next_ + share_, count_);
+                    next_ = end;
+                }
+                work_(begin, end);
+                done();
+            }
+        }
+
+        /// @brief Takes the next share of the batch.
+        ///
+        /// @param [out] begin Index of the first row of the share.
+        /// @param [out] end Index past the last row of the share.
+        ///
+        /// @return false if no share is left.
+        bool take(size_t& begin, size_t& end) {
+            util::thread::Mutex::Locker lock(mutex_);
+            if (next_ >= count_) {
+                return (false);
+            }
+            begin = next_;
+            end = std::min(next_ + share_, count_);
+            next_ = end;
+            return (true);
+        }
+
+        /// @brief Records that a share has been converted.
+        void done() {
+            util::thread::Mutex::Locker lock(mutex_);
+            if (--pending_ == 0) {
+                done_cond_.signal();
+            }
+        }
+
+        /// @brief Function converting a range of rows.
+        Work work_;
+
+        /// @brief Number of rows converted by a thread at a time.
+        const size_t share_;
+
+        /// @brief Maximum number of threads, including the calling one.
+        const unsigned int max_threads_;
+
+        /// @brief Threads started so far.
+        std::vector<ThreadPtr> threads_;
+
+        /// @brief Mutex protecting the members below.
+        util::thread::Mutex mutex_;
+
+        /// @brief Signalled when a batch has shares to convert or when
+        /// the threads are stopped.
+        util::thread::CondVar work_cond_;
+
+        /// @brief Signalled when the last share of a batch is converted.
+        util::thread::CondVar done_cond_;
+
+        /// @brief Index of the first row of the next share.
+        size_t next_;
+
+        /// @brief Number of rows in the batch.
+        size_t count_;
+
+        /// @brief Number of shares of the batch not converted yet.
+        size_t pending_;
+
+        /// @brief Indicates that the threads are being stopped.
+        bool stopping_;
+    };
+
+    /// @brief Loads leases from the lease file.
+    ///
+    /// This is the common part of @c load and @c loadRuns, which only
+    /// differ in how the leases read are stored.
+    ///
+    /// @param lease_file A reference to the lease file.
+    /// @param store Function storing a lease read from the file.
+    /// @param max_errors Maximum number of corrupted leases.
+    /// @param close_file_on_exit A boolean flag which indicates if
+    /// the file should be closed after it has been successfully parsed.
+    /// @param threads Maximum number of threads creating the leases.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    static void loadFile(LeaseFileType& lease_file,
+                         const typename StoreFunction<
+                             boost::shared_ptr<LeaseObjectType> >::type& store,
+                         const uint32_t max_errors,
+                         const bool close_file_on_exit,
+                         const unsigned int threads) {
+
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_FILE_LOAD)
+            .arg(lease_file.getFilename());
+
+        // Reopen the file, as we don't know whether the file is open
+        // and we also don't know its current state.
+        lease_file.close();
+        lease_file.open();
+
+        if (threads > 1) {
+            loadBatches<LeaseObjectType>(lease_file, store, max_errors,
+                                         threads);
+
+        } else {
+            boost::shared_ptr<LeaseObjectType> lease;
+            // Track the number of corrupted leases.
+            uint32_t errcnt = 0;
+            while (true) {
+                // Unable to parse the lease.
+                if (!lease_file.next(lease)) {
+                    handleError(lease_file, lease_file.getReads(),
+                                lease_file.getReadMsg(), errcnt, max_errors);
+                    // Skip the corrupted lease.
+                    continue;
+                }
+
+                // Lease was found and we successfully parsed it.
+                if (lease) {
+                    store(lease);
+
+                } else {
+                    // Being here means that we hit the end of file.
+                    break;
+
+                }
+            }
+        }
+
+        if (lease_file.needsConversion()) {
+            LOG_WARN(dhcpsrv_logger,
+                     (lease_file.getInputSchemaState()
+                      == util::VersionedCSVFile::NEEDS_UPGRADE
+                      ?  DHCPSRV_MEMFILE_NEEDS_UPGRADING
+                      : DHCPSRV_MEMFILE_NEEDS_DOWNGRADING))
+                     .arg(lease_file.getFilename())
+                     .arg(lease_file.getSchemaVersion());
+        }
+
+        if (close_file_on_exit) {
+            lease_file.close();
+        }
+    }
+
+    /// @brief Number of rows converted to leases by one thread at a time
+    /// when loading the lease file by several threads.
+    static size_t ROWS_PER_THREAD() {
+        return (4096);
+    }
+
+    /// @brief Loads leases from the open lease file using several threads.
+    ///
+    /// The rows are read in batches of at most @c ROWS_PER_THREAD rows per
+    /// thread. The threads are started once for the whole file, and only
+    /// when a batch has a share of rows for them, so a small file is
+    /// loaded by fewer threads. The calling thread creates leases too.
+    /// Once all leases of the batch have been created, they are stored
+    /// in the file order.
+    ///
+    /// @param lease_file A reference to the open lease file.
+    /// @param store Function storing a lease read from the file.
+    /// @param max_errors Maximum number of corrupted leases.
+    /// @param threads Maximum number of threads creating the leases.
+    /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded.
+    template<typename LeaseObjectType, typename LeaseFileType>
+    static void loadBatches(LeaseFileType& lease_file,
+                            const typename StoreFunction<
+                            boost::shared_ptr<LeaseObjectType> >::type& store,
+                            const uint32_t max_errors,
+                            const unsigned int threads) {
+        typedef boost::shared_ptr<LeaseObjectType> LeasePtr;
+
+        const size_t share = ROWS_PER_THREAD();
+        const size_t batch_size = share * threads;
+
+        // The rows, leases and error messages are indexed by the position
+        // of the row in the batch. The same objects are used for all
+        // batches. They grow with the rows read, so that a small file
+        // doesn't allocate the whole batch.
+        std::vector<util::CSVRow> rows;
+        std::vector<LeasePtr> leases;
+        std::vector<std::string> errors;
+
+        // The threads only touch the rows of a batch between the start
+        // and the end of Workers::run, so the vectors may be resized
+        // while reading the next batch.
+        Workers workers(boost::bind(&LeaseFileLoader::parseRows<
+                                    LeasePtr, LeaseFileType>,
+                                    boost::cref(lease_file),
+                                    boost::cref(rows), boost::ref(leases),
+                                    boost::ref(errors), _1, _2),
+                        share, threads);
+
+        // Track the number of corrupted leases.
+        uint32_t errcnt = 0;
+        bool eof = false;
+        while (!eof) {
+            // Read the next batch of rows.
+            const uint32_t first_row = lease_file.getReads();
+            size_t count = 0;
+            bool read_error = false;
+            while (count < batch_size) {
+                if (count == rows.size()) {
+                    rows.resize(count + 1);
+                }
+                if (!lease_file.nextRow(rows[count])) {
+                    read_error = true;
+                    break;
+                }
+                if (rows[count].empty()) {
+                    eof = true;
+                    break;
+                }
+                ++count;
+            }
+
+            // The row which couldn't be read is handled after the rows
+            // preceding it.
+            const uint32_t error_row = lease_file.getReads();
+            const std::string error_msg =
+                read_error ? lease_file.getReadMsg() : "";
+
+            if (leases.size() < count) {
+                leases.resize(count);
+                errors.resize(count);
+            }
+
+            // Create the leases.
+            workers.run(count);
+
+            // Insert the leases in the file order.
+            for (size_t i = 0; i < count; ++i) {
+                if (leases[i]) {
+                    lease_file.rowParsed(true);
+                    store(leases[i]);
+                    leases[i].reset();
+
+                } else {
+                    lease_file.rowParsed(false, errors[i]);
+                    handleError(lease_file, first_row + i + 1, errors[i],
+                                errcnt, max_errors);
+                }
+            }
+
+            if (read_error) {
+                lease_file.setReadMsg(error_msg);
+                handleError(lease_file, error_row, error_msg, errcnt,
+                            max_errors);
+            }
+        }
+    }
+
+    /// @brief Creates the leases from a range of rows.
+    ///
+    /// This is run by the threads loading the lease file. The error
+    /// messages are recorded for the rows from which the lease couldn't
+    /// be created.
+    ///
+    /// @param lease_file A reference to the lease file the rows were
+    /// read from.
+    /// @param rows Rows read from the lease file.
+    /// @param [out] leases Leases created from the rows. The pointer is
+    /// NULL for the rows from which the lease couldn't be created.
+    /// @param [out] errors Error messages for the rows from which the
+    /// lease couldn't be created.
+    /// @param begin Index of the first row to convert.
+    /// @param end Index past the last row to convert.
+    /// @tparam LeasePtrType Pointer to a @c Lease4 or @c Lease6.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    template<typename LeasePtrType, typename LeaseFileType>
+    static void parseRows(const LeaseFileType& lease_file,
+                          const std::vector<util::CSVRow>& rows,
+                          std::vector<LeasePtrType>& leases,
+                          std::vector<std::string>& errors,
+                          const size_t begin, const size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            try {
+                leases[i] = lease_file.parseRow(rows[i]);
+
+            } catch (const std::exception& ex) {
+                leases[i].reset();
+                errors[i] = ex.what();
+            }
+        }
+    }
+
+    /// @brief Inserts, updates or removes the lease read from the file.
+    ///
+    /// @param storage A reference to the container holding leases.
+    /// @param lease Lease read from the lease file.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    /// @tparam LeasePtrType Pointer to a @c Lease4 or @c Lease6.
+    template<typename StorageType, typename LeasePtrType>
+    static void storeLease(StorageType& storage, const LeasePtrType& lease) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL_DATA,
+                  DHCPSRV_MEMFILE_LEASE_LOAD)
+            .arg(lease->toText());
+
+        // Check if this lease exists.
+        typename StorageType::iterator lease_it =
+            storage.find(lease->addr_);
+        // The lease doesn't exist yet. Insert the lease if
+        // it has a positive valid lifetime.
+        if (lease_it == storage.end()) {
+            if (lease->valid_lft_ > 0) {
+                storage.insert(lease);
+            }
+        } else {
+            // The lease exists. If the new entry has a valid
+            // lifetime of 0 it is an indication to remove the
+            // existing entry. Otherwise, we update the lease.
+            if (lease->valid_lft_ == 0) {
+                storage.erase(lease_it);
+
+            } else {
+                // Use replace to re-index leases on update.
+                storage.replace(lease_it, lease);
+            }
+        }
+    }
+
+    /// @brief Stores the most recent entry of the lease, writing the
+    /// leases to a new run when the storage is full.
+    ///
+    /// @param storage A reference to the container holding leases.
+    /// @param [in,out] runs Names of the run files.
+    /// @param run_prefix Prefix of the names of the run files.
+    /// @param max_leases Maximum number of leases held in the storage.
+    /// @param lease Lease read from the lease file.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    /// @tparam LeasePtrType Pointer to a @c Lease4 or @c Lease6.
+    template<typename LeaseFileType, typename StorageType,
+             typename LeasePtrType>
+    static void storeLatest(StorageType& storage,
+                            std::vector<std::string>& runs,
+                            const std::string& run_prefix,
+                            const size_t max_leases,
+                            const LeasePtrType& lease) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL_DATA,
+                  DHCPSRV_MEMFILE_LEASE_LOAD)
+            .arg(lease->toText());
+
+        // The entries with the valid lifetime of 0 are kept too, as they
+        // remove the lease from the previous runs.
+        typename StorageType::iterator lease_it = storage.find(lease->addr_);
+        if (lease_it == storage.end()) {
+            storage.insert(lease);
+
+        } else {
+            storage.replace(lease_it, lease);
+        }
+
+        if ((max_leases > 0) && (storage.size() >= max_leases)) {
+            std::ostringstream run;
+            run << run_prefix << ".run" << (runs.size() + 1);
+            runs.push_back(run.str());
+
+            // Remove what may be left by a previous cleanup, as the
+            // leases would be appended to it.
+            static_cast<void>(remove(runs.back().c_str()));
+            LeaseFileType run_file(runs.back());
+            run_file.open();
+            for (typename StorageType::const_iterator held = storage.begin();
+                 held != storage.end(); ++held) {
+                run_file.append(**held);
+            }
+            run_file.close();
+            storage.clear();
+        }
+    }
+
+    /// @brief Reads the next lease from a run file.
+    ///
+    /// @param run_file A reference to the open run file.
+    /// @param [out] lease Lease read or NULL at the end of the file.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    /// @tparam LeasePtrType Pointer to a @c Lease4 or @c Lease6.
+    ///
+    /// @throw isc::util::CSVFileError if the lease can't be read.
+    template<typename LeaseFileType, typename LeasePtrType>
+    static void nextRunLease(LeaseFileType& run_file, LeasePtrType& lease) {
+        if (!run_file.next(lease)) {
+            isc_throw(util::CSVFileError, "failed to read a lease from the"
+                      " run file " << run_file.getFilename() << ": "
+                      << run_file.getReadMsg());
+        }
+    }
+
+    /// @brief Handles a row which couldn't be read or converted to a lease.
+    ///
+    /// @param lease_file A reference to the lease file.
+    /// @param row Number of the row in the lease file.
+    /// @param error_msg Error message.
+    /// @param [in,out] errcnt Number of errors so far.
+    /// @param max_errors Maximum number of corrupted leases.
+    /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
+    ///
+    /// @throw isc::util::CSVFileError when the maximum number of errors
+    /// has been exceeded.
+    template<typename LeaseFileType>
+    static void handleError(LeaseFileType& lease_file, const uint32_t row,
+                            const std::string& error_msg, uint32_t& errcnt,
+                            const uint32_t max_errors) {
+        LOG_ERROR(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASE_LOAD_ROW_ERROR)
+            .arg(row)
+            .arg(error_msg);
+
+        // A value of 0xFFFFFFFF indicates that we don't return
+        // until the whole file is parsed, even if errors occur.
+        // Otherwise, check if we have exceeded the maximum number
+        // of errors and throw an exception if we have.
+        if (++errcnt > max_errors) {
+            // If we break parsing the CSV file because of too many
+            // errors, it doesn't make sense to keep the file open.
+            // This is because the caller wouldn't know where we
+            // stopped parsing and where the internal file pointer
+            // is. So, there are probably no cases when the caller
+            // would continue to use the open file.
+            lease_file.close();
+            isc_throw(util::CSVFileError, "exceeded maximum number of"
+                      " failures " << max_errors << " to read a lease"
+                      " from the lease file "
+                      << lease_file.getFilename());
+        }
+    }
 };
 
 }  // namespace dhcp
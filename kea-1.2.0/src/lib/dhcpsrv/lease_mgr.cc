@@ -218,6 +218,20 @@ LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
 }
 
+Lease4Collection
+LeaseMgr::getSubnetLeases4(SubnetID, const asiolink::IOAddress&,
+                           const size_t) const {
+    isc_throw(NotImplemented, "getSubnetLeases4 is not supported by the "
+              << getType() << " lease database backend");
+}
+
+Lease6Collection
+LeaseMgr::getSubnetLeases6(SubnetID, const asiolink::IOAddress&,
+                           const size_t) const {
+    isc_throw(NotImplemented, "getSubnetLeases6 is not supported by the "
+              << getType() << " lease database backend");
+}
+
 std::string
 LeaseMgr::getDBVersion() {
     isc_throw(NotImplemented, "LeaseMgr::getDBVersion() called");
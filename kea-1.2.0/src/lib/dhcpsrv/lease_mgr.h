@@ -439,6 +439,51 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& expired_leases,
                                    const size_t max_leases) const = 0;
 
+    /// @brief Returns a page of DHCPv4 leases belonging to a subnet.
+    ///
+    /// The leases are returned in the ascending order of their addresses,
+    /// starting after the specified address. This allows for walking all
+    /// leases of a large subnet in pages, e.g. when a relay recovers its
+    /// lease table, without copying all of them at once. The next page is
+    /// obtained by passing the address of the last lease of the previous
+    /// page.
+    ///
+    /// The default implementation throws @c isc::NotImplemented, so as
+    /// backends which don't support this query report it explicitly.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param lower_bound_address Only the leases with the addresses greater
+    /// than this address are returned. The 0.0.0.0 address starts with the
+    /// first lease of the subnet.
+    /// @param page_size Maximum number of leases to be returned. If this
+    /// value is set to 0, all remaining leases of the subnet are returned.
+    ///
+    /// @return Collection of the DHCPv4 leases.
+    virtual Lease4Collection
+    getSubnetLeases4(SubnetID subnet_id,
+                     const isc::asiolink::IOAddress& lower_bound_address,
+                     const size_t page_size) const;
+
+    /// @brief Returns a page of DHCPv6 leases belonging to a subnet.
+    ///
+    /// This is the DHCPv6 counterpart of @c getSubnetLeases4. The leases
+    /// of all types are returned in the ascending order of their addresses
+    /// or prefixes. The SQL backends store these addresses as text and
+    /// order them by that text.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param lower_bound_address Only the leases with the addresses greater
+    /// than this address are returned. The :: address starts with the first
+    /// lease of the subnet.
+    /// @param page_size Maximum number of leases to be returned. If this
+    /// value is set to 0, all remaining leases of the subnet are returned.
+    ///
+    /// @return Collection of the DHCPv6 leases.
+    virtual Lease6Collection
+    getSubnetLeases6(SubnetID subnet_id,
+                     const isc::asiolink::IOAddress& lower_bound_address,
+                     const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// @param lease4 The lease to be updated.
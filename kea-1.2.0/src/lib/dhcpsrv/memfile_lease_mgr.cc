@@ -85,10 +85,13 @@ public:
     /// @param run_once_now A flag that causes LFC to be invoked immediately,
     /// regardless of the value of lfc_interval.  This is primarily used to
     /// cause lease file schema upgrades upon startup.
+    /// @param max_leases Maximum number of leases held in memory by the
+    /// cleanup, 0 if not limited.
     void setup(const uint32_t lfc_interval,
                const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-               bool run_once_now = false);
+               bool run_once_now = false,
+               const uint32_t max_leases = 0);
 
     /// @brief Spawns a new process.
     void execute();
@@ -158,7 +161,8 @@ void
 LFCSetup::setup(const uint32_t lfc_interval,
                 const boost::shared_ptr<CSVLeaseFile4>& lease_file4,
                 const boost::shared_ptr<CSVLeaseFile6>& lease_file6,
-                bool run_once_now) {
+                bool run_once_now,
+                const uint32_t max_leases) {
 
     // If to nothing to do, punt
     if (lfc_interval == 0 && !run_once_now) {
@@ -208,6 +212,12 @@ LFCSetup::setup(const uint32_t lfc_interval,
     args.push_back("-c");
     args.push_back("ignored-path");
 
+    // Maximum number of leases held in memory.
+    if (max_leases > 0) {
+        args.push_back("-m");
+        args.push_back(boost::lexical_cast<std::string>(max_leases));
+    }
+
     // Create the process (do not start it yet).
     process_.reset(new util::ProcessSpawn(executable, args));
 
@@ -862,6 +872,34 @@ Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
     }
 }
 
+Lease4Collection
+Memfile_LeaseMgr::getSubnetLeases4(SubnetID subnet_id,
+                                   const asiolink::IOAddress& lower_bound_address,
+                                   const size_t page_size) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_SUBID_PAGE4)
+        .arg(page_size)
+        .arg(subnet_id)
+        .arg(lower_bound_address.toText());
+
+    // Obtain the index which sorts leases by subnet and address.
+    const Lease4StorageSubnetIdAddressIndex& index =
+        storage4_.get<SubnetIdAddressIndexTag>();
+
+    // Skip the leases of this subnet up to and including the lower bound
+    // address, and copy the following ones until the end of the subnet.
+    Lease4Collection collection;
+    for (Lease4StorageSubnetIdAddressIndex::const_iterator lease =
+             index.upper_bound(boost::make_tuple(subnet_id, lower_bound_address));
+         (lease != index.end()) && ((*lease)->subnet_id_ == subnet_id) &&
+         ((page_size == 0) || (collection.size() < page_size));
+         ++lease) {
+        collection.push_back(Lease4Ptr(new Lease4(**lease)));
+    }
+
+    return (collection);
+}
+
 void
 Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -888,6 +926,34 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
 }
 
+Lease6Collection
+Memfile_LeaseMgr::getSubnetLeases6(SubnetID subnet_id,
+                                   const asiolink::IOAddress& lower_bound_address,
+                                   const size_t page_size) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_GET_SUBID_PAGE6)
+        .arg(page_size)
+        .arg(subnet_id)
+        .arg(lower_bound_address.toText());
+
+    // Obtain the index which sorts leases by subnet and address.
+    const Lease6StorageSubnetIdAddressIndex& index =
+        storage6_.get<SubnetIdAddressIndexTag>();
+
+    // Skip the leases of this subnet up to and including the lower bound
+    // address, and copy the following ones until the end of the subnet.
+    Lease6Collection collection;
+    for (Lease6StorageSubnetIdAddressIndex::const_iterator lease =
+             index.upper_bound(boost::make_tuple(subnet_id, lower_bound_address));
+         (lease != index.end()) && ((*lease)->subnet_id_ == subnet_id) &&
+         ((page_size == 0) || (collection.size() < page_size));
+         ++lease) {
+        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+    }
+
+    return (collection);
+}
+
 void
 Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1165,12 +1231,15 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
 
     storage.clear();
 
+    const unsigned int threads = getLoadThreads();
+
     // Load the leasefile.completed, if exists.
     bool conversion_needed = false;
     lease_file.reset(new LeaseFileType(std::string(filename + ".completed")));
     if (lease_file->exists()) {
         LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                               MAX_LEASE_ERRORS);
+                                               MAX_LEASE_ERRORS, true,
+                                               threads);
         conversion_needed = conversion_needed || lease_file->needsConversion();
     } else {
         // If the leasefile.completed doesn't exist, let's load the leases
@@ -1178,14 +1247,16 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
         lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_PREVIOUS)));
         if (lease_file->exists()) {
             LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                                   MAX_LEASE_ERRORS);
+                                                   MAX_LEASE_ERRORS, true,
+                                                   threads);
             conversion_needed =  conversion_needed || lease_file->needsConversion();
         }
 
         lease_file.reset(new LeaseFileType(appendSuffix(filename, FILE_INPUT)));
         if (lease_file->exists()) {
             LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                                   MAX_LEASE_ERRORS);
+                                                   MAX_LEASE_ERRORS, true,
+                                                   threads);
             conversion_needed =  conversion_needed || lease_file->needsConversion();
         }
     }
@@ -1198,12 +1269,34 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
     // future lease updates.
     lease_file.reset(new LeaseFileType(filename));
     LeaseFileLoader::load<LeaseObjectType>(*lease_file, storage,
-                                           MAX_LEASE_ERRORS, false);
+                                           MAX_LEASE_ERRORS, false, threads);
     conversion_needed =  conversion_needed || lease_file->needsConversion();
 
     return (conversion_needed);
 }
 
+unsigned int
+Memfile_LeaseMgr::getLoadThreads() const {
+    std::string threads_str;
+    try {
+        threads_str = conn_.getParameter("load-threads");
+    } catch (const std::exception&) {
+        // Load the files by the calling thread by default.
+        return (1);
+    }
+
+    unsigned int threads = 0;
+    try {
+        threads = boost::lexical_cast<unsigned int>(threads_str);
+    } catch (const boost::bad_lexical_cast&) {
+        // Reported below.
+    }
+    if (threads == 0) {
+        isc_throw(isc::BadValue, "invalid value of the load-threads "
+                  << threads_str << " specified");
+    }
+    return (threads);
+}
 
 bool
 Memfile_LeaseMgr::isLFCRunning() const {
@@ -1245,9 +1338,25 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
                   << lfc_interval_str << " specified");
     }
 
+    std::string lfc_max_leases_str = "0";
+    try {
+        lfc_max_leases_str = conn_.getParameter("lfc-max-leases");
+    } catch (const std::exception&) {
+        // Ignore and default to 0.
+    }
+
+    uint32_t lfc_max_leases = 0;
+    try {
+        lfc_max_leases = boost::lexical_cast<uint32_t>(lfc_max_leases_str);
+    } catch (boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-max-leases "
+                  << lfc_max_leases_str << " specified");
+    }
+
     if (lfc_interval > 0 || conversion_needed) {
         lfc_setup_.reset(new LFCSetup(boost::bind(&Memfile_LeaseMgr::lfcCallback, this)));
-        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed);
+        lfc_setup_->setup(lfc_interval, lease_file4_, lease_file6_, conversion_needed,
+                          lfc_max_leases);
     }
 }
 
@@ -73,6 +73,20 @@ class LFCSetup;
 /// is not specified, the default location in the installation
 /// directory is used: var/kea/kea-leases4.csv and
 /// var/kea/kea-leases6.csv.
+///
+/// Large lease files are loaded by several threads, which create the
+/// leases from the rows of the files. The leases are still inserted into
+/// the container in the file order. The number of threads can be
+/// specified with the "load-threads=[n]" parameter in the database
+/// access string. By default, the files are loaded by the calling thread
+/// only. The threads are only started for the batches of rows actually
+/// read, so a small file doesn't use them all.
+///
+/// The memory used by the %Lease File Cleanup can be bounded with the
+/// "lfc-max-leases=[n]" parameter, which sets the maximum number of
+/// leases held in memory by the @c kea-lfc. The leases exceeding it are
+/// written to the temporary files next to the lease file. By default, or
+/// when it is 0, all leases are held in memory.
 class Memfile_LeaseMgr : public LeaseMgr {
 public:
 
@@ -286,6 +300,38 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& expired_leases,
                                    const size_t max_leases) const;
 
+    /// @brief Returns a page of DHCPv4 leases belonging to a subnet.
+    ///
+    /// The leases are located using the index by subnet identifier and
+    /// address, so the cost of obtaining a page doesn't depend on the
+    /// number of leases in other subnets and pages already returned.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param lower_bound_address Only the leases with the addresses greater
+    /// than this address are returned.
+    /// @param page_size Maximum number of leases to be returned, 0 means
+    /// no limit.
+    ///
+    /// @return Collection of the DHCPv4 leases.
+    virtual Lease4Collection
+    getSubnetLeases4(SubnetID subnet_id,
+                     const isc::asiolink::IOAddress& lower_bound_address,
+                     const size_t page_size) const;
+
+    /// @brief Returns a page of DHCPv6 leases belonging to a subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param lower_bound_address Only the leases with the addresses greater
+    /// than this address are returned.
+    /// @param page_size Maximum number of leases to be returned, 0 means
+    /// no limit.
+    ///
+    /// @return Collection of the DHCPv6 leases.
+    virtual Lease6Collection
+    getSubnetLeases6(SubnetID subnet_id,
+                     const isc::asiolink::IOAddress& lower_bound_address,
+                     const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// @warning This function does not validate the pointer to the lease.
@@ -565,6 +611,14 @@ private:
                              boost::shared_ptr<LeaseFileType>& lease_file,
                              StorageType& storage);
 
+    /// @brief Returns the number of threads loading the lease files.
+    ///
+    /// It is the value of the @c load-threads parameter or 1 if the
+    /// parameter hasn't been specified.
+    ///
+    /// @throw isc::BadValue if the value of the parameter is invalid.
+    unsigned int getLoadThreads() const;
+
     /// @brief stores IPv4 leases
     Lease4Storage storage4_;
 
@@ -655,6 +709,9 @@ private:
     /// schema do not match the current schema (older or newer), and need
     /// conversion. This value is passed through to LFCSetup::setup() via its
     /// run_once_now parameter.
+    ///
+    /// The @c lfc-max-leases configuration parameter is passed to the
+    /// @c kea-lfc application.
     void lfcSetup(bool conversion_needed = false);
 
     /// @brief Performs a lease file cleanup for DHCPv4 or DHCPv6.
@@ -42,6 +42,9 @@ struct ClientIdSubnetIdIndexTag { };
 /// @brief Tag for indexes by client id, HW address and subnet id.
 struct ClientIdHWAddressSubnetIdIndexTag { };
 
+/// @brief Tag for indexes by subnet id and address.
+struct SubnetIdAddressIndexTag { };
+
 /// @name Multi index containers holding DHCPv4 and DHCPv6 leases.
 ///
 //@{
@@ -52,9 +55,10 @@ struct ClientIdHWAddressSubnetIdIndexTag { };
 /// - using an IPv6 address,
 /// - using a composite index: DUID, IAID and lease type.
 /// - using a composite index: boolean flag indicating if the state is
-///   "expired-reclaimed" and expiration time.
+///   "expired-reclaimed" and expiration time,
+/// - using a composite index: subnet id and IPv6 address.
 ///
-/// Indexes can be accessed using the index number (from 0 to 2) or a
+/// Indexes can be accessed using the index number (from 0 to 3) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
 typedef boost::multi_index_container<
@@ -103,6 +107,22 @@ typedef boost::multi_index_container<
                 boost::multi_index::const_mem_fun<Lease, int64_t,
                                                   &Lease::getExpirationTime>
             >
+        >,
+
+        // Specification of the fourth index starts here.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<SubnetIdAddressIndexTag>,
+            // This is a composite index that sorts the leases of each
+            // subnet by address, so as all leases of the subnet may be
+            // walked in pages starting after the last returned address.
+            boost::multi_index::composite_key<
+                Lease6,
+                // The subnet id is accessed through the subnet_id_ member.
+                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>,
+                // The IPv6 address is held in the addr_ member.
+                boost::multi_index::member<Lease, isc::asiolink::IOAddress,
+                                           &Lease::addr_>
+            >
         >
      >
 > Lease6Storage; // Specify the type name of this container.
@@ -115,9 +135,10 @@ typedef boost::multi_index_container<
 /// - composite index: client id and subnet id,
 /// - composite index: HW address, client id and subnet id
 /// - using a composite index: boolean flag indicating if the state is
-///   "expired-reclaimed" and expiration time.
+///   "expired-reclaimed" and expiration time,
+/// - composite index: subnet id and IPv4 address.
 ///
-/// Indexes can be accessed using the index number (from 0 to 4) or a
+/// Indexes can be accessed using the index number (from 0 to 5) or a
 /// name tag. It is recommended to use the tags to access indexes as
 /// they do not depend on the order of indexes in the container.
 typedef boost::multi_index_container<
@@ -210,6 +231,22 @@ typedef boost::multi_index_container<
                 boost::multi_index::const_mem_fun<Lease, int64_t,
                                                   &Lease::getExpirationTime>
             >
+        >,
+
+        // Specification of the sixth index starts here.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<SubnetIdAddressIndexTag>,
+            // This is a composite index that sorts the leases of each
+            // subnet by address, so as all leases of the subnet may be
+            // walked in pages starting after the last returned address.
+            boost::multi_index::composite_key<
+                Lease4,
+                // The subnet id is accessed through the subnet_id_ member.
+                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>,
+                // The IPv4 address is held in the addr_ member.
+                boost::multi_index::member<Lease, isc::asiolink::IOAddress,
+                                           &Lease::addr_>
+            >
         >
     >
 > Lease4Storage; // Specify the type name for this container.
@@ -229,6 +266,10 @@ typedef Lease6Storage::index<DuidIaidTypeIndexTag>::type Lease6StorageDuidIaidTy
 /// @brief DHCPv6 lease storage index by expiration time.
 typedef Lease6Storage::index<ExpirationIndexTag>::type Lease6StorageExpirationIndex;
 
+/// @brief DHCPv6 lease storage index by subnet identifier and address.
+typedef Lease6Storage::index<SubnetIdAddressIndexTag>::type
+Lease6StorageSubnetIdAddressIndex;
+
 /// @brief DHCPv4 lease storage index by address.
 typedef Lease4Storage::index<AddressIndexTag>::type Lease4StorageAddressIndex;
 
@@ -247,6 +288,10 @@ Lease4StorageClientIdSubnetIdIndex;
 typedef Lease4Storage::index<ClientIdHWAddressSubnetIdIndexTag>::type
 Lease4StorageClientIdHWAddressSubnetIdIndex;
 
+/// @brief DHCPv4 lease storage index by subnet identifier and address.
+typedef Lease4Storage::index<SubnetIdAddressIndexTag>::type
+Lease4StorageSubnetIdAddressIndex;
+
 //@}
 } // end of isc::dhcp namespace
 } // end of isc namespace
@@ -140,6 +140,15 @@ tagged_statements = { {
                             "WHERE state != ? AND expire < ? "
                             "ORDER BY expire ASC "
                             "LIMIT ?"},
+    {MySqlLeaseMgr::GET_LEASE4_PAGE,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state "
+                            "FROM lease4 "
+                            "WHERE subnet_id = ? AND address > ? "
+                            "ORDER BY address ASC "
+                            "LIMIT ?"},
     {MySqlLeaseMgr::GET_LEASE6_ADDR,
                     "SELECT address, duid, valid_lifetime, "
                         "expire, subnet_id, pref_lifetime, "
@@ -179,6 +188,17 @@ tagged_statements = { {
                             "WHERE state != ? AND expire < ? "
                             "ORDER BY expire ASC "
                             "LIMIT ?"},
+    {MySqlLeaseMgr::GET_LEASE6_PAGE,
+                    "SELECT address, duid, valid_lifetime, "
+                        "expire, subnet_id, pref_lifetime, "
+                        "lease_type, iaid, prefix_len, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "hwaddr, hwtype, hwaddr_source, "
+                        "state "
+                            "FROM lease6 "
+                            "WHERE subnet_id = ? AND address > ? "
+                            "ORDER BY address ASC "
+                            "LIMIT ?"},
     {MySqlLeaseMgr::GET_VERSION,
                     "SELECT version, minor FROM schema_version"},
     {MySqlLeaseMgr::INSERT_LEASE4,
@@ -1912,6 +1932,94 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     getLeaseCollection(statement_index, inbind, expired_leases);
 }
 
+Lease4Collection
+MySqlLeaseMgr::getSubnetLeases4(SubnetID subnet_id,
+                                const asiolink::IOAddress& lower_bound_address,
+                                const size_t page_size) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_GET_SUBID_PAGE4)
+        .arg(page_size)
+        .arg(subnet_id)
+        .arg(lower_bound_address.toText());
+
+    // Set up the WHERE clause value
+    MYSQL_BIND inbind[3];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Subnet ID
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&subnet_id);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    // Lower bound address
+    uint32_t lb_address = lower_bound_address.toUint32();
+    inbind[1].buffer_type = MYSQL_TYPE_LONG;
+    inbind[1].buffer = reinterpret_cast<char*>(&lb_address);
+    inbind[1].is_unsigned = MLM_TRUE;
+
+    // If the page size is 0, we will return all leases. This is
+    // achieved by setting the limit to a very high value.
+    uint32_t limit = page_size > 0 ? static_cast<uint32_t>(page_size) :
+        std::numeric_limits<uint32_t>::max();
+    inbind[2].buffer_type = MYSQL_TYPE_LONG;
+    inbind[2].buffer = reinterpret_cast<char*>(&limit);
+    inbind[2].is_unsigned = MLM_TRUE;
+
+    // Get the data
+    Lease4Collection result;
+    getLeaseCollection(GET_LEASE4_PAGE, inbind, result);
+
+    return (result);
+}
+
+Lease6Collection
+MySqlLeaseMgr::getSubnetLeases6(SubnetID subnet_id,
+                                const asiolink::IOAddress& lower_bound_address,
+                                const size_t page_size) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_GET_SUBID_PAGE6)
+        .arg(page_size)
+        .arg(subnet_id)
+        .arg(lower_bound_address.toText());
+
+    // Set up the WHERE clause value
+    MYSQL_BIND inbind[3];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Subnet ID
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&subnet_id);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    // Lower bound address. The addresses are compared as text, and the
+    // text of some addresses sorts before "::", so the beginning of the
+    // subnet is the empty string.
+    std::string lb_address = lower_bound_address.isV6Zero() ?
+        std::string() : lower_bound_address.toText();
+    unsigned long lb_address_length = lb_address.size();
+
+    // See the earlier description of the use of "const_cast" when accessing
+    // the address for an explanation of the reason.
+    inbind[1].buffer_type = MYSQL_TYPE_STRING;
+    inbind[1].buffer = const_cast<char*>(lb_address.c_str());
+    inbind[1].buffer_length = lb_address_length;
+    inbind[1].length = &lb_address_length;
+
+    // If the page size is 0, we will return all leases. This is
+    // achieved by setting the limit to a very high value.
+    uint32_t limit = page_size > 0 ? static_cast<uint32_t>(page_size) :
+        std::numeric_limits<uint32_t>::max();
+    inbind[2].buffer_type = MYSQL_TYPE_LONG;
+    inbind[2].buffer = reinterpret_cast<char*>(&limit);
+    inbind[2].is_unsigned = MLM_TRUE;
+
+    // Get the data
+    Lease6Collection result;
+    getLeaseCollection(GET_LEASE6_PAGE, inbind, result);
+
+    return (result);
+}
+
 
 
 // Update lease methods.  These comprise common code that handles the actual
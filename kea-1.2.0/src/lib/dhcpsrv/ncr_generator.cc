@@ -105,5 +105,22 @@ void queueNCR(const NameChangeType& chg_type, const Lease6Ptr& lease) {
     }
 }
 
+bool hasIdenticalDnsData(const Lease4& lease, const Lease4& old_lease) {
+    if (!lease.hasIdenticalFqdn(old_lease)) {
+        return (false);
+    }
+
+    // Client id takes precedence over HW address, as in queueNCR.
+    if (lease.client_id_ || old_lease.client_id_) {
+        return (lease.client_id_ && old_lease.client_id_ &&
+                (*lease.client_id_ == *old_lease.client_id_));
+    }
+
+    if (lease.hwaddr_ && old_lease.hwaddr_) {
+        return (*lease.hwaddr_ == *old_lease.hwaddr_);
+    }
+    return (!lease.hwaddr_ && !old_lease.hwaddr_);
+}
+
 }
 }
@@ -41,6 +41,20 @@ void queueNCR(const dhcp_ddns::NameChangeType& chg_type, const Lease4Ptr& lease)
 /// @param lease Pointer to the lease.
 void queueNCR(const dhcp_ddns::NameChangeType& chg_type, const Lease6Ptr& lease);
 
+/// @brief Checks if the renewal of the DHCPv4 lease leaves its DNS data
+/// unchanged.
+///
+/// The DNS data are unchanged when the FQDN data of the lease are identical
+/// and the DHCID would be computed from the same identifier, i.e. the same
+/// client identifier or, if the leases have none, the same HW address.
+/// No name change requests are needed for such a renewal.
+///
+/// @param lease Renewed lease.
+/// @param old_lease Lease before the renewal.
+///
+/// @return true if the DNS data of the leases are identical.
+bool hasIdenticalDnsData(const Lease4& lease, const Lease4& old_lease);
+
 } // end of isc::dhcp namespace
 } // end of isc namespace
 
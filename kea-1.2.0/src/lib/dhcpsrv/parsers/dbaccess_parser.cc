@@ -54,6 +54,8 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
     std::map<string, string> values_copy = values_;
 
     int64_t lfc_interval = 0;
+    int64_t load_threads = 1;
+    int64_t lfc_max_leases = 0;
     int64_t timeout = 0;
     int64_t port = 0;
     // 2. Update the copy with the passed keywords.
@@ -68,6 +70,16 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
                 values_copy[param.first] =
                     boost::lexical_cast<std::string>(lfc_interval);
 
+            } else if (param.first == "load-threads") {
+                load_threads = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(load_threads);
+
+            } else if (param.first == "lfc-max-leases") {
+                lfc_max_leases = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(lfc_max_leases);
+
             } else if (param.first == "connect-timeout") {
                 timeout = param.second->intValue();
                 values_copy[param.first] =
@@ -124,7 +136,29 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
                   << " (" << value->getPosition() << ")");
     }
 
-    // d. Check that the timeout is within a reasonable range.
+    // d. Check that the number of threads loading the lease files is
+    // within a reasonable range.
+    if ((load_threads < 1) ||
+        (load_threads > std::numeric_limits<uint16_t>::max())) {
+        ConstElementPtr value = database_config->get("load-threads");
+        isc_throw(DhcpConfigError, "load-threads value: " << load_threads
+                  << " is out of range, expected value: 1.."
+                  << std::numeric_limits<uint16_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // e. Check that the maximum number of leases the LFC keeps in
+    // memory is within a reasonable range.
+    if ((lfc_max_leases < 0) ||
+        (lfc_max_leases > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("lfc-max-leases");
+        isc_throw(DhcpConfigError, "lfc-max-leases value: " << lfc_max_leases
+                  << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // f. Check that the timeout is within a reasonable range.
     if ((timeout < 0) ||
         (timeout > std::numeric_limits<uint32_t>::max())) {
         ConstElementPtr value = database_config->get("connect-timeout");
@@ -134,7 +168,7 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
                   << " (" << value->getPosition() << ")");
     }
 
-    // e. Check that the port is within a reasonable range.
+    // g. Check that the port is within a reasonable range.
     if ((port < 0) ||
         (port > std::numeric_limits<uint16_t>::max())) {
         ConstElementPtr value = database_config->get("port");
@@ -164,6 +164,90 @@ void ControlSocketParser::parse(SrvConfig& srv_cfg, isc::data::ConstElementPtr v
     srv_cfg.setControlSocketInfo(value);
 }
 
+// ******************************** ReceiveQueueParser ****************************
+void ReceiveQueueParser::parse(SrvConfig& srv_cfg, isc::data::ConstElementPtr value) {
+    if (!value || (value->getType() != Element::map)) {
+        isc_throw(DhcpConfigError, "Specified receive-queue is expected to be a map"
+                  ", i.e. a structure defined within { }");
+    }
+
+    PacketQueueConfig config;
+    BOOST_FOREACH(ConfigPair param, value->mapValue()) {
+        try {
+            if (param.first == "capacity") {
+                config.capacity_ = getUint32(value, "capacity");
+
+            } else if (param.first == "drop-policy") {
+                config.policy_ = PacketQueueConfig::
+                    policyFromText(getString(value, "drop-policy"));
+
+            } else if (param.first == "max-age") {
+                config.max_age_ = getUint32(value, "max-age");
+
+            } else {
+                isc_throw(DhcpConfigError, "unsupported parameter '"
+                          << param.first << "' in receive-queue ("
+                          << param.second->getPosition() << ")");
+            }
+
+        } catch (const DhcpConfigError&) {
+            throw;
+
+        } catch (const std::exception& ex) {
+            isc_throw(DhcpConfigError, ex.what() << " ("
+                      << param.second->getPosition() << ")");
+        }
+    }
+    srv_cfg.setReceiveQueueConfig(config);
+}
+
+// ******************************** RateLimitParser ****************************
+void RateLimitParser::parse(SrvConfig& srv_cfg, isc::data::ConstElementPtr value) {
+    if (!value || (value->getType() != Element::map)) {
+        isc_throw(DhcpConfigError, "Specified rate-limit is expected to be a map"
+                  ", i.e. a structure defined within { }");
+    }
+
+    RateLimitConfig config;
+    BOOST_FOREACH(ConfigPair param, value->mapValue()) {
+        try {
+            if (param.first == "client-rate") {
+                config.client_rate_ = getUint32(value, "client-rate");
+
+            } else if (param.first == "client-burst") {
+                config.client_burst_ = getUint32(value, "client-burst");
+
+            } else if (param.first == "relay-rate") {
+                config.relay_rate_ = getUint32(value, "relay-rate");
+
+            } else if (param.first == "relay-burst") {
+                config.relay_burst_ = getUint32(value, "relay-burst");
+
+            } else if (param.first == "max-sources") {
+                config.max_sources_ = getUint32(value, "max-sources");
+                if (config.max_sources_ == 0) {
+                    isc_throw(DhcpConfigError, "max-sources must be greater"
+                              " than 0 (" << param.second->getPosition()
+                              << ")");
+                }
+
+            } else {
+                isc_throw(DhcpConfigError, "unsupported parameter '"
+                          << param.first << "' in rate-limit ("
+                          << param.second->getPosition() << ")");
+            }
+
+        } catch (const DhcpConfigError&) {
+            throw;
+
+        } catch (const std::exception& ex) {
+            isc_throw(DhcpConfigError, ex.what() << " ("
+                      << param.second->getPosition() << ")");
+        }
+    }
+    srv_cfg.setRateLimitConfig(config);
+}
+
 // **************************** OptionDataParser *************************
 OptionDataParser::OptionDataParser(const uint16_t address_family)
     : address_family_(address_family) {
@@ -895,6 +979,19 @@ SubnetConfigParser::createSubnet(ConstElementPtr params) {
                   << "(" << getPosition("reservation-mode", params) << ")");
     }
 
+    // Set the lease cache threshold if specified. If not, the existing
+    // leases are always extended in the lease database upon renewal.
+    ConstElementPtr cache_threshold = params->get("cache-threshold");
+    if (cache_threshold) {
+        try {
+            subnet_->setCacheThreshold(cache_threshold->doubleValue());
+        } catch (const isc::Exception& ex) {
+            isc_throw(DhcpConfigError, "Failed to process specified value"
+                      " of cache-threshold parameter: " << ex.what()
+                      << " (" << cache_threshold->getPosition() << ")");
+        }
+    }
+
     // Try setting up client class.
     string client_class = getString(params, "client-class");
     if (!client_class.empty()) {
@@ -341,6 +341,50 @@ public:
     void parse(SrvConfig& srv_cfg, isc::data::ConstElementPtr value);
 };
 
+/// @brief Parser for the receive-queue structure
+///
+/// The structure holds the following optional parameters:
+/// - capacity - maximum number of packets in the queue, 0 disables
+///   the queue,
+/// - drop-policy - "drop-oldest" or "drop-discovery",
+/// - max-age - maximum number of milliseconds a packet may wait in the
+///   queue, 0 means no limit.
+class ReceiveQueueParser : public isc::data::SimpleParser {
+public:
+    /// @brief Parses receive-queue structure
+    ///
+    /// @param srv_cfg parsed values will be stored here
+    /// @param value pointer to the content of parsed values
+    ///
+    /// @throw DhcpConfigError if the value is not a map or holds an
+    /// unsupported parameter or value.
+    void parse(SrvConfig& srv_cfg, isc::data::ConstElementPtr value);
+};
+
+/// @brief Parser for the rate-limit structure
+///
+/// The structure holds the following optional parameters:
+/// - client-rate - packets per second accepted from a single client,
+///   0 disables the client limit,
+/// - client-burst - packets a single client may send at once, 0 means
+///   the client-rate,
+/// - relay-rate - packets per second accepted from a single relay,
+///   0 disables the relay limit,
+/// - relay-burst - packets a single relay may send at once, 0 means
+///   the relay-rate,
+/// - max-sources - maximum number of the tracked clients and relays.
+class RateLimitParser : public isc::data::SimpleParser {
+public:
+    /// @brief Parses rate-limit structure
+    ///
+    /// @param srv_cfg parsed values will be stored here
+    /// @param value pointer to the content of parsed values
+    ///
+    /// @throw DhcpConfigError if the value is not a map or holds an
+    /// unsupported parameter or value.
+    void parse(SrvConfig& srv_cfg, isc::data::ConstElementPtr value);
+};
+
 
 /// @brief Parser for option data value.
 ///
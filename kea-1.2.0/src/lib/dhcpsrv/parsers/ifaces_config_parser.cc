@@ -62,6 +62,16 @@ IfacesConfigParser::parse(const CfgIfacePtr& cfg,
                 }
             }
 
+            if (element.first == "receive-ring") {
+                if (protocol_ == AF_INET) {
+                    cfg->useReceiveRing(AF_INET, element.second->boolValue());
+                    continue;
+                } else {
+                    isc_throw(DhcpConfigError,
+                              "receive-ring is not supported in DHCPv6");
+                }
+            }
+
             // This should never happen as the input produced by the parser
             // see (src/bin/dhcpX/dhcpX_parser.yy) should not produce any
             // other parameter, so this case is only to catch bugs in
@@ -111,6 +111,17 @@ PgSqlTaggedStatement tagged_statements[] = {
               "ORDER BY expire "
               "LIMIT $3"},
 
+    // GET_LEASE4_PAGE
+    { 3, { OID_INT8, OID_INT8, OID_INT8 },
+      "get_lease4_page",
+      "SELECT address, hwaddr, client_id, "
+          "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease4 "
+              "WHERE subnet_id = $1 AND address > $2 "
+              "ORDER BY address "
+              "LIMIT $3"},
+
     // GET_LEASE6_ADDR
     { 2, { OID_VARCHAR, OID_INT2 },
       "get_lease6_addr",
@@ -155,6 +166,18 @@ PgSqlTaggedStatement tagged_statements[] = {
               "ORDER BY expire "
               "LIMIT $3"},
 
+    // GET_LEASE6_PAGE
+    { 3, { OID_INT8, OID_VARCHAR, OID_INT8 },
+      "get_lease6_page",
+      "SELECT address, duid, valid_lifetime, "
+          "extract(epoch from expire)::bigint, subnet_id, pref_lifetime, "
+          "lease_type, iaid, prefix_len, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease6 "
+              "WHERE subnet_id = $1 AND address > $2 "
+              "ORDER BY address "
+              "LIMIT $3"},
+
     // GET_VERSION
     { 0, { OID_NONE },
       "get_version",
@@ -1198,6 +1221,80 @@ PgSqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     getLeaseCollection(statement_index, bind_array, expired_leases);
 }
 
+Lease4Collection
+PgSqlLeaseMgr::getSubnetLeases4(SubnetID subnet_id,
+                                const asiolink::IOAddress& lower_bound_address,
+                                const size_t page_size) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_GET_SUBID_PAGE4)
+        .arg(page_size)
+        .arg(subnet_id)
+        .arg(lower_bound_address.toText());
+
+    // Set up the WHERE clause value
+    PsqlBindArray bind_array;
+
+    // SUBNET_ID
+    std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
+    bind_array.add(subnet_id_str);
+
+    // Lower bound address
+    std::string lb_address_str = boost::lexical_cast<std::string>
+                                 (lower_bound_address.toUint32());
+    bind_array.add(lb_address_str);
+
+    // If the page size is 0, we will return all leases. This is
+    // achieved by setting the limit to a very high value.
+    uint32_t limit = page_size > 0 ? static_cast<uint32_t>(page_size) :
+        std::numeric_limits<uint32_t>::max();
+    std::string limit_str = boost::lexical_cast<std::string>(limit);
+    bind_array.add(limit_str);
+
+    // Get the data
+    Lease4Collection result;
+    getLeaseCollection(GET_LEASE4_PAGE, bind_array, result);
+
+    return (result);
+}
+
+Lease6Collection
+PgSqlLeaseMgr::getSubnetLeases6(SubnetID subnet_id,
+                                const asiolink::IOAddress& lower_bound_address,
+                                const size_t page_size) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_GET_SUBID_PAGE6)
+        .arg(page_size)
+        .arg(subnet_id)
+        .arg(lower_bound_address.toText());
+
+    // Set up the WHERE clause value
+    PsqlBindArray bind_array;
+
+    // SUBNET_ID
+    std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
+    bind_array.add(subnet_id_str);
+
+    // Lower bound address. The addresses are compared as text, and the
+    // text of some addresses sorts before "::", so the beginning of the
+    // subnet is the empty string.
+    std::string lb_address_str = lower_bound_address.isV6Zero() ?
+        std::string() : lower_bound_address.toText();
+    bind_array.add(lb_address_str);
+
+    // If the page size is 0, we will return all leases. This is
+    // achieved by setting the limit to a very high value.
+    uint32_t limit = page_size > 0 ? static_cast<uint32_t>(page_size) :
+        std::numeric_limits<uint32_t>::max();
+    std::string limit_str = boost::lexical_cast<std::string>(limit);
+    bind_array.add(limit_str);
+
+    // Get the data
+    Lease6Collection result;
+    getLeaseCollection(GET_LEASE6_PAGE, bind_array, result);
+
+    return (result);
+}
+
 
 template<typename LeasePtr>
 void
@@ -258,6 +258,50 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& expired_leases,
                                    const size_t max_leases) const;
 
+    /// @brief Returns a page of DHCPv4 leases belonging to a subnet.
+    ///
+    /// The leases are selected with the keyset query ordered by address
+    /// which uses the index by subnet identifier and address, so the cost
+    /// of obtaining a page doesn't depend on the pages already returned.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param lower_bound_address Only the leases with the addresses greater
+    /// than this address are returned.
+    /// @param page_size Maximum number of leases to be returned, 0 means
+    /// no limit.
+    ///
+    /// @return Collection of the DHCPv4 leases.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection
+    getSubnetLeases4(SubnetID subnet_id,
+                     const isc::asiolink::IOAddress& lower_bound_address,
+                     const size_t page_size) const;
+
+    /// @brief Returns a page of DHCPv6 leases belonging to a subnet.
+    ///
+    /// The DHCPv6 addresses are stored as text, so the leases are ordered
+    /// by the text of their addresses rather than by their numeric values.
+    /// Passing the last address of a page as the lower bound still returns
+    /// the next page.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    /// @param lower_bound_address Only the leases with the addresses greater
+    /// than this address are returned. The :: address starts with the first
+    /// lease of the subnet.
+    /// @param page_size Maximum number of leases to be returned, 0 means
+    /// no limit.
+    ///
+    /// @return Collection of the DHCPv6 leases.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection
+    getSubnetLeases6(SubnetID subnet_id,
+                     const isc::asiolink::IOAddress& lower_bound_address,
+                     const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// Updates the record of the lease in the database (as identified by the
@@ -392,10 +436,12 @@ public:
         GET_LEASE4_HWADDR,          // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,    // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,          // Get expired lease4
+        GET_LEASE4_PAGE,            // Get page of lease4 by subnet ID
         GET_LEASE6_ADDR,            // Get lease6 by address
         GET_LEASE6_DUID_IAID,       // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID, // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,          // Get expired lease6
+        GET_LEASE6_PAGE,            // Get page of lease6 by subnet ID
         GET_VERSION,                // Obtain version number
         INSERT_LEASE4,              // Add entry to lease4 table
         INSERT_LEASE6,              // Add entry to lease6 table
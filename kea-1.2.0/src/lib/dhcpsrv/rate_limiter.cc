@@ -0,0 +1,216 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/rate_limiter.h>
+
+#include <boost/functional/hash.hpp>
+
+using namespace isc::asiolink;
+using namespace boost::posix_time;
+
+namespace {
+
+/// @brief Number of token fractions in a token.
+const int64_t TOKEN = 1000000;
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const uint32_t RateLimitConfig::DEFAULT_MAX_SOURCES;
+
+RateLimiter::RateLimiter()
+    : config_(), buckets_(), mask_(0) {
+}
+
+void
+RateLimiter::configure(const RateLimitConfig& config) {
+    if (config == config_) {
+        return;
+    }
+
+    config_ = config;
+    buckets_.clear();
+    mask_ = 0;
+    if (enabled()) {
+        // Round the table size up to the power of two, so as the index is
+        // obtained by masking the hash. Each source may use two slots.
+        size_t size = 2;
+        while ((size < config_.max_sources_) && (size < (1U << 30))) {
+            size <<= 1;
+        }
+        Bucket empty = { 0, 0, 0 };
+        buckets_.resize(size, empty);
+        mask_ = size - 1;
+    }
+}
+
+RateLimiter::Source
+RateLimiter::check(const Pkt4Ptr& query, const ptime& now) {
+    if (!enabled()) {
+        return (NONE);
+    }
+
+    const int64_t now_us = toMicroseconds(now);
+    Source sources[3];
+    Bucket* buckets[3];
+    size_t count = 0;
+    if (config_.client_rate_ > 0) {
+        OptionPtr client_id = query->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+        if (client_id && !client_id->getData().empty()) {
+            sources[count] = CLIENT_ID;
+            buckets[count++] = refill(CLIENT_ID, &client_id->getData()[0],
+                                      client_id->getData().size(), now_us);
+        }
+
+        HWAddrPtr hwaddr = query->getHWAddr();
+        if (hwaddr && !hwaddr->hwaddr_.empty()) {
+            sources[count] = HW_ADDRESS;
+            buckets[count++] = refill(HW_ADDRESS, &hwaddr->hwaddr_[0],
+                                      hwaddr->hwaddr_.size(), now_us);
+        }
+    }
+
+    if ((config_.relay_rate_ > 0) && !query->getGiaddr().isV4Zero()) {
+        const std::vector<uint8_t>& giaddr = query->getGiaddr().toBytes();
+        sources[count] = RELAY;
+        buckets[count++] = refill(RELAY, &giaddr[0], giaddr.size(), now_us);
+    }
+
+    return (consume(sources, buckets, count));
+}
+
+RateLimiter::Source
+RateLimiter::check(const Pkt6Ptr& query, const ptime& now) {
+    if (!enabled()) {
+        return (NONE);
+    }
+
+    const int64_t now_us = toMicroseconds(now);
+    Source sources[2];
+    Bucket* buckets[2];
+    size_t count = 0;
+    if (config_.client_rate_ > 0) {
+        DuidPtr duid = query->getClientId();
+        if (duid && !duid->getDuid().empty()) {
+            const std::vector<uint8_t>& data = duid->getDuid();
+            sources[count] = CLIENT_ID;
+            buckets[count++] = refill(CLIENT_ID, &data[0], data.size(),
+                                      now_us);
+        }
+    }
+
+    // The relayed message is received from the relay closest to the
+    // server.
+    if ((config_.relay_rate_ > 0) && !query->relay_info_.empty()) {
+        const std::vector<uint8_t>& remote = query->getRemoteAddr().toBytes();
+        sources[count] = RELAY;
+        buckets[count++] = refill(RELAY, &remote[0], remote.size(), now_us);
+    }
+
+    return (consume(sources, buckets, count));
+}
+
+std::string
+RateLimiter::sourceToText(const Source& source) {
+    switch (source) {
+    case CLIENT_ID:
+        return ("client identifier");
+    case HW_ADDRESS:
+        return ("hardware address");
+    case RELAY:
+        return ("relay");
+    default:
+        ;
+    }
+    return ("none");
+}
+
+RateLimiter::Bucket*
+RateLimiter::refill(const Source& source, const uint8_t* data,
+                    const size_t len, const int64_t now) {
+    const bool relay = (source == RELAY);
+    const int64_t rate = relay ? config_.relay_rate_ : config_.client_rate_;
+    int64_t burst = relay ? config_.relay_burst_ : config_.client_burst_;
+    if (burst == 0) {
+        burst = rate;
+    }
+    const int64_t capacity = burst * TOKEN;
+
+    // The source kind is a part of the hash, so as the same bytes used
+    // as different identifiers get different buckets.
+    size_t hash = static_cast<size_t>(source);
+    boost::hash_combine(hash, boost::hash_range(data, data + len));
+    const uint64_t tag = (hash != 0 ? hash : 1);
+
+    Bucket* bucket = &buckets_[tag & mask_];
+    if (bucket->tag_ != tag) {
+        Bucket* other = &buckets_[(tag & mask_) ^ 1];
+        if (other->tag_ == tag) {
+            bucket = other;
+
+        } else {
+            // New source or the one which has been evicted. Reclaim the
+            // least recently used slot.
+            if (other->last_ < bucket->last_) {
+                bucket = other;
+            }
+            bucket->tag_ = tag;
+            bucket->last_ = now;
+            bucket->tokens_ = capacity;
+        }
+    }
+
+    // Refill the bucket with the tokens gained since the last packet.
+    const int64_t elapsed = now - bucket->last_;
+    if (elapsed > 0) {
+        if (elapsed >= (capacity - bucket->tokens_) / rate) {
+            bucket->tokens_ = capacity;
+        } else {
+            bucket->tokens_ += elapsed * rate;
+        }
+        bucket->last_ = now;
+    }
+
+    return (bucket);
+}
+
+RateLimiter::Source
+RateLimiter::consume(const Source* sources, Bucket* const* buckets,
+                     const size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        if (buckets[i]->tokens_ < TOKEN) {
+            return (sources[i]);
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        // The sources of the query may share a bucket when one has
+        // reclaimed the slot of another; take a single token from it.
+        bool taken = false;
+        for (size_t j = 0; j < i; ++j) {
+            taken = taken || (buckets[j] == buckets[i]);
+        }
+        if (!taken) {
+            buckets[i]->tokens_ -= TOKEN;
+        }
+    }
+    return (NONE);
+}
+
+int64_t
+RateLimiter::toMicroseconds(const ptime& now) {
+    static const ptime epoch(boost::gregorian::date(1970, 1, 1));
+    return ((now - epoch).total_microseconds());
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
@@ -0,0 +1,226 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef RATE_LIMITER_H
+#define RATE_LIMITER_H
+
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Configuration of the rate limiting of the received packets.
+///
+/// The rates are expressed in packets per second and the bursts in
+/// packets. The rate of 0 disables the rate limiting for the given kind
+/// of the source, which is the default.
+struct RateLimitConfig {
+
+    /// @brief Default maximum number of the tracked sources.
+    static const uint32_t DEFAULT_MAX_SOURCES = 65536;
+
+    /// @brief Constructor.
+    ///
+    /// @param client_rate Rate of packets allowed from a single client.
+    /// @param client_burst Number of packets a client may send at once.
+    /// If 0, the client rate is used.
+    /// @param relay_rate Rate of packets allowed from a single relay.
+    /// @param relay_burst Number of packets a relay may send at once.
+    /// If 0, the relay rate is used.
+    /// @param max_sources Maximum number of the tracked sources.
+    RateLimitConfig(const uint32_t client_rate = 0,
+                    const uint32_t client_burst = 0,
+                    const uint32_t relay_rate = 0,
+                    const uint32_t relay_burst = 0,
+                    const uint32_t max_sources = DEFAULT_MAX_SOURCES)
+        : client_rate_(client_rate), client_burst_(client_burst),
+          relay_rate_(relay_rate), relay_burst_(relay_burst),
+          max_sources_(max_sources) {
+    }
+
+    /// @brief Checks if the rate limiting is enabled.
+    bool enabled() const {
+        return ((client_rate_ > 0) || (relay_rate_ > 0));
+    }
+
+    /// @brief Compares two configurations.
+    bool operator==(const RateLimitConfig& other) const {
+        return ((client_rate_ == other.client_rate_) &&
+                (client_burst_ == other.client_burst_) &&
+                (relay_rate_ == other.relay_rate_) &&
+                (relay_burst_ == other.relay_burst_) &&
+                (max_sources_ == other.max_sources_));
+    }
+
+    /// @brief Compares two configurations.
+    bool operator!=(const RateLimitConfig& other) const {
+        return (!(*this == other));
+    }
+
+    /// @brief Rate of packets allowed from a single client.
+    uint32_t client_rate_;
+
+    /// @brief Number of packets a single client may send at once.
+    uint32_t client_burst_;
+
+    /// @brief Rate of packets allowed from a single relay.
+    uint32_t relay_rate_;
+
+    /// @brief Number of packets a single relay may send at once.
+    uint32_t relay_burst_;
+
+    /// @brief Maximum number of the tracked sources.
+    uint32_t max_sources_;
+};
+
+/// @brief Token bucket rate limiter for the received packets.
+///
+/// A misbehaving client or a looping relay may flood the server with
+/// packets which all go through the classification and the lease
+/// database lookups. This class tracks the rate of packets received
+/// from each source and tells the server to drop the packets exceeding
+/// the configured rate, before any expensive processing takes place.
+///
+/// The client is identified by its client identifier (DHCPv4 only),
+/// hardware address (DHCPv4 only) and DUID (DHCPv6 only), each one
+/// having a separate bucket. The relay is identified by the relay agent
+/// address (giaddr) for DHCPv4 and by the source address of the relayed
+/// message for DHCPv6.
+///
+/// The buckets are held in a fixed size hash table, indexed by the hash
+/// of the source identity. Each source may occupy one of two adjacent
+/// slots; when both are taken by other sources, the least recently used
+/// one is reclaimed. A reclaimed bucket starts full, so the table size
+/// only bounds the memory and never causes packets to be dropped.
+class RateLimiter {
+public:
+
+    /// @brief Kind of the source which exceeded its rate.
+    enum Source {
+        /// The packet is within the limits.
+        NONE,
+        /// Client identifier or DUID.
+        CLIENT_ID,
+        /// Hardware address.
+        HW_ADDRESS,
+        /// Relay agent address.
+        RELAY
+    };
+
+    /// @brief Constructor.
+    ///
+    /// Creates the disabled rate limiter.
+    RateLimiter();
+
+    /// @brief Sets the configuration of the rate limiter.
+    ///
+    /// If the configuration differs from the current one, all sources
+    /// are forgotten.
+    ///
+    /// @param config New configuration.
+    void configure(const RateLimitConfig& config);
+
+    /// @brief Returns the configuration of the rate limiter.
+    const RateLimitConfig& getConfig() const {
+        return (config_);
+    }
+
+    /// @brief Checks if the rate limiting is enabled.
+    bool enabled() const {
+        return (config_.enabled());
+    }
+
+    /// @brief Accounts the DHCPv4 query and checks if it exceeds the rate.
+    ///
+    /// @param query Parsed DHCPv4 query.
+    /// @param now Current time.
+    ///
+    /// @return @c NONE if the query should be processed or the kind of
+    /// the source which exceeded its rate.
+    Source check(const Pkt4Ptr& query, const boost::posix_time::ptime& now =
+                 boost::posix_time::microsec_clock::universal_time());
+
+    /// @brief Accounts the DHCPv6 query and checks if it exceeds the rate.
+    ///
+    /// @param query Parsed DHCPv6 query.
+    /// @param now Current time.
+    ///
+    /// @return @c NONE if the query should be processed or the kind of
+    /// the source which exceeded its rate.
+    Source check(const Pkt6Ptr& query, const boost::posix_time::ptime& now =
+                 boost::posix_time::microsec_clock::universal_time());
+
+    /// @brief Returns textual name of the source kind.
+    ///
+    /// @param source Source kind.
+    static std::string sourceToText(const Source& source);
+
+private:
+
+    /// @brief Token bucket of a single source.
+    struct Bucket {
+        /// @brief Hash of the source identity, 0 for the unused bucket.
+        uint64_t tag_;
+        /// @brief Time of the last refill in microseconds.
+        int64_t last_;
+        /// @brief Number of the available tokens in millionths.
+        int64_t tokens_;
+    };
+
+    /// @brief Finds the bucket of the source and refills it.
+    ///
+    /// The bucket of a new source, or of the one which has been evicted,
+    /// starts full.
+    ///
+    /// @param source Kind of the source.
+    /// @param data Pointer to the source identity.
+    /// @param len Length of the source identity.
+    /// @param now Current time in microseconds.
+    ///
+    /// @return Pointer to the bucket of the source.
+    Bucket* refill(const Source& source, const uint8_t* data,
+                   const size_t len, const int64_t now);
+
+    /// @brief Takes a token from each bucket if none of them is empty.
+    ///
+    /// A query dropped because one of its sources exceeded the rate
+    /// doesn't use up the tokens of its other sources.
+    ///
+    /// @param sources Kinds of the sources of the query.
+    /// @param buckets Buckets of the sources of the query.
+    /// @param count Number of the sources.
+    ///
+    /// @return @c NONE if the tokens have been taken or the kind of the
+    /// first source having an empty bucket.
+    Source consume(const Source* sources, Bucket* const* buckets,
+                   const size_t count);
+
+    /// @brief Converts time to microseconds.
+    ///
+    /// @param now Time to be converted.
+    static int64_t toMicroseconds(const boost::posix_time::ptime& now);
+
+    /// @brief Current configuration.
+    RateLimitConfig config_;
+
+    /// @brief Hash table of the buckets.
+    std::vector<Bucket> buckets_;
+
+    /// @brief Mask applied to the hash to get the bucket index.
+    uint64_t mask_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // RATE_LIMITER_H
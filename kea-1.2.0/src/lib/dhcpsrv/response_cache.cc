@@ -0,0 +1,228 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/response_cache.h>
+
+using namespace isc::asiolink;
+using namespace boost::posix_time;
+
+namespace isc {
+namespace dhcp {
+
+ResponseCache::ResponseCache(const uint32_t ttl, const size_t max_entries)
+    : ttl_(ttl), max_entries_(max_entries), responses_() {
+}
+
+void
+ResponseCache::setTTL(const uint32_t ttl) {
+    if (ttl != ttl_) {
+        ttl_ = ttl;
+        clear();
+    }
+}
+
+ResponseCache::Entry::Entry()
+    : key_(), expire_(), data_(), remote_addr_(IOAddress::IPV4_ZERO_ADDRESS()),
+      local_addr_(IOAddress::IPV4_ZERO_ADDRESS()), remote_port_(0),
+      local_port_(0), iface_(), ifindex_(0), remote_hwaddr_(),
+      local_hwaddr_() {
+}
+
+Pkt4Ptr
+ResponseCache::get(const Pkt4Ptr& query) {
+    Key key;
+    if (!enabled() || !makeKey(query, key)) {
+        return (Pkt4Ptr());
+    }
+    const Entry* entry = get(key);
+    if (!entry) {
+        return (Pkt4Ptr());
+    }
+    Pkt4Ptr response = makeResponse<Pkt4>(*entry);
+    if (response && entry->local_hwaddr_) {
+        response->setLocalHWAddr(HWAddrPtr(new HWAddr(*entry->local_hwaddr_)));
+    }
+    return (response);
+}
+
+Pkt6Ptr
+ResponseCache::get(const Pkt6Ptr& query) {
+    Key key;
+    if (!enabled() || !makeKey(query, key)) {
+        return (Pkt6Ptr());
+    }
+    const Entry* entry = get(key);
+    if (!entry) {
+        return (Pkt6Ptr());
+    }
+    return (makeResponse<Pkt6>(*entry));
+}
+
+void
+ResponseCache::add(const Pkt4Ptr& query, const Pkt4Ptr& response) {
+    Key key;
+    if (enabled() && response && makeKey(query, key)) {
+        add(key, *response, response->getLocalHWAddr());
+    }
+}
+
+void
+ResponseCache::add(const Pkt6Ptr& query, const Pkt6Ptr& response) {
+    Key key;
+    if (enabled() && response && makeKey(query, key)) {
+        add(key, *response, HWAddrPtr());
+    }
+}
+
+void
+ResponseCache::clear() {
+    responses_.clear();
+}
+
+bool
+ResponseCache::makeKey(const Pkt4Ptr& query, Key& key) {
+    // The client identifier takes precedence over the hardware address
+    // as it is the case for the lease lookups. The identity type is
+    // prepended to avoid collisions between both.
+    OptionPtr client_id = query->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+    if (client_id && !client_id->getData().empty()) {
+        key.push_back(DHO_DHCP_CLIENT_IDENTIFIER);
+        key.insert(key.end(), client_id->getData().begin(),
+                   client_id->getData().end());
+
+    } else {
+        HWAddrPtr hwaddr = query->getHWAddr();
+        if (!hwaddr || hwaddr->hwaddr_.empty()) {
+            return (false);
+        }
+        key.push_back(0);
+        key.push_back(static_cast<uint8_t>(hwaddr->htype_ >> 8));
+        key.push_back(static_cast<uint8_t>(hwaddr->htype_ & 0xFF));
+        key.insert(key.end(), hwaddr->hwaddr_.begin(), hwaddr->hwaddr_.end());
+    }
+    finishKey(*query, key);
+    return (true);
+}
+
+bool
+ResponseCache::makeKey(const Pkt6Ptr& query, Key& key) {
+    DuidPtr duid = query->getClientId();
+    if (!duid) {
+        return (false);
+    }
+    key = duid->getDuid();
+    finishKey(*query, key);
+    return (true);
+}
+
+void
+ResponseCache::finishKey(const Pkt& query, Key& key) {
+    // Different relays may forward queries with the same transaction id
+    // for the same client, so the remote address is a part of the key.
+    const std::vector<uint8_t>& remote = query.getRemoteAddr().toBytes();
+    key.insert(key.end(), remote.begin(), remote.end());
+    const uint32_t transid = query.getTransid();
+    key.push_back(static_cast<uint8_t>(transid >> 24));
+    key.push_back(static_cast<uint8_t>((transid >> 16) & 0xFF));
+    key.push_back(static_cast<uint8_t>((transid >> 8) & 0xFF));
+    key.push_back(static_cast<uint8_t>(transid & 0xFF));
+    key.push_back(query.getType());
+}
+
+const ResponseCache::Entry*
+ResponseCache::get(const Key& key) {
+    removeExpired(microsec_clock::universal_time());
+
+    const EntryContainer::nth_index<1>::type& idx = responses_.get<1>();
+    EntryContainer::nth_index<1>::type::const_iterator entry = idx.find(key);
+    if (entry == idx.end()) {
+        return (0);
+    }
+    return (&(*entry));
+}
+
+void
+ResponseCache::add(const Key& key, Pkt& response,
+                   const HWAddrPtr& local_hwaddr) {
+    const util::OutputBuffer& buffer = response.getBuffer();
+    if (buffer.getLength() == 0) {
+        return;
+    }
+
+    const ptime now = microsec_clock::universal_time();
+    removeExpired(now);
+
+    // The response to the same query may be already there if the callouts
+    // altered the query. Replace it, so as the new one is returned.
+    EntryContainer::nth_index<1>::type& idx = responses_.get<1>();
+    idx.erase(key);
+
+    while (!responses_.empty() && (responses_.size() >= max_entries_)) {
+        responses_.pop_front();
+    }
+
+    // The response may be modified once it is sent, so the cache holds
+    // copies of the data needed to send it again.
+    Entry entry;
+    entry.key_ = key;
+    entry.expire_ = now + milliseconds(ttl_);
+    const uint8_t* data = static_cast<const uint8_t*>(buffer.getData());
+    entry.data_.assign(data, data + buffer.getLength());
+    entry.remote_addr_ = response.getRemoteAddr();
+    entry.local_addr_ = response.getLocalAddr();
+    entry.remote_port_ = response.getRemotePort();
+    entry.local_port_ = response.getLocalPort();
+    entry.iface_ = response.getIface();
+    entry.ifindex_ = response.getIndex();
+    HWAddrPtr remote_hwaddr = response.getRemoteHWAddr();
+    if (remote_hwaddr) {
+        entry.remote_hwaddr_.reset(new HWAddr(*remote_hwaddr));
+    }
+    if (local_hwaddr) {
+        entry.local_hwaddr_.reset(new HWAddr(*local_hwaddr));
+    }
+    responses_.push_back(entry);
+}
+
+template<typename PktType>
+boost::shared_ptr<PktType>
+ResponseCache::makeResponse(const Entry& entry) {
+    boost::shared_ptr<PktType> response(new PktType(&entry.data_[0],
+                                                    entry.data_.size()));
+    try {
+        response->unpack();
+
+    } catch (const std::exception&) {
+        return (boost::shared_ptr<PktType>());
+    }
+
+    response->setRemoteAddr(entry.remote_addr_);
+    response->setLocalAddr(entry.local_addr_);
+    response->setRemotePort(entry.remote_port_);
+    response->setLocalPort(entry.local_port_);
+    response->setIface(entry.iface_);
+    response->setIndex(entry.ifindex_);
+    if (entry.remote_hwaddr_) {
+        response->setRemoteHWAddr(HWAddrPtr(new HWAddr(*entry.remote_hwaddr_)));
+    }
+    response->getBuffer().writeData(&entry.data_[0], entry.data_.size());
+    return (response);
+}
+
+void
+ResponseCache::removeExpired(const ptime& now) {
+    // Responses are held in the order of expiration.
+    while (!responses_.empty() && (responses_.front().expire_ <= now)) {
+        responses_.pop_front();
+    }
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
@@ -0,0 +1,264 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef RESPONSE_CACHE_H
+#define RESPONSE_CACHE_H
+
+#include <asiolink/io_address.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/pkt.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <boost/multi_index/hashed_index.hpp>
+#include <boost/multi_index/indexed_by.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Short lived cache of the responses sent to the clients.
+///
+/// Clients and relays retransmit their queries when the server is slow
+/// to respond. Without this cache every retransmitted copy of the query
+/// goes through the full processing, including lease database lookups
+/// and updates, which makes the server even slower and causes even more
+/// retransmissions when the server is already overloaded.
+///
+/// The cache holds the responses sent to the clients for a configured
+/// period of time, indexed by the client identity (client identifier,
+/// or hardware address when the client identifier is absent, for DHCPv4
+/// and DUID for DHCPv6), the remote address, the transaction id and the
+/// message type of the query. A retransmitted query is then answered
+/// with the response held in the cache rather than being processed again.
+///
+/// The cache holds a copy of the wire data of the response, along with
+/// the addresses and the interface it was sent to, rather than the
+/// response object itself. Every retransmission is answered with a new
+/// response object created from this copy, so the modifications of the
+/// sent response (e.g. by the hooks libraries) don't alter the cached
+/// one.
+///
+/// The cache is disabled when its lifetime is set to 0, which is the
+/// default.
+class ResponseCache {
+public:
+
+    /// @brief Default maximum number of responses held in the cache.
+    static const size_t DEFAULT_MAX_ENTRIES = 4096;
+
+    /// @brief Constructor.
+    ///
+    /// @param ttl Number of milliseconds for which the responses are held
+    /// in the cache. The value of 0 disables the cache.
+    /// @param max_entries Maximum number of responses held in the cache.
+    /// When this limit is reached, the oldest responses are removed to
+    /// make room for the new ones.
+    ResponseCache(const uint32_t ttl = 0,
+                  const size_t max_entries = DEFAULT_MAX_ENTRIES);
+
+    /// @brief Sets the lifetime of the cached responses.
+    ///
+    /// If the lifetime differs from the current value, all responses are
+    /// removed from the cache.
+    ///
+    /// @param ttl Lifetime in milliseconds. The value of 0 disables the
+    /// cache.
+    void setTTL(const uint32_t ttl);
+
+    /// @brief Returns the lifetime of the cached responses in milliseconds.
+    uint32_t getTTL() const {
+        return (ttl_);
+    }
+
+    /// @brief Checks if the cache is enabled.
+    bool enabled() const {
+        return (ttl_ > 0);
+    }
+
+    /// @brief Returns the response sent to the previous copy of the
+    /// DHCPv4 query.
+    ///
+    /// @param query Received DHCPv4 query.
+    ///
+    /// @return Pointer to a new packet created from the cached response,
+    /// holding its wire data in the output buffer, or null pointer if
+    /// there is no valid response for this query in the cache.
+    Pkt4Ptr get(const Pkt4Ptr& query);
+
+    /// @brief Returns the response sent to the previous copy of the
+    /// DHCPv6 query.
+    ///
+    /// @param query Received DHCPv6 query.
+    ///
+    /// @return Pointer to a new packet created from the cached response,
+    /// holding its wire data in the output buffer, or null pointer if
+    /// there is no valid response for this query in the cache.
+    Pkt6Ptr get(const Pkt6Ptr& query);
+
+    /// @brief Adds the response to the DHCPv4 query to the cache.
+    ///
+    /// This function does nothing if the cache is disabled, if the
+    /// response hasn't been packed or if the client identity can't be
+    /// determined from the query.
+    ///
+    /// @param query DHCPv4 query.
+    /// @param response Packed response to this query.
+    void add(const Pkt4Ptr& query, const Pkt4Ptr& response);
+
+    /// @brief Adds the response to the DHCPv6 query to the cache.
+    ///
+    /// This function does nothing if the cache is disabled, if the
+    /// response hasn't been packed or if the client identity can't be
+    /// determined from the query.
+    ///
+    /// @param query DHCPv6 query.
+    /// @param response Packed response to this query.
+    void add(const Pkt6Ptr& query, const Pkt6Ptr& response);
+
+    /// @brief Removes all responses from the cache.
+    void clear();
+
+    /// @brief Returns the number of responses held in the cache.
+    size_t size() const {
+        return (responses_.size());
+    }
+
+private:
+
+    /// @brief Type of the key identifying the query.
+    typedef std::vector<uint8_t> Key;
+
+    /// @brief Creates a key for the DHCPv4 query.
+    ///
+    /// @param query DHCPv4 query.
+    /// @param [out] key Created key.
+    ///
+    /// @return true if the key has been created, false if the query
+    /// carries neither the client identifier nor the hardware address.
+    static bool makeKey(const Pkt4Ptr& query, Key& key);
+
+    /// @brief Creates a key for the DHCPv6 query.
+    ///
+    /// @param query DHCPv6 query.
+    /// @param [out] key Created key.
+    ///
+    /// @return true if the key has been created, false if the query
+    /// doesn't carry the client identifier.
+    static bool makeKey(const Pkt6Ptr& query, Key& key);
+
+    /// @brief Appends the remote address, transaction id and message
+    /// type of the query to the key.
+    ///
+    /// @param query Received query.
+    /// @param [out] key Key to which the values are appended.
+    static void finishKey(const Pkt& query, Key& key);
+
+    /// @brief Structure holding the cached response.
+    struct Entry {
+        /// @brief Key identifying the query.
+        Key key_;
+        /// @brief Time when the response expires.
+        boost::posix_time::ptime expire_;
+        /// @brief Wire data of the response.
+        std::vector<uint8_t> data_;
+        /// @brief Remote address the response was sent to.
+        asiolink::IOAddress remote_addr_;
+        /// @brief Local address the response was sent from.
+        asiolink::IOAddress local_addr_;
+        /// @brief Remote port the response was sent to.
+        uint16_t remote_port_;
+        /// @brief Local port the response was sent from.
+        uint16_t local_port_;
+        /// @brief Name of the interface the response was sent over.
+        std::string iface_;
+        /// @brief Index of the interface the response was sent over.
+        uint32_t ifindex_;
+        /// @brief Remote hardware address the response was sent to.
+        HWAddrPtr remote_hwaddr_;
+        /// @brief Local hardware address the response was sent from
+        /// (DHCPv4 only).
+        HWAddrPtr local_hwaddr_;
+
+        /// @brief Constructor.
+        Entry();
+    };
+
+    /// @brief Returns the cached response for the given key.
+    ///
+    /// Expired responses are removed from the cache.
+    ///
+    /// @param key Key identifying the query.
+    ///
+    /// @return Pointer to the cached response or null pointer if there
+    /// is no valid response for this key.
+    const Entry* get(const Key& key);
+
+    /// @brief Adds the response for the given key to the cache.
+    ///
+    /// @param key Key identifying the query.
+    /// @param response Packed response to be added.
+    /// @param local_hwaddr Local hardware address of the response, if any.
+    void add(const Key& key, Pkt& response,
+             const HWAddrPtr& local_hwaddr);
+
+    /// @brief Creates a new response from the cached one.
+    ///
+    /// The response is unpacked from the cached wire data, which is also
+    /// written to its output buffer, so as it can be sent without being
+    /// packed again.
+    ///
+    /// @param entry Cached response.
+    /// @tparam PktType @c Pkt4 or @c Pkt6.
+    ///
+    /// @return Pointer to the new response or null pointer if the cached
+    /// one can't be unpacked.
+    template<typename PktType>
+    static boost::shared_ptr<PktType> makeResponse(const Entry& entry);
+
+    /// @brief Removes expired responses from the cache.
+    ///
+    /// @param now Current time.
+    void removeExpired(const boost::posix_time::ptime& now);
+
+    /// @brief Multi index container holding the cached responses.
+    ///
+    /// The responses are held in the order in which they have been added,
+    /// so the responses to expire first are at the front of the sequenced
+    /// index.
+    typedef boost::multi_index_container<
+        Entry,
+        boost::multi_index::indexed_by<
+            // Sequenced index #0 is used to remove expired responses.
+            boost::multi_index::sequenced<>,
+            // Hashed index #1 is used to find a response for the query.
+            boost::multi_index::hashed_unique<
+                boost::multi_index::member<Entry, Key, &Entry::key_>
+            >
+        >
+    > EntryContainer;
+
+    /// @brief Lifetime of the responses in milliseconds.
+    uint32_t ttl_;
+
+    /// @brief Maximum number of the responses held in the cache.
+    size_t max_entries_;
+
+    /// @brief Cached responses.
+    EntryContainer responses_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // RESPONSE_CACHE_H
@@ -32,6 +32,7 @@ SrvConfig::SrvConfig()
       cfg_host_operations6_(CfgHostOperations::createConfig6()),
       class_dictionary_(new ClientClassDictionary()),
       decline_timer_(0), echo_v4_client_id_(true), dhcp4o6_port_(0),
+      response_cache_ttl_(0), receive_queue_config_(), rate_limit_config_(),
       d2_client_config_(new D2ClientConfig()) {
 }
 
@@ -46,6 +47,7 @@ SrvConfig::SrvConfig(const uint32_t sequence)
       cfg_host_operations6_(CfgHostOperations::createConfig6()),
       class_dictionary_(new ClientClassDictionary()),
       decline_timer_(0), echo_v4_client_id_(true), dhcp4o6_port_(0),
+      response_cache_ttl_(0), receive_queue_config_(), rate_limit_config_(),
       d2_client_config_(new D2ClientConfig()) {
 }
 
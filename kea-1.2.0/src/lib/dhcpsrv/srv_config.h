@@ -8,6 +8,7 @@
 #define DHCPSRV_CONFIG_H
 
 #include <cc/cfg_to_element.h>
+#include <dhcp/packet_queue.h>
 #include <dhcpsrv/cfg_db_access.h>
 #include <dhcpsrv/cfg_duid.h>
 #include <dhcpsrv/cfg_expiration.h>
@@ -22,6 +23,7 @@
 #include <dhcpsrv/cfg_mac_source.h>
 #include <dhcpsrv/client_class_def.h>
 #include <dhcpsrv/d2_client_cfg.h>
+#include <dhcpsrv/rate_limiter.h>
 #include <dhcpsrv/logging_info.h>
 #include <hooks/hooks_config.h>
 #include <cc/data.h>
@@ -520,6 +522,57 @@ public:
         return (dhcp4o6_port_);
     }
 
+    /// @brief Sets the lifetime of the cached responses
+    ///
+    /// The server holds the responses sent to the clients for this period
+    /// of time and answers retransmitted queries with the cached responses
+    /// instead of processing them again. See @ref ResponseCache.
+    ///
+    /// @param ttl lifetime of the cached responses in milliseconds, 0
+    /// disables the cache
+    void setResponseCacheTTL(const uint32_t ttl) {
+        response_cache_ttl_ = ttl;
+    }
+
+    /// @brief Returns the lifetime of the cached responses
+    ///
+    /// See @ref setResponseCacheTTL for brief discussion.
+    /// @return lifetime of the cached responses in milliseconds
+    uint32_t getResponseCacheTTL() const {
+        return (response_cache_ttl_);
+    }
+
+    /// @brief Sets the configuration of the receive queue
+    ///
+    /// The server reads the received packets into this queue before
+    /// processing them and drops the packets it can't keep up with.
+    /// See @ref PacketQueue.
+    ///
+    /// @param config configuration of the receive queue
+    void setReceiveQueueConfig(const PacketQueueConfig& config) {
+        receive_queue_config_ = config;
+    }
+
+    /// @brief Returns the configuration of the receive queue
+    const PacketQueueConfig& getReceiveQueueConfig() const {
+        return (receive_queue_config_);
+    }
+
+    /// @brief Sets the configuration of the rate limiting
+    ///
+    /// The server drops the packets received from the clients and the
+    /// relays exceeding the configured rates. See @ref RateLimiter.
+    ///
+    /// @param config configuration of the rate limiting
+    void setRateLimitConfig(const RateLimitConfig& config) {
+        rate_limit_config_ = config;
+    }
+
+    /// @brief Returns the configuration of the rate limiting
+    const RateLimitConfig& getRateLimitConfig() const {
+        return (rate_limit_config_);
+    }
+
     /// @brief Returns pointer to the D2 client configuration
     D2ClientConfigPtr getD2ClientConfig() {
         return (d2_client_config_);
@@ -631,6 +684,15 @@ private:
     /// this socket is bound and connected to this port and port + 1
     uint16_t dhcp4o6_port_;
 
+    /// @brief Lifetime of the cached responses in milliseconds
+    uint32_t response_cache_ttl_;
+
+    /// @brief Configuration of the receive queue
+    PacketQueueConfig receive_queue_config_;
+
+    /// @brief Configuration of the rate limiting
+    RateLimitConfig rate_limit_config_;
+
     D2ClientConfigPtr d2_client_config_;
 };
 
@@ -27,19 +27,6 @@ prefixLessThanFirstAddress(const IOAddress& prefix, const PoolPtr& pool) {
     return (prefix < pool->getFirstAddress());
 }
 
-/// @brief Function used in calls to std::sort to compare first
-/// prefixes of the two pools.
-///
-/// @param pool1 First pool.
-/// @param pool2 Second pool.
-///
-/// @return true if first prefix of the first pool is smaller than
-/// the first address of the second pool.
-bool
-comparePoolFirstAddress(const PoolPtr& pool1, const PoolPtr& pool2) {
-    return (pool1->getFirstAddress() < pool2->getFirstAddress());
-};
-
 }
 
 namespace isc {
@@ -59,7 +46,8 @@ Subnet::Subnet(const isc::asiolink::IOAddress& prefix, uint8_t len,
      last_allocated_ia_(lastAddrInPrefix(prefix, len)),
      last_allocated_ta_(lastAddrInPrefix(prefix, len)),
      last_allocated_pd_(lastAddrInPrefix(prefix, len)), relay_(relay),
-     host_reservation_mode_(HR_ALL), cfg_option_(new CfgOption())
+     host_reservation_mode_(HR_ALL), cache_threshold_(0.0),
+     cfg_option_(new CfgOption())
       {
     if ((prefix.isV6() && len > 128) ||
         (prefix.isV4() && len > 32)) {
@@ -107,6 +95,16 @@ Subnet::allowClientClass(const isc::dhcp::ClientClass& class_name) {
     white_list_.insert(class_name);
 }
 
+void
+Subnet::setCacheThreshold(const double threshold) {
+    if ((threshold < 0.0) || (threshold >= 1.0)) {
+        isc_throw(BadValue, "invalid cache threshold " << threshold
+                  << " specified for subnet " << toText()
+                  << ", the value must be in the range of [0, 1)");
+    }
+    cache_threshold_ = threshold;
+}
+
 isc::asiolink::IOAddress Subnet::getLastAllocated(Lease::Type type) const {
     // check if the type is valid (and throw if it isn't)
     checkType(type);
@@ -259,32 +257,12 @@ const PoolPtr Subnet::getPool(Lease::Type type, const isc::asiolink::IOAddress&
     // check if the type is valid (and throw if it isn't)
     checkType(type);
 
-    const PoolCollection& pools = getPools(type);
-
-    PoolPtr candidate;
-
-    if (!pools.empty()) {
-        // Pools are sorted by their first prefixes. For example: 2001::,
-        // 2001::db8::, 3000:: etc. If our hint is 2001:db8:5:: we want to
-        // find the pool with the longest matching prefix, so: 2001:db8::,
-        // rather than 2001::. upper_bound returns the first pool with a prefix
-        // that is greater than 2001:db8:5::, i.e. 3000::. To find the longest
-        // matching prefix we use decrement operator to go back by one item.
-        // If returned iterator points to begin it means that prefixes in all
-        // pools are greater than out prefix, and thus there is no match.
-        PoolCollection::const_iterator ub =
-            std::upper_bound(pools.begin(), pools.end(), hint,
-                             prefixLessThanFirstAddress);
-
-        if (ub != pools.begin()) {
-            --ub;
-            if ((*ub)->inRange(hint)) {
-                candidate = *ub;
-            }
-        }
+    PoolPtr candidate = findPool(type, hint);
 
-        // If we don't find anything better, then let's just use the first pool
-        if (!candidate && anypool) {
+    // If we don't find anything better, then let's just use the first pool
+    if (!candidate && anypool) {
+        const PoolCollection& pools = getPools(type);
+        if (!pools.empty()) {
             candidate = *pools.begin();
         }
     }
@@ -293,6 +271,32 @@ const PoolPtr Subnet::getPool(Lease::Type type, const isc::asiolink::IOAddress&
     return (candidate);
 }
 
+PoolPtr
+Subnet::findPool(Lease::Type type, const isc::asiolink::IOAddress& addr) const {
+    const PoolCollection& pools = getPools(type);
+
+    // Pools are sorted by their first prefixes. For example: 2001::,
+    // 2001::db8::, 3000:: etc. If our hint is 2001:db8:5:: we want to
+    // find the pool with the longest matching prefix, so: 2001:db8::,
+    // rather than 2001::. upper_bound returns the first pool with a prefix
+    // that is greater than 2001:db8:5::, i.e. 3000::. To find the longest
+    // matching prefix we use decrement operator to go back by one item.
+    // If returned iterator points to begin it means that prefixes in all
+    // pools are greater than out prefix, and thus there is no match.
+    PoolCollection::const_iterator ub =
+        std::upper_bound(pools.begin(), pools.end(), addr,
+                         prefixLessThanFirstAddress);
+
+    if (ub != pools.begin()) {
+        --ub;
+        if ((*ub)->inRange(addr)) {
+            return (*ub);
+        }
+    }
+
+    return (PoolPtr());
+}
+
 void
 Subnet::addPool(const PoolPtr& pool) {
     // check if the type is valid (and throw if it isn't)
@@ -340,12 +344,13 @@ Subnet::addPool(const PoolPtr& pool) {
 
     PoolCollection& pools_writable = getPoolsWritable(pool->getType());
 
-    // Add the pool to the appropriate pools collection
-    pools_writable.push_back(pool);
-
-    // Sort pools by first address.
-    std::sort(pools_writable.begin(), pools_writable.end(),
-              comparePoolFirstAddress);
+    // Add the pool to the appropriate pools collection, keeping the pools
+    // sorted by first address.
+    pools_writable.insert(std::upper_bound(pools_writable.begin(),
+                                           pools_writable.end(),
+                                           pool->getFirstAddress(),
+                                           prefixLessThanFirstAddress),
+                          pool);
 }
 
 void
@@ -371,16 +376,8 @@ Subnet::inPool(Lease::Type type, const isc::asiolink::IOAddress& addr) const {
         return (false);
     }
 
-    const PoolCollection& pools = getPools(type);
-
-    for (PoolCollection::const_iterator pool = pools.begin();
-         pool != pools.end(); ++pool) {
-        if ((*pool)->inRange(addr)) {
-            return (true);
-        }
-    }
-    // There's no pool that address belongs to
-    return (false);
+    // There's no pool that address belongs to if none is found.
+    return (static_cast<bool>(findPool(type, addr)));
 }
 
 bool
@@ -79,6 +79,9 @@ public:
     /// is not always true. For the given example, 2001::1234:abcd would return
     /// true for inRange(), but false for inPool() check.
     ///
+    /// Just like @ref getPool, this method uses binary search to find the
+    /// pool the address may belong to.
+    ///
     /// @param type type of pools to iterate over
     /// @param addr this address will be checked if it belongs to any pools in
     ///        that subnet
@@ -342,6 +345,29 @@ public:
         host_reservation_mode_ = mode;
     }
 
+    /// @brief Returns the lease cache threshold.
+    ///
+    /// When a client renews a lease which is still unchanged and whose
+    /// remaining lifetime is above this fraction of the valid lifetime,
+    /// the allocation engine hands out the existing lease with the
+    /// remaining lifetime instead of extending it in the lease database.
+    /// The value of 0 (default) disables lease caching.
+    ///
+    /// @return cache threshold as a fraction of the valid lifetime.
+    double getCacheThreshold() const {
+        return (cache_threshold_);
+    }
+
+    /// @brief Sets the lease cache threshold.
+    ///
+    /// See @ref getCacheThreshold for details.
+    ///
+    /// @param threshold fraction of the valid lifetime, which must be in
+    /// the range of [0, 1). The value of 0 disables lease caching.
+    ///
+    /// @throw BadValue if the threshold is out of range.
+    void setCacheThreshold(const double threshold);
+
 protected:
     /// @brief Returns all pools (non-const variant)
     ///
@@ -428,6 +454,21 @@ protected:
     /// type.
     bool poolOverlaps(const Lease::Type& pool_type, const PoolPtr& pool) const;
 
+    /// @brief Returns the pool the specified address belongs to.
+    ///
+    /// The pools of each type are sorted by their first addresses and they
+    /// don't overlap, so the only pool which may contain the address is
+    /// the last one starting at or before it. It is found using binary
+    /// search.
+    ///
+    /// @param type Pool type.
+    /// @param addr Address the pool is looked for.
+    ///
+    /// @return Pointer to the pool or null pointer if there is no pool of the
+    /// specified type the address belongs to.
+    PoolPtr findPool(Lease::Type type,
+                     const isc::asiolink::IOAddress& addr) const;
+
     /// @brief subnet-id
     ///
     /// Subnet-id is a unique value that can be used to find or identify
@@ -435,6 +476,10 @@ protected:
     SubnetID id_;
 
     /// @brief collection of IPv4 or non-temporary IPv6 pools in that subnet
+    ///
+    /// This and the other pool collections are kept sorted by the first
+    /// addresses of the pools, so as the pools can be looked up by address
+    /// using binary search (see @ref findPool).
     PoolCollection pools_;
 
     /// @brief collection of IPv6 temporary address pools in that subnet
@@ -506,6 +551,11 @@ protected:
     ///
     /// See @ref HRMode type for details.
     HRMode host_reservation_mode_;
+
+    /// @brief Lease cache threshold.
+    ///
+    /// See @ref getCacheThreshold for details.
+    double cache_threshold_;
 private:
 
     /// @brief Pointer to the option data configuration for this subnet.
@@ -318,6 +318,62 @@ TEST_F(AllocEngine4Test, simpleRenew4) {
     EXPECT_TRUE(testStatistics("assigned-addresses", 1, subnet_->getID()));
 }
 
+// This test checks that the existing lease is handed out without being
+// extended in the lease database when the client renews early and the
+// lease cache threshold is set for the subnet.
+TEST_F(AllocEngine4Test, renewReuseLease4) {
+    boost::scoped_ptr<AllocEngine> engine;
+    ASSERT_NO_THROW(engine.reset(new AllocEngine(AllocEngine::ALLOC_ITERATIVE,
+                                                 100, false)));
+    ASSERT_TRUE(engine);
+
+    // The valid lifetime for the subnet is 3 seconds. The lease is reused
+    // if more than 0.9 seconds of its lifetime remain.
+    subnet_->setCacheThreshold(0.3);
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_, IOAddress("0.0.0.0"),
+                                    false, true, "somehost.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+
+    Lease4Ptr lease = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(0, lease->reuseable_valid_lft_);
+
+    // Pretend that the lease was allocated a second ago.
+    time_t lease_cltt = lease->cltt_ - 1;
+    lease->cltt_ = lease_cltt;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+
+    // Renew the lease. Nothing but the lifetime would change so the
+    // existing lease should be returned.
+    Lease4Ptr lease2 = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ(lease->addr_, lease2->addr_);
+    EXPECT_EQ(lease_cltt, lease2->cltt_);
+    EXPECT_GT(lease2->reuseable_valid_lft_, 0);
+    EXPECT_LT(lease2->reuseable_valid_lft_, lease2->valid_lft_);
+
+    // The lease in the database should not have been updated.
+    Lease4Ptr from_mgr = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ(lease_cltt, from_mgr->cltt_);
+
+    // Should NOT have bumped assigned-addresses
+    EXPECT_TRUE(testStatistics("assigned-addresses", 1, subnet_->getID()));
+
+    // If the client's data changes, the lease must be extended.
+    ctx.hostname_ = "otherhost.example.com.";
+    Lease4Ptr lease3 = engine->allocateLease4(ctx);
+    ASSERT_TRUE(lease3);
+    EXPECT_EQ(0, lease3->reuseable_valid_lft_);
+    EXPECT_GT(lease3->cltt_, lease_cltt);
+
+    from_mgr = LeaseMgrFactory::instance().getLease4(lease->addr_);
+    ASSERT_TRUE(from_mgr);
+    EXPECT_EQ("otherhost.example.com.", from_mgr->hostname_);
+    EXPECT_GT(from_mgr->cltt_, lease_cltt);
+}
+
 // This test verifies that the allocator picks addresses that belong to the
 // pool
 TEST_F(AllocEngine4Test, IterativeAllocator) {
@@ -706,6 +706,48 @@ TEST_F(AllocEngine6Test, renewExtendLeaseLifetime) {
         << "Lease lifetime was not extended, but it should";
 }
 
+// Checks that the existing lease is handed out without being extended
+// when the client sends the Renew early and the lease cache threshold
+// is set for the subnet.
+TEST_F(AllocEngine6Test, renewReuseLeaseWithinCacheThreshold) {
+    // The lease is reused if more than 100 seconds of its lifetime remain.
+    subnet_->setCacheThreshold(0.25);
+
+    // Create a lease for the client.
+    Lease6Ptr lease(new Lease6(Lease::TYPE_NA, IOAddress("2001:db8:1::15"),
+                               duid_, iaid_, 300, 400, 100, 200,
+                               subnet_->getID(), HWAddrPtr(), 128));
+
+    // Allocated 200 seconds ago - half of the lifetime.
+    time_t lease_cltt = time(NULL) - 200;
+    lease->cltt_ = lease_cltt;
+
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 100);
+
+    // This is what the client will send in his renew message.
+    AllocEngine::HintContainer hints;
+    hints.push_back(make_pair(IOAddress("2001:db8:1::15"), 128));
+
+    // Client should receive a lease.
+    Lease6Collection renewed = renewTest(engine, pool_, hints, true);
+    ASSERT_EQ(1, renewed.size());
+
+    // The lease lifetime should not be extended. The client gets the
+    // remaining lifetime instead.
+    EXPECT_EQ(lease_cltt, renewed[0]->cltt_);
+    EXPECT_LE(renewed[0]->reuseable_valid_lft_, 200);
+    EXPECT_GE(renewed[0]->reuseable_valid_lft_, 190);
+
+    // Half of the lifetime is no longer above the threshold of 75%.
+    subnet_->setCacheThreshold(0.75);
+    renewed = renewTest(engine, pool_, hints, true);
+    ASSERT_EQ(1, renewed.size());
+    EXPECT_GT(renewed[0]->cltt_, lease_cltt);
+    EXPECT_EQ(0, renewed[0]->reuseable_valid_lft_);
+}
+
 // Checks if the lease lifetime is extended when the client sends the
 // Renew and the client has a reservation for the lease.
 TEST_F(AllocEngine6Test, renewExtendLeaseLifetimeForReservation) {
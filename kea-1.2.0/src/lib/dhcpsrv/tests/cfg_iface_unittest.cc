@@ -358,6 +358,15 @@ TEST_F(CfgIfaceTest, equality) {
     cfg2.useSocketType(AF_INET, "udp");
     EXPECT_TRUE(cfg1 == cfg2);
     EXPECT_FALSE(cfg1 != cfg2);
+
+    // Differ by the use of the receive ring.
+    cfg1.useReceiveRing(AF_INET, true);
+    EXPECT_FALSE(cfg1 == cfg2);
+    EXPECT_TRUE(cfg1 != cfg2);
+
+    cfg2.useReceiveRing(AF_INET, true);
+    EXPECT_TRUE(cfg1 == cfg2);
+    EXPECT_FALSE(cfg1 != cfg2);
 }
 
 // This test verifies that it is possible to unparse the interface config.
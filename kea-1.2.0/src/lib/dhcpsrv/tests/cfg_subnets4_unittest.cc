@@ -452,6 +452,7 @@ TEST(CfgSubnets4Test, unparseSubnet) {
     subnet2->setIface("lo");
     subnet2->setRelayInfo(IOAddress("10.0.0.1"));
     subnet3->setIface("eth1");
+    subnet3->setCacheThreshold(0.25);
 
     cfg.add(subnet1);
     cfg.add(subnet2);
@@ -506,6 +507,7 @@ TEST(CfgSubnets4Test, unparseSubnet) {
         "    \"4o6-interface-id\": \"\",\n"
         "    \"4o6-subnet\": \"\",\n"
         "    \"reservation-mode\": \"all\",\n"
+        "    \"cache-threshold\": 0.25,\n"
         "    \"option-data\": [ ],\n"
         "    \"pools\": [ ]\n"
         "} ]\n";
@@ -177,6 +177,8 @@ private:
     /// @return true if the value of the parameter should be quoted.
      bool quoteValue(const std::string& parameter) const {
          return ((parameter != "persist") && (parameter != "lfc-interval") &&
+                 (parameter != "load-threads") &&
+                 (parameter != "lfc-max-leases") &&
                  (parameter != "connect-timeout") &&
                  (parameter != "port") &&
                  (parameter != "readonly"));
@@ -353,6 +355,74 @@ TEST_F(DbAccessParserTest, largeLFCInterval) {
     EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
 }
 
+// This test checks that the parser accepts the valid value of the
+// load-threads parameter.
+TEST_F(DbAccessParserTest, validLoadThreads) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases6.csv",
+                            "load-threads", "4",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid load threads", parser.getDbAccessParameters(),
+                      config);
+}
+
+// This test checks that the parser rejects the zero value of the
+// load-threads parameter.
+TEST_F(DbAccessParserTest, zeroLoadThreads) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases6.csv",
+                            "load-threads", "0",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
+// This test checks that the parser accepts the valid value of the
+// lfc-max-leases parameter.
+TEST_F(DbAccessParserTest, validLFCMaxLeases) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases6.csv",
+                            "lfc-max-leases", "100000",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid LFC max leases", parser.getDbAccessParameters(),
+                      config);
+}
+
+// This test checks that the parser rejects the negative value of the
+// lfc-max-leases parameter.
+TEST_F(DbAccessParserTest, negativeLFCMaxLeases) {
+    const char* config[] = {"type", "memfile",
+                            "name", "/opt/kea/var/kea-leases6.csv",
+                            "lfc-max-leases", "-1",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
 // This test checks that the parser accepts the valid value of the
 // timeout parameter.
 TEST_F(DbAccessParserTest, validTimeout) {
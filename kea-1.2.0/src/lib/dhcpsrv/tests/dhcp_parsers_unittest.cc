@@ -318,6 +318,83 @@ TEST_F(DhcpParserTest, MacSourcesDuplicate) {
     EXPECT_THROW(parser.parse(sources, values), DhcpConfigError);
 }
 
+/// Verifies the code that parses receive-queue structure.
+TEST_F(DhcpParserTest, ReceiveQueue) {
+    SrvConfig cfg;
+
+    // The queue is disabled by default.
+    EXPECT_EQ(0, cfg.getReceiveQueueConfig().capacity_);
+
+    ReceiveQueueParser parser;
+    ElementPtr values = Element::fromJSON("{ \"capacity\": 256,"
+                                          "  \"drop-policy\": \"drop-discovery\","
+                                          "  \"max-age\": 1500 }");
+    ASSERT_NO_THROW(parser.parse(cfg, values));
+    EXPECT_EQ(256, cfg.getReceiveQueueConfig().capacity_);
+    EXPECT_EQ(PacketQueueConfig::DROP_DISCOVERY,
+              cfg.getReceiveQueueConfig().policy_);
+    EXPECT_EQ(1500, cfg.getReceiveQueueConfig().max_age_);
+
+    // Unspecified parameters take their default values.
+    values = Element::fromJSON("{ \"capacity\": 128 }");
+    ASSERT_NO_THROW(parser.parse(cfg, values));
+    EXPECT_EQ(128, cfg.getReceiveQueueConfig().capacity_);
+    EXPECT_EQ(PacketQueueConfig::DROP_OLDEST,
+              cfg.getReceiveQueueConfig().policy_);
+    EXPECT_EQ(0, cfg.getReceiveQueueConfig().max_age_);
+
+    // Bogus values are rejected.
+    values = Element::fromJSON("{ \"drop-policy\": \"drop-all\" }");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+    values = Element::fromJSON("{ \"capacity\": -1 }");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+    values = Element::fromJSON("{ \"size\": 10 }");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+    values = Element::fromJSON("[ 10 ]");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+}
+
+/// Verifies the code that parses rate-limit structure.
+TEST_F(DhcpParserTest, RateLimit) {
+    SrvConfig cfg;
+
+    // The rate limiting is disabled by default.
+    EXPECT_FALSE(cfg.getRateLimitConfig().enabled());
+
+    RateLimitParser parser;
+    ElementPtr values = Element::fromJSON("{ \"client-rate\": 10,"
+                                          "  \"client-burst\": 20,"
+                                          "  \"relay-rate\": 1000,"
+                                          "  \"relay-burst\": 2000,"
+                                          "  \"max-sources\": 1024 }");
+    ASSERT_NO_THROW(parser.parse(cfg, values));
+    EXPECT_TRUE(cfg.getRateLimitConfig().enabled());
+    EXPECT_EQ(10, cfg.getRateLimitConfig().client_rate_);
+    EXPECT_EQ(20, cfg.getRateLimitConfig().client_burst_);
+    EXPECT_EQ(1000, cfg.getRateLimitConfig().relay_rate_);
+    EXPECT_EQ(2000, cfg.getRateLimitConfig().relay_burst_);
+    EXPECT_EQ(1024, cfg.getRateLimitConfig().max_sources_);
+
+    // Unspecified parameters take their default values.
+    values = Element::fromJSON("{ \"relay-rate\": 500 }");
+    ASSERT_NO_THROW(parser.parse(cfg, values));
+    EXPECT_EQ(0, cfg.getRateLimitConfig().client_rate_);
+    EXPECT_EQ(500, cfg.getRateLimitConfig().relay_rate_);
+    EXPECT_EQ(0, cfg.getRateLimitConfig().relay_burst_);
+    EXPECT_EQ(RateLimitConfig::DEFAULT_MAX_SOURCES,
+              cfg.getRateLimitConfig().max_sources_);
+
+    // Bogus values are rejected.
+    values = Element::fromJSON("{ \"client-rate\": -1 }");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+    values = Element::fromJSON("{ \"max-sources\": 0 }");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+    values = Element::fromJSON("{ \"rate\": 10 }");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+    values = Element::fromJSON("10");
+    EXPECT_THROW(parser.parse(cfg, values), DhcpConfigError);
+}
+
 
 /// @brief Test Fixture class which provides basic structure for testing
 /// configuration parsing.  This is essentially the same structure provided
@@ -1995,6 +1995,106 @@ GenericLeaseMgrTest::testDeleteExpiredReclaimedLeases4() {
     }
 }
 
+void
+GenericLeaseMgrTest::testGetSubnetLeases4() {
+    // Get the leases to be used for the test.
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_GE(leases.size(), 6);
+
+    // Put the leases with even indexes in the subnet 1 and the remaining
+    // ones in the subnet 2. Add them in the reverse order to make sure that
+    // they are returned ordered by address rather than by insertion.
+    for (int i = static_cast<int>(leases.size()) - 1; i >= 0; --i) {
+        leases[i]->subnet_id_ = (i % 2 == 0 ? 1 : 2);
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Retrieve all leases of the subnet 1.
+    Lease4Collection page;
+    ASSERT_NO_THROW(page = lmptr_->getSubnetLeases4(1, IOAddress("0.0.0.0"), 0));
+    ASSERT_EQ(leases.size() / 2, page.size());
+    for (size_t i = 0; i < page.size(); ++i) {
+        EXPECT_EQ(leases[2 * i]->addr_, page[i]->addr_);
+        EXPECT_EQ(1, page[i]->subnet_id_);
+    }
+
+    // Walk the leases of the subnet 2 in pages of 3 leases, starting each
+    // page after the last address of the previous one.
+    vector<IOAddress> walked;
+    IOAddress last("0.0.0.0");
+    for (;;) {
+        ASSERT_NO_THROW(page = lmptr_->getSubnetLeases4(2, last, 3));
+        if (page.empty()) {
+            break;
+        }
+        ASSERT_LE(page.size(), 3);
+        for (size_t i = 0; i < page.size(); ++i) {
+            EXPECT_EQ(2, page[i]->subnet_id_);
+            walked.push_back(page[i]->addr_);
+        }
+        last = page.back()->addr_;
+        ASSERT_LE(walked.size(), leases.size());
+    }
+    ASSERT_EQ(leases.size() / 2, walked.size());
+    for (size_t i = 0; i < walked.size(); ++i) {
+        EXPECT_EQ(leases[2 * i + 1]->addr_, walked[i]);
+    }
+
+    // There are no leases in the other subnets.
+    ASSERT_NO_THROW(page = lmptr_->getSubnetLeases4(123, IOAddress("0.0.0.0"), 0));
+    EXPECT_TRUE(page.empty());
+}
+
+void
+GenericLeaseMgrTest::testGetSubnetLeases6() {
+    // Get the leases to be used for the test.
+    vector<Lease6Ptr> leases = createLeases6();
+    ASSERT_GE(leases.size(), 6);
+
+    // Put the leases with even indexes in the subnet 1 and the remaining
+    // ones in the subnet 2. Add them in the reverse order to make sure that
+    // they are returned ordered by address rather than by insertion.
+    for (int i = static_cast<int>(leases.size()) - 1; i >= 0; --i) {
+        leases[i]->subnet_id_ = (i % 2 == 0 ? 1 : 2);
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Retrieve all leases of the subnet 1.
+    Lease6Collection page;
+    ASSERT_NO_THROW(page = lmptr_->getSubnetLeases6(1, IOAddress("::"), 0));
+    ASSERT_EQ(leases.size() / 2, page.size());
+    for (size_t i = 0; i < page.size(); ++i) {
+        EXPECT_EQ(leases[2 * i]->addr_, page[i]->addr_);
+        EXPECT_EQ(1, page[i]->subnet_id_);
+    }
+
+    // Walk the leases of the subnet 2 in pages of 3 leases, starting each
+    // page after the last address of the previous one.
+    vector<IOAddress> walked;
+    IOAddress last("::");
+    for (;;) {
+        ASSERT_NO_THROW(page = lmptr_->getSubnetLeases6(2, last, 3));
+        if (page.empty()) {
+            break;
+        }
+        ASSERT_LE(page.size(), 3);
+        for (size_t i = 0; i < page.size(); ++i) {
+            EXPECT_EQ(2, page[i]->subnet_id_);
+            walked.push_back(page[i]->addr_);
+        }
+        last = page.back()->addr_;
+        ASSERT_LE(walked.size(), leases.size());
+    }
+    ASSERT_EQ(leases.size() / 2, walked.size());
+    for (size_t i = 0; i < walked.size(); ++i) {
+        EXPECT_EQ(leases[2 * i + 1]->addr_, walked[i]);
+    }
+
+    // There are no leases in the other subnets.
+    ASSERT_NO_THROW(page = lmptr_->getSubnetLeases6(123, IOAddress("::"), 0));
+    EXPECT_TRUE(page.empty());
+}
+
 void
 GenericLeaseMgrTest::testDeleteExpiredReclaimedLeases6() {
     // Get the leases to be used for the test.
@@ -344,6 +344,24 @@ public:
     ///   expired
     void testGetDeclinedLeases6();
 
+    /// @brief Checks that the DHCPv4 leases of a subnet can be retrieved
+    /// in pages.
+    ///
+    /// This test checks the following:
+    /// - only the leases of the specified subnet are returned
+    /// - leases are returned in the ascending order of addresses
+    /// - walking the subnet in pages returns all of its leases once.
+    void testGetSubnetLeases4();
+
+    /// @brief Checks that the DHCPv6 leases of a subnet can be retrieved
+    /// in pages.
+    ///
+    /// This test checks the following:
+    /// - only the leases of the specified subnet are returned
+    /// - leases are returned in the ascending order of addresses
+    /// - walking the subnet in pages returns all of its leases once.
+    void testGetSubnetLeases6();
+
     /// @brief Checks that selected expired-reclaimed IPv6 leases
     /// are removed.
     ///
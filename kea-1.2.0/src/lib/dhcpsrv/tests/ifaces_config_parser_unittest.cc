@@ -172,4 +172,37 @@ TEST_F(IfacesConfigParserTest, socketTypeInvalid) {
     ASSERT_THROW(parser6.parse(cfg_iface, config_element), DhcpConfigError);
 }
 
+// This test verifies that the receive ring can be enabled for DHCPv4.
+TEST_F(IfacesConfigParserTest, receiveRing) {
+    // The ring is disabled by default.
+    CfgIface cfg_ref;
+    EXPECT_FALSE(cfg_ref.getReceiveRing());
+
+    std::string config = "{ \"interfaces\": [ ],"
+        " \"receive-ring\": true }";
+    ElementPtr config_element = Element::fromJSON(config);
+
+    IfacesConfigParser parser4(AF_INET);
+    CfgIfacePtr cfg_iface = CfgMgr::instance().getStagingCfg()->getCfgIface();
+    ASSERT_TRUE(cfg_iface);
+    ASSERT_NO_THROW(parser4.parse(cfg_iface, config_element));
+    EXPECT_TRUE(cfg_iface->getReceiveRing());
+
+    // Check it can be unparsed.
+    runToElementTest<CfgIface>(config, *cfg_iface);
+
+    // The value must be a boolean.
+    config = "{ \"interfaces\": [ ],"
+        " \"receive-ring\": \"yes\" }";
+    config_element = Element::fromJSON(config);
+    EXPECT_THROW(parser4.parse(cfg_iface, config_element), DhcpConfigError);
+
+    // DHCPv6 doesn't use raw sockets.
+    IfacesConfigParser parser6(AF_INET6);
+    config = "{ \"interfaces\": [ ],"
+        " \"receive-ring\": true }";
+    config_element = Element::fromJSON(config);
+    EXPECT_THROW(parser6.parse(cfg_iface, config_element), DhcpConfigError);
+}
+
 } // end of anonymous namespace
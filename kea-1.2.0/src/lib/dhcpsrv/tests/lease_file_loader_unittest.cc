@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace isc;
 using namespace isc::asiolink;
@@ -531,4 +532,258 @@ TEST_F(LeaseFileLoaderTest, loadWriteLeaseWithZeroLifetime) {
     checkStats(*lf, 0, 0, 0, 1, 1, 0);
     }
 }
+
+// This test verifies that the large DHCPv4 lease file is loaded by several
+// threads with the same result as by a single thread, including the
+// removed leases and the corrupted entries.
+TEST_F(LeaseFileLoaderTest, loadThreads4) {
+    // Create a file of several batches of rows. Each lease is written
+    // twice and every seventh lease is then removed. Every thousandth
+    // entry lacks the HW address and is invalid.
+    std::ostringstream s;
+    s << v4_hdr_;
+    size_t invalid = 0;
+    for (unsigned int i = 0; i < 6000; ++i) {
+        const std::string address = IOAddress(0x0a000000 + i).toText();
+        s << address << ",06:07:08:09:" << std::hex << (i / 256) << ":"
+          << (i % 256) << std::dec << ",,200,200,8,1,1,,1\n";
+        if (i % 1000 == 0) {
+            s << address << ",,,200,300,8,1,1,,0\n";
+            ++invalid;
+        }
+        if (i % 7 == 0) {
+            s << address << ",06:07:08:09:0a:bc,,0,400,8,1,1,,1\n";
+        }
+    }
+    for (unsigned int i = 0; i < 6000; ++i) {
+        s << IOAddress(0x0a000000 + i).toText()
+          << ",06:07:08:09:0a:bd,,200," << (500 + i) << ",8,1,1,,1\n";
+    }
+    io_.writeFile(s.str());
+
+    // Load the file by a single thread.
+    boost::scoped_ptr<CSVLeaseFile4> lf(new CSVLeaseFile4(filename_));
+    Lease4Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(*lf, storage, 10));
+    const uint32_t reads = lf->getReads();
+    EXPECT_EQ(invalid, lf->getReadErrs());
+    EXPECT_EQ(reads - invalid - 1, lf->getReadLeases());
+
+    // And by several threads.
+    Lease4Storage storage_threads;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(*lf, storage_threads, 10,
+                                                  true, 2));
+    {
+    SCOPED_TRACE("Read leases");
+    checkStats(*lf, reads, reads - invalid - 1, invalid, 0, 0, 0);
+    }
+
+    // All leases are added back by the second round of entries.
+    ASSERT_EQ(6000, storage_threads.size());
+    Lease4Ptr lease = getLease<Lease4Ptr>("10.0.23.111", storage_threads);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(5999 + 500 - 200, lease->cltt_);
+
+    // Both storages hold the same leases.
+    lf->close();
+    io_.removeFile();
+    LeaseFileLoader::write<Lease4>(*lf, storage);
+    const std::string expected = io_.readFile();
+    io_.removeFile();
+    writeLeases<Lease4, CSVLeaseFile4, Lease4Storage>(*lf, storage_threads,
+                                                      expected);
+}
+
+// This test verifies that the large DHCPv6 lease file is loaded by several
+// threads with the same result as by a single thread.
+TEST_F(LeaseFileLoaderTest, loadThreads6) {
+    // Every other lease is removed by the last entry of the file.
+    std::ostringstream s;
+    s << v6_hdr_;
+    for (unsigned int i = 0; i < 10000; ++i) {
+        s << "2001:db8:1::" << std::hex << i << std::dec
+          << ",00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200," << (200 + i)
+          << ",8,100,0,7,0,1,1,,,1\n";
+    }
+    for (unsigned int i = 0; i < 10000; i += 2) {
+        s << "2001:db8:1::" << std::hex << i << std::dec
+          << ",00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,0,300,8,100,0,7,0,1,1,"
+          << ",,1\n";
+    }
+    io_.writeFile(s.str());
+
+    boost::scoped_ptr<CSVLeaseFile6> lf(new CSVLeaseFile6(filename_));
+    Lease6Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease6>(*lf, storage, 0, true, 4));
+    {
+    SCOPED_TRACE("Read leases");
+    checkStats(*lf, 15001, 15000, 0, 0, 0, 0);
+    }
+
+    ASSERT_EQ(5000, storage.size());
+    EXPECT_FALSE(getLease<Lease6Ptr>("2001:db8:1::2", storage));
+    Lease6Ptr lease = getLease<Lease6Ptr>("2001:db8:1::270f", storage);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(9999, lease->cltt_);
+}
+
+// This test verifies that loading the lease file by several threads
+// stops when the maximum number of errors is exceeded.
+TEST_F(LeaseFileLoaderTest, loadThreadsMaxErrors) {
+    std::ostringstream s;
+    s << v4_hdr_;
+    for (unsigned int i = 0; i < 10000; ++i) {
+        s << IOAddress(0x0a000000 + i).toText()
+          << ((i % 100 == 0) ? ",," : ",06:07:08:09:0a:bc,")
+          << ",200,200,8,1,1,,0\n";
+    }
+    io_.writeFile(s.str());
+
+    boost::scoped_ptr<CSVLeaseFile4> lf(new CSVLeaseFile4(filename_));
+    Lease4Storage storage;
+    EXPECT_THROW(LeaseFileLoader::load<Lease4>(*lf, storage, 99, true, 3),
+                 util::CSVFileError);
+
+    storage.clear();
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(*lf, storage, 100, true, 3));
+    {
+    SCOPED_TRACE("Read leases");
+    checkStats(*lf, 10001, 9900, 100, 0, 0, 0);
+    }
+    EXPECT_EQ(9900, storage.size());
+}
+
+// This test verifies that a lease file much smaller than a batch is
+// loaded correctly when many threads are allowed.
+TEST_F(LeaseFileLoaderTest, loadThreadsSmallFile) {
+    io_.writeFile(v4_hdr_ +
+                  "192.0.2.1,06:07:08:09:0a:bc,,200,200,8,1,1,,0\n"
+                  "192.0.2.2,,,200,200,8,1,1,,0\n"
+                  "192.0.2.3,06:07:08:09:0a:bd,,200,200,8,1,1,,0\n");
+
+    boost::scoped_ptr<CSVLeaseFile4> lf(new CSVLeaseFile4(filename_));
+    Lease4Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(*lf, storage, 10, true,
+                                                  64));
+    {
+    SCOPED_TRACE("Read leases");
+    checkStats(*lf, 4, 2, 1, 0, 0, 0);
+    }
+    EXPECT_EQ(2, storage.size());
+    EXPECT_TRUE(getLease<Lease4Ptr>("192.0.2.1", storage));
+    EXPECT_TRUE(getLease<Lease4Ptr>("192.0.2.3", storage));
+}
+
+// This test verifies that the DHCPv4 leases loaded into the sorted runs
+// are written the same way as the leases loaded into memory.
+TEST_F(LeaseFileLoaderTest, loadWriteRuns4) {
+    // Each lease is written twice and every seventh lease is removed by
+    // its second entry.
+    std::ostringstream s;
+    s << v4_hdr_;
+    for (unsigned int i = 0; i < 3000; ++i) {
+        s << IOAddress(0x0a000000 + (i * 7919) % 3000).toText()
+          << ",06:07:08:09:0a:bc,,200,200,8,1,1,,1\n";
+    }
+    for (unsigned int i = 0; i < 3000; ++i) {
+        s << IOAddress(0x0a000000 + i).toText() << ",06:07:08:09:0a:bd,,"
+          << ((i % 7 == 0) ? 0 : 200) << ",300,8,1,1,,1\n";
+    }
+    io_.writeFile(s.str());
+
+    boost::scoped_ptr<CSVLeaseFile4> lf(new CSVLeaseFile4(filename_));
+    Lease4Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease4>(*lf, storage));
+
+    // Load the leases into the runs of at most 1000 leases.
+    Lease4Storage held;
+    std::vector<std::string> runs;
+    const std::string run_prefix = absolutePath("leases4.csv.output");
+    ASSERT_NO_THROW(LeaseFileLoader::loadRuns<Lease4>(*lf, held, runs,
+                                                      run_prefix, 1000,
+                                                      0, 2));
+    {
+    SCOPED_TRACE("Read leases");
+    checkStats(*lf, 6001, 6000, 0, 0, 0, 0);
+    }
+    ASSERT_EQ(6, runs.size());
+    EXPECT_EQ(run_prefix + ".run1", runs[0]);
+    EXPECT_TRUE(held.empty());
+
+    // Write both into the lease files and compare them.
+    lf->close();
+    io_.removeFile();
+    LeaseFileLoader::write<Lease4>(*lf, storage);
+    const std::string expected = io_.readFile();
+
+    LeaseFileIO output(run_prefix);
+    CSVLeaseFile4 lf_output(run_prefix);
+    ASSERT_NO_THROW(LeaseFileLoader::writeRuns<Lease4>(lf_output, held,
+                                                       runs));
+    EXPECT_EQ(expected, output.readFile());
+    {
+    SCOPED_TRACE("Written leases");
+    checkStats(lf_output, 0, 0, 0, storage.size(), storage.size(), 0);
+    }
+
+    LeaseFileLoader::removeRuns(runs);
+    EXPECT_FALSE(LeaseFileIO(runs[0], false).exists());
+}
+
+// This test verifies that the DHCPv6 leases removed by a lease file are
+// removed from the runs written for the previous lease file.
+TEST_F(LeaseFileLoaderTest, loadWriteRuns6) {
+    std::ostringstream s;
+    s << v6_hdr_;
+    for (unsigned int i = 0; i < 100; ++i) {
+        s << "2001:db8:1::" << std::hex << i << std::dec
+          << ",00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200," << (200 + i)
+          << ",8,100,0,7,0,1,1,,,1\n";
+    }
+    io_.writeFile(s.str());
+
+    Lease6Storage held;
+    std::vector<std::string> runs;
+    const std::string run_prefix = absolutePath("leases6.csv.output");
+    CSVLeaseFile6 lf_prev(filename_);
+    ASSERT_NO_THROW(LeaseFileLoader::loadRuns<Lease6>(lf_prev, held, runs,
+                                                      run_prefix, 30));
+    EXPECT_EQ(3, runs.size());
+    EXPECT_EQ(10, held.size());
+
+    // The second file removes every other lease and updates the last one.
+    s.str("");
+    s << v6_hdr_;
+    for (unsigned int i = 0; i < 100; i += 2) {
+        s << "2001:db8:1::" << std::hex << i << std::dec
+          << ",00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,0,300"
+          << ",8,100,0,7,0,1,1,,,1\n";
+    }
+    s << "2001:db8:1::63,00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f,200,1000"
+      << ",8,100,0,7,0,1,1,,,1\n";
+    io_.writeFile(s.str());
+
+    CSVLeaseFile6 lf_copy(filename_);
+    ASSERT_NO_THROW(LeaseFileLoader::loadRuns<Lease6>(lf_copy, held, runs,
+                                                      run_prefix, 30));
+    EXPECT_EQ(5, runs.size());
+
+    LeaseFileIO output(run_prefix);
+    CSVLeaseFile6 lf_output(run_prefix);
+    ASSERT_NO_THROW(LeaseFileLoader::writeRuns<Lease6>(lf_output, held,
+                                                       runs));
+    LeaseFileLoader::removeRuns(runs);
+
+    // Only the leases with odd addresses are left.
+    Lease6Storage storage;
+    ASSERT_NO_THROW(LeaseFileLoader::load<Lease6>(lf_output, storage));
+    EXPECT_EQ(50, storage.size());
+    EXPECT_FALSE(getLease<Lease6Ptr>("2001:db8:1::2", storage));
+    Lease6Ptr lease = getLease<Lease6Ptr>("2001:db8:1::3", storage);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(3, lease->cltt_);
+    lease = getLease<Lease6Ptr>("2001:db8:1::63", storage);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(800, lease->cltt_);
+}
 } // end of anonymous namespace
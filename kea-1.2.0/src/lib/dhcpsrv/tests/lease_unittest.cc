@@ -6,6 +6,7 @@
 
 #include <config.h>
 #include <asiolink/io_address.h>
+#include <cc/data.h>
 #include <dhcp/duid.h>
 #include <dhcpsrv/lease.h>
 #include <util/pointer_util.h>
@@ -15,6 +16,7 @@
 
 using namespace isc;
 using namespace isc::asiolink;
+using namespace isc::data;
 using namespace isc::dhcp;
 
 namespace {
@@ -423,6 +425,32 @@ TEST_F(Lease4Test, toText) {
     EXPECT_EQ(expected.str(), lease.toText());
 }
 
+// Verify that toElement() method reports Lease4 structure properly.
+TEST_F(Lease4Test, toElement) {
+
+    const time_t current_time = 12345678;
+    Lease4 lease(IOAddress("192.0.2.3"), hwaddr_, clientid_, 3600, 123,
+                 456, current_time, 789, true, false, "myhost.example.com.");
+
+    std::string expected = "{ \"ip-address\": \"192.0.2.3\","
+        " \"subnet-id\": 789,"
+        " \"hw-address\": \"" + hwaddr_->toText(false) + "\","
+        " \"client-id\": \"" + clientid_->toText() + "\","
+        " \"cltt\": 12345678, \"valid-lft\": 3600,"
+        " \"fqdn-fwd\": true, \"fqdn-rev\": false,"
+        " \"hostname\": \"myhost.example.com.\", \"state\": \"default\" }";
+    EXPECT_TRUE(Element::fromJSON(expected)->equals(*lease.toElement()))
+        << lease.toElement()->str();
+
+    // The hardware address and client identifier are omitted when the
+    // lease doesn't have them.
+    lease.hwaddr_.reset();
+    lease.client_id_.reset();
+    ElementPtr map = lease.toElement();
+    EXPECT_FALSE(map->contains("hw-address"));
+    EXPECT_FALSE(map->contains("client-id"));
+}
+
 // Verify that decline() method properly clears up specific fields.
 TEST_F(Lease4Test, decline) {
 
@@ -848,6 +876,39 @@ TEST(Lease6Test, toText) {
     EXPECT_EQ(expected.str(), lease.toText());
 }
 
+// Verify that toElement() method reports Lease6 structure properly.
+TEST(Lease6Test, toElement) {
+
+    HWAddrPtr hwaddr(new HWAddr(HWADDR, sizeof(HWADDR), HTYPE_ETHER));
+
+    uint8_t llt[] = {0, 1, 2, 3, 4, 5, 6, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf};
+    DuidPtr duid(new DUID(llt, sizeof(llt)));
+
+    Lease6 lease(Lease::TYPE_PD, IOAddress("2001:db8:1::"), duid, 123456,
+                 400, 800, 100, 200, 5678, hwaddr, 56);
+    lease.cltt_ = 12345678;
+
+    std::string expected = "{ \"ip-address\": \"2001:db8:1::\","
+        " \"type\": \"IA_PD\", \"prefix-len\": 56, \"iaid\": 123456,"
+        " \"duid\": \"00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f\","
+        " \"subnet-id\": 5678,"
+        " \"hw-address\": \"" + hwaddr->toText(false) + "\","
+        " \"cltt\": 12345678, \"preferred-lft\": 400, \"valid-lft\": 800,"
+        " \"fqdn-fwd\": false, \"fqdn-rev\": false, \"hostname\": \"\","
+        " \"state\": \"default\" }";
+    EXPECT_TRUE(Element::fromJSON(expected)->equals(*lease.toElement()))
+        << lease.toElement()->str();
+
+    // The prefix length is only reported for prefixes.
+    lease.type_ = Lease::TYPE_NA;
+    lease.hwaddr_.reset();
+    ElementPtr map = lease.toElement();
+    EXPECT_FALSE(map->contains("prefix-len"));
+    EXPECT_FALSE(map->contains("hw-address"));
+    ASSERT_TRUE(map->get("type"));
+    EXPECT_EQ("IA_NA", map->get("type")->stringValue());
+}
+
 // Verify that the lease states are correctly returned in the textual format.
 TEST(Lease6Test, stateToText) {
     EXPECT_EQ("default", Lease6::statesToText(Lease::STATE_DEFAULT));
@@ -373,6 +373,22 @@ TEST_F(MemfileLeaseMgrTest, constructor) {
     pmap["persist"] = "true";
     pmap["lfc-interval"] = "bogus";
     EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The load-threads must be a positive integer.
+    pmap["lfc-interval"] = "0";
+    pmap["load-threads"] = "4";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    pmap["load-threads"] = "0";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+    pmap["load-threads"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
+
+    // The lfc-max-leases must be an integer.
+    pmap.erase("load-threads");
+    pmap["lfc-max-leases"] = "1000";
+    EXPECT_NO_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)));
+    pmap["lfc-max-leases"] = "bogus";
+    EXPECT_THROW(lease_mgr.reset(new Memfile_LeaseMgr(pmap)), isc::BadValue);
 }
 
 // Checks if there is no lease manager NoLeaseManager is thrown.
@@ -570,6 +586,58 @@ TEST_F(MemfileLeaseMgrTest, leaseFileCleanup4) {
     EXPECT_EQ(result_file_contents, input_file.readFile());
 }
 
+// This test checks that the cleanup of the DHCPv4 lease file gives the
+// same result when the leases held in memory by the LFC are limited.
+TEST_F(MemfileLeaseMgrTest, leaseFileCleanup4MaxLeases) {
+    std::string new_file_contents =
+        "address,hwaddr,client_id,valid_lifetime,expire,"
+        "subnet_id,fqdn_fwd,fqdn_rev,hostname,state\n";
+
+    // The lease 192.0.2.4 is removed by the current file.
+    std::string current_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,200,8,1,1,,1\n"
+        "192.0.2.4,04:04:04:04:04:04,,0,800,8,1,1,,1\n"
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1\n";
+    LeaseFileIO current_file(getLeaseFilePath("leasefile4_0.csv"));
+    current_file.writeFile(current_file_contents);
+
+    std::string previous_file_contents = new_file_contents +
+        "192.0.2.4,04:04:04:04:04:04,,200,200,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,200,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1\n";
+    LeaseFileIO previous_file(getLeaseFilePath("leasefile4_0.csv.2"));
+    previous_file.writeFile(previous_file_contents);
+
+    // Create the backend, the LFC holds one lease in memory.
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "1";
+    pmap["lfc-max-leases"] = "1";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr(new NakedMemfileLeaseMgr(pmap));
+
+    // Run the lease file cleanup and wait for it to complete.
+    ASSERT_NO_THROW(lease_mgr->lfcCallback());
+    ASSERT_TRUE(waitForProcess(*lease_mgr, 2));
+    EXPECT_EQ(0, lease_mgr->getLFCExitStatus())
+        << "Executing the LFC process failed: make sure that"
+        " the kea-lfc program has been compiled.";
+
+    std::string result_file_contents = new_file_contents +
+        "192.0.2.2,02:02:02:02:02:02,,200,800,8,1,1,,1\n"
+        "192.0.2.3,03:03:03:03:03:03,,200,800,8,1,1,,1\n";
+
+    LeaseFileIO input_file(getLeaseFilePath("leasefile4_0.csv.2"), false);
+    ASSERT_TRUE(input_file.exists());
+    EXPECT_EQ(result_file_contents, input_file.readFile());
+
+    // The temporary files have been removed.
+    LeaseFileIO run_file(getLeaseFilePath("leasefile4_0.csv.output.run1"),
+                         false);
+    EXPECT_FALSE(run_file.exists());
+}
+
 // This test checks that the callback function executing the cleanup of the
 // DHCPv6 lease file works as expected.
 TEST_F(MemfileLeaseMgrTest, leaseFileCleanup6) {
@@ -973,6 +1041,20 @@ TEST_F(MemfileLeaseMgrTest, getExpiredLeases6) {
     testGetExpiredLeases6();
 }
 
+/// @brief Check that the DHCPv4 leases of a subnet can be retrieved in
+/// pages ordered by address.
+TEST_F(MemfileLeaseMgrTest, getSubnetLeases4) {
+    startBackend(V4);
+    testGetSubnetLeases4();
+}
+
+/// @brief Check that the DHCPv6 leases of a subnet can be retrieved in
+/// pages ordered by address.
+TEST_F(MemfileLeaseMgrTest, getSubnetLeases6) {
+    startBackend(V6);
+    testGetSubnetLeases6();
+}
+
 /// @brief Check that expired reclaimed DHCPv6 leases are removed.
 TEST_F(MemfileLeaseMgrTest, deleteExpiredReclaimedLeases6) {
     startBackend(V6);
@@ -456,6 +456,12 @@ TEST_F(MySqlLeaseMgrTest, getExpiredLeases4) {
     testGetExpiredLeases4();
 }
 
+/// @brief Check that the DHCPv4 leases of a subnet can be retrieved in
+/// pages ordered by address.
+TEST_F(MySqlLeaseMgrTest, getSubnetLeases4) {
+    testGetSubnetLeases4();
+}
+
 /// @brief Check that the expired DHCPv6 leases can be retrieved.
 ///
 /// This test adds a number of leases to the lease database and marks
@@ -467,6 +473,12 @@ TEST_F(MySqlLeaseMgrTest, getExpiredLeases6) {
     testGetExpiredLeases6();
 }
 
+/// @brief Check that the DHCPv6 leases of a subnet can be retrieved in
+/// pages ordered by address.
+TEST_F(MySqlLeaseMgrTest, getSubnetLeases6) {
+    testGetSubnetLeases6();
+}
+
 /// @brief Check that expired reclaimed DHCPv6 leases are removed.
 TEST_F(MySqlLeaseMgrTest, deleteExpiredReclaimedLeases6) {
     testDeleteExpiredReclaimedLeases6();
@@ -586,6 +586,37 @@ TEST_F(NCRGenerator4Test, useClientId) {
     }
 }
 
+// Test that the DNS data of a renewed lease are identical only when the
+// FQDN data and the identifier used to compute the DHCID are unchanged.
+TEST_F(NCRGenerator4Test, identicalDnsData) {
+    lease_->hostname_ = "myhost.example.com.";
+    lease_->fqdn_fwd_ = true;
+    lease_->fqdn_rev_ = true;
+    Lease4 renewed(*lease_);
+    renewed.valid_lft_ += 100;
+    EXPECT_TRUE(hasIdenticalDnsData(renewed, *lease_));
+
+    // A changed hostname requires a DNS update.
+    renewed.hostname_ = "other.example.com.";
+    EXPECT_FALSE(hasIdenticalDnsData(renewed, *lease_));
+    renewed.hostname_ = lease_->hostname_;
+
+    // Without client identifiers the HW address is used.
+    renewed.hwaddr_.reset(new HWAddr(HWAddr::fromText("01:02:03:04:05:07")));
+    EXPECT_FALSE(hasIdenticalDnsData(renewed, *lease_));
+
+    // The client identifier takes precedence over the HW address.
+    lease_->client_id_ = ClientId::fromText("01:01:01:01");
+    renewed.client_id_ = ClientId::fromText("01:01:01:01");
+    EXPECT_TRUE(hasIdenticalDnsData(renewed, *lease_));
+
+    renewed.client_id_ = ClientId::fromText("01:01:01:02");
+    EXPECT_FALSE(hasIdenticalDnsData(renewed, *lease_));
+
+    renewed.client_id_.reset();
+    EXPECT_FALSE(hasIdenticalDnsData(renewed, *lease_));
+}
+
 // Test that NameChangeRequest is not generated if the lease is NULL,
 // and that the call to queueNCR doesn't cause an exception or
 // assertion.
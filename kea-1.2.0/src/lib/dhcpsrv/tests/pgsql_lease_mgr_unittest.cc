@@ -308,6 +308,12 @@ TEST_F(PgSqlLeaseMgrTest, getExpiredLeases4) {
     testGetExpiredLeases4();
 }
 
+/// @brief Check that the DHCPv4 leases of a subnet can be retrieved in
+/// pages ordered by address.
+TEST_F(PgSqlLeaseMgrTest, getSubnetLeases4) {
+    testGetSubnetLeases4();
+}
+
 /// @brief Check that expired reclaimed DHCPv4 leases are removed.
 TEST_F(PgSqlLeaseMgrTest, deleteExpiredReclaimedLeases4) {
     testDeleteExpiredReclaimedLeases4();
@@ -402,6 +408,12 @@ TEST_F(PgSqlLeaseMgrTest, getExpiredLeases6) {
     testGetExpiredLeases6();
 }
 
+/// @brief Check that the DHCPv6 leases of a subnet can be retrieved in
+/// pages ordered by address.
+TEST_F(PgSqlLeaseMgrTest, getSubnetLeases6) {
+    testGetSubnetLeases6();
+}
+
 // Verifies that IPv4 lease statistics can be recalculated.
 TEST_F(PgSqlLeaseMgrTest, recountLeaseStats4) {
     testRecountLeaseStats4();
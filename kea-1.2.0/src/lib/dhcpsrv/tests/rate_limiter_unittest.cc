@@ -0,0 +1,215 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option.h>
+#include <dhcpsrv/rate_limiter.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace boost::posix_time;
+
+namespace {
+
+/// @brief Creates DHCPv4 query.
+///
+/// @param mac_byte Last byte of the hardware address.
+/// @param giaddr Relay agent address.
+Pkt4Ptr
+createQuery4(const uint8_t mac_byte, const std::string& giaddr = "0.0.0.0") {
+    Pkt4Ptr query(new Pkt4(DHCPDISCOVER, 1234));
+    std::vector<uint8_t> mac(6, 0);
+    mac[5] = mac_byte;
+    query->setHWAddr(HTYPE_ETHER, mac.size(), mac);
+    query->setGiaddr(IOAddress(giaddr));
+    return (query);
+}
+
+/// @brief Creates DHCPv6 query.
+///
+/// @param duid_byte Last byte of the DUID.
+/// @param relay Remote address of the relay or empty string if the
+/// query is not relayed.
+Pkt6Ptr
+createQuery6(const uint8_t duid_byte, const std::string& relay = "") {
+    Pkt6Ptr query(new Pkt6(DHCPV6_SOLICIT, 1234));
+    std::vector<uint8_t> duid(8, 0);
+    duid[1] = 1;
+    duid[7] = duid_byte;
+    query->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID, duid)));
+    if (!relay.empty()) {
+        query->addRelayInfo(Pkt6::RelayInfo());
+        query->setRemoteAddr(IOAddress(relay));
+    }
+    return (query);
+}
+
+// This test verifies that the rate limiter is disabled by default.
+TEST(RateLimiterTest, disabled) {
+    RateLimiter limiter;
+    EXPECT_FALSE(limiter.enabled());
+
+    Pkt4Ptr query = createQuery4(1);
+    for (int i = 0; i < 100; ++i) {
+        ASSERT_EQ(RateLimiter::NONE, limiter.check(query));
+    }
+}
+
+// This test verifies that the client is limited to the configured burst
+// and then to the configured rate.
+TEST(RateLimiterTest, client4) {
+    RateLimiter limiter;
+    limiter.configure(RateLimitConfig(10, 3));
+    ASSERT_TRUE(limiter.enabled());
+
+    ptime now = microsec_clock::universal_time();
+    Pkt4Ptr query = createQuery4(1);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(RateLimiter::NONE, limiter.check(query, now));
+    }
+    EXPECT_EQ(RateLimiter::HW_ADDRESS, limiter.check(query, now));
+
+    // Other clients are not affected.
+    EXPECT_EQ(RateLimiter::NONE, limiter.check(createQuery4(2), now));
+
+    // The rate of 10 packets per second gives a token every 100ms.
+    now += milliseconds(50);
+    EXPECT_EQ(RateLimiter::HW_ADDRESS, limiter.check(query, now));
+    now += milliseconds(50);
+    EXPECT_EQ(RateLimiter::NONE, limiter.check(query, now));
+    EXPECT_EQ(RateLimiter::HW_ADDRESS, limiter.check(query, now));
+
+    // The bucket doesn't exceed the burst size after a long idle time.
+    now += seconds(3600);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(RateLimiter::NONE, limiter.check(query, now));
+    }
+    EXPECT_EQ(RateLimiter::HW_ADDRESS, limiter.check(query, now));
+
+    // The queries dropped because of the hardware address don't take
+    // the tokens of the client identifier.
+    query->addOption(OptionPtr(new Option(Option::V4,
+                                          DHO_DHCP_CLIENT_IDENTIFIER,
+                                          std::vector<uint8_t>(7, 1))));
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(RateLimiter::HW_ADDRESS, limiter.check(query, now));
+    }
+    now += seconds(1);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(RateLimiter::NONE, limiter.check(query, now));
+    }
+
+    // The client identifier is checked first.
+    EXPECT_EQ(RateLimiter::CLIENT_ID, limiter.check(query, now));
+}
+
+// This test verifies that the relays are limited independently of the
+// clients.
+TEST(RateLimiterTest, relay4) {
+    RateLimiter limiter;
+    limiter.configure(RateLimitConfig(0, 0, 2));
+
+    ptime now = microsec_clock::universal_time();
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery4(1, "10.0.0.1"), now));
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery4(2, "10.0.0.1"), now));
+    EXPECT_EQ(RateLimiter::RELAY,
+              limiter.check(createQuery4(3, "10.0.0.1"), now));
+
+    // Another relay and directly connected clients are not affected.
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery4(3, "10.0.0.2"), now));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(RateLimiter::NONE, limiter.check(createQuery4(4), now));
+    }
+}
+
+// This test verifies that a query is accounted to its client and to its
+// relay only when neither of them exceeds its rate.
+TEST(RateLimiterTest, clientAndRelay4) {
+    RateLimiter limiter;
+    limiter.configure(RateLimitConfig(1, 1, 1, 1));
+
+    ptime now = microsec_clock::universal_time();
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery4(1, "10.0.0.1"), now));
+
+    // The relay has no tokens left, so the query from the second client
+    // is dropped without taking the token of the client.
+    EXPECT_EQ(RateLimiter::RELAY,
+              limiter.check(createQuery4(2, "10.0.0.1"), now));
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery4(2, "10.0.0.2"), now));
+
+    // The client has no tokens left, so the relay keeps its token.
+    EXPECT_EQ(RateLimiter::HW_ADDRESS,
+              limiter.check(createQuery4(2, "10.0.0.3"), now));
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery4(3, "10.0.0.3"), now));
+}
+
+// This test verifies that the DHCPv6 clients and relays are limited.
+TEST(RateLimiterTest, check6) {
+    RateLimiter limiter;
+    limiter.configure(RateLimitConfig(1, 0, 3));
+
+    ptime now = microsec_clock::universal_time();
+    EXPECT_EQ(RateLimiter::NONE, limiter.check(createQuery6(1), now));
+    EXPECT_EQ(RateLimiter::CLIENT_ID, limiter.check(createQuery6(1), now));
+
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery6(2, "2001:db8::1"), now));
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery6(3, "2001:db8::1"), now));
+    EXPECT_EQ(RateLimiter::NONE,
+              limiter.check(createQuery6(4, "2001:db8::1"), now));
+    EXPECT_EQ(RateLimiter::RELAY,
+              limiter.check(createQuery6(5, "2001:db8::1"), now));
+
+    now += seconds(1);
+    EXPECT_EQ(RateLimiter::NONE, limiter.check(createQuery6(1), now));
+}
+
+// This test verifies that the sources exceeding the table size are
+// still tracked and that reconfiguration resets the state.
+TEST(RateLimiterTest, maxSources) {
+    RateLimiter limiter;
+    limiter.configure(RateLimitConfig(1, 1, 0, 0, 4));
+
+    ptime now = microsec_clock::universal_time();
+    for (uint8_t mac = 1; mac <= 100; ++mac) {
+        ASSERT_EQ(RateLimiter::NONE, limiter.check(createQuery4(mac), now));
+    }
+
+    // The most recent source is still tracked.
+    EXPECT_EQ(RateLimiter::HW_ADDRESS, limiter.check(createQuery4(100), now));
+
+    // New configuration forgets all sources.
+    limiter.configure(RateLimitConfig(2, 1, 0, 0, 4));
+    EXPECT_EQ(RateLimiter::NONE, limiter.check(createQuery4(100), now));
+}
+
+// This test verifies the names of the source kinds.
+TEST(RateLimiterTest, sourceToText) {
+    EXPECT_EQ("none", RateLimiter::sourceToText(RateLimiter::NONE));
+    EXPECT_EQ("client identifier",
+              RateLimiter::sourceToText(RateLimiter::CLIENT_ID));
+    EXPECT_EQ("hardware address",
+              RateLimiter::sourceToText(RateLimiter::HW_ADDRESS));
+    EXPECT_EQ("relay", RateLimiter::sourceToText(RateLimiter::RELAY));
+}
+
+} // end of anonymous namespace
@@ -0,0 +1,216 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option.h>
+#include <dhcpsrv/response_cache.h>
+
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Creates DHCPv4 query with the specified hardware address.
+///
+/// @param type Message type.
+/// @param transid Transaction id.
+/// @param mac_byte Last byte of the hardware address.
+Pkt4Ptr
+createQuery4(const uint8_t type, const uint32_t transid,
+             const uint8_t mac_byte = 1) {
+    Pkt4Ptr query(new Pkt4(type, transid));
+    std::vector<uint8_t> mac(6, 0);
+    mac[5] = mac_byte;
+    query->setHWAddr(HTYPE_ETHER, mac.size(), mac);
+    return (query);
+}
+
+/// @brief Creates DHCPv6 query with the specified DUID.
+///
+/// @param type Message type.
+/// @param transid Transaction id.
+/// @param duid_byte Last byte of the DUID.
+Pkt6Ptr
+createQuery6(const uint8_t type, const uint32_t transid,
+             const uint8_t duid_byte = 1) {
+    Pkt6Ptr query(new Pkt6(type, transid));
+    std::vector<uint8_t> duid(8, 0);
+    duid[1] = 1;
+    duid[7] = duid_byte;
+    query->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID, duid)));
+    return (query);
+}
+
+/// @brief Creates packed DHCPv4 response.
+///
+/// @param type Message type.
+/// @param transid Transaction id.
+Pkt4Ptr
+createResponse4(const uint8_t type, const uint32_t transid) {
+    Pkt4Ptr response(new Pkt4(type, transid));
+    response->setRemoteAddr(IOAddress("192.0.2.1"));
+    response->setIface("eth0");
+    response->setIndex(1);
+    response->pack();
+    return (response);
+}
+
+/// @brief Creates packed DHCPv6 response.
+///
+/// @param type Message type.
+/// @param transid Transaction id.
+Pkt6Ptr
+createResponse6(const uint8_t type, const uint32_t transid) {
+    Pkt6Ptr response(new Pkt6(type, transid));
+    response->setRemoteAddr(IOAddress("fe80::1"));
+    response->setIface("eth0");
+    response->setIndex(1);
+    response->pack();
+    return (response);
+}
+
+/// @brief Returns the contents of the packet's output buffer.
+///
+/// @param pkt Packet.
+std::vector<uint8_t>
+getWireData(const PktPtr& pkt) {
+    const uint8_t* data =
+        static_cast<const uint8_t*>(pkt->getBuffer().getData());
+    return (std::vector<uint8_t>(data, data + pkt->getBuffer().getLength()));
+}
+
+// This test verifies that the cache is disabled by default.
+TEST(ResponseCacheTest, disabled) {
+    ResponseCache cache;
+    EXPECT_FALSE(cache.enabled());
+
+    Pkt4Ptr query = createQuery4(DHCPDISCOVER, 1234);
+    cache.add(query, createResponse4(DHCPOFFER, 1234));
+    EXPECT_EQ(0, cache.size());
+    EXPECT_FALSE(cache.get(query));
+}
+
+// This test verifies that the response to the DHCPv4 query is returned
+// for the retransmitted query only.
+TEST(ResponseCacheTest, get4) {
+    ResponseCache cache(10000);
+    ASSERT_TRUE(cache.enabled());
+
+    // The response which hasn't been packed is not cached.
+    Pkt4Ptr query = createQuery4(DHCPDISCOVER, 1234);
+    cache.add(query, Pkt4Ptr(new Pkt4(DHCPOFFER, 1234)));
+    EXPECT_EQ(0, cache.size());
+
+    Pkt4Ptr response = createResponse4(DHCPOFFER, 1234);
+    cache.add(query, response);
+    EXPECT_EQ(1, cache.size());
+
+    // The retransmitted query is a different object with the same contents.
+    // It is answered with a copy of the response.
+    Pkt4Ptr cached = cache.get(createQuery4(DHCPDISCOVER, 1234));
+    ASSERT_TRUE(cached);
+    EXPECT_FALSE(cached == response);
+    EXPECT_EQ(DHCPOFFER, cached->getType());
+    EXPECT_EQ(1234, cached->getTransid());
+    EXPECT_EQ("192.0.2.1", cached->getRemoteAddr().toText());
+    EXPECT_EQ("eth0", cached->getIface());
+    EXPECT_EQ(1, cached->getIndex());
+    EXPECT_TRUE(getWireData(cached) == getWireData(response));
+
+    // Modifying the sent copy doesn't alter the cached response.
+    cached->getBuffer().clear();
+    cached = cache.get(createQuery4(DHCPDISCOVER, 1234));
+    ASSERT_TRUE(cached);
+    EXPECT_TRUE(getWireData(cached) == getWireData(response));
+
+    // Different transaction id, message type or client.
+    EXPECT_FALSE(cache.get(createQuery4(DHCPDISCOVER, 1235)));
+    EXPECT_FALSE(cache.get(createQuery4(DHCPREQUEST, 1234)));
+    EXPECT_FALSE(cache.get(createQuery4(DHCPDISCOVER, 1234, 2)));
+
+    // The client identifier takes precedence over the hardware address.
+    Pkt4Ptr query_id = createQuery4(DHCPDISCOVER, 1234);
+    query_id->addOption(OptionPtr(new Option(Option::V4,
+                                             DHO_DHCP_CLIENT_IDENTIFIER,
+                                             std::vector<uint8_t>(7, 1))));
+    EXPECT_FALSE(cache.get(query_id));
+    cache.add(query_id, response);
+    EXPECT_TRUE(cache.get(query_id));
+    EXPECT_EQ(2, cache.size());
+
+    // Changing the lifetime clears the cache.
+    cache.setTTL(5000);
+    EXPECT_EQ(0, cache.size());
+    EXPECT_FALSE(cache.get(query));
+}
+
+// This test verifies that the response to the DHCPv6 query is returned
+// for the retransmitted query only.
+TEST(ResponseCacheTest, get6) {
+    ResponseCache cache(10000);
+
+    Pkt6Ptr query = createQuery6(DHCPV6_SOLICIT, 1234);
+    Pkt6Ptr response = createResponse6(DHCPV6_ADVERTISE, 1234);
+    cache.add(query, response);
+
+    Pkt6Ptr cached = cache.get(createQuery6(DHCPV6_SOLICIT, 1234));
+    ASSERT_TRUE(cached);
+    EXPECT_FALSE(cached == response);
+    EXPECT_EQ(DHCPV6_ADVERTISE, cached->getType());
+    EXPECT_EQ(1234, cached->getTransid());
+    EXPECT_EQ("fe80::1", cached->getRemoteAddr().toText());
+    EXPECT_EQ("eth0", cached->getIface());
+    EXPECT_TRUE(getWireData(cached) == getWireData(response));
+
+    EXPECT_FALSE(cache.get(createQuery6(DHCPV6_SOLICIT, 1235)));
+    EXPECT_FALSE(cache.get(createQuery6(DHCPV6_REQUEST, 1234)));
+    EXPECT_FALSE(cache.get(createQuery6(DHCPV6_SOLICIT, 1234, 2)));
+
+    // The query without the client identifier is not cached.
+    Pkt6Ptr anonymous(new Pkt6(DHCPV6_SOLICIT, 1));
+    cache.add(anonymous, response);
+    EXPECT_EQ(1, cache.size());
+    EXPECT_FALSE(cache.get(anonymous));
+}
+
+// This test verifies that the responses expire.
+TEST(ResponseCacheTest, expire) {
+    ResponseCache cache(1);
+
+    Pkt4Ptr query = createQuery4(DHCPDISCOVER, 1234);
+    cache.add(query, createResponse4(DHCPOFFER, 1234));
+    ASSERT_EQ(1, cache.size());
+
+    usleep(5000);
+    EXPECT_FALSE(cache.get(query));
+    EXPECT_EQ(0, cache.size());
+}
+
+// This test verifies that the oldest responses are removed when the
+// cache is full.
+TEST(ResponseCacheTest, maxEntries) {
+    ResponseCache cache(10000, 2);
+
+    for (uint32_t transid = 1; transid <= 3; ++transid) {
+        cache.add(createQuery4(DHCPREQUEST, transid),
+                  createResponse4(DHCPACK, transid));
+    }
+    EXPECT_EQ(2, cache.size());
+    EXPECT_FALSE(cache.get(createQuery4(DHCPREQUEST, 1)));
+    EXPECT_TRUE(cache.get(createQuery4(DHCPREQUEST, 2)));
+    EXPECT_TRUE(cache.get(createQuery4(DHCPREQUEST, 3)));
+}
+
+} // end of anonymous namespace
@@ -125,6 +125,26 @@ TEST(Subnet4Test, matchClientId) {
     EXPECT_TRUE(subnet.getMatchClientId());
 }
 
+// Checks that the lease cache threshold can be set and that invalid
+// values are rejected.
+TEST(Subnet4Test, cacheThreshold) {
+    Subnet4 subnet(IOAddress("192.0.2.1"), 24, 1000, 2000, 3000);
+
+    // Lease caching is disabled by default.
+    EXPECT_EQ(0.0, subnet.getCacheThreshold());
+
+    ASSERT_NO_THROW(subnet.setCacheThreshold(0.25));
+    EXPECT_EQ(0.25, subnet.getCacheThreshold());
+
+    // The threshold must be in the range of [0, 1).
+    EXPECT_THROW(subnet.setCacheThreshold(-0.1), BadValue);
+    EXPECT_THROW(subnet.setCacheThreshold(1.0), BadValue);
+    EXPECT_EQ(0.25, subnet.getCacheThreshold());
+
+    ASSERT_NO_THROW(subnet.setCacheThreshold(0.0));
+    EXPECT_EQ(0.0, subnet.getCacheThreshold());
+}
+
 // Checks that it is possible to add and retrieve multiple pools.
 TEST(Subnet4Test, pool4InSubnet4) {
 
@@ -394,6 +414,48 @@ TEST(Subnet4Test, inRangeinPool) {
     EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, IOAddress("192.3.0.0")));
 }
 
+// This test checks that the address is found in the right pool when the
+// subnet has many small pools added in any order.
+TEST(Subnet4Test, inPoolManyPools) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
+
+    // Pools of 4 addresses with gaps of 4 addresses, added in reverse
+    // order of every other pool first.
+    for (int i = 30; i >= 0; i -= 2) {
+        subnet->addPool(Pool4Ptr(new Pool4(IOAddress(8 * i + 0xc0000200),
+                                           IOAddress(8 * i + 0xc0000203))));
+    }
+    for (int i = 31; i >= 1; i -= 2) {
+        subnet->addPool(Pool4Ptr(new Pool4(IOAddress(8 * i + 0xc0000200),
+                                           IOAddress(8 * i + 0xc0000203))));
+    }
+
+    // The pools are sorted.
+    const PoolCollection& pools = subnet->getPools(Lease::TYPE_V4);
+    ASSERT_EQ(32, pools.size());
+    for (int i = 0; i < 32; ++i) {
+        EXPECT_EQ(IOAddress(8 * i + 0xc0000200), pools[i]->getFirstAddress());
+    }
+
+    for (int i = 0; i < 32; ++i) {
+        for (int j = 0; j < 8; ++j) {
+            IOAddress addr(8 * i + j + 0xc0000200);
+            PoolPtr pool = subnet->getPool(Lease::TYPE_V4, addr, false);
+            if (j < 4) {
+                EXPECT_TRUE(subnet->inPool(Lease::TYPE_V4, addr)) << addr;
+                ASSERT_TRUE(pool) << addr;
+                EXPECT_EQ(pools[i], pool);
+            } else {
+                EXPECT_FALSE(subnet->inPool(Lease::TYPE_V4, addr)) << addr;
+                EXPECT_FALSE(pool) << addr;
+            }
+        }
+    }
+
+    // An address out of the pools gets any pool when asked for one.
+    EXPECT_EQ(pools[0], subnet->getPool(Lease::TYPE_V4, IOAddress("192.0.2.4")));
+}
+
 // This test checks if the toText() method returns text representation
 TEST(Subnet4Test, toText) {
     Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
@@ -5,12 +5,16 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
 
 #include <gtest/gtest.h>
 
 #include <exceptions/exceptions.h>
 
 #include <cryptolink/cryptolink.h>
+#include <cryptolink/crypto_hmac.h>
 
 #include <dns/tsigkey.h>
 
@@ -19,6 +23,9 @@
 
 using namespace std;
 using namespace isc::dns;
+using isc::cryptolink::CryptoLink;
+using isc::cryptolink::HMAC;
+using isc::cryptolink::deleteHMAC;
 using isc::UnitTestUtil;
 using isc::util::unittests::matchWireData;
 
@@ -155,6 +162,35 @@ TEST_F(TSIGKeyTest, assignment) {
     compareTSIGKeys(original, copy);
 }
 
+// The HMAC objects created by the key sign like the ones created with
+// the secret directly, also when the key is a copy.
+TEST_F(TSIGKeyTest, createHMAC) {
+    const string data("someDataToSign");
+    boost::shared_ptr<HMAC> expected_hmac(
+        CryptoLink::getCryptoLink().createHMAC(secret.c_str(), secret.size(),
+                                               isc::cryptolink::SHA256),
+        deleteHMAC);
+    expected_hmac->update(data.c_str(), data.size());
+    const vector<uint8_t> expected =
+        expected_hmac->sign(expected_hmac->getOutputLength());
+
+    TSIGKey* original = new TSIGKey(key_name, TSIGKey::HMACSHA256_NAME(),
+                                    secret.c_str(), secret.size());
+    const TSIGKey copy(*original);
+    delete original;
+
+    for (int i = 0; i < 2; ++i) {
+        boost::shared_ptr<HMAC> hmac(copy.createHMAC(), deleteHMAC);
+        EXPECT_EQ(isc::cryptolink::SHA256, hmac->getHashAlgorithm());
+        hmac->update(data.c_str(), data.size());
+        EXPECT_TRUE(expected == hmac->sign(hmac->getOutputLength()));
+    }
+
+    // A key without the secret can't sign.
+    const TSIGKey empty_key(key_name, TSIGKey::HMACSHA256_NAME(), NULL, 0);
+    EXPECT_THROW(empty_key.createHMAC(), isc::cryptolink::BadKey);
+}
+
 class TSIGKeyRingTest : public ::testing::Test {
 protected:
     TSIGKeyRingTest() :
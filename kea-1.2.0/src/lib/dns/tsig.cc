@@ -54,7 +54,7 @@ struct TSIGContext::TSIGContextImpl {
                     TSIGError error = TSIGError::NOERROR()) :
         state_(INIT), key_(key), error_(error),
         previous_timesigned_(0), digest_len_(0),
-        last_sig_dist_(-1)
+        last_sig_dist_(-1), buffer_(0)
     {
         if (error == TSIGError::NOERROR()) {
             // In normal (NOERROR) case, the key should be valid, and we
@@ -67,10 +67,7 @@ struct TSIGContext::TSIGContextImpl {
             // it at this moment; a subsequent sign/verify operation will try
             // to create the HMAC, which would also fail.
             try {
-                hmac_.reset(CryptoLink::getCryptoLink().createHMAC(
-                                key_.getSecret(), key_.getSecretLength(),
-                                key_.getAlgorithm()),
-                                deleteHMAC);
+                hmac_.reset(key_.createHMAC(), deleteHMAC);
             } catch (const isc::Exception&) {
                 return;
             }
@@ -117,17 +114,15 @@ struct TSIGContext::TSIGContextImpl {
     // has been successfully created in the constructor, return it; otherwise
     // create a new one and return it.  In the former case, the ownership is
     // transferred to the caller; the stored HMAC will be reset after the
-    // call.
+    // call.  The new one is cloned from the HMAC object kept by the key,
+    // so the secret isn't processed again.
     HMACPtr createHMAC() {
         if (hmac_) {
             HMACPtr ret = HMACPtr();
             ret.swap(hmac_);
             return (ret);
         }
-        return (HMACPtr(CryptoLink::getCryptoLink().createHMAC(
-                            key_.getSecret(), key_.getSecretLength(),
-                            key_.getAlgorithm()),
-                        deleteHMAC));
+        return (HMACPtr(key_.createHMAC(), deleteHMAC));
     }
 
     // The following three are helper methods to compute the digest for
@@ -135,22 +130,17 @@ struct TSIGContext::TSIGContextImpl {
     // and verify() and to keep these callers concise.
     // These methods take an HMAC object, which will be updated with the
     // calculated digest.
-    // Note: All methods construct a local OutputBuffer as a work space with a
-    // fixed initial buffer size to avoid intermediate buffer extension.
-    // This should be efficient enough, especially for fundamentally expensive
-    // operation like cryptographic sign/verify, but if the creation of the
-    // buffer in each helper method is still identified to be a severe
-    // performance bottleneck, we could have this class a buffer as a member
-    // variable and reuse it throughout the object's lifetime.  Right now,
-    // we prefer keeping the scope for local things as small as possible.
-    void digestPreviousMAC(HMACPtr hmac);
-    void digestTSIGVariables(HMACPtr hmac, uint16_t rrclass, uint32_t rrttl,
-                             uint64_t time_signed, uint16_t fudge,
-                             uint16_t error, uint16_t otherlen,
-                             const void* otherdata,
-                             bool time_variables_only) const;
-    void digestDNSMessage(HMACPtr hmac, uint16_t qid, const void* data,
-                          size_t data_len) const;
+    // Note: All methods use the buffer_ member as a work space, which is
+    // reused throughout the object's lifetime, so that signing and verifying
+    // a message doesn't allocate a buffer for each of the digested parts.
+    void digestPreviousMAC(const HMACPtr& hmac);
+    void digestTSIGVariables(const HMACPtr& hmac, uint16_t rrclass,
+                             uint32_t rrttl, uint64_t time_signed,
+                             uint16_t fudge, uint16_t error,
+                             uint16_t otherlen, const void* otherdata,
+                             bool time_variables_only);
+    void digestDNSMessage(const HMACPtr& hmac, uint16_t qid, const void* data,
+                          size_t data_len);
     State state_;
     const TSIGKey key_;
     vector<uint8_t> previous_digest_;
@@ -162,10 +152,12 @@ struct TSIGContext::TSIGContextImpl {
     // means the last message was signed. Special value -1 means there was no
     // signed message yet.
     int last_sig_dist_;
+    // Work space of the digest helper methods.
+    OutputBuffer buffer_;
 };
 
 void
-TSIGContext::TSIGContextImpl::digestPreviousMAC(HMACPtr hmac) {
+TSIGContext::TSIGContextImpl::digestPreviousMAC(const HMACPtr& hmac) {
     // We should have ensured the digest size fits 16 bits within this class
     // implementation.
     assert(previous_digest_.size() <= 0xffff);
@@ -177,48 +169,39 @@ TSIGContext::TSIGContextImpl::digestPreviousMAC(HMACPtr hmac) {
         return;
     }
 
-    OutputBuffer buffer(sizeof(uint16_t) + previous_digest_.size());
+    buffer_.clear();
     const uint16_t previous_digest_len(previous_digest_.size());
-    buffer.writeUint16(previous_digest_len);
+    buffer_.writeUint16(previous_digest_len);
     if (previous_digest_len != 0) {
-        buffer.writeData(&previous_digest_[0], previous_digest_len);
+        buffer_.writeData(&previous_digest_[0], previous_digest_len);
     }
-    hmac->update(buffer.getData(), buffer.getLength());
+    hmac->update(buffer_.getData(), buffer_.getLength());
 }
 
 void
 TSIGContext::TSIGContextImpl::digestTSIGVariables(
-    HMACPtr hmac, uint16_t rrclass, uint32_t rrttl, uint64_t time_signed,
-    uint16_t fudge, uint16_t error, uint16_t otherlen, const void* otherdata,
-    bool time_variables_only) const
+    const HMACPtr& hmac, uint16_t rrclass, uint32_t rrttl,
+    uint64_t time_signed, uint16_t fudge, uint16_t error, uint16_t otherlen,
+    const void* otherdata, bool time_variables_only)
 {
-    // It's bit complicated, but we can still predict the necessary size of
-    // the data to be digested.  So we precompute it to avoid possible
-    // reallocation inside OutputBuffer (not absolutely necessary, but this
-    // is a bit more efficient)
-    size_t data_size = 8;
-    if (!time_variables_only) {
-        data_size += 10 + key_.getKeyName().getLength() +
-            key_.getAlgorithmName().getLength();
-    }
-    OutputBuffer buffer(data_size);
+    buffer_.clear();
 
     if (!time_variables_only) {
-        key_.getKeyName().toWire(buffer);
-        buffer.writeUint16(rrclass);
-        buffer.writeUint32(rrttl);
-        key_.getAlgorithmName().toWire(buffer);
+        key_.getKeyName().toWire(buffer_);
+        buffer_.writeUint16(rrclass);
+        buffer_.writeUint32(rrttl);
+        key_.getAlgorithmName().toWire(buffer_);
     }
-    buffer.writeUint16(time_signed >> 32);
-    buffer.writeUint32(time_signed & 0xffffffff);
-    buffer.writeUint16(fudge);
+    buffer_.writeUint16(time_signed >> 32);
+    buffer_.writeUint32(time_signed & 0xffffffff);
+    buffer_.writeUint16(fudge);
 
     if (!time_variables_only) {
-        buffer.writeUint16(error);
-        buffer.writeUint16(otherlen);
+        buffer_.writeUint16(error);
+        buffer_.writeUint16(otherlen);
     }
 
-    hmac->update(buffer.getData(), buffer.getLength());
+    hmac->update(buffer_.getData(), buffer_.getLength());
     if (!time_variables_only && otherlen > 0) {
         hmac->update(otherdata, otherlen);
     }
@@ -239,28 +222,28 @@ namespace {
 const size_t MESSAGE_HEADER_LEN = 12;
 }
 void
-TSIGContext::TSIGContextImpl::digestDNSMessage(HMACPtr hmac,
+TSIGContext::TSIGContextImpl::digestDNSMessage(const HMACPtr& hmac,
                                                uint16_t qid, const void* data,
-                                               size_t data_len) const
+                                               size_t data_len)
 {
-    OutputBuffer buffer(MESSAGE_HEADER_LEN);
+    buffer_.clear();
     const uint8_t* msgptr = static_cast<const uint8_t*>(data);
 
     // Install the original ID
-    buffer.writeUint16(qid);
+    buffer_.writeUint16(qid);
     msgptr += sizeof(uint16_t);
 
     // Copy the rest of the header except the ARCOUNT field.
-    buffer.writeData(msgptr, 8);
+    buffer_.writeData(msgptr, 8);
     msgptr += 8;
 
     // Install the adjusted ARCOUNT (we don't care even if the value is bogus
     // and it underflows; it would simply result in verification failure)
-    buffer.writeUint16(InputBuffer(msgptr, sizeof(uint16_t)).readUint16() - 1);
+    buffer_.writeUint16(InputBuffer(msgptr, sizeof(uint16_t)).readUint16() - 1);
     msgptr += 2;
 
     // Digest the header and the rest of the DNS message
-    hmac->update(buffer.getData(), buffer.getLength());
+    hmac->update(buffer_.getData(), buffer_.getLength());
     hmac->update(msgptr, data_len - MESSAGE_HEADER_LEN);
 }
 
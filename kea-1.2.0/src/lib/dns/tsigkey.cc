@@ -12,12 +12,14 @@
 #include <exceptions/exceptions.h>
 
 #include <cryptolink/cryptolink.h>
+#include <cryptolink/crypto_hmac.h>
 
 #include <dns/name.h>
 #include <util/encode/base64.h>
 #include <dns/tsigkey.h>
 
 #include <boost/lexical_cast.hpp>
+#include <boost/shared_ptr.hpp>
 
 using namespace std;
 using namespace isc::cryptolink;
@@ -78,7 +80,8 @@ TSIGKey::TSIGKeyImpl {
         key_name_(key_name), algorithm_name_(algorithm_name),
         algorithm_(algorithm), digestbits_(digestbits),
         secret_(static_cast<const uint8_t*>(secret),
-                static_cast<const uint8_t*>(secret) + secret_len)
+                static_cast<const uint8_t*>(secret) + secret_len),
+        hmac_()
     {
         // Convert the key and algorithm names to the canonical form.
         key_name_.downcase();
@@ -86,12 +89,27 @@ TSIGKey::TSIGKeyImpl {
             algorithm_name_ = TSIGKey::HMACMD5_NAME();
         }
         algorithm_name_.downcase();
+
+        // Key the HMAC object cloned for each signed or verified message.
+        // If it fails (e.g. the algorithm isn't supported by the crypto
+        // library), createHMAC() will try again and report the error.
+        // An empty secret is not pre-keyed: createHMAC() handles it.
+        if (!secret_.empty()) {
+            try {
+                hmac_.reset(CryptoLink::getCryptoLink().createHMAC(
+                                &secret_[0], secret_.size(), algorithm_),
+                            deleteHMAC);
+            } catch (const isc::Exception&) {
+            }
+        }
     }
     Name key_name_;
     Name algorithm_name_;
     const isc::cryptolink::HashAlgorithm algorithm_;
     size_t digestbits_;
     const vector<uint8_t> secret_;
+    // HMAC object keyed with the secret, never updated itself.
+    boost::shared_ptr<HMAC> hmac_;
 };
 
 TSIGKey::TSIGKey(const Name& key_name, const Name& algorithm_name,
@@ -256,6 +274,16 @@ TSIGKey::toText() const {
     }
 }
 
+HMAC*
+TSIGKey::createHMAC() const {
+    if (impl_->hmac_) {
+        return (impl_->hmac_->clone());
+    }
+    return (CryptoLink::getCryptoLink().createHMAC(getSecret(),
+                                                   getSecretLength(),
+                                                   getAlgorithm()));
+}
+
 const
 Name& TSIGKey::HMACMD5_NAME() {
     static Name alg_name("hmac-md5.sig-alg.reg.int");
@@ -202,6 +202,24 @@ public:
     /// \return The string representation of the given TSIGKey.
     std::string toText() const;
 
+    /// \brief Creates an HMAC object for signing or verifying with the key.
+    ///
+    /// When the key is constructed, an HMAC object keyed with its secret
+    /// is created and kept (and shared by the copies of the key).  This
+    /// method returns a clone of that object, so the secret isn't processed
+    /// again for every message signed or verified with the key.  It may be
+    /// called concurrently from several threads.
+    ///
+    /// The caller is responsible for deleting the returned object with
+    /// \c isc::cryptolink::deleteHMAC().
+    ///
+    /// \exception isc::cryptolink::CryptoLinkError if the HMAC object
+    /// can't be created, e.g. the algorithm is unknown or the secret is
+    /// empty.
+    ///
+    /// \return A pointer to the new HMAC object.
+    isc::cryptolink::HMAC* createHMAC() const;
+
     ///
     /// \name Well known algorithm names as defined in RFC2845 and RFC4635.
     ///
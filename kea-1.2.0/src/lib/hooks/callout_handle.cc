@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
 
+#include <climits>
 #include <string>
 #include <utility>
 #include <vector>
@@ -22,7 +23,7 @@ namespace hooks {
 CalloutHandle::CalloutHandle(const boost::shared_ptr<CalloutManager>& manager,
                     const boost::shared_ptr<LibraryManagerCollection>& lmcoll)
     : lm_collection_(lmcoll), arguments_(), context_collection_(),
-      manager_(manager), server_hooks_(ServerHooks::getServerHooks()),
+      context_slots_(), manager_(manager), server_hooks_(ServerHooks::getServerHooks()),
       next_step_(NEXT_STEP_CONTINUE) {
 
     // Call the "context_create" hook.  We should be OK doing this - although
@@ -43,6 +44,7 @@ CalloutHandle::~CalloutHandle() {
     // all memory that could have been allocated by libraries that were loaded.
     arguments_.clear();
     context_collection_.clear();
+    context_slots_.clear();
 
     // Normal destruction of the remaining variables will include the
     // destruction of lm_collection_, an action that decrements the reference
@@ -112,6 +114,57 @@ CalloutHandle::getContextForLibrary() const {
     return (libcontext->second);
 }
 
+// Return the index of the context slots for the currently pointed-to library.
+// The pre-library index of -1 goes first and INT_MAX after the libraries.
+
+size_t
+CalloutHandle::getSlotsIndex() const {
+    int libindex = manager_->getLibraryIndex();
+    if (libindex == INT_MAX) {
+        return (manager_->getNumLibraries() + 2);
+    }
+    return (static_cast<size_t>(libindex + 1));
+}
+
+// Return the context slots for the currently pointed-to library, creating
+// them if they do not exist.
+
+CalloutHandle::SlotCollection&
+CalloutHandle::getSlotsForLibrary() {
+    size_t index = getSlotsIndex();
+    if (index >= context_slots_.size()) {
+        context_slots_.resize(index + 1);
+    }
+    return (context_slots_[index]);
+}
+
+// Return the value of a context slot of the currently pointed-to library.  If
+// the slot is not set, throw an exception.
+
+const boost::any&
+CalloutHandle::getContextSlotElement(const size_t slot) const {
+    size_t index = getSlotsIndex();
+    if ((index >= context_slots_.size()) ||
+        (slot >= context_slots_[index].size()) ||
+        context_slots_[index][slot].empty()) {
+        isc_throw(NoSuchCalloutContext, "unable to find callout context "
+                  "slot " << slot << " in the context associated with "
+                  "current library");
+    }
+    return (context_slots_[index][slot]);
+}
+
+// Clear a context slot of the currently pointed-to library.
+
+void
+CalloutHandle::deleteContextSlot(const size_t slot) {
+    size_t index = getSlotsIndex();
+    if ((index < context_slots_.size()) &&
+        (slot < context_slots_[index].size())) {
+        context_slots_[index][slot] = boost::any();
+    }
+}
+
 // Return the name of all items in the context associated with the current]
 // library.
 
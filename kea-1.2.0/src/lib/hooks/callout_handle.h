@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -72,7 +72,8 @@ class LibraryManagerCollection;
 ///   information to callous within another library.  Typically such context
 ///   is created in the "context_create" callout and destroyed in the
 ///   "context_destroy" callout.  The information is accessed through the
-///   {get,set}Context() methods.
+///   {get,set}Context() methods, or through the {get,set}ContextSlot()
+///   methods which identify the items with numbers instead of names.
 ///
 /// - Per-library handle (LibraryHandle). The library handle allows the
 ///   callout to dynamically register and deregister callouts. In the latter
@@ -112,6 +113,17 @@ public:
     /// need to be set when the CalloutHandle is constructed.
     typedef std::map<int, ElementCollection> ContextCollection;
 
+    /// Typedef to allow abbreviations in specifications when accessing
+    /// context slots.  The SlotCollection holds the values of the slots of
+    /// a particular library, indexed by the slot number.
+    typedef std::vector<boost::any> SlotCollection;
+
+    /// Typedef to allow abbreviations in specifications when accessing
+    /// context slots.  There is one SlotCollection for each library,
+    /// indexed by a number derived from the library index (see
+    /// getSlotsIndex()), so as the slots are accessed without a lookup.
+    typedef std::vector<SlotCollection> SlotContextCollection;
+
     /// @brief Constructor
     ///
     /// Creates the object and calls the callouts on the "context_create"
@@ -320,14 +332,66 @@ public:
 
     /// @brief Delete all context items
     ///
-    /// Deletes all items from the context associated with the current library.
+    /// Deletes all items from the context associated with the current library,
+    /// including the context slots.
     ///
     /// N.B. If any elements are raw pointers, the pointed-to data is NOT
     /// deleted by this.
     void deleteAllContext() {
         getContextForLibrary().clear();
+        getSlotsForLibrary().clear();
+    }
+
+    /// @brief Set context slot
+    ///
+    /// Sets an element in the context associated with the current library,
+    /// identified by a number rather than a name.  The numbers are chosen by
+    /// the library, typically as the values of an enumeration, and should be
+    /// small as the slots are held in a vector.  Unlike the named context
+    /// items, the slots are accessed without a lookup, so the callouts called
+    /// for every packet should prefer them.  If the slot is already set, its
+    /// value is replaced.
+    ///
+    /// @param slot Number of the slot to set.
+    /// @param value Value to set.
+    template <typename T>
+    void setContextSlot(const size_t slot, T value) {
+        SlotCollection& slots = getSlotsForLibrary();
+        if (slot >= slots.size()) {
+            slots.resize(slot + 1);
+        }
+        slots[slot] = value;
+    }
+
+    /// @brief Get context slot
+    ///
+    /// Gets an element from the context slot associated with the current
+    /// library.
+    ///
+    /// @param slot Number of the slot to get.
+    /// @param value [out] Value to set.  The type of "value" is important:
+    ///        it must match the type of the value set.
+    ///
+    /// @throw NoSuchCalloutContext Thrown if the slot is not set.
+    /// @throw boost::bad_any_cast Thrown if the slot is set but the type of
+    ///        the data is not the same as the type of the variable provided
+    ///        to receive its value.
+    template <typename T>
+    void getContextSlot(const size_t slot, T& value) const {
+        value = boost::any_cast<T>(getContextSlotElement(slot));
     }
 
+    /// @brief Delete context slot
+    ///
+    /// Clears the context slot associated with the current library.  If the
+    /// slot is not set, the method is a no-op.
+    ///
+    /// N.B. If the element is a raw pointer, the pointed-to data is NOT deleted
+    /// by this.
+    ///
+    /// @param slot Number of the slot to delete.
+    void deleteContextSlot(const size_t slot);
+
     /// @brief Get hook name
     ///
     /// Get the name of the hook to which the current callout is attached.
@@ -375,6 +439,36 @@ private:
     ///        associated with the current library.
     const ElementCollection& getContextForLibrary() const;
 
+    /// @brief Return index of the context slots for current library
+    ///
+    /// Maps the current library index, which may be -1 outside callouts, 0 to
+    /// the number of libraries, or INT_MAX, to the index in the collection of
+    /// context slots.
+    ///
+    /// @return Index of the slots of the current library.
+    size_t getSlotsIndex() const;
+
+    /// @brief Return reference to context slots for current library
+    ///
+    /// Called by all slot-setting functions, this returns a reference to the
+    /// context slots for the current library, creating them if they do not
+    /// exist.
+    ///
+    /// @return Reference to the collection of slots associated with the
+    ///         current library.
+    SlotCollection& getSlotsForLibrary();
+
+    /// @brief Return reference to context slot for current library
+    ///
+    /// Called by all slot-accessing functions.
+    ///
+    /// @param slot Number of the slot.
+    ///
+    /// @return Reference to the value of the slot.
+    ///
+    /// @throw NoSuchCalloutContext Thrown if the slot is not set.
+    const boost::any& getContextSlotElement(const size_t slot) const;
+
     // Member variables
 
     /// Pointer to the collection of libraries for which this handle has been
@@ -387,6 +481,9 @@ private:
     /// Context collection - there is one entry per library context.
     ContextCollection context_collection_;
 
+    /// Context slots - there is one entry per library using the slots.
+    SlotContextCollection context_slots_;
+
     /// Callout manager.
     boost::shared_ptr<CalloutManager> manager_;
 
@@ -9,6 +9,7 @@
 
 #include <hooks/callout_handle.h>
 #include <hooks/library_handle.h>
+#include <hooks/shared_state.h>
 
 namespace {
 
@@ -0,0 +1,80 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SHARED_STATE_H
+#define SHARED_STATE_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace isc {
+namespace hooks {
+
+/// @brief State shared by the callouts of a hooks library
+///
+/// Hooks libraries keeping state across packets, e.g. a registry of the
+/// known clients, look it up in the callouts called for every packet while
+/// the state is seldom replaced, e.g. when reloaded from a file.  Instead
+/// of protecting the lookups with a lock, this class holds the current state
+/// as a pointer to a constant object.  The callouts take a copy of the
+/// pointer and look up the object without any further synchronization.  The
+/// state is replaced by a new object, usually a modified copy of the
+/// current one, and the replaced object is destroyed when the last callout
+/// using it releases its pointer.
+///
+/// The pointer is accessed with the atomic operations on the
+/// @c boost::shared_ptr, so the state may be used and replaced by several
+/// threads.  Concurrent replacements must be serialized by the caller if
+/// they are based on the current state.
+///
+/// @tparam StateType Type of the object holding the state.
+template<typename StateType>
+class SharedState : public boost::noncopyable {
+public:
+
+    /// @brief Pointer to the object holding the state.
+    typedef boost::shared_ptr<const StateType> StatePtr;
+
+    /// @brief Constructor
+    ///
+    /// @param state Pointer to the initial state, NULL by default.
+    explicit SharedState(const StatePtr& state = StatePtr())
+        : state_(state) {
+    }
+
+    /// @brief Returns the current state.
+    ///
+    /// @return Pointer to the current state, which remains valid when the
+    ///         state is replaced.
+    StatePtr get() const {
+        return (boost::atomic_load(&state_));
+    }
+
+    /// @brief Replaces the state.
+    ///
+    /// The replaced state is released after the replacement, so it is not
+    /// destroyed while it is being replaced.
+    ///
+    /// @param state Pointer to the new state.
+    void set(const StatePtr& state) {
+        StatePtr old_state = boost::atomic_exchange(&state_, state);
+    }
+
+    /// @brief Releases the state.
+    void reset() {
+        set(StatePtr());
+    }
+
+private:
+
+    /// @brief Pointer to the current state.
+    StatePtr state_;
+};
+
+} // namespace hooks
+} // namespace isc
+
+#endif // SHARED_STATE_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,8 @@
 
 #include <gtest/gtest.h>
 
+#include <climits>
+
 using namespace isc::hooks;
 using namespace std;
 
@@ -316,6 +318,76 @@ TEST_F(CalloutHandleTest, StatusField) {
     EXPECT_EQ(CalloutHandle::NEXT_STEP_CONTINUE, handle.getStatus());
 }
 
+// *** Context Slot Tests ***
+//
+// The slots are held per library, so the tests set the current library
+// index in the callout manager.
+
+// Test that the slots can be set, retrieved and deleted.
+
+TEST_F(CalloutHandleTest, ContextSlots) {
+    CalloutHandle handle(getCalloutManager());
+    getCalloutManager()->setLibraryIndex(1);
+
+    int value = 0;
+    EXPECT_THROW(handle.getContextSlot(0, value), NoSuchCalloutContext);
+
+    handle.setContextSlot(0, 42);
+    handle.setContextSlot(3, string("forty-three"));
+    ASSERT_NO_THROW(handle.getContextSlot(0, value));
+    EXPECT_EQ(42, value);
+    string text;
+    ASSERT_NO_THROW(handle.getContextSlot(3, text));
+    EXPECT_EQ("forty-three", text);
+
+    // Slots between the ones set and the wrong types are reported.
+    EXPECT_THROW(handle.getContextSlot(1, value), NoSuchCalloutContext);
+    EXPECT_THROW(handle.getContextSlot(4, value), NoSuchCalloutContext);
+    EXPECT_THROW(handle.getContextSlot(3, value), boost::bad_any_cast);
+
+    // Replace a value.
+    handle.setContextSlot(0, 44);
+    ASSERT_NO_THROW(handle.getContextSlot(0, value));
+    EXPECT_EQ(44, value);
+
+    // Delete a slot, including one which was never set.
+    handle.deleteContextSlot(0);
+    EXPECT_THROW(handle.getContextSlot(0, value), NoSuchCalloutContext);
+    EXPECT_NO_THROW(handle.deleteContextSlot(10));
+    EXPECT_NO_THROW(handle.getContextSlot(3, text));
+
+    // Deleting all context deletes the slots too.
+    handle.deleteAllContext();
+    EXPECT_THROW(handle.getContextSlot(3, text), NoSuchCalloutContext);
+}
+
+// Test that the slots of the different libraries are distinct.
+
+TEST_F(CalloutHandleTest, ContextSlotsPerLibrary) {
+    CalloutHandle handle(getCalloutManager());
+
+    // The library indexes used outside callouts, by the libraries and
+    // by the server.
+    const int indexes[] = { -1, 0, 1, 4, INT_MAX };
+    const int count = sizeof(indexes) / sizeof(indexes[0]);
+    for (int i = 0; i < count; ++i) {
+        getCalloutManager()->setLibraryIndex(indexes[i]);
+        handle.setContextSlot(0, i);
+    }
+
+    for (int i = 0; i < count; ++i) {
+        getCalloutManager()->setLibraryIndex(indexes[i]);
+        int value = -1;
+        ASSERT_NO_THROW(handle.getContextSlot(0, value))
+            << "library index " << indexes[i];
+        EXPECT_EQ(i, value) << "library index " << indexes[i];
+    }
+
+    getCalloutManager()->setLibraryIndex(2);
+    int value = -1;
+    EXPECT_THROW(handle.getContextSlot(0, value), NoSuchCalloutContext);
+}
+
 // Further tests of the "skip" flag and tests of getting the name of the
 // hook to which the current callout is attached is in the "handles_unittest"
 // module.
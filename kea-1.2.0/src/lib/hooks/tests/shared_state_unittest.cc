@@ -0,0 +1,93 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <hooks/shared_state.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+
+using namespace isc::hooks;
+using namespace isc::util::thread;
+using namespace std;
+
+namespace {
+
+/// @brief State used by the tests.
+typedef map<string, int> Registry;
+
+/// @brief Pointer to the state used by the tests.
+typedef boost::shared_ptr<const Registry> RegistryPtr;
+
+// Test that the state can be set, retrieved and released.
+
+TEST(SharedStateTest, getSet) {
+    SharedState<Registry> state;
+    EXPECT_FALSE(state.get());
+
+    boost::shared_ptr<Registry> registry(new Registry());
+    (*registry)["one"] = 1;
+    state.set(registry);
+    RegistryPtr current = state.get();
+    ASSERT_TRUE(current);
+    EXPECT_EQ(registry.get(), current.get());
+
+    // The replaced state remains valid for its users.
+    boost::shared_ptr<Registry> updated(new Registry(*current));
+    (*updated)["two"] = 2;
+    state.set(updated);
+    EXPECT_EQ(1, current->size());
+    EXPECT_EQ(2, state.get()->size());
+
+    state.reset();
+    EXPECT_FALSE(state.get());
+    EXPECT_EQ(1, current->count("one"));
+}
+
+/// @brief Looks up the state until it holds the specified number of entries.
+///
+/// @param state State being looked up.
+/// @param last Number of entries of the last state.
+/// @param [out] errors Number of inconsistent states found.
+void lookup(const SharedState<Registry>* state, const int last, int* errors) {
+    int size = 0;
+    while (size < last) {
+        RegistryPtr current = state->get();
+        size = current->size();
+        // Each state holds the entries of the previous ones.
+        for (int i = 0; i < size; ++i) {
+            Registry::const_iterator it = current->find(string(1, 'a' + i));
+            if ((it == current->end()) || (it->second != i)) {
+                ++(*errors);
+            }
+        }
+    }
+}
+
+// Test that the state can be looked up while it is replaced.
+
+TEST(SharedStateTest, concurrentLookups) {
+    SharedState<Registry> state(RegistryPtr(new Registry()));
+
+    int errors = 0;
+    Thread reader(boost::bind(&lookup, &state, 26, &errors));
+
+    for (int i = 0; i < 26; ++i) {
+        boost::shared_ptr<Registry> updated(new Registry(*state.get()));
+        (*updated)[string(1, 'a' + i)] = i;
+        state.set(updated);
+    }
+
+    reader.wait();
+    EXPECT_EQ(0, errors);
+}
+
+} // Anonymous namespace
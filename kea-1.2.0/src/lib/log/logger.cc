@@ -9,6 +9,7 @@
 
 #include <log/logger.h>
 #include <log/logger_impl.h>
+#include <log/logger_manager.h>
 #include <log/logger_name.h>
 #include <log/logger_support.h>
 #include <log/message_dictionary.h>
@@ -22,9 +23,15 @@ namespace isc {
 namespace log {
 
 // Initialize underlying logger, but only if logging has been initialized.
+// The loggers are static objects which may be first used by several
+// threads at once, so the implementation is created under the lock.
 void Logger::initLoggerImpl() {
     if (isLoggingInitialized()) {
-        loggerptr_ = new LoggerImpl(name_);
+        isc::util::thread::Mutex::Locker
+            mutex_locker(LoggerManager::getMutex());
+        if (!loggerptr_.load(std::memory_order_relaxed)) {
+            loggerptr_.store(new LoggerImpl(name_), std::memory_order_release);
+        }
     } else {
         isc_throw(LoggingNotInitialized, "attempt to access logging function "
                   "before logging has been initialized");
@@ -34,7 +41,7 @@ void Logger::initLoggerImpl() {
 // Destructor.
 
 Logger::~Logger() {
-    delete loggerptr_;
+    delete loggerptr_.load();
 
     // The next statement is required for the Kea hooks framework, where a
     // statically-linked Kea loads and unloads multiple libraries. See the hooks
@@ -7,6 +7,7 @@
 #ifndef LOGGER_H
 #define LOGGER_H
 
+#include <atomic>
 #include <cassert>
 #include <cstdlib>
 #include <string>
@@ -343,18 +344,23 @@ private:
     /// regardless of whether is is statically or automatically declared -  will
     /// cause a "LoggingNotInitialized" exception to be thrown.
     ///
+    /// The pointer is atomic so that threads which find it set need no
+    /// lock; only the first use takes the logger manager mutex.
+    ///
     /// \return Returns pointer to implementation
     LoggerImpl* getLoggerPtr() {
-        if (!loggerptr_) {
+        LoggerImpl* ptr = loggerptr_.load(std::memory_order_acquire);
+        if (!ptr) {
             initLoggerImpl();
+            ptr = loggerptr_.load(std::memory_order_acquire);
         }
-        return (loggerptr_);
+        return (ptr);
     }
 
     /// \brief Initialize Underlying Implementation and Set loggerptr_
     void initLoggerImpl();
 
-    LoggerImpl* loggerptr_;                  ///< Pointer to underlying logger
+    std::atomic<LoggerImpl*> loggerptr_;     ///< Pointer to underlying logger
     char        name_[MAX_LOGGER_NAME_SIZE + 1]; ///< Copy of the logger name
 };
 
@@ -49,8 +49,9 @@ public:
     bool getResponse(std::string& response);
 
     /// @brief Uses select to poll the Control Channel for data waiting
+    /// @param timeout_sec number of seconds to wait for the data
     /// @return -1 on error, 0 if no data is available,  1 if data is ready
-    int selectCheck();
+    int selectCheck(const unsigned int timeout_sec = 0);
 
     /// @brief Retains the fd of the open socket
     int socket_fd_;
@@ -5,9 +5,6 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <util/csv_file.h>
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/constants.hpp>
-#include <boost/algorithm/string/split.hpp>
 #include <algorithm>
 #include <fstream>
 #include <sstream>
@@ -27,13 +24,32 @@ CSVRow::CSVRow(const std::string& text, const char separator)
 
 void
 CSVRow::parse(const std::string& line) {
-    // Tokenize the string using a specified separator. Disable compression,
-    // so as the two consecutive separators mark an empty value.
-    boost::split(values_, line, boost::is_any_of(separator_),
-                 boost::algorithm::token_compress_off);
+    // Tokenize the string using a specified separator. Two consecutive
+    // separators mark an empty value. The values are assigned to the
+    // strings already held by the row, so as their memory is reused.
+    const char separator = separator_[0];
+    size_t count = 0;
+    size_t start = 0;
+    for (;;) {
+        size_t end = line.find(separator, start);
+        if (end == std::string::npos) {
+            end = line.size();
+        }
+        if (count < values_.size()) {
+            values_[count].assign(line, start, end - start);
+        } else {
+            values_.push_back(line.substr(start, end - start));
+        }
+        ++count;
+        if (end == line.size()) {
+            break;
+        }
+        start = end + 1;
+    }
+    values_.resize(count);
 }
 
-std::string
+const std::string&
 CSVRow::readAt(const size_t at) const {
     checkIndex(at);
     return (values_[at]);
@@ -79,7 +95,7 @@ CSVRow::checkIndex(const size_t at) const {
 }
 
 CSVFile::CSVFile(const std::string& filename)
-    : filename_(filename), fs_(), cols_(0), read_msg_() {
+    : filename_(filename), fs_(), cols_(0), read_msg_(), line_() {
 }
 
 CSVFile::~CSVFile() {
@@ -237,11 +253,10 @@ CSVFile::next(CSVRow& row, const bool skip_validation) {
     }
 
     // Get exactly one line of the file.
-    std::string line;
-    std::getline(*fs_, line);
+    std::getline(*fs_, line_);
     // If we got empty line because we reached the end of file
     // return an empty row.
-    if (line.empty() && fs_->eof()) {
+    if (line_.empty() && fs_->eof()) {
         row = EMPTY_ROW();
         return (true);
 
@@ -253,7 +268,7 @@ CSVFile::next(CSVRow& row, const bool skip_validation) {
         return (false);
     }
     // If we read anything, parse it.
-    row.parse(line);
+    row.parse(line_);
 
     // And check if it is correct.
     return (skip_validation ? true : validate(row));
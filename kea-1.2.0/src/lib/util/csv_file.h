@@ -92,6 +92,10 @@ public:
     /// to the @c values_ private container. These values can be retrieved
     /// from the container by calling @c CSVRow::readAt function.
     ///
+    /// The values are tokenized in place, reusing the memory held by the
+    /// values of the previously parsed row. Parsing subsequent rows of a
+    /// file into the same object doesn't allocate memory for each value.
+    ///
     /// This function is exception-free.
     ///
     /// @param line String holding a row of comma separated values.
@@ -107,7 +111,7 @@ public:
     /// @throw CSVFileError if the index is out of range. The number of elements
     /// being held by the container can be obtained using
     /// @c CSVRow::getValuesCount.
-    std::string readAt(const size_t at) const;
+    const std::string& readAt(const size_t at) const;
 
     /// @brief Trims a given number of elements from the end of a row
     ///
@@ -214,6 +218,16 @@ public:
         }
     }
 
+    /// @brief Checks if the row is empty.
+    ///
+    /// The row is empty when its string representation is empty, i.e. it
+    /// holds no values or a single empty value. This is equivalent to, but
+    /// much cheaper than comparing the row with @c CSVFile::EMPTY_ROW.
+    bool empty() const {
+        return (values_.empty() ||
+                ((values_.size() == 1) && values_[0].empty()));
+    }
+
     /// @brief Equality operator.
     ///
     /// Two CSV rows are equal when their string representation is equal. This
@@ -247,9 +261,7 @@ private:
     /// @brief Separator character specified in the constructor.
     ///
     /// @note Separator is held as a string object (one character long),
-    /// because the boost::is_any_of algorithm requires a string, not a
-    /// char value. If we held the separator as a char, we would need to
-    /// convert it to string on every call to @c CSVRow::parse.
+    /// so as it can be appended to the rendered row.
     std::string separator_;
 
     /// @brief Internal container holding values that belong to the row.
@@ -499,6 +511,11 @@ private:
 
     /// @brief Holds last error during row reading or validation.
     std::string read_msg_;
+
+    /// @brief Buffer holding the last line read from the file.
+    ///
+    /// It is reused for all lines to avoid allocating memory for each row.
+    std::string line_;
 };
 
 } // namespace isc::util
@@ -7,10 +7,6 @@
 #include <util/encode/hex.h>
 #include <util/strutil.h>
 
-#include <boost/algorithm/string/classification.hpp>
-#include <boost/algorithm/string/constants.hpp>
-#include <boost/algorithm/string/split.hpp>
-
 #include <numeric>
 #include <sstream>
 #include <string.h>
@@ -201,48 +197,58 @@ quotedStringToBinary(const std::string& quoted_string) {
 void
 decodeColonSeparatedHexString(const std::string& hex_string,
                               std::vector<uint8_t>& binary) {
-    std::vector<std::string> split_text;
-    boost::split(split_text, hex_string, boost::is_any_of(":"),
-                 boost::algorithm::token_compress_off);
+    // If there is at least one colon, none of the octets may be empty.
+    const bool separated = (hex_string.find(':') != std::string::npos);
 
+    // The octets are decoded as the string is scanned, without copying
+    // them into separate strings first.
     std::vector<uint8_t> binary_vec;
-    for (size_t i = 0; i < split_text.size(); ++i) {
+    binary_vec.reserve(hex_string.size() / 3 + 1);
+    size_t start = 0;
+    for (;;) {
+        size_t end = hex_string.find(':', start);
+        if (end == std::string::npos) {
+            end = hex_string.size();
+        }
+        const size_t length = end - start;
 
         // If there are multiple tokens and the current one is empty, it
         // means that two consecutive colons were specified. This is not
         // allowed.
-        if ((split_text.size() > 1) && split_text[i].empty()) {
+        if (separated && (length == 0)) {
             isc_throw(isc::BadValue, "two consecutive colons specified in"
                       " a decoded string '" << hex_string << "'");
 
         // Between a colon we expect at most two characters.
-        } else if (split_text[i].size() > 2) {
+        } else if (length > 2) {
             isc_throw(isc::BadValue, "invalid format of the decoded string"
                       << " '" << hex_string << "'");
 
-        } else if (!split_text[i].empty()) {
-            std::stringstream s;
-            s << "0x";
-
-            for (unsigned int j = 0; j < split_text[i].length(); ++j) {
+        } else if (length > 0) {
+            unsigned int binary_value = 0;
+            for (size_t j = start; j < end; ++j) {
+                const char c = hex_string[j];
                 // Check if we're dealing with hexadecimal digit.
-                if (!isxdigit(split_text[i][j])) {
-                    isc_throw(isc::BadValue, "'" << split_text[i][j]
+                if (!isxdigit(static_cast<unsigned char>(c))) {
+                    isc_throw(isc::BadValue, "'" << c
                               << "' is not a valid hexadecimal digit in"
                               << " decoded string '" << hex_string << "'");
                 }
-                s << split_text[i][j];
+                binary_value <<= 4;
+                if (isdigit(static_cast<unsigned char>(c))) {
+                    binary_value |= c - '0';
+                } else {
+                    binary_value |= tolower(static_cast<unsigned char>(c))
+                        - 'a' + 10;
+                }
             }
-
-            // The stream should now have one or two hexadecimal digits.
-            // Let's convert it to a number and store in a temporary
-            // vector.
-            unsigned int binary_value;
-            s >> std::hex >> binary_value;
-
             binary_vec.push_back(static_cast<uint8_t>(binary_value));
         }
 
+        if (end == hex_string.size()) {
+            break;
+        }
+        start = end + 1;
     }
 
     // All ok, replace the data in the output vector with a result.
@@ -258,26 +264,28 @@ decodeFormattedHexString(const std::string& hex_string,
         decodeColonSeparatedHexString(hex_string, binary);
 
     } else {
-        std::ostringstream s;
+        std::string s;
+        s.reserve(hex_string.length() + 1);
 
         // If we have odd number of digits we'll have to prepend '0'.
         if (hex_string.length() % 2 != 0) {
-            s << "0";
+            s.push_back('0');
         }
 
         // It is ok to use '0x' prefix in a string.
-        if ((hex_string.length() > 2) && (hex_string.substr(0, 2) == "0x")) {
+        if ((hex_string.length() > 2) &&
+            (hex_string.compare(0, 2, "0x") == 0)) {
             // Exclude '0x' from the decoded string.
-            s << hex_string.substr(2);
+            s.append(hex_string, 2, std::string::npos);
 
         } else {
             // No '0x', so decode the whole string.
-            s << hex_string;
+            s.append(hex_string);
         }
 
         try {
             // Decode the hex string.
-            encode::decodeHex(s.str(), binary);
+            encode::decodeHex(s, binary);
 
         } catch (...) {
             isc_throw(isc::BadValue, "'" << hex_string << "' is not a valid"
@@ -42,6 +42,41 @@ TEST(CSVRow, parse) {
     EXPECT_TRUE(row1.readAt(0).empty());
 }
 
+// This test checks that the rows of different lengths can be parsed
+// using the same object and that the empty rows are recognized.
+TEST(CSVRow, parseMany) {
+    CSVRow row;
+    EXPECT_TRUE(row.empty());
+
+    row.parse("foo,bar,foo-bar,bar-foo");
+    ASSERT_EQ(4, row.getValuesCount());
+    EXPECT_FALSE(row.empty());
+    EXPECT_EQ("foo-bar", row.readAt(2));
+
+    // Shorter row with longer values.
+    row.parse("foo-bar-foo,,");
+    ASSERT_EQ(3, row.getValuesCount());
+    EXPECT_EQ("foo-bar-foo", row.readAt(0));
+    EXPECT_TRUE(row.readAt(1).empty());
+    EXPECT_TRUE(row.readAt(2).empty());
+    EXPECT_EQ("foo-bar-foo,,", row.render());
+
+    // Longer row again.
+    row.parse("a,b,c,d,e");
+    ASSERT_EQ(5, row.getValuesCount());
+    EXPECT_EQ("a,b,c,d,e", row.render());
+
+    // A single empty value makes the row empty, like an empty line.
+    row.parse("");
+    EXPECT_TRUE(row.empty());
+    EXPECT_TRUE(row == CSVFile::EMPTY_ROW());
+
+    // But a separator alone doesn't.
+    row.parse(",");
+    EXPECT_FALSE(row.empty());
+    EXPECT_FALSE(row == CSVFile::EMPTY_ROW());
+}
+
 // This test checks that the text representation of the CSV row
 // is created correctly.
 TEST(CSVRow, render) {
@@ -124,7 +124,7 @@ VersionedCSVFile::next(CSVRow& row) {
     // Use base class to physical read the row, but skip its row
     // validation
     CSVFile::next(row, true);
-    if (row == CSVFile::EMPTY_ROW()) {
+    if (row.empty()) {
         return(true);
     }
 